@@ -0,0 +1,89 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// One analysis_plan::analyze call per spectrum, flattened into keys and values
+// as the C API does, versus one analyze_batch call over all spectra, at each
+// thread count up to the hardware concurrency.
+#include "bench_utils.hpp"
+
+#include "analysis_plan.hpp"
+#include "enum_maps.hpp"
+#include "fourier_analysis.hpp"
+#include "fourier_transforms.hpp"
+#include "parallel.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t nfft = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 8192;
+	const size_t count = (2 < argc) ? std::strtoul(argv[2], nullptr, 10) : 256;
+	const size_t size = (nfft / 2 + 1) * 2;
+	std::vector<gn::real_t> in(nfft);
+	std::vector<gn::real_t> out(size * count);
+	for (size_t m = 0; m < count; ++m) {
+		const double cycles = static_cast<double>(1021 + m % 64);
+		for (size_t i = 0; i < nfft; ++i) {
+			const double x = 0.9 * std::cos(6.283185307179586 * cycles *
+					static_cast<double>(i) / static_cast<double>(nfft));
+			in[i] = x + 1e-3 * x * x;
+		}
+		gn::rfft(in.data(), in.size(), out.data() + m * size, size, 1, nfft,
+				gn::Window::BlackmanHarris, gn::RfftScale::DbfsSin);
+	}
+
+	gn::fourier_analysis fa;
+	fa.set_fsample("1e6");
+	fa.add_max_tone("A", gn::FACompTag::Signal, "0.0", "fdata", 3);
+	fa.set_hd(9);
+	fa.set_imd(3);
+	fa.set_wo(5);
+	auto plan = fa.prepare(nfft, gn::FreqAxisType::DcLeft, false);
+
+	bench::print_header("Fourier analysis of a batch of real spectra");
+	std::printf("nfft = %zu, spectra = %zu, results per spectrum = %zu\n\n",
+			nfft, count, plan->results_size());
+	std::vector<gn::str_t> keys(plan->results_size());
+	std::vector<gn::real_t> values(plan->results_size() * count);
+	double t_loop = bench::median_seconds([&]() {
+		for (size_t m = 0; m < count; ++m) {
+			gn::fourier_analysis_results r =
+					plan->analyze(out.data() + m * size, size);
+			size_t i = 0;
+			for (size_t j = 0; j < gn::fourier_analysis_results::size; ++j) {
+				keys[i] = gn::fa_result_map.at(static_cast<int>(j));
+				values[m * keys.size() + i++] = r.get(static_cast<gn::FAResult>(j));
+			}
+			for (size_t t = 0; t < r.tone_count(); ++t) {
+				for (int j = 0; j < static_cast<int>(gn::FAToneResult::__SIZE__);
+						++j) {
+					keys[i] = gn::fourier_analysis::flat_tone_key(r.tone_keys[t], j);
+					values[m * keys.size() + i++] =
+							r.get_tone(t, static_cast<gn::FAToneResult>(j));
+				}
+			}
+		}
+	});
+	std::printf("%-24s %14s %10s\n", "method", "time (ms)", "speedup");
+	std::printf("%-24s %14.2f %10.2f\n", "analyze per spectrum", t_loop * 1e3,
+			1.0);
+	const size_t saved_threads = gn::get_num_threads();
+	const size_t max_threads =
+			std::max<size_t>(1, std::thread::hardware_concurrency());
+	for (size_t nt = 1; nt <= max_threads; nt *= 2) {
+		gn::set_num_threads(nt);
+		double t_batch = bench::median_seconds([&]() {
+			plan->analyze_batch(out.data(), out.size(), count);
+		});
+		char label[32];
+		std::snprintf(label, sizeof(label), "analyze_batch (%zu thr)", nt);
+		std::printf("%-24s %14.2f %10.2f\n", label, t_batch * 1e3,
+				t_loop / t_batch);
+	}
+	gn::set_num_threads(saved_threads);
+	return 0;
+}
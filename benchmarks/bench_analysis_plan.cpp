@@ -0,0 +1,58 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// fourier_analysis::analyze versus a prepared analysis_plan on the same
+// spectrum.
+#include "bench_utils.hpp"
+
+#include "analysis_plan.hpp"
+#include "fourier_analysis.hpp"
+#include "fourier_transforms.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t nfft = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 65536;
+	const int nreps = 100;
+	std::vector<gn::real_t> in(nfft);
+	for (size_t i = 0; i < nfft; ++i) {
+		const double x = 0.9 * std::cos(6.283185307179586 * 1021.0 *
+				static_cast<double>(i) / static_cast<double>(nfft));
+		in[i] = x + 1e-3 * x * x;
+	}
+	std::vector<gn::real_t> out((nfft / 2 + 1) * 2);
+	gn::rfft(in.data(), in.size(), out.data(), out.size(), 1, nfft,
+			gn::Window::BlackmanHarris, gn::RfftScale::DbfsSin);
+
+	gn::fourier_analysis fa;
+	fa.set_fsample("1e6");
+	fa.add_fixed_tone("A", gn::FACompTag::Signal, "1021*fbin", 3);
+	fa.set_hd(9);
+	fa.set_imd(3);
+	fa.set_wo(5);
+	fa.set_clk({ 4, 8 });
+	auto plan = fa.prepare(nfft, gn::FreqAxisType::DcLeft, false);
+
+	bench::print_header("Fourier analysis of one real spectrum");
+	std::printf("nfft = %zu, components = %zu\n\n", nfft, plan->keys().size());
+	double t_fa = bench::median_seconds([&]() {
+		for (int r = 0; r < nreps; ++r) {
+			fa.analyze(out.data(), out.size(), nfft,
+					gn::FreqAxisType::DcLeft);
+		}
+	});
+	double t_plan = bench::median_seconds([&]() {
+		for (int r = 0; r < nreps; ++r) {
+			plan->analyze(out.data(), out.size());
+		}
+	});
+	std::printf("%-20s %14s %10s\n", "method", "time (us)", "speedup");
+	std::printf("%-20s %14.1f %10.2f\n", "analyze", t_fa / nreps * 1e6, 1.0);
+	std::printf("%-20s %14.1f %10.2f\n", "analysis_plan", t_plan / nreps * 1e6,
+			t_fa / t_plan);
+	return 0;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Streaming histogram of a 16-bit tone, captured in chunks by several workers:
+// one caller-owned array filled with hist(preserve = true) and analyzed with
+// hist_analysis, versus one code_density_accumulator per worker, merged and
+// analyzed in O(1).  Also prints the cost of hist_analysis alone, and checks
+// that the histograms and analysis results are identical.
+#include "bench_utils.hpp"
+
+#include "code_density.hpp"
+#include "code_density_accumulator.hpp"
+
+#include <cmath>
+
+namespace gn = genalyzer_impl;
+
+int main() {
+	const int n = 16;
+	const gn::CodeFormat fmt = gn::CodeFormat::TwosComplement;
+	const size_t nworkers = 4;
+	const size_t nchunks = 64;
+	const size_t chunk = 1 << 14;
+	const double amp = std::ldexp(1.0, n - 1) - 1.0;
+	std::vector<int16_t> wf(nchunks * chunk);
+	for (size_t i = 0; i < wf.size(); ++i) {
+		wf[i] = static_cast<int16_t>(std::lround(
+				amp * std::sin(0.000123 * static_cast<double>(i))));
+	}
+	const size_t hist_size = gn::code_density_size(n, fmt);
+	bench::print_header("Chunked histogram: hist + hist_analysis vs. "
+			"code_density_accumulator");
+	std::printf("samples = %zu, chunks = %zu, workers = %zu\n\n", wf.size(),
+			nchunks, nworkers);
+	std::vector<uint64_t> hist(hist_size);
+	std::map<gn::str_t, gn::real_t> r1;
+	double t_hist = bench::median_seconds([&]() {
+		std::fill(hist.begin(), hist.end(), 0);
+		for (size_t c = 0; c < nchunks; ++c) {
+			gn::hist(hist.data(), hist.size(), wf.data() + c * chunk, chunk, n,
+					fmt, true);
+		}
+		r1 = gn::hist_analysis(hist.data(), hist.size());
+	});
+	double t_scan = bench::median_seconds([&]() {
+		r1 = gn::hist_analysis(hist.data(), hist.size());
+	});
+	std::vector<std::shared_ptr<gn::code_density_accumulator>> accs;
+	for (size_t w = 0; w < nworkers; ++w) {
+		accs.push_back(gn::code_density_accumulator::create(n, fmt));
+	}
+	std::map<gn::str_t, gn::real_t> r2;
+	double t_acc = bench::median_seconds([&]() {
+		for (auto &acc : accs) {
+			acc->reset();
+		}
+		for (size_t c = 0; c < nchunks; ++c) {
+			accs[c % nworkers]->push(wf.data() + c * chunk, chunk);
+		}
+		for (size_t w = 1; w < nworkers; ++w) {
+			accs[0]->merge(*accs[w]);
+		}
+		r2 = gn::hist_analysis(*accs[0]);
+	});
+	double t_o1 = bench::median_seconds([&]() {
+		r2 = gn::hist_analysis(*accs[0]);
+	});
+	std::vector<uint64_t> snap(hist_size);
+	accs[0]->snapshot(snap.data(), snap.size());
+	std::printf("%-32s %12.3f ms\n", "hist + hist_analysis", t_hist * 1e3);
+	std::printf("%-32s %12.3f ms\n", "accumulators + merge + analysis",
+			t_acc * 1e3);
+	std::printf("%-32s %12.3f us\n", "hist_analysis (array)", t_scan * 1e6);
+	std::printf("%-32s %12.3f us\n", "hist_analysis (accumulator)",
+			t_o1 * 1e6);
+	std::printf("identical : %s\n",
+			(hist == snap && r1 == r2) ? "yes" : "NO");
+	return 0;
+}
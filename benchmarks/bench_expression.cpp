@@ -0,0 +1,77 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// expression::evaluate (token walk with std::map lookups) versus
+// compiled_expression::evaluate (postfix bytecode with slot-indexed variables)
+// on the kind of frequency expressions fourier_analysis generates.
+#include "bench_utils.hpp"
+
+#include "expression.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const int nreps = (1 < argc) ? std::atoi(argv[1]) : 1000;
+	const gn::str_vector infix = { "A", "2*A", "3*A", "9*A", "A+B", "2*A-B",
+		"2*B-A", "3*A+2*B", "A+fs/10", "-(2*B-3*A)+fs%7", "fs/4-A",
+		"(A+B)/2+fshift", "fs*2^-3", "fdata/2-fbin" };
+	gn::expression::var_map vars{ { "A", 100.0e3 }, { "B", 123.0e3 },
+		{ "fbin", 1.0e6 / 8192 }, { "fdata", 1.0e6 }, { "fs", 1.0e6 },
+		{ "fshift", 0.0 } };
+	gn::str_vector slots;
+	std::vector<gn::real_t> values;
+	for (const auto &kv : vars) {
+		slots.push_back(kv.first);
+		values.push_back(kv.second);
+	}
+	std::vector<std::unique_ptr<gn::expression>> exprs;
+	std::vector<gn::compiled_expression> code;
+	for (const gn::str_t &s : infix) {
+		exprs.push_back(std::make_unique<gn::expression>(s));
+		code.push_back(exprs.back()->compile(slots));
+	}
+	for (size_t i = 0; i < exprs.size(); ++i) {
+		if (exprs[i]->evaluate(vars) != code[i].evaluate(values.data())) {
+			std::printf("mismatch: %s\n", infix[i].c_str());
+			return 1;
+		}
+	}
+
+	bench::print_header("Evaluation of frequency expressions");
+	std::printf("expressions = %zu, repetitions = %d\n\n", exprs.size(), nreps);
+	volatile gn::real_t sink = 0.0;
+	double t_parse = bench::median_seconds([&]() {
+		for (int r = 0; r < nreps; ++r) {
+			for (const gn::str_t &s : infix) {
+				sink = gn::expression(s).evaluate(vars);
+			}
+		}
+	});
+	double t_eval = bench::median_seconds([&]() {
+		for (int r = 0; r < nreps; ++r) {
+			for (const auto &e : exprs) {
+				sink = e->evaluate(vars);
+			}
+		}
+	});
+	double t_code = bench::median_seconds([&]() {
+		for (int r = 0; r < nreps; ++r) {
+			for (const gn::compiled_expression &c : code) {
+				sink = c.evaluate(values.data());
+			}
+		}
+	});
+	const double n = static_cast<double>(nreps) * exprs.size();
+	std::printf("%-24s %14s %10s\n", "method", "time (ns)", "speedup");
+	std::printf("%-24s %14.1f %10.2f\n", "parse + evaluate", t_parse / n * 1e9,
+			t_eval / t_parse);
+	std::printf("%-24s %14.1f %10.2f\n", "expression::evaluate",
+			t_eval / n * 1e9, 1.0);
+	std::printf("%-24s %14.1f %10.2f\n", "compiled_expression",
+			t_code / n * 1e9, t_eval / t_code);
+	return 0;
+}
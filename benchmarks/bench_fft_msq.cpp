@@ -0,0 +1,48 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Averaged rfft + norm versus rfft_msq (mean-square output) of quantized data.
+#include "bench_utils.hpp"
+
+#include "array_ops.hpp"
+#include "fourier_transforms.hpp"
+#include "parallel.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t nfft = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 65536;
+	const size_t navg = (2 < argc) ? std::strtoul(argv[2], nullptr, 10) : 64;
+	const int n = 16;
+	std::vector<int16_t> in(navg * nfft);
+	for (size_t i = 0; i < in.size(); ++i) {
+		in[i] = static_cast<int16_t>(
+				32000.0 * std::sin(0.0123 * static_cast<double>(i)));
+	}
+	std::vector<gn::real_t> out(nfft + 2);
+	std::vector<gn::real_t> msq(nfft / 2 + 1);
+	gn::set_num_threads(1);
+
+	bench::print_header("Averaged rfft, mean-square output (int16, 1 thread)");
+	std::printf("nfft = %zu, navg = %zu\n\n", nfft, navg);
+	double t_rfft = bench::median_seconds([&]() {
+		gn::rfft(in.data(), in.size(), out.data(), out.size(), n, navg, nfft,
+				gn::Window::BlackmanHarris, gn::CodeFormat::TwosComplement,
+				gn::RfftScale::DbfsSin);
+		gn::norm(out.data(), out.size(), msq.data(), msq.size());
+	});
+	double t_msq = bench::median_seconds([&]() {
+		gn::rfft_msq(in.data(), in.size(), msq.data(), msq.size(), n, navg,
+				nfft, gn::Window::BlackmanHarris,
+				gn::CodeFormat::TwosComplement, gn::RfftScale::DbfsSin);
+	});
+	std::printf("%-14s %14s %10s\n", "method", "time (ms)", "speedup");
+	std::printf("%-14s %14.2f %10.2f\n", "rfft + norm", t_rfft * 1e3, 1.0);
+	std::printf("%-14s %14.2f %10.2f\n", "rfft_msq", t_msq * 1e3,
+			t_rfft / t_msq);
+	return 0;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Averaged (navg > 1) rfft of quantized data versus thread count.
+#include "bench_utils.hpp"
+
+#include "fourier_transforms.hpp"
+#include "parallel.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t nfft = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 65536;
+	const size_t navg = (2 < argc) ? std::strtoul(argv[2], nullptr, 10) : 64;
+	const int n = 16;
+	std::vector<int16_t> in(navg * nfft);
+	for (size_t i = 0; i < in.size(); ++i) {
+		in[i] = static_cast<int16_t>(
+				32000.0 * std::sin(0.0123 * static_cast<double>(i)));
+	}
+	std::vector<gn::real_t> out(nfft + 2);
+
+	bench::print_header("Averaged rfft (int16, Blackman-Harris)");
+	std::printf("nfft = %zu, navg = %zu, hardware threads = %u\n\n", nfft,
+			navg, std::thread::hardware_concurrency());
+	std::printf("%8s %14s %10s\n", "threads", "time (ms)", "speedup");
+	double t1 = 0.0;
+	const size_t max_threads =
+			std::max(1u, std::thread::hardware_concurrency());
+	for (size_t nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+		gn::set_num_threads(nthreads);
+		double t = bench::median_seconds([&]() {
+			gn::rfft(in.data(), in.size(), out.data(), out.size(), n, navg,
+					nfft, gn::Window::BlackmanHarris,
+					gn::CodeFormat::TwosComplement,
+					gn::RfftScale::DbfsSin);
+		});
+		if (1 == nthreads) {
+			t1 = t;
+		}
+		std::printf("%8zu %14.2f %10.2f\n", nthreads, t * 1e3, t1 / t);
+	}
+	return 0;
+}
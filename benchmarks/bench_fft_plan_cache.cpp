@@ -0,0 +1,140 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Plan and window table cache hit-path scaling: every thread repeatedly
+// transforms small records at the same nfft, so each call is dominated by the
+// plan lookup (and, for windowed transforms, the window table lookup) rather
+// than by the FFT itself.  The threads are created once per thread count, so
+// a timed rep only measures the transforms.
+#include "bench_utils.hpp"
+
+#include "fourier_transforms.hpp"
+
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+std::string window_name(gn::Window window) {
+	switch (window) {
+		case gn::Window::BlackmanHarris:
+			return "BlackmanHarris";
+		case gn::Window::Hann:
+			return "Hann";
+		default:
+			return "NoWindow";
+	}
+}
+
+void transform(const std::vector<gn::real_t> &in, std::vector<gn::real_t> &out,
+		size_t nfft, gn::Window window, int ncalls) {
+	for (int k = 0; k < ncalls; ++k) {
+		gn::rfft(in.data(), in.size(), out.data(), out.size(), 1, nfft,
+				window, gn::RfftScale::DbfsSin);
+	}
+}
+
+// nthreads threads that each run ncalls transforms per round.  run() starts
+// a round and returns when every thread has finished it.
+class worker_pool {
+public:
+	worker_pool(unsigned nthreads, size_t nfft, gn::Window window, int ncalls)
+		: m_nfft{ nfft }, m_window{ window }, m_ncalls{ ncalls } {
+		for (unsigned i = 0; i < nthreads; ++i) {
+			m_threads.emplace_back(&worker_pool::loop, this);
+		}
+	}
+
+	~worker_pool() {
+		{
+			std::lock_guard<std::mutex> lock(m_mtx);
+			m_stop = true;
+		}
+		m_start.notify_all();
+		for (std::thread &th : m_threads) {
+			th.join();
+		}
+	}
+
+	void run() {
+		std::unique_lock<std::mutex> lock(m_mtx);
+		++m_round;
+		m_pending = m_threads.size();
+		m_start.notify_all();
+		m_done.wait(lock, [this] { return 0 == m_pending; });
+	}
+
+private:
+	void loop() {
+		std::vector<gn::real_t> in(m_nfft);
+		for (size_t i = 0; i < m_nfft; ++i) {
+			in[i] = std::sin(0.1 * static_cast<double>(i));
+		}
+		std::vector<gn::real_t> out(m_nfft + 2);
+		size_t round = 0;
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(m_mtx);
+				m_start.wait(lock,
+						[&] { return m_stop || round != m_round; });
+				if (m_stop) {
+					return;
+				}
+				round = m_round;
+			}
+			transform(in, out, m_nfft, m_window, m_ncalls);
+			std::lock_guard<std::mutex> lock(m_mtx);
+			if (0 == --m_pending) {
+				m_done.notify_one();
+			}
+		}
+	}
+
+	const size_t m_nfft;
+	const gn::Window m_window;
+	const int m_ncalls;
+	std::vector<std::thread> m_threads;
+	std::mutex m_mtx;
+	std::condition_variable m_start;
+	std::condition_variable m_done;
+	size_t m_round = 0;
+	size_t m_pending = 0;
+	bool m_stop = false;
+};
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+	const size_t nfft = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 64;
+	const int ncalls = (2 < argc) ? std::atoi(argv[2]) : 20000;
+	unsigned max_threads = std::max(32u, std::thread::hardware_concurrency());
+
+	std::printf("\nnfft = %zu, calls per thread = %d, hardware threads = %u\n",
+			nfft, ncalls, std::thread::hardware_concurrency());
+	for (const gn::Window window : { gn::Window::NoWindow,
+			gn::Window::BlackmanHarris, gn::Window::Hann }) {
+		// Create the plan and window table up front so every timed call is a
+		// cache hit
+		std::vector<gn::real_t> in(nfft), out(nfft + 2);
+		transform(in, out, nfft, window, 1);
+
+		const std::string title = "FFTW plan cache hit path (rfft, " +
+				window_name(window) + ")";
+		bench::print_header(title.c_str());
+		std::printf("%8s %14s %16s\n", "threads", "time (ms)", "calls / s");
+		for (unsigned nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+			worker_pool pool(nthreads, nfft, window, ncalls);
+			double t = bench::median_seconds([&]() { pool.run(); }, 3);
+			double rate = static_cast<double>(nthreads) * ncalls / t;
+			std::printf("%8u %14.2f %16.0f\n", nthreads, t * 1e3, rate);
+		}
+	}
+	return 0;
+}
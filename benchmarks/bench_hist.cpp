@@ -0,0 +1,56 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Histogram of a quantized sine (int16) with hist versus hist_parallel, by
+// thread count, for 12- and 16-bit codes.  Also checks that the two
+// histograms are identical.
+#include "bench_utils.hpp"
+
+#include "code_density.hpp"
+#include "parallel.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t size =
+			(1 < argc) ? std::strtoul(argv[1], nullptr, 10) : (1 << 24);
+	bench::print_header("Histogram (int16): hist vs. hist_parallel");
+	std::printf("samples = %zu, hardware threads = %u\n\n", size,
+			std::thread::hardware_concurrency());
+	std::printf("%4s %8s %12s %14s %9s %10s\n", "n", "threads", "hist (ms)",
+			"parallel (ms)", "speedup", "identical");
+	const size_t max_threads =
+			std::max(1u, std::thread::hardware_concurrency());
+	for (const int n : { 12, 16 }) {
+		const double amp = std::ldexp(1.0, n - 1) - 1.0;
+		std::vector<int16_t> in(size);
+		for (size_t i = 0; i < size; ++i) {
+			in[i] = static_cast<int16_t>(std::lround(
+					amp * std::sin(0.000123 * static_cast<double>(i))));
+		}
+		const size_t hist_size =
+				gn::code_density_size(n, gn::CodeFormat::TwosComplement);
+		std::vector<uint64_t> h1(hist_size);
+		std::vector<uint64_t> h2(hist_size);
+		for (size_t nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+			gn::set_num_threads(nthreads);
+			double t1 = bench::median_seconds([&]() {
+				gn::hist(h1.data(), h1.size(), in.data(), in.size(), n,
+						gn::CodeFormat::TwosComplement, false);
+			});
+			double t2 = bench::median_seconds([&]() {
+				gn::hist_parallel(h2.data(), h2.size(), in.data(), in.size(),
+						n, gn::CodeFormat::TwosComplement, false);
+			});
+			std::printf("%4d %8zu %12.2f %14.2f %9.2f %10s\n", n, nthreads,
+					t1 * 1e3, t2 * 1e3, t1 / t2, (h1 == h2) ? "yes" : "NO");
+		}
+	}
+	gn::set_num_threads(1);
+	return 0;
+}
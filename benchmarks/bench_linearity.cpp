@@ -0,0 +1,113 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Static linearity from codes: hist, dnl, dnl_analysis, inl, inl_analysis
+// (plus hist_analysis) versus one linearity_analysis call, for ramp and tone
+// captures at 12 to 22 bits.  The histogram overload is timed against the
+// same sequence without hist.  Also checks that the histograms, DNL, INL, and
+// summary results are identical.
+#include "bench_utils.hpp"
+
+#include "code_density.hpp"
+#include "constants.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+// hist_analysis, dnl_analysis, and inl_analysis results, in the order of
+// linearity_analysis_ordered_keys()
+std::vector<gn::real_t> map_values(const std::map<gn::str_t, gn::real_t> &h,
+		const std::map<gn::str_t, gn::real_t> &d,
+		const std::map<gn::str_t, gn::real_t> &i) {
+	std::vector<gn::real_t> v;
+	for (const gn::str_t &k : gn::hist_analysis_ordered_keys()) {
+		v.push_back(h.at(k));
+	}
+	for (const gn::str_t &k : gn::dnl_analysis_ordered_keys()) {
+		v.push_back(d.at(k));
+	}
+	for (const gn::str_t &k : gn::inl_analysis_ordered_keys()) {
+		v.push_back(i.at(k));
+	}
+	return v;
+}
+
+} // namespace
+
+int main() {
+	const size_t wf_size = 1 << 22;
+	const gn::CodeFormat format = gn::CodeFormat::TwosComplement;
+	const gn::InlLineFit fit = gn::InlLineFit::BestFit;
+	bench::print_header("Histogram + DNL + INL + analyses: separate vs. fused");
+	std::printf("%4s %5s %14s %14s %14s %14s %10s\n", "n", "type",
+			"calls (ms)", "fused (ms)", "h calls (ms)",
+			"h fused (ms)",
+			"identical");
+	for (const gn::DnlSignal type :
+			{ gn::DnlSignal::Ramp, gn::DnlSignal::Tone }) {
+		for (const int n : { 12, 16, 20, 22 }) {
+			const std::pair<int64_t, int64_t> mm =
+					gn::resolution_to_minmax<int64_t>(n, format);
+			const double span = static_cast<double>(mm.second - mm.first);
+			std::vector<int32_t> wf(wf_size);
+			for (size_t i = 0; i < wf_size; ++i) {
+				const double x = static_cast<double>(i) / wf_size;
+				const double y = (gn::DnlSignal::Ramp == type)
+						? (x - 0.5) * 1.02
+						: 0.51 * std::sin(2 * gn::k_pi * 7.0123 * x);
+				wf[i] = static_cast<int32_t>(std::lround(std::min(std::max(
+						y * span, static_cast<double>(mm.first)),
+						static_cast<double>(mm.second))));
+			}
+			const size_t size = gn::code_density_size(n, format);
+			std::vector<uint64_t> hist(size), hist2(size);
+			std::vector<gn::real_t> dnl(size), inl(size), dnl2(size),
+					inl2(size);
+			std::vector<gn::real_t> values, values2(
+					gn::linearity_analysis_ordered_keys().size());
+			gn::linearity_results r{};
+			auto analyses = [&]() {
+				std::map<gn::str_t, gn::real_t> ha =
+						gn::hist_analysis(hist.data(), size);
+				gn::dnl(dnl.data(), size, hist.data(), size, type);
+				std::map<gn::str_t, gn::real_t> da =
+						gn::dnl_analysis(dnl.data(), size);
+				gn::inl(inl.data(), size, dnl.data(), size, fit);
+				std::map<gn::str_t, gn::real_t> ia =
+						gn::inl_analysis(inl.data(), size);
+				values = map_values(ha, da, ia);
+			};
+			const double t_calls = bench::median_seconds([&]() {
+				gn::hist(hist.data(), size, wf.data(), wf_size, n, format,
+						false);
+				analyses();
+			});
+			const double t_fused = bench::median_seconds([&]() {
+				r = gn::linearity_analysis(hist2.data(), size, dnl2.data(),
+						size, inl2.data(), size, wf.data(), wf_size, n, format,
+						type, fit);
+			});
+			gn::linearity_results_values(values2.data(), values2.size(), r);
+			bool same = hist == hist2 && dnl == dnl2 && inl == inl2 &&
+					values == values2;
+			const double t_hist_calls = bench::median_seconds(analyses);
+			const double t_hist_fused = bench::median_seconds([&]() {
+				r = gn::linearity_analysis(dnl2.data(), size, inl2.data(),
+						size, hist.data(), size, type, fit);
+			});
+			gn::linearity_results_values(values2.data(), values2.size(), r);
+			same = same && dnl == dnl2 && inl == inl2 && values == values2;
+			std::printf("%4d %5s %14.3f %14.3f %14.3f %14.3f %10s\n", n,
+					(gn::DnlSignal::Ramp == type) ? "ramp" : "tone",
+					t_calls * 1e3, t_fused * 1e3, t_hist_calls * 1e3,
+					t_hist_fused * 1e3, same ? "yes" : "NO");
+		}
+	}
+	return 0;
+}
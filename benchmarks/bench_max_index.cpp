@@ -0,0 +1,75 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Component searches over a mean-square spectrum: a linear scan versus the
+// range-maximum queries of a spectrum_index.  The searches mimic one analysis
+// with a MaxTone and several WO components: each searches a mask that covers
+// nearly every bin, and each one found is removed from the next search.
+#include "bench_utils.hpp"
+
+#include "fourier_analysis_comp_mask.hpp"
+#include "spectrum_index.hpp"
+
+#include <cstdlib>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t size = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 1048577;
+	const size_t searches = 10;
+	std::vector<gn::real_t> msq(size);
+	for (size_t i = 0; i < size; ++i) {
+		msq[i] = 1e-12 * static_cast<gn::real_t>(1 + (i * 7919) % 101);
+	}
+	for (size_t k = 1; k <= searches; ++k) {
+		msq[k * (size / (searches + 1))] = 1e-3 / static_cast<gn::real_t>(k);
+	}
+	gn::fourier_analysis_comp_mask tones(false, size);
+	for (size_t k = 1; k <= 40; ++k) {
+		const gn::diff_t c = static_cast<gn::diff_t>(k * (size / 41)) + 5;
+		tones.set_range(c - 3, c + 3);
+	}
+
+	auto search = [&](auto &&find) {
+		gn::fourier_analysis_comp_mask mask(false, size);
+		mask.set_all();
+		mask.unset_ranges(tones);
+		gn::diff_t found = 0;
+		for (size_t k = 0; k < searches; ++k) {
+			std::tuple<gn::diff_t, gn::diff_t, gn::diff_t> r = find(mask);
+			found += std::get<0>(r);
+			mask.unset_ranges([&]() {
+				gn::fourier_analysis_comp_mask m(false, size);
+				m.set_range(std::get<0>(r) - 3, std::get<0>(r) + 3);
+				return m;
+			}());
+		}
+		return found;
+	};
+
+	bench::print_header("Component searches over one spectrum");
+	std::printf("size = %zu, searches = %zu\n\n", size, searches);
+	volatile gn::diff_t sink = 0;
+	double t_scan = bench::median_seconds([&]() {
+		sink = search([&](const gn::fourier_analysis_comp_mask &m) {
+			return m.find_max_index(msq.data(), msq.size());
+		});
+	});
+	gn::spectrum_index index;
+	double t_index = bench::median_seconds([&]() {
+		index.build(msq.data(), msq.size(), true);
+		sink = search([&](const gn::fourier_analysis_comp_mask &m) {
+			return m.find_max_index(index);
+		});
+	});
+	double t_build = bench::median_seconds([&]() {
+		index.build(msq.data(), msq.size(), true);
+	});
+	std::printf("%-24s %14s %10s\n", "method", "time (us)", "speedup");
+	std::printf("%-24s %14.1f %10.2f\n", "linear scan", t_scan * 1e6, 1.0);
+	std::printf("%-24s %14.1f %10.2f\n", "spectrum_index", t_index * 1e6,
+			t_scan / t_index);
+	std::printf("%-24s %14.1f\n", "  (build only)", t_build * 1e6);
+	return 0;
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Normalize-window kernels at each available SIMD level, and the averaged rfft
+// that uses them.  Every level must match the scalar kernels bit for bit.
+#include "bench_utils.hpp"
+
+#include "fourier_transforms.hpp"
+#include "parallel.hpp"
+#include "simd_kernels.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+bool available(gn::SimdLevel level) {
+	try {
+		gn::set_simd_level(level);
+		return true;
+	} catch (const std::exception &) {
+		return false;
+	}
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+	const size_t nfft = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 65536;
+	const size_t navg = (2 < argc) ? std::strtoul(argv[2], nullptr, 10) : 16;
+	const int n = 16;
+	const size_t size = navg * nfft;
+	std::vector<int16_t> in(2 * size);
+	for (size_t i = 0; i < in.size(); ++i) {
+		in[i] = static_cast<int16_t>(
+				32000.0 * std::sin(0.0123 * static_cast<double>(i)));
+	}
+	std::vector<double> win(nfft);
+	for (size_t i = 0; i < nfft; ++i) {
+		win[i] = 0.5 - 0.5 * std::cos(6.283185307179586 * i / nfft);
+	}
+	const double scalar = 2.0 / (1 << n);
+	std::vector<double> real_out(size);
+	std::vector<double> cplx_out(2 * size);
+	std::vector<gn::real_t> fft_out((nfft / 2 + 1) * 2);
+	std::vector<double> real_ref, cplx_ref, fft_ref;
+	gn::set_num_threads(1);
+
+	bench::print_header("Normalize-window kernels (int16 -> double, 1 thread)");
+	std::printf("nfft = %zu, navg = %zu\n\n", nfft, navg);
+	std::printf("%-8s %12s %12s %12s %8s\n", "level", "real (ms)",
+			"iq (ms)", "rfft (ms)", "exact");
+	double t_scalar = 0.0;
+	for (gn::SimdLevel level : { gn::SimdLevel::Scalar, gn::SimdLevel::Avx2,
+				 gn::SimdLevel::Avx512, gn::SimdLevel::Neon }) {
+		if (!available(level)) {
+			continue;
+		}
+		double t_real = bench::median_seconds([&]() {
+			for (size_t k = 0; k < navg; ++k) {
+				gn::norm_window(in.data() + k * nfft, win.data(),
+						real_out.data() + k * nfft, nfft, scalar, 0.0);
+			}
+		});
+		double t_cplx = bench::median_seconds([&]() {
+			for (size_t k = 0; k < navg; ++k) {
+				const int16_t *p = in.data() + 2 * k * nfft;
+				gn::norm_window_cplx(p, p + 1, 2, win.data(),
+						cplx_out.data() + 2 * k * nfft, nfft, scalar, 0.0);
+			}
+		});
+		double t_rfft = bench::median_seconds([&]() {
+			gn::rfft(in.data(), size, fft_out.data(), fft_out.size(), n, navg,
+					nfft, gn::Window::BlackmanHarris,
+					gn::CodeFormat::TwosComplement, gn::RfftScale::DbfsSin);
+		});
+		bool exact = true;
+		if (gn::SimdLevel::Scalar == level) {
+			t_scalar = t_real;
+			real_ref = real_out;
+			cplx_ref = cplx_out;
+			fft_ref = fft_out;
+		} else {
+			exact = real_ref == real_out && cplx_ref == cplx_out &&
+					fft_ref == fft_out;
+		}
+		std::printf("%-8s %12.3f %12.3f %12.2f %8s", gn::simd_level_name(level),
+				t_real * 1e3, t_cplx * 1e3, t_rfft * 1e3, exact ? "yes" : "NO");
+		std::printf("   (real speedup %.2f)\n", t_scalar / t_real);
+	}
+	return 0;
+}
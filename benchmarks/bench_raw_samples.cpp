@@ -0,0 +1,100 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Histogram and normalize raw DMA buffers: unpacking the whole buffer into an
+// int32 array and calling hist/normalize, versus hist_raw/normalize_raw, which
+// decode a block at a time.  Formats: 12-bit packed (3 bytes per 2 samples),
+// 14-bit left-justified in 16-bit words, and 24-bit big-endian words.  Also
+// checks that the results are identical.
+#include "bench_utils.hpp"
+
+#include "code_density.hpp"
+#include "processes.hpp"
+#include "sample_format.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+// Write codes as raw samples of the given format, with offset 0 and stride 1
+std::vector<uint8_t> pack(const std::vector<int32_t> &codes,
+		const gn::sample_format &fmt) {
+	const int cb = fmt.container_bits;
+	std::vector<uint8_t> buf((codes.size() * cb + 7) / 8, 0);
+	for (size_t c = 0; c < codes.size(); ++c) {
+		uint64_t v = static_cast<uint32_t>(codes[c]) & ((1u << fmt.bits) - 1);
+		if (fmt.left_justified) {
+			v <<= cb - fmt.bits;
+		}
+		for (int t = 0; t < cb; ++t) {
+			const uint64_t k = c * cb + (fmt.big_endian ? cb - 1 - t : t);
+			const int b = fmt.big_endian ? 7 - static_cast<int>(k % 8)
+					: static_cast<int>(k % 8);
+			buf[k / 8] |= static_cast<uint8_t>(((v >> t) & 1) << b);
+		}
+	}
+	return buf;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+	const size_t size =
+			(1 < argc) ? std::strtoul(argv[1], nullptr, 10) : (1 << 22);
+	const gn::CodeFormat tc = gn::CodeFormat::TwosComplement;
+	const struct {
+		const char *name;
+		gn::sample_format fmt;
+	} cases[] = {
+		{ "12-bit packed", { 12, 12, false, false, tc, 1, 0 } },
+		{ "14-bit left in 16", { 14, 16, true, false, tc, 1, 0 } },
+		{ "24-bit big-endian", { 24, 24, false, true, tc, 1, 0 } },
+	};
+	bench::print_header("Raw samples: unpack + hist/normalize vs. "
+			"hist_raw/normalize_raw");
+	std::printf("samples = %zu\n\n", size);
+	std::printf("%-18s %10s %10s %10s %10s %10s\n", "format", "hist (ms)",
+			"raw (ms)", "norm (ms)", "raw (ms)", "identical");
+	for (const auto &c : cases) {
+		const gn::sample_format &fmt = c.fmt;
+		const double amp = std::ldexp(1.0, fmt.bits - 1) - 1.0;
+		std::vector<int32_t> codes(size);
+		for (size_t i = 0; i < size; ++i) {
+			codes[i] = static_cast<int32_t>(std::lround(
+					amp * std::sin(0.000123 * static_cast<double>(i))));
+		}
+		const std::vector<uint8_t> buf = pack(codes, fmt);
+		const size_t hist_size = gn::code_density_size(fmt.bits, fmt.format);
+		std::vector<uint64_t> h1(hist_size);
+		std::vector<uint64_t> h2(hist_size);
+		std::vector<gn::real_t> n1(size);
+		std::vector<gn::real_t> n2(size);
+		std::vector<int32_t> tmp(size);
+		double t_hist = bench::median_seconds([&]() {
+			gn::unpack_raw(tmp.data(), size, buf.data(), buf.size(), fmt);
+			gn::hist(h1.data(), h1.size(), tmp.data(), size, fmt.bits,
+					fmt.format, false);
+		});
+		double t_hist_raw = bench::median_seconds([&]() {
+			gn::hist_raw(h2.data(), h2.size(), buf.data(), buf.size(), fmt,
+					size, false);
+		});
+		double t_norm = bench::median_seconds([&]() {
+			gn::unpack_raw(tmp.data(), size, buf.data(), buf.size(), fmt);
+			gn::normalize(tmp.data(), size, n1.data(), size, fmt.bits,
+					fmt.format);
+		});
+		double t_norm_raw = bench::median_seconds([&]() {
+			gn::normalize_raw(buf.data(), buf.size(), n2.data(), size, fmt);
+		});
+		const bool same = (h1 == h2) && (n1 == n2) && (tmp == codes);
+		std::printf("%-18s %10.2f %10.2f %10.2f %10.2f %10s\n", c.name,
+				t_hist * 1e3, t_hist_raw * 1e3, t_norm * 1e3,
+				t_norm_raw * 1e3, same ? "yes" : "NO");
+	}
+	return 0;
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// SINAD of a non-coherent capture: three- and four-parameter sine fits versus
+// the FFT path (windowed rfft, then Fourier analysis with a prepared plan), at
+// typical capture sizes.  Also prints the SINAD each method reports; the FFT
+// value depends on how much of the leakage the component widths capture.
+#include "bench_utils.hpp"
+
+#include "analysis_plan.hpp"
+#include "fourier_analysis.hpp"
+#include "fourier_transforms.hpp"
+#include "sine_fit.hpp"
+#include "waveforms.hpp"
+
+namespace gn = genalyzer_impl;
+
+int main() {
+	const gn::real_t fs = 1e6;
+	const gn::real_t freq = 101234.5678;
+
+	gn::fourier_analysis fa;
+	fa.set_fsample("1e6");
+	fa.add_max_tone("A", gn::FACompTag::Signal, "0.0", "fdata", 3);
+	fa.set_hd(5);
+	fa.set_ssb(gn::FASsb::DC, 3);
+
+	bench::print_header("SINAD of a non-coherent tone: sine fit vs. FFT");
+	std::printf("%-8s %12s %12s %12s %8s %8s %8s\n", "size", "3-par (us)",
+			"4-par (us)", "FFT (us)", "3-par dB", "4-par dB", "FFT dB");
+	for (size_t size = 4096; size <= 65536; size *= 2) {
+		std::vector<gn::real_t> wf(size);
+		std::vector<gn::real_t> noise(size);
+		gn::cos(wf.data(), size, fs, 0.9, freq, 0.3, 0.0, 0.0);
+		gn::gaussian(noise.data(), size, 0.01, 1e-4);
+		for (size_t i = 0; i < size; ++i) {
+			wf[i] += noise[i];
+		}
+		const size_t fft_size = (size / 2 + 1) * 2;
+		std::vector<gn::real_t> fft(fft_size);
+		auto plan = fa.prepare(size, gn::FreqAxisType::DcLeft, false);
+
+		std::map<gn::str_t, gn::real_t> r3, r4;
+		gn::fourier_analysis_results rf;
+		double t3 = bench::median_seconds([&]() {
+			r3 = gn::sine_fit_analysis(wf.data(), size, fs, freq, false);
+		});
+		// Start the four-parameter fit half a bin off
+		const gn::real_t guess = freq + 0.5 * fs / static_cast<gn::real_t>(size);
+		double t4 = bench::median_seconds([&]() {
+			r4 = gn::sine_fit_analysis(wf.data(), size, fs, guess, true);
+		});
+		double tf = bench::median_seconds([&]() {
+			gn::rfft(wf.data(), size, fft.data(), fft_size, 1, size,
+					gn::Window::BlackmanHarris, gn::RfftScale::DbfsSin);
+			rf = plan->analyze(fft.data(), fft_size);
+		});
+		std::printf("%-8zu %12.1f %12.1f %12.1f %8.2f %8.2f %8.2f\n", size,
+				t3 * 1e6, t4 * 1e6, tf * 1e6, r3.at("sinad"), r4.at("sinad"),
+				rf.get(gn::FAResult::SINAD));
+	}
+	return 0;
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Fixed-tone measurement (fundamental and HD2-HD5) of a real capture: rfft_msq
+// followed by analysis of the whole spectrum, versus analyze_sparse, which
+// computes only the component bins.  Coherent captures are analyzed without a
+// window and with single-bin tones; non-coherent captures with a
+// Blackman-Harris window and 3 side bins per tone.  Also prints the largest
+// difference between the two over all results in dB.  analyze_sparse falls
+// back to the full spectrum past about log2(nfft) component bins.
+#include "bench_utils.hpp"
+
+#include "analysis_plan.hpp"
+#include "fourier_analysis.hpp"
+#include "fourier_transforms.hpp"
+#include "waveforms.hpp"
+
+#include <cmath>
+
+namespace gn = genalyzer_impl;
+
+int main() {
+	const gn::real_t fs = 1e6;
+	bench::print_header("Fixed-tone analysis: full spectrum vs. sparse bins");
+	std::printf("%-8s %-16s %5s %12s %12s %9s %10s\n", "nfft", "window",
+			"bins", "full (ms)", "sparse (ms)", "speedup", "max dB err");
+	for (size_t nfft = 65536; nfft <= 1048576; nfft *= 4) {
+		for (const bool windowed : { false, true }) {
+			const gn::real_t fbin = fs / static_cast<gn::real_t>(nfft);
+			const gn::real_t freq = windowed ? 1021.37 * fbin : 1021 * fbin;
+			std::vector<gn::real_t> wf(nfft);
+			std::vector<gn::real_t> tmp(nfft);
+			gn::cos(wf.data(), nfft, fs, 0.9, freq, 0.0, 0.0, 0.0);
+			for (int h = 2; h <= 5; ++h) {
+				gn::cos(tmp.data(), nfft, fs, 1e-4 / h, h * freq, 0.5, 0.0, 0.0);
+				for (size_t i = 0; i < nfft; ++i) {
+					wf[i] += tmp[i];
+				}
+			}
+			gn::gaussian(tmp.data(), nfft, 0.0, 1e-5);
+			for (size_t i = 0; i < nfft; ++i) {
+				wf[i] += tmp[i];
+			}
+			const gn::Window window = windowed ? gn::Window::BlackmanHarris
+											   : gn::Window::NoWindow;
+			const int ssb = windowed ? 3 : 0;
+			gn::fourier_analysis fa;
+			fa.set_fsample("1e6");
+			fa.add_fixed_tone("A", gn::FACompTag::Signal,
+					windowed ? "1021.37*fbin" : "1021*fbin", ssb);
+			fa.set_ssb(gn::FASsb::Default, ssb);
+			fa.set_hd(5);
+			fa.set_wo(0);
+			auto plan = fa.prepare(nfft, gn::FreqAxisType::DcLeft, false);
+
+			std::vector<gn::real_t> msq(nfft / 2 + 1);
+			gn::fourier_analysis_results full, sparse;
+			double t_full = bench::median_seconds([&]() {
+				gn::rfft_msq(wf.data(), nfft, msq.data(), msq.size(), 1, nfft,
+						window, gn::RfftScale::DbfsSin);
+				full = plan->analyze(msq.data(), msq.size());
+			});
+			double t_sparse = bench::median_seconds([&]() {
+				sparse = plan->analyze_sparse(wf.data(), nfft, 1, window,
+						gn::RfftScale::DbfsSin);
+			});
+			gn::real_t err = 0.0;
+			for (gn::FAResult r : { gn::FAResult::SNR, gn::FAResult::SINAD,
+						 gn::FAResult::SFDR, gn::FAResult::NSD }) {
+				err = std::max(err, std::fabs(full.get(r) - sparse.get(r)));
+			}
+			for (size_t t = 0; t < full.tone_count(); ++t) {
+				err = std::max(err,
+						std::fabs(full.get_tone(t, gn::FAToneResult::Mag_dBFS) -
+								sparse.get_tone(t, gn::FAToneResult::Mag_dBFS)));
+			}
+			std::printf("%-8zu %-16s %5zu %12.2f %12.2f %9.1f %10.1e\n", nfft,
+					windowed ? "BlackmanHarris" : "NoWindow",
+					plan->sparse_bins().size(), t_full * 1e3, t_sparse * 1e3,
+					t_full / t_sparse, err);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Tone histogram and DNL at 20 to 30 bits: dense histx + dnl versus a
+// sparse_histogram.  The tone spans +/-2^19 codes, as in a low-level test of
+// a high-resolution converter.  Prints the time to histogram and compute DNL,
+// and the memory used by histogram and DNL arrays (dense is skipped where it
+// needs more than 1 GB).  Also checks that the two DNLs are identical.
+#include "bench_utils.hpp"
+
+#include "code_density.hpp"
+#include "sparse_histogram.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gn = genalyzer_impl;
+
+int main() {
+	const size_t size = 1 << 22;
+	const double amp = std::ldexp(1.0, 19) - 1.0;
+	std::vector<int32_t> wf(size);
+	for (size_t i = 0; i < size; ++i) {
+		wf[i] = static_cast<int32_t>(std::lround(amp *
+				std::sin(0.000123456 * static_cast<double>(i) + 0.1)));
+	}
+	bench::print_header("Tone histogram + DNL: dense vs. sparse");
+	std::printf("%4s %12s %12s %12s %12s %10s\n", "n", "dense (ms)",
+			"dense (MB)", "sparse (ms)", "sparse (MB)", "identical");
+	for (const int n : { 20, 24, 28, 30 }) {
+		const std::pair<int64_t, int64_t> mm =
+				gn::resolution_to_minmax<int64_t>(n,
+						gn::CodeFormat::TwosComplement);
+		const size_t hist_size = gn::code_densityx_size(mm.first, mm.second);
+		const bool run_dense = hist_size * 16 <= (size_t{ 1 } << 30);
+		std::vector<uint64_t> hist;
+		std::vector<gn::real_t> dnl;
+		double t_dense = 0.0;
+		if (run_dense) {
+			hist.resize(hist_size);
+			dnl.resize(hist_size);
+			t_dense = bench::median_seconds([&]() {
+				gn::histx(hist.data(), hist.size(), wf.data(), wf.size(),
+						mm.first, mm.second, false);
+				gn::dnl(dnl.data(), dnl.size(), hist.data(), hist.size(),
+						gn::DnlSignal::Tone);
+			}, 3);
+		}
+		std::shared_ptr<gn::sparse_histogram> sh;
+		std::vector<gn::real_t> sdnl;
+		double t_sparse = bench::median_seconds([&]() {
+			sh = gn::sparse_histogram::create(mm.first, mm.second);
+			sh->add(wf.data(), wf.size());
+			const gn::size_p nz = sh->nz_range();
+			sdnl.resize(nz.second - nz.first + 1);
+			gn::dnl(sdnl.data(), sdnl.size(), *sh, gn::DnlSignal::Tone);
+		}, 3);
+		const double mb = 1.0 / (1 << 20);
+		const size_t sparse_bytes =
+				sh->memory_size() + sdnl.size() * sizeof(gn::real_t);
+		const double sparse_mb = static_cast<double>(sparse_bytes) * mb;
+		std::printf("%4d ", n);
+		if (run_dense) {
+			const size_t first = sh->nz_range().first;
+			const bool same = std::equal(sdnl.begin(), sdnl.end(),
+					dnl.begin() + static_cast<std::ptrdiff_t>(first));
+			std::printf("%12.1f %12.1f %12.1f %12.1f %10s\n", t_dense * 1e3,
+					static_cast<double>(hist_size * 16) * mb, t_sparse * 1e3,
+					sparse_mb, same ? "yes" : "NO");
+		} else {
+			std::printf("%12s %12.1f %12.1f %12.1f %10s\n", "-",
+					static_cast<double>(hist_size * 16) * mb, t_sparse * 1e3,
+					sparse_mb, "-");
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// Mask sums over a mean-square spectrum: bin by bin versus a spectrum_index.
+// The masks mimic one analysis: a few that cover nearly every bin (AB, NAD,
+// Noise) and many that cover a handful of small ranges (tags and tones).
+#include "bench_utils.hpp"
+
+#include "fourier_analysis_comp_mask.hpp"
+#include "spectrum_index.hpp"
+
+#include <cstdlib>
+
+namespace gn = genalyzer_impl;
+
+int main(int argc, char *argv[]) {
+	const size_t size = (1 < argc) ? std::strtoul(argv[1], nullptr, 10) : 1048577;
+	std::vector<gn::real_t> msq(size);
+	for (size_t i = 0; i < size; ++i) {
+		msq[i] = 1e-12 * static_cast<gn::real_t>(1 + (i * 7919) % 101);
+	}
+	gn::fourier_analysis_comp_mask tones(false, size);
+	for (size_t k = 1; k <= 40; ++k) {
+		const gn::diff_t c = static_cast<gn::diff_t>(k * (size / 41));
+		tones.set_range(c - 3, c + 3);
+	}
+	std::vector<gn::fourier_analysis_comp_mask> masks;
+	for (int i = 0; i < 3; ++i) {
+		masks.emplace_back(false, size);
+		masks.back().set_all();
+		masks.back().unset_ranges(tones);
+	}
+	for (int i = 0; i < 12; ++i) {
+		masks.push_back(tones);
+	}
+
+	bench::print_header("Mask sums over one spectrum");
+	std::printf("size = %zu, masks = %zu, ranges per small mask = %zu\n\n",
+			size, masks.size(), tones.num_ranges());
+	volatile gn::real_t sink = 0.0;
+	double t_naive = bench::median_seconds([&]() {
+		for (const auto &m : masks) {
+			sink = m.sum(msq.data(), msq.size());
+		}
+	});
+	gn::spectrum_index index;
+	double t_index = bench::median_seconds([&]() {
+		index.build(msq.data(), msq.size());
+		for (const auto &m : masks) {
+			sink = m.sum(index);
+		}
+	});
+	double t_build = bench::median_seconds([&]() {
+		index.build(msq.data(), msq.size());
+	});
+	std::printf("%-24s %14s %10s\n", "method", "time (us)", "speedup");
+	std::printf("%-24s %14.1f %10.2f\n", "bin by bin", t_naive * 1e6, 1.0);
+	std::printf("%-24s %14.1f %10.2f\n", "spectrum_index", t_index * 1e6,
+			t_naive / t_index);
+	std::printf("%-24s %14.1f\n", "  (build only)", t_build * 1e6);
+	return 0;
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_BENCH_UTILS_HPP
+#define GENALYZER_BENCH_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace bench {
+
+// Returns the median wall-clock time of one call to f, in seconds, over
+// nreps repetitions (after one untimed warm-up call).
+template <typename F>
+double median_seconds(F &&f, int nreps = 5) {
+	using clock = std::chrono::steady_clock;
+	f();
+	std::vector<double> t(static_cast<size_t>(nreps));
+	for (double &ti : t) {
+		auto t0 = clock::now();
+		f();
+		ti = std::chrono::duration<double>(clock::now() - t0).count();
+	}
+	std::sort(t.begin(), t.end());
+	return t[t.size() / 2];
+}
+
+inline void print_header(const char *title) {
+	std::printf("\n%s\n", title);
+	for (const char *p = title; *p; ++p) {
+		std::putchar('-');
+	}
+	std::putchar('\n');
+}
+
+} // namespace bench
+
+#endif // GENALYZER_BENCH_UTILS_HPP
@@ -21,6 +21,8 @@
  * \li \ref gn_fft_analysis "Fourier Analysis"
  * \li \ref gn_hist_analysis "Histogram Analysis"
  * \li \ref gn_inl_analysis "INL Analysis"
+ * \li \ref gn_linearity_analysis "Linearity Analysis"
+ * \li \ref gn_sine_fit_analysis "Sine-Fit Analysis"
  * \li \ref gn_wf_analysis "Waveform Analysis"
  *
  * Each analysis routine returns results by filling a Keys array (rkeys) and a
@@ -47,7 +49,9 @@ typedef enum GnAnalysisType {
 	GnAnalysisTypeFourier, ///< Fourier (FFT)
 	GnAnalysisTypeHistogram, ///< Histogram
 	GnAnalysisTypeINL, ///< INL (integral nonlinearity)
-	GnAnalysisTypeWaveform ///< Waveform
+	GnAnalysisTypeWaveform, ///< Waveform
+	GnAnalysisTypeSineFit, ///< Sine fit
+	GnAnalysisTypeLinearity ///< Histogram, DNL, and INL
 } GnAnalysisType;
 
 /**
@@ -92,6 +96,15 @@ typedef enum GnFASsb {
 	GnFASsbWO, ///< SSB for WorstOther components
 } GnFASsb;
 
+/**
+ * @brief GnFftPlanner enumerates FFTW planner effort levels
+ */
+typedef enum GnFftPlanner {
+	GnFftPlannerEstimate, ///< Heuristic plan (FFTW_ESTIMATE)
+	GnFftPlannerMeasure, ///< Measured plan (FFTW_MEASURE)
+	GnFftPlannerPatient ///< Exhaustively measured plan (FFTW_PATIENT)
+} GnFftPlanner;
+
 /**
  * @brief GnFreqAxisFormat enumerates frequency axis formats
  */
@@ -220,6 +233,25 @@ __api int gn_error_string(char *buf, ///< [out] Pointer to character array
 		size_t size ///< [in] Size of character array
 );
 
+/**
+ * @brief Get the number of threads used by parallel algorithms
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_get_num_threads(size_t *num_threads ///< [out] Thread count
+);
+
+/**
+ * @brief Set the number of threads used by parallel algorithms
+ * @return Always returns 0
+ * @details The default is 1, which keeps all computation on the calling
+ * thread.  With more than one thread, averaged FFTs (navg > 1) split their
+ * records across a shared thread pool.  Results are bit-identical to the
+ * single-threaded path.
+ */
+__api int gn_set_num_threads(
+		size_t num_threads ///< [in] Thread count; 0 selects hardware concurrency
+);
+
 /**
  * @brief Set whether library-returned strings include a null terminator
  * @return Always returns 0
@@ -511,6 +543,73 @@ __api int gn_histx64(
 		///< histogram
 );
 
+/**
+ * @brief Compute a code density histogram from 16-bit quantized waveform data
+ * on multiple threads
+ * @return 0 on success, non-zero otherwise
+ * @details The input is split into gn_get_num_threads() slices, each counted
+ * into a private sub-histogram, and the sub-histograms are summed into hist.
+ * The result is identical to gn_hist16().
+ */
+__api int gn_hist16_parallel(
+		uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		GnCodeFormat format, ///< [in] Code format
+		bool preserve ///< [in] If true, hist is not cleared before computing the
+		///< histogram
+);
+
+/**
+ * @brief Compute a code density histogram from 16-bit data using explicit code
+ * bounds on multiple threads
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_hist16_parallel().  The result is identical to gn_histx16().
+ */
+__api int gn_histx16_parallel(
+		uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int64_t min, ///< [in] Min code
+		int64_t max, ///< [in] Max code
+		bool preserve ///< [in] If true, hist is not cleared before computing the
+		///< histogram
+);
+
+/**
+ * @brief Compute a code density histogram directly from raw ADC samples
+ * @return 0 on success, non-zero otherwise
+ * @details The buffer is a stream of containers of container_bits bits each;
+ * sample j is container offset + j * stride.  With 8, 16, 24, or 32 container
+ * bits, containers are words of that many bytes; otherwise they are packed
+ * back to back, e.g. two 12-bit samples in three bytes.  Samples are decoded
+ * a block at a time, without an intermediate array, and the result is
+ * identical to gn_hist32() of the decoded codes.  See gn_raw_sample_count()
+ * for the number of samples in the buffer.
+ */
+__api int gn_hist_raw(
+		uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		const uint8_t *buf, ///< [in] Raw buffer pointer
+		size_t buf_size, ///< [in] Raw buffer size in bytes
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		int container_bits, ///< [in] Bits per container, from n to 32
+		bool left_justified, ///< [in] If true, the code is in the most
+		///< significant container bits
+		bool big_endian, ///< [in] Byte order of words; bit order of packed
+		///< containers
+		GnCodeFormat format, ///< [in] Code format
+		size_t stride, ///< [in] Containers per sample (e.g. channels)
+		size_t offset, ///< [in] Index of the first container (e.g. channel)
+		size_t count, ///< [in] Number of samples, from the first; at most
+		///< gn_raw_sample_count()
+		bool preserve ///< [in] If true, hist is not cleared before computing the
+		///< histogram
+);
+
 /**
  * @brief Compute summary statistics of histogram data
  * @return 0 on success, non-zero otherwise
@@ -569,6 +668,128 @@ gn_inl_analysis(char **rkeys, ///< [out] Result keys array pointer
 		size_t inl_size ///< [in] Input array size
 );
 
+/**
+ * @brief Compute DNL, INL, and their summary statistics from histogram data
+ * @return 0 on success, non-zero otherwise
+ * @details Equivalent to gn_hist_analysis, gn_dnl, gn_dnl_analysis, gn_inl,
+ * and gn_inl_analysis, with identical results, in fewer passes over the
+ * histogram.  The results contain the following key-value pairs (see general
+ * description of
+ * \ref AnalysisRoutines "Analysis Routines").
+ * <table>
+ *   <tr><th> Key                 <th> Description
+ *   <tr><td> hist_sum            <td> Sum of all histogram bins
+ *   <tr><td> hist_first_nz_index <td> First non-zero bin
+ *   <tr><td> hist_last_nz_index  <td> Last non-zero bin
+ *   <tr><td> hist_nz_range       <td> Non-zero bin range
+ *   <tr><td> dnl_min             <td> Minumum DNL value
+ *   <tr><td> dnl_max             <td> Maximum DNL value
+ *   <tr><td> dnl_avg             <td> Average DNL value
+ *   <tr><td> dnl_rms             <td> RMS DNL value
+ *   <tr><td> dnl_min_index       <td> Index of first occurence of minimum DNL
+ *   <tr><td> dnl_max_index       <td> Index of first occurence of maximum DNL
+ *   <tr><td> dnl_first_nm_index  <td> Index of first non-missing code
+ *   <tr><td> dnl_last_nm_index   <td> Index of last non-missing code
+ *   <tr><td> dnl_nm_range        <td> Non-missing code range
+ *   <tr><td> inl_min             <td> Minumum INL value
+ *   <tr><td> inl_max             <td> Maximum INL value
+ *   <tr><td> inl_min_index       <td> Index of first occurence of minimum INL
+ *   <tr><td> inl_max_index       <td> Index of first occurence of maximum INL
+ * </table>
+ */
+__api int gn_linearity_analysis(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		double *dnl, ///< [out] DNL array pointer
+		size_t dnl_size, ///< [in] DNL array size
+		double *inl, ///< [out] INL array pointer
+		size_t inl_size, ///< [in] INL array size
+		const uint64_t *hist, ///< [in] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		GnDnlSignal type, ///< [in] Signal type used to acquire the histogram
+		GnInlLineFit fit ///< [in] Line fit type
+);
+
+/**
+ * @brief Compute the histogram, DNL, INL, and their summary statistics from
+ * 16-bit quantized waveform data
+ * @return 0 on success, non-zero otherwise
+ * @details Equivalent to gn_hist16 followed by gn_linearity_analysis, with
+ * identical results.
+ */
+__api int gn_linearity_analysis16(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		double *dnl, ///< [out] DNL array pointer
+		size_t dnl_size, ///< [in] DNL array size
+		double *inl, ///< [out] INL array pointer
+		size_t inl_size, ///< [in] INL array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		GnCodeFormat format, ///< [in] Code format
+		GnDnlSignal type, ///< [in] Signal type used to acquire the waveform
+		GnInlLineFit fit ///< [in] Line fit type
+);
+
+/**
+ * @brief Compute the histogram, DNL, INL, and their summary statistics from
+ * 32-bit quantized waveform data
+ * @return 0 on success, non-zero otherwise
+ * @details Equivalent to gn_hist32 followed by gn_linearity_analysis, with
+ * identical results.
+ */
+__api int gn_linearity_analysis32(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		double *dnl, ///< [out] DNL array pointer
+		size_t dnl_size, ///< [in] DNL array size
+		double *inl, ///< [out] INL array pointer
+		size_t inl_size, ///< [in] INL array size
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		GnCodeFormat format, ///< [in] Code format
+		GnDnlSignal type, ///< [in] Signal type used to acquire the waveform
+		GnInlLineFit fit ///< [in] Line fit type
+);
+
+/**
+ * @brief Compute the histogram, DNL, INL, and their summary statistics from
+ * 64-bit quantized waveform data
+ * @return 0 on success, non-zero otherwise
+ * @details Equivalent to gn_hist64 followed by gn_linearity_analysis, with
+ * identical results.
+ */
+__api int gn_linearity_analysis64(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		double *dnl, ///< [out] DNL array pointer
+		size_t dnl_size, ///< [in] DNL array size
+		double *inl, ///< [out] INL array pointer
+		size_t inl_size, ///< [in] INL array size
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		GnCodeFormat format, ///< [in] Code format
+		GnDnlSignal type, ///< [in] Signal type used to acquire the waveform
+		GnInlLineFit fit ///< [in] Line fit type
+);
+
 /**
  * \defgroup CodeDensityHelpers Helpers
  * @{
@@ -600,645 +821,1915 @@ __api int gn_code_densityx_size(size_t *size, ///< [out] Output array size
 } // extern "C"
 #endif
 
-/* Fourier Analysis */
+/* Sparse Histograms */
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /**
- * \defgroup FourierAnalysis Fourier Analysis
+ * \defgroup SparseHistogram Sparse Histograms
  * @{
  */
 
 /**
- * @brief Run Fourier analysis and return all results
+ * @brief Create a sparse histogram object for a given resolution and code
+ * format
  * @return 0 on success, non-zero otherwise
- * @details The results contain the following key-value pairs (see general
- * description of
- * \ref AnalysisRoutines "Analysis Routines").
- * <table>
- *   <tr><th> Key                  <th> Description <th> Units <tr><td>
- * signaltype           <td> Signal type: 0=Real, 1=Complex                <td>
- *   <tr><td> nfft                 <td> FFT size <td> <tr><td> datasize <td>
- * Data size                                     <td> <tr><td> fbin <td>
- * Frequency bin size                            <td> Hz <tr><td> fdata <td>
- * Data rate                                     <td> S/s <tr><td> fsample <td>
- * Sample rate                                   <td> S/s <tr><td> fshift <td>
- * Shift frequency                               <td> Hz <tr><td> fsnr <td>
- * Full-scale-to-noise ratio (a.k.a. "SNRFS")    <td> dB <tr><td> snr <td>
- * Signal-to-noise ratio                         <td> dB <tr><td> sinad <td>
- * Signal-to-noise-and-distortion ratio          <td> dB <tr><td> sfdr <td>
- * Spurious-free dynamic range                   <td> dB <tr><td> abn <td>
- * Average bin noise                             <td> dBFS <tr><td> nsd <td>
- * Noise spectral density                        <td> dBFS/Hz <tr><td>
- * carrierindex         <td> Order index of the Carrier tone               <td>
- *   <tr><td> maxspurindex         <td> Order index of the MaxSpur tone <td>
- *   <tr><td> ab_width             <td> Analysis band width <td> Hz <tr><td>
- * ab_i1                <td> Analysis band first index                     <td>
- *   <tr><td> ab_i2                <td> Analysis band last index <td> <tr><td>
- * {PREFIX}_nbins       <td> Number of bins associated with PREFIX         <td>
- *   <tr><td> {PREFIX}_rss         <td> Root-sum-square associated with PREFIX
- * <td> <tr><td> {TONEKEY}:orderindex <td> Tone order index <td> <tr><td>
- * {TONEKEY}:freq       <td> Tone frequency                                <td>
- * Hz <tr><td> {TONEKEY}:ffinal     <td> Tone final frequency <td> Hz <tr><td>
- * {TONEKEY}:fwavg      <td> Tone weighted-average frequency               <td>
- * Hz <tr><td> {TONEKEY}:i1         <td> Tone first index <td> <tr><td>
- * {TONEKEY}:i2         <td> Tone last index                               <td>
- *   <tr><td> {TONEKEY}:nbins      <td> Tone number of bins <td> <tr><td>
- * {TONEKEY}:inband     <td> 0: tone is in-band; 1: tone is out-of-band    <td>
- *   <tr><td> {TONEKEY}:mag        <td> Tone magnitude <td> <tr><td>
- * {TONEKEY}:mag_dbfs   <td> Tone magnitude relative to full-scale         <td>
- * dBFS <tr><td> {TONEKEY}:mag_dbc    <td> Tone magnitude relative to carrier
- * <td> dBc <tr><td> {TONEKEY}:phase      <td> Tone phase <td> rad <tr><td>
- * {TONEKEY}:phase_c    <td> Tone phase relative to carrier                <td>
- * rad
- * </table>
+ * @details A sparse histogram stores counts only for the code range that is
+ * hit, in pages of 32-bit counters, so histograms of 20- to 30-bit codes fit
+ * in memory.  Bins are indexed like the array of gn_hist16().
  */
-__api int gn_fft_analysis(
-		char **rkeys, ///< [out] Result keys array pointer
-		size_t rkeys_size, ///< [in] Result keys array size
-		double *rvalues, ///< [out] Result values array pointer
-		size_t rvalues_size, ///< [in] Result values array size
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		const double *in, ///< [in] Interleaved Re/Im input array pointer
-		size_t in_size, ///< [in] Input array size
-		size_t nfft, ///< [in] FFT size
-		GnFreqAxisType axis_type ///< [in] Frequency axis type
+__api int gn_sh_create(const char *obj_key, ///< [in] Object key
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Run Fourier analysis and return only the requested result keys
+ * @brief Create a sparse histogram object for an explicit code range
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fft_analysis_select(
-		double *rvalues, ///< [out] Result values array pointer
-		size_t rvalues_size, ///< [in] Result values array size
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		const char **rkeys, ///< [in] Result keys array pointer
-		size_t rkeys_size, ///< [in] Result keys array size
-		const double *in, ///< [in] Interleaved Re/Im input array pointer
-		size_t in_size, ///< [in] Input array size
-		size_t nfft, ///< [in] FFT size
-		GnFreqAxisType axis_type ///< [in] Frequency axis type
+__api int gn_sh_createx(const char *obj_key, ///< [in] Object key
+		int64_t min, ///< [in] Min code
+		int64_t max ///< [in] Max code
 );
 
 /**
- * @brief Run Fourier analysis and return a single result by key
+ * @brief Add 16-bit quantized waveform data to a sparse histogram
  * @return 0 on success, non-zero otherwise
+ * @details Codes outside the histogram range are ignored.
  */
-__api int gn_fft_analysis_single(
-		double *rvalue, ///< [out] Result value
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		const char *rkey, ///< [in] Result key
-		const double *in, ///< [in] Interleaved Re/Im input array pointer
-		size_t in_size, ///< [in] Input array size
-		size_t nfft, ///< [in] FFT size
-		GnFreqAxisType axis_type ///< [in] Frequency axis type
+__api int gn_sh_add16(const char *obj_key, ///< [in] Object key
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
 );
 
 /**
- * \defgroup FourierAnalysisConfiguration Configuration
- * @{
- */
-
-/**
- * @brief Set the analysis band center and width in Hz
+ * @brief Add 32-bit quantized waveform data to a sparse histogram
  * @return 0 on success, non-zero otherwise
+ * @details Codes outside the histogram range are ignored.
  */
-__api int gn_fa_analysis_band(const char *obj_key, ///< [in] Object key
-		double center, ///< [in] Analysis band center
-		double width ///< [in] Analysis band width
+__api int gn_sh_add32(const char *obj_key, ///< [in] Object key
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
 );
 
 /**
- * @brief Set the analysis band center and width as expressions
+ * @brief Add 64-bit quantized waveform data to a sparse histogram
  * @return 0 on success, non-zero otherwise
+ * @details Codes outside the histogram range are ignored.
  */
-__api int gn_fa_analysis_band_e(
-		const char *obj_key, ///< [in] Object key
-		const char *center, ///< [in] Analysis band center expression
-		const char *width ///< [in] Analysis band width expression
+__api int gn_sh_add64(const char *obj_key, ///< [in] Object key
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
 );
 
 /**
- * @brief Configure clock sub-harmonic divisors for clock spur identification
+ * @brief Get the counts of a range of bins of a sparse histogram
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_clk(
-		const char *obj_key, ///< [in] Object key
-		const int *clk, ///< [in] Pointer to array of clock divisors
-		size_t clk_size, ///< [in] Size of array of clock divisors
-		bool as_noise ///< [in] If true, CLK components will be treated as noise
+__api int gn_sh_get(uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		size_t first, ///< [in] Index of first bin
+		const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Enable or disable the converter offset component
+ * @brief Clear all counts of a sparse histogram
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_fa_conv_offset(const char *obj_key, ///< [in] Object key
-		bool enable ///< [in] If true, enable converter offset
+__api int gn_sh_reset(const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Create a new Fourier analysis configuration object
+ * @brief Compute DNL from a sparse histogram
  * @return 0 on success, non-zero otherwise
+ * @details DNL is computed for bins [first, last], the first and last non-zero
+ * bins (see gn_sh_nz_range()), and is identical to those bins of gn_dnl() on
+ * the equivalent dense histogram.  The histogram must have a non-zero bin.
  */
-__api int gn_fa_create(const char *obj_key ///< [in] Object key
+__api int gn_sh_dnl(double *dnl, ///< [out] Output array pointer
+		size_t dnl_size, ///< [in] Output array size (last - first + 1)
+		const char *obj_key, ///< [in] Object key
+		GnDnlSignal type ///< [in] Signal type
 );
 
 /**
- * @brief Set whether DC is classified as distortion or noise
+ * @brief Compute summary statistics of a sparse histogram
  * @return 0 on success, non-zero otherwise
+ * @details The results are the sum, the first and last non-zero bins (see
+ * gn_sh_nz_range()), and the non-zero range, 1 + last - first.
  */
-__api int gn_fa_dc(const char *obj_key, ///< [in] Object key
-		bool as_dist ///< [in] If true, treat DC as distortion
+__api int
+gn_sh_analysis(char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Set the data rate in Hz
- * @return 0 on success, non-zero otherwise
+ * \defgroup SparseHistogramHelpers Helpers
+ * @{
  */
-__api int gn_fa_fdata(const char *obj_key, ///< [in] Object key
-		double f ///< [in] fdata
-);
 
 /**
- * @brief Set the data rate as an expression
+ * @brief Get the first and last non-zero bins of a sparse histogram
  * @return 0 on success, non-zero otherwise
+ * @details If all bins are zero, first and last are the number of bins.
  */
-__api int gn_fa_fdata_e(const char *obj_key, ///< [in] Object key
-		const char *f ///< [in] fdata expression
+__api int gn_sh_nz_range(size_t *first, ///< [out] First non-zero bin
+		size_t *last, ///< [out] Last non-zero bin
+		const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Add a tone component at a fixed frequency in Hz
+ * @brief Get the number of bins of a sparse histogram
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_fixed_tone(const char *obj_key, ///< [in] Object key
-		const char *comp_key, ///< [in] Component key
-		GnFACompTag tag, ///< [in] Tag
-		double freq, ///< [in] Frequency
-		int ssb ///< [in] Number of single-side bins
+__api int gn_sh_size(size_t *size, ///< [out] Number of bins
+		const char *obj_key ///< [in] Object key
 );
 
-/**
+/** @} SparseHistogramHelpers */
+
+/** @} SparseHistogram */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/* Code Density Accumulators */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup CodeDensityAccumulator Code Density Accumulators
+ * @{
+ */
+
+/**
+ * @brief Create a code density accumulator object for a given resolution and
+ * code format
+ * @return 0 on success, non-zero otherwise
+ * @details An accumulator owns a histogram, indexed like the array of
+ * gn_hist16(), to which waveforms are pushed in any number of chunks.  It also
+ * tracks the total and out-of-range sample counts and the smallest and largest
+ * code pushed.  Accumulators filled by separate workers are combined with
+ * gn_cda_merge().
+ */
+__api int gn_cda_create(const char *obj_key, ///< [in] Object key
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Create a code density accumulator object for an explicit code range
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_createx(const char *obj_key, ///< [in] Object key
+		int64_t min, ///< [in] Min code
+		int64_t max ///< [in] Max code
+);
+
+/**
+ * @brief Push 16-bit quantized waveform data to a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_push16(const char *obj_key, ///< [in] Object key
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
+);
+
+/**
+ * @brief Push 32-bit quantized waveform data to a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_push32(const char *obj_key, ///< [in] Object key
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
+);
+
+/**
+ * @brief Push 64-bit quantized waveform data to a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_push64(const char *obj_key, ///< [in] Object key
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
+);
+
+/**
+ * @brief Add the histogram and counts of one code density accumulator to
+ * another
+ * @return 0 on success, non-zero otherwise
+ * @details Both accumulators must have the same code range.
+ */
+__api int gn_cda_merge(const char *obj_key, ///< [in] Object key
+		const char *other_key ///< [in] Key of accumulator to add
+);
+
+/**
+ * @brief Discard all samples pushed to a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_reset(const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Get the histogram of a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_snapshot(uint64_t *hist, ///< [out] Histogram array pointer
+		size_t hist_size, ///< [in] Histogram array size
+		const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Compute summary statistics of a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ * @details The results are those of gn_hist_analysis() on its histogram, but
+ * are computed in constant time.
+ */
+__api int
+gn_cda_analysis(char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *obj_key ///< [in] Object key
+);
+
+/**
+ * \defgroup CodeDensityAccumulatorHelpers Helpers
+ * @{
+ */
+
+/**
+ * @brief Get the sample counts of a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_counts(uint64_t *count, ///< [out] Total samples pushed
+		uint64_t *below, ///< [out] Samples below min code
+		uint64_t *above, ///< [out] Samples above max code
+		const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Get the smallest and largest codes pushed to a code density
+ * accumulator
+ * @return 0 on success, non-zero otherwise
+ * @details If no samples were pushed, min_code is greater than max_code.
+ */
+__api int gn_cda_code_range(int64_t *min_code, ///< [out] Smallest code
+		int64_t *max_code, ///< [out] Largest code
+		const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Get the number of bins of a code density accumulator
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_cda_size(size_t *size, ///< [out] Number of bins
+		const char *obj_key ///< [in] Object key
+);
+
+/** @} CodeDensityAccumulatorHelpers */
+
+/** @} CodeDensityAccumulator */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/* Fourier Analysis */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup FourierAnalysis Fourier Analysis
+ * @{
+ */
+
+/**
+ * @brief Run Fourier analysis and return all results
+ * @return 0 on success, non-zero otherwise
+ * @details The results contain the following key-value pairs (see general
+ * description of
+ * \ref AnalysisRoutines "Analysis Routines").
+ * <table>
+ *   <tr><th> Key                  <th> Description <th> Units <tr><td>
+ * signaltype           <td> Signal type: 0=Real, 1=Complex                <td>
+ *   <tr><td> nfft                 <td> FFT size <td> <tr><td> datasize <td>
+ * Data size                                     <td> <tr><td> fbin <td>
+ * Frequency bin size                            <td> Hz <tr><td> fdata <td>
+ * Data rate                                     <td> S/s <tr><td> fsample <td>
+ * Sample rate                                   <td> S/s <tr><td> fshift <td>
+ * Shift frequency                               <td> Hz <tr><td> fsnr <td>
+ * Full-scale-to-noise ratio (a.k.a. "SNRFS")    <td> dB <tr><td> snr <td>
+ * Signal-to-noise ratio                         <td> dB <tr><td> sinad <td>
+ * Signal-to-noise-and-distortion ratio          <td> dB <tr><td> sfdr <td>
+ * Spurious-free dynamic range                   <td> dB <tr><td> abn <td>
+ * Average bin noise                             <td> dBFS <tr><td> nsd <td>
+ * Noise spectral density                        <td> dBFS/Hz <tr><td>
+ * carrierindex         <td> Order index of the Carrier tone               <td>
+ *   <tr><td> maxspurindex         <td> Order index of the MaxSpur tone <td>
+ *   <tr><td> ab_width             <td> Analysis band width <td> Hz <tr><td>
+ * ab_i1                <td> Analysis band first index                     <td>
+ *   <tr><td> ab_i2                <td> Analysis band last index <td> <tr><td>
+ * {PREFIX}_nbins       <td> Number of bins associated with PREFIX         <td>
+ *   <tr><td> {PREFIX}_rss         <td> Root-sum-square associated with PREFIX
+ * <td> <tr><td> {TONEKEY}:orderindex <td> Tone order index <td> <tr><td>
+ * {TONEKEY}:freq       <td> Tone frequency                                <td>
+ * Hz <tr><td> {TONEKEY}:ffinal     <td> Tone final frequency <td> Hz <tr><td>
+ * {TONEKEY}:fwavg      <td> Tone weighted-average frequency               <td>
+ * Hz <tr><td> {TONEKEY}:i1         <td> Tone first index <td> <tr><td>
+ * {TONEKEY}:i2         <td> Tone last index                               <td>
+ *   <tr><td> {TONEKEY}:nbins      <td> Tone number of bins <td> <tr><td>
+ * {TONEKEY}:inband     <td> 0: tone is in-band; 1: tone is out-of-band    <td>
+ *   <tr><td> {TONEKEY}:mag        <td> Tone magnitude <td> <tr><td>
+ * {TONEKEY}:mag_dbfs   <td> Tone magnitude relative to full-scale         <td>
+ * dBFS <tr><td> {TONEKEY}:mag_dbc    <td> Tone magnitude relative to carrier
+ * <td> dBc <tr><td> {TONEKEY}:phase      <td> Tone phase <td> rad <tr><td>
+ * {TONEKEY}:phase_c    <td> Tone phase relative to carrier                <td>
+ * rad
+ * </table>
+ */
+__api int gn_fft_analysis(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nfft, ///< [in] FFT size
+		GnFreqAxisType axis_type ///< [in] Frequency axis type
+);
+
+/**
+ * @brief Run Fourier analysis and return only the requested result keys
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fft_analysis_select(
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		const char **rkeys, ///< [in] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nfft, ///< [in] FFT size
+		GnFreqAxisType axis_type ///< [in] Frequency axis type
+);
+
+/**
+ * @brief Run Fourier analysis and return a single result by key
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fft_analysis_single(
+		double *rvalue, ///< [out] Result value
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		const char *rkey, ///< [in] Result key
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nfft, ///< [in] FFT size
+		GnFreqAxisType axis_type ///< [in] Frequency axis type
+);
+
+/**
+ * \defgroup FourierAnalysisConfiguration Configuration
+ * @{
+ */
+
+/**
+ * @brief Set the analysis band center and width in Hz
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_analysis_band(const char *obj_key, ///< [in] Object key
+		double center, ///< [in] Analysis band center
+		double width ///< [in] Analysis band width
+);
+
+/**
+ * @brief Set the analysis band center and width as expressions
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_analysis_band_e(
+		const char *obj_key, ///< [in] Object key
+		const char *center, ///< [in] Analysis band center expression
+		const char *width ///< [in] Analysis band width expression
+);
+
+/**
+ * @brief Configure clock sub-harmonic divisors for clock spur identification
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_clk(
+		const char *obj_key, ///< [in] Object key
+		const int *clk, ///< [in] Pointer to array of clock divisors
+		size_t clk_size, ///< [in] Size of array of clock divisors
+		bool as_noise ///< [in] If true, CLK components will be treated as noise
+);
+
+/**
+ * @brief Enable or disable the converter offset component
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fa_conv_offset(const char *obj_key, ///< [in] Object key
+		bool enable ///< [in] If true, enable converter offset
+);
+
+/**
+ * @brief Create a new Fourier analysis configuration object
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_create(const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Set whether DC is classified as distortion or noise
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_dc(const char *obj_key, ///< [in] Object key
+		bool as_dist ///< [in] If true, treat DC as distortion
+);
+
+/**
+ * @brief Set the data rate in Hz
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fdata(const char *obj_key, ///< [in] Object key
+		double f ///< [in] fdata
+);
+
+/**
+ * @brief Set the data rate as an expression
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fdata_e(const char *obj_key, ///< [in] Object key
+		const char *f ///< [in] fdata expression
+);
+
+/**
+ * @brief Add a tone component at a fixed frequency in Hz
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fixed_tone(const char *obj_key, ///< [in] Object key
+		const char *comp_key, ///< [in] Component key
+		GnFACompTag tag, ///< [in] Tag
+		double freq, ///< [in] Frequency
+		int ssb ///< [in] Number of single-side bins
+);
+
+/**
  * @brief Add a tone component at a fixed frequency specified as an expression
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_fixed_tone_e(const char *obj_key, ///< [in] Object key
-		const char *comp_key, ///< [in] Component key
-		GnFACompTag tag, ///< [in] Tag
-		const char *freq, ///< [in] Frequency expression
-		int ssb ///< [in] Number of single-side bins
+__api int gn_fa_fixed_tone_e(const char *obj_key, ///< [in] Object key
+		const char *comp_key, ///< [in] Component key
+		GnFACompTag tag, ///< [in] Tag
+		const char *freq, ///< [in] Frequency expression
+		int ssb ///< [in] Number of single-side bins
+);
+
+/**
+ * @brief Set the sample rate in Hz
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fsample(const char *obj_key, ///< [in] Object key
+		double f ///< [in] fsample
+);
+
+/**
+ * @brief Set the sample rate as an expression
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fsample_e(const char *obj_key, ///< [in] Object key
+		const char *f ///< [in] fsample expression
+);
+
+/**
+ * @brief Set the shift frequency in Hz
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fshift(const char *obj_key, ///< [in] Object key
+		double f ///< [in] fshift
+);
+
+/**
+ * @brief Set the shift frequency as an expression
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_fshift_e(const char *obj_key, ///< [in] Object key
+		const char *f ///< [in] fshift expression
+);
+
+/**
+ * @brief Enable or disable fundamental image components
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fa_fund_images(const char *obj_key, ///< [in] Object key
+		bool enable ///< [in] If true, enable fundamental images
+);
+
+/**
+ * @brief Set the maximum harmonic distortion order
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_hd(
+		const char *obj_key, ///< [in] Object key
+		int n ///< [in] Order of harmonic distortion, i.e., the maximum harmonic
+);
+
+/**
+ * @brief Configure interleaving factors for interleaving spur identification
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_ilv(
+		const char *obj_key, ///< [in] Object key
+		const int *ilv, ///< [in] Pointer to array of interleaving factors
+		size_t ilv_size, ///< [in] Size of array of interleaving factors
+		bool as_noise ///< [in] If true, ILV components will be treated as noise
+);
+
+/**
+ * @brief Set the maximum intermodulation distortion order
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_imd(const char *obj_key, ///< [in] Object key
+		int n ///< [in] Order of intermodulation distortion
+);
+
+/**
+ * @brief Enable or disable IMD tone results
+ * @return 0 on success, non-zero otherwise
+ * @details If disabled, IMD products are enumerated numerically when the
+ * analysis is compiled, dropped if outside the analysis band, and merged if
+ * they land on the same bins.  They still contribute to the IMD, THD, and
+ * distortion results and to SFDR, but have no tone results.  Use for
+ * configurations with many Signals.
+ */
+__api int gn_fa_imd_tones(const char *obj_key, ///< [in] Object key
+		bool enable ///< [in] If true, report each IMD product as a tone
+);
+
+/**
+ * @brief Load a Fourier analysis configuration from a JSON file
+ * @return 0 on success, non-zero otherwise
+ * @details If obj_key is empty, the object key is derived from filename.
+ */
+__api int gn_fa_load(char *buf, ///< [out] Pointer to character array
+		size_t size, ///< [in] Size of character array
+		const char *filename, ///< [in] Filename
+		const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Add a tone component at the spectral maximum
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_max_tone(const char *obj_key, ///< [in] Object key
+		const char *comp_key, ///< [in] Component key
+		GnFACompTag tag, ///< [in] Tag
+		int ssb ///< [in] Number of single-side bins
+);
+
+/**
+ * @brief Get a string preview of the analysis configuration
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_preview(
+		char *buf, ///< [out] Pointer to character array
+		size_t size, ///< [in] Size of character array
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		bool cplx ///< [in] If true, preview will include complex components
+);
+
+/**
+ * @brief Enable or disable quadrature error components
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fa_quad_errors(const char *obj_key, ///< [in] Object key
+		bool enable ///< [in] If true, enable quadrature errors
+);
+
+/**
+ * @brief Remove a user-defined component from the analysis
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_remove_comp(const char *obj_key, ///< [in] Object key
+		const char *comp_key ///< [in] Component key
+);
+
+/**
+ * @brief Reset a Fourier analysis object to default configuration
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_reset(const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Set the number of single-side bins for a component group
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_ssb(const char *obj_key, ///< [in] Object key
+		GnFASsb group, ///< [in] SSB group
+		int ssb ///< [in] Number of single-side bins
+);
+
+/**
+ * @brief Set the value of an expression variable
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_var(const char *obj_key, ///< [in] Object key
+		const char *name, ///< [in] Variable name
+		double value ///< [in] Variable value
+);
+
+/**
+ * @brief Set the number of worst-other tones to identify
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fa_wo(const char *obj_key, ///< [in] Object key
+		int n ///< [in] Number of worst others
+);
+
+/** @} FourierAnalysisConfiguration */
+
+/**
+ * \defgroup FourierAnalysisResults Results
+ * @{
+ */
+
+/**
+ * @brief Look up a single numeric result by key from analysis results
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fa_result(double *result, ///< [out] Result associated with rkey
+		const char **rkeys, ///< [in] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const double *rvalues, ///< [in] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *rkey ///< [in] Key of desired result
+);
+
+/**
+ * @brief Format a single analysis result as a human-readable string
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fa_result_string(char *result, ///< [out] Result string associated with rkey
+		size_t result_size, ///< [in] Size of result string
+		const char **rkeys, ///< [in] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const double *rvalues, ///< [in] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *rkey ///< [in] Key of desired result
+);
+
+/** @} FourierAnalysisResults */
+
+/**
+ * \defgroup FourierAnalysisHelpers Helpers
+ * @{
+ */
+
+/**
+ * @brief Get the size of the object key string returned by gn_fa_load
+ * @return 0 on success, non-zero otherwise
+ * @details The library string termination setting determines whether or not a
+ * null terminator is included in the size.  See \ref gn_set_string_termination.
+ */
+__api int
+gn_fa_load_key_size(size_t *size, ///< [out] Number of characters in key
+		const char *filename, ///< [in] Filename
+		const char *obj_key ///< [in] Object key
+);
+
+/**
+ * @brief Get the size of the preview string returned by gn_fa_preview
+ * @return 0 on success, non-zero otherwise
+ * @details The library string termination setting determines whether or not a
+ * null terminator is included in the size.  See \ref gn_set_string_termination.
+ */
+__api int gn_fa_preview_size(
+		size_t *size, ///< [out] Number of characters in compenent list string
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		bool cplx ///< [in] If true, list will include complex components
+);
+
+/**
+ * @brief Get the size of the string returned by gn_fa_result_string
+ * @return 0 on success, non-zero otherwise
+ * @details The library string termination setting determines whether or not a
+ * null terminator is included in the size.  See \ref gn_set_string_termination.
+ */
+__api int gn_fa_result_string_size(
+		size_t *size, ///< [out] Number of characters result string
+		const char **rkeys, ///< [in] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const double *rvalues, ///< [in] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *rkey ///< [in] Key of desired result
+);
+
+/**
+ * @brief Get the size of each key string in Fourier analysis results
+ * @return 0 on success, non-zero otherwise
+ * @details The library string termination setting determines whether or not a
+ * null terminator is included in the key sizes.  See \ref
+ * gn_set_string_termination.
+ */
+__api int gn_fft_analysis_results_key_sizes(
+		size_t *key_sizes, ///< [out] Key size array pointer
+		size_t key_sizes_size, ///< [in] Key size array size
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		size_t in_size, ///< [in] Input array size
+		size_t nfft ///< [in] FFT size
+);
+
+/**
+ * @brief Get the number of key-value pairs in Fourier analysis results
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fft_analysis_results_size(
+		size_t *size, ///< [out] Number of key-value result pairs
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		size_t in_size, ///< [in] Input array size
+		size_t nfft ///< [in] FFT size
+);
+
+/** @} FourierAnalysisHelpers */
+
+/** @} FourierAnalysis */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/* Fourier Transforms */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup FourierTransforms Fourier Transforms
+ * @{
+ */
+
+/**
+ * @brief Compute the complex FFT of normalized (double) I/Q data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_fft(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const double *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const double *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window ///< [in] Window
+);
+
+/**
+ * @brief Compute the complex FFT of 16-bit quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fft16(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int16_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the complex FFT of 32-bit quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fft32(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int32_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int32_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the complex FFT of 64-bit quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_fft64(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int64_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int64_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the complex FFT of 16-bit quantized I/Q data in single
+ * precision
+ * @return 0 on success, non-zero otherwise
+ * @details Requires genalyzer to be built with the FFTW float library.
+ */
+__api int
+gn_fft16f(float *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int16_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the real FFT (one-sided spectrum) of normalized (double) data
+ * @return 0 on success, non-zero otherwise
+ * @details This function will be implemented in the future.
+ */
+__api int gn_rfft(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const double *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the real FFT of 16-bit quantized data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_rfft16(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the real FFT of 32-bit quantized data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_rfft32(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the real FFT of 64-bit quantized data
+ * @return 0 on success, non-zero otherwise
+ */
+__api int
+gn_rfft64(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the real FFT of 16-bit quantized data in single precision
+ * @return 0 on success, non-zero otherwise
+ * @details Requires genalyzer to be built with the FFTW float library.
+ */
+__api int
+gn_rfft16f(float *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of normalized (double) I/Q
+ * data
+ * @return 0 on success, non-zero otherwise
+ * @details Same as gn_fft, but the output holds the mean-square magnitude of
+ * each bin (half the gn_fft output size) and the averaged phase is not
+ * computed.  The output matches gn_norm of the gn_fft output, and can be
+ * passed to gn_fft_analysis as is.
+ */
+__api int
+gn_fft_msq(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const double *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const double *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window ///< [in] Window
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of 16-bit quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_msq.
+ */
+__api int
+gn_fft_msq16(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int16_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of 32-bit quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_msq.
+ */
+__api int
+gn_fft_msq32(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int32_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int32_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of 64-bit quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_msq.
+ */
+__api int
+gn_fft_msq64(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int64_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int64_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of normalized (double) real
+ * data
+ * @return 0 on success, non-zero otherwise
+ * @details Same as gn_rfft, but the output holds the mean-square magnitude of
+ * each bin (half the gn_rfft output size); see gn_fft_msq.
+ */
+__api int
+gn_rfft_msq(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const double *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of 16-bit quantized real
+ * data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_rfft_msq.
+ */
+__api int
+gn_rfft_msq16(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of 32-bit quantized real
+ * data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_rfft_msq.
+ */
+__api int
+gn_rfft_msq32(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of 64-bit quantized real
+ * data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_rfft_msq.
+ */
+__api int
+gn_rfft_msq64(double *out, ///< [out] Mean-square output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged complex FFTs of several channels of normalized
+ * (double) I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details The input holds nch channels of navg * nfft samples each (twice
+ * that for interleaved I/Q), the first sample of each channel stride elements
+ * after that of the previous one.  The records of all channels are transformed
+ * with one FFTW plan.  Row c of the output, 2 * nfft elements, matches gn_fft
+ * for channel c alone.
+ */
+__api int
+gn_fft_batch(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const double *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const double *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window ///< [in] Window
+);
+
+/**
+ * @brief Compute the averaged complex FFTs of several channels of 16-bit
+ * quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_batch.
+ */
+__api int
+gn_fft_batch16(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int16_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the averaged complex FFTs of several channels of 32-bit
+ * quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_batch.
+ */
+__api int
+gn_fft_batch32(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int32_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int32_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the averaged complex FFTs of several channels of 64-bit
+ * quantized I/Q data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_batch.
+ */
+__api int
+gn_fft_batch64(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int64_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int64_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Compute the averaged real FFTs of several channels of normalized
+ * (double) data
+ * @return 0 on success, non-zero otherwise
+ * @details The input holds nch channels of navg * nfft samples each, the first
+ * sample of each channel stride elements after that of the previous one.  Row
+ * c of the output, (nfft / 2 + 1) * 2 elements, matches gn_rfft for channel c
+ * alone.
+ */
+__api int
+gn_rfft_batch(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const double *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged real FFTs of several channels of 16-bit
+ * quantized data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_rfft_batch.
+ */
+__api int
+gn_rfft_batch16(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged real FFTs of several channels of 32-bit
+ * quantized data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_rfft_batch.
+ */
+__api int
+gn_rfft_batch32(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
+);
+
+/**
+ * @brief Compute the averaged real FFTs of several channels of 64-bit
+ * quantized data
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_rfft_batch.
+ */
+__api int
+gn_rfft_batch64(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nch, ///< [in] Number of channels
+		size_t stride, ///< [in] Channel stride (0 for contiguous channels)
+		int n, ///< [in] Resolution
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnCodeFormat format, ///< [in] Code format
+		GnRfftScale scale ///< [in] Scaling mode
 );
 
 /**
- * @brief Set the sample rate in Hz
+ * @brief Get the FFTW planner effort used for new FFT plans
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_fsample(const char *obj_key, ///< [in] Object key
-		double f ///< [in] fsample
+__api int gn_fft_get_planner(GnFftPlanner *planner ///< [out] Planner effort
 );
 
 /**
- * @brief Set the sample rate as an expression
+ * @brief Set the FFTW planner effort used for new FFT plans
  * @return 0 on success, non-zero otherwise
+ * @details The planner effort is part of the plan cache key.  The default is
+ * GnFftPlannerEstimate.
  */
-__api int gn_fa_fsample_e(const char *obj_key, ///< [in] Object key
-		const char *f ///< [in] fsample expression
+__api int gn_fft_set_planner(GnFftPlanner planner ///< [in] Planner effort
 );
 
 /**
- * @brief Set the shift frequency in Hz
+ * @brief Save accumulated FFTW wisdom to a file
  * @return 0 on success, non-zero otherwise
+ * @details When single-precision FFTs are available, their wisdom is saved to
+ * a second file, filename with ".float" appended.
  */
-__api int gn_fa_fshift(const char *obj_key, ///< [in] Object key
-		double f ///< [in] fshift
+__api int gn_fft_wisdom_export(const char *filename ///< [in] File name
 );
 
 /**
- * @brief Set the shift frequency as an expression
+ * @brief Load FFTW wisdom from a file
  * @return 0 on success, non-zero otherwise
+ * @details When single-precision FFTs are available, their wisdom is also
+ * loaded from filename with ".float" appended, if that file exists.
  */
-__api int gn_fa_fshift_e(const char *obj_key, ///< [in] Object key
-		const char *f ///< [in] fshift expression
+__api int gn_fft_wisdom_import(const char *filename ///< [in] File name
 );
 
 /**
- * @brief Enable or disable fundamental image components
+ * @brief Discard all accumulated FFTW wisdom
  * @return 0 on success, non-zero otherwise
+ * @details Cached plans are kept; only plans created afterwards are affected.
+ * Single-precision wisdom, when available, is discarded too.
  */
-__api int
-gn_fa_fund_images(const char *obj_key, ///< [in] Object key
-		bool enable ///< [in] If true, enable fundamental images
-);
+__api int gn_fft_wisdom_forget();
 
 /**
- * @brief Set the maximum harmonic distortion order
+ * \defgroup FourierTransformHelpers Helpers
+ * @{
+ */
+
+/**
+ * @brief Get the output array size for complex FFT functions
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_hd(
-		const char *obj_key, ///< [in] Object key
-		int n ///< [in] Order of harmonic distortion, i.e., the maximum harmonic
+__api int gn_fft_size(size_t *out_size, ///< [out] Output array size
+		size_t i_size, ///< [in] In-phase input array size
+		size_t q_size, ///< [in] Quadrature input array size
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft ///< [in] FFT size
 );
 
 /**
- * @brief Configure interleaving factors for interleaving spur identification
+ * @brief Get the output array size for real FFT functions
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_ilv(
-		const char *obj_key, ///< [in] Object key
-		const int *ilv, ///< [in] Pointer to array of interleaving factors
-		size_t ilv_size, ///< [in] Size of array of interleaving factors
-		bool as_noise ///< [in] If true, ILV components will be treated as noise
+__api int gn_rfft_size(size_t *out_size, ///< [out] Output array size
+		size_t in_size, ///< [in] Input array size
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft ///< [in] FFT size
 );
 
 /**
- * @brief Set the maximum intermodulation distortion order
+ * @brief Get the output array size for batched complex FFT functions
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_imd(const char *obj_key, ///< [in] Object key
-		int n ///< [in] Order of intermodulation distortion
+__api int gn_fft_batch_size(size_t *out_size, ///< [out] Output array size
+		size_t nch, ///< [in] Number of channels
+		size_t nfft ///< [in] FFT size
 );
 
 /**
- * @brief Load a Fourier analysis configuration from a JSON file
+ * @brief Get the output array size for batched real FFT functions
  * @return 0 on success, non-zero otherwise
- * @details If obj_key is empty, the object key is derived from filename.
  */
-__api int gn_fa_load(char *buf, ///< [out] Pointer to character array
-		size_t size, ///< [in] Size of character array
-		const char *filename, ///< [in] Filename
-		const char *obj_key ///< [in] Object key
+__api int gn_rfft_batch_size(size_t *out_size, ///< [out] Output array size
+		size_t nch, ///< [in] Number of channels
+		size_t nfft ///< [in] FFT size
 );
 
 /**
- * @brief Add a tone component at the spectral maximum
+ * @brief Remove all cached window coefficient tables
+ * @return Always returns 0
+ */
+__api int gn_fft_window_cache_clear();
+
+/**
+ * @brief Get the number of cached window coefficient tables
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_max_tone(const char *obj_key, ///< [in] Object key
-		const char *comp_key, ///< [in] Component key
-		GnFACompTag tag, ///< [in] Tag
-		int ssb ///< [in] Number of single-side bins
+__api int gn_fft_window_cache_size(size_t *size ///< [out] Number of tables
 );
 
 /**
- * @brief Get a string preview of the analysis configuration
+ * @brief Precompute and cache the window coefficient table for an FFT size
  * @return 0 on success, non-zero otherwise
+ * @details Complex FFT functions use the GnRfftScaleNative table.  If genalyzer
+ * is built with the FFTW float library, the single-precision table is warmed
+ * too.
  */
-__api int gn_fa_preview(
-		char *buf, ///< [out] Pointer to character array
-		size_t size, ///< [in] Size of character array
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		bool cplx ///< [in] If true, preview will include complex components
+__api int gn_fft_window_cache_warm(GnWindow window, ///< [in] Window
+		size_t nfft, ///< [in] FFT size
+		GnRfftScale scale ///< [in] Scaling mode
 );
 
+/** @} FourierTransformHelpers */
+
+/** @} FourierTransforms */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/* Spectrum Averager */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
- * @brief Enable or disable quadrature error components
+ * \defgroup SpectrumAverager Spectrum Averager
+ * @{
+ */
+
+/**
+ * @brief Create a complex spectrum averager object
  * @return 0 on success, non-zero otherwise
+ * @details A spectrum averager accepts records one at a time, or in chunks of
+ * whole records, and keeps only running per-bin sums.  The averaged spectrum
+ * matches gn_fft with navg equal to the number of records added.
  */
-__api int
-gn_fa_quad_errors(const char *obj_key, ///< [in] Object key
-		bool enable ///< [in] If true, enable quadrature errors
+__api int gn_sa_create(const char *obj_key, ///< [in] Object key
+		size_t nfft, ///< [in] FFT size
+		GnWindow window ///< [in] Window
 );
 
 /**
- * @brief Remove a user-defined component from the analysis
+ * @brief Create a real spectrum averager object
  * @return 0 on success, non-zero otherwise
+ * @details The averaged spectrum matches gn_rfft with navg equal to the number
+ * of records added.
  */
-__api int gn_fa_remove_comp(const char *obj_key, ///< [in] Object key
-		const char *comp_key ///< [in] Component key
+__api int gn_sa_rcreate(const char *obj_key, ///< [in] Object key
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnRfftScale scale ///< [in] Scaling mode
 );
 
 /**
- * @brief Reset a Fourier analysis object to default configuration
+ * @brief Add records of normalized (double) I/Q data to a complex spectrum
+ * averager
  * @return 0 on success, non-zero otherwise
+ * @details The input size must be a multiple of the FFT size.
  */
-__api int gn_fa_reset(const char *obj_key ///< [in] Object key
+__api int gn_sa_add(const char *obj_key, ///< [in] Object key
+		const double *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const double *q, ///< [in] Quadrature input array pointer
+		size_t q_size ///< [in] Quadrature input array size
 );
 
 /**
- * @brief Set the number of single-side bins for a component group
+ * @brief Add records of 16-bit quantized I/Q data to a complex spectrum
+ * averager
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_ssb(const char *obj_key, ///< [in] Object key
-		GnFASsb group, ///< [in] SSB group
-		int ssb ///< [in] Number of single-side bins
+__api int gn_sa_add16(const char *obj_key, ///< [in] Object key
+		const int16_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int16_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Set the value of an expression variable
+ * @brief Add records of 32-bit quantized I/Q data to a complex spectrum
+ * averager
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_var(const char *obj_key, ///< [in] Object key
-		const char *name, ///< [in] Variable name
-		double value ///< [in] Variable value
+__api int gn_sa_add32(const char *obj_key, ///< [in] Object key
+		const int32_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int32_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Set the number of worst-other tones to identify
+ * @brief Add records of 64-bit quantized I/Q data to a complex spectrum
+ * averager
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fa_wo(const char *obj_key, ///< [in] Object key
-		int n ///< [in] Number of worst others
+__api int gn_sa_add64(const char *obj_key, ///< [in] Object key
+		const int64_t *i, ///< [in] In-phase input array pointer
+		size_t i_size, ///< [in] In-phase input array size
+		const int64_t *q, ///< [in] Quadrature input array pointer
+		size_t q_size, ///< [in] Quadrature input array size
+		int n, ///< [in] Resolution
+		GnCodeFormat format ///< [in] Code format
 );
 
-/** @} FourierAnalysisConfiguration */
-
 /**
- * \defgroup FourierAnalysisResults Results
- * @{
+ * @brief Add records of normalized (double) data to a real spectrum averager
+ * @return 0 on success, non-zero otherwise
+ * @details The input size must be a multiple of the FFT size.
  */
+__api int gn_sa_radd(const char *obj_key, ///< [in] Object key
+		const double *in, ///< [in] Input array pointer
+		size_t in_size ///< [in] Input array size
+);
 
 /**
- * @brief Look up a single numeric result by key from analysis results
+ * @brief Add records of 16-bit quantized data to a real spectrum averager
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_fa_result(double *result, ///< [out] Result associated with rkey
-		const char **rkeys, ///< [in] Result keys array pointer
-		size_t rkeys_size, ///< [in] Result keys array size
-		const double *rvalues, ///< [in] Result values array pointer
-		size_t rvalues_size, ///< [in] Result values array size
-		const char *rkey ///< [in] Key of desired result
+__api int gn_sa_radd16(const char *obj_key, ///< [in] Object key
+		const int16_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Format a single analysis result as a human-readable string
+ * @brief Add records of 32-bit quantized data to a real spectrum averager
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_fa_result_string(char *result, ///< [out] Result string associated with rkey
-		size_t result_size, ///< [in] Size of result string
-		const char **rkeys, ///< [in] Result keys array pointer
-		size_t rkeys_size, ///< [in] Result keys array size
-		const double *rvalues, ///< [in] Result values array pointer
-		size_t rvalues_size, ///< [in] Result values array size
-		const char *rkey ///< [in] Key of desired result
+__api int gn_sa_radd32(const char *obj_key, ///< [in] Object key
+		const int32_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		GnCodeFormat format ///< [in] Code format
 );
 
-/** @} FourierAnalysisResults */
-
 /**
- * \defgroup FourierAnalysisHelpers Helpers
- * @{
+ * @brief Add records of 64-bit quantized data to a real spectrum averager
+ * @return 0 on success, non-zero otherwise
  */
+__api int gn_sa_radd64(const char *obj_key, ///< [in] Object key
+		const int64_t *in, ///< [in] Input array pointer
+		size_t in_size, ///< [in] Input array size
+		int n, ///< [in] Resolution
+		GnCodeFormat format ///< [in] Code format
+);
 
 /**
- * @brief Get the size of the object key string returned by gn_fa_load
+ * @brief Get the averaged spectrum of all records added so far
  * @return 0 on success, non-zero otherwise
- * @details The library string termination setting determines whether or not a
- * null terminator is included in the size.  See \ref gn_set_string_termination.
  */
-__api int
-gn_fa_load_key_size(size_t *size, ///< [out] Number of characters in key
-		const char *filename, ///< [in] Filename
+__api int gn_sa_get(double *out, ///< [out] Interleaved Re/Im output array pointer
+		size_t out_size, ///< [in] Output array size
 		const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Get the size of the preview string returned by gn_fa_preview
+ * @brief Discard all records added to a spectrum averager
  * @return 0 on success, non-zero otherwise
- * @details The library string termination setting determines whether or not a
- * null terminator is included in the size.  See \ref gn_set_string_termination.
  */
-__api int gn_fa_preview_size(
-		size_t *size, ///< [out] Number of characters in compenent list string
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		bool cplx ///< [in] If true, list will include complex components
+__api int gn_sa_reset(const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Get the size of the string returned by gn_fa_result_string
- * @return 0 on success, non-zero otherwise
- * @details The library string termination setting determines whether or not a
- * null terminator is included in the size.  See \ref gn_set_string_termination.
+ * \defgroup SpectrumAveragerHelpers Helpers
+ * @{
  */
-__api int gn_fa_result_string_size(
-		size_t *size, ///< [out] Number of characters result string
-		const char **rkeys, ///< [in] Result keys array pointer
-		size_t rkeys_size, ///< [in] Result keys array size
-		const double *rvalues, ///< [in] Result values array pointer
-		size_t rvalues_size, ///< [in] Result values array size
-		const char *rkey ///< [in] Key of desired result
-);
 
 /**
- * @brief Get the size of each key string in Fourier analysis results
+ * @brief Get the number of records added to a spectrum averager
  * @return 0 on success, non-zero otherwise
- * @details The library string termination setting determines whether or not a
- * null terminator is included in the key sizes.  See \ref
- * gn_set_string_termination.
  */
-__api int gn_fft_analysis_results_key_sizes(
-		size_t *key_sizes, ///< [out] Key size array pointer
-		size_t key_sizes_size, ///< [in] Key size array size
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		size_t in_size, ///< [in] Input array size
-		size_t nfft ///< [in] FFT size
+__api int gn_sa_count(size_t *count, ///< [out] Number of records
+		const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Get the number of key-value pairs in Fourier analysis results
+ * @brief Get the output array size for gn_sa_get
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fft_analysis_results_size(
-		size_t *size, ///< [out] Number of key-value result pairs
-		const char *
-				cfg_id, ///< [in] Configuration identifier (filename or object key)
-		size_t in_size, ///< [in] Input array size
-		size_t nfft ///< [in] FFT size
+__api int gn_sa_size(size_t *out_size, ///< [out] Output array size
+		const char *obj_key ///< [in] Object key
 );
 
-/** @} FourierAnalysisHelpers */
+/** @} SpectrumAveragerHelpers */
 
-/** @} FourierAnalysis */
+/** @} SpectrumAverager */
 
 #ifdef __cplusplus
 } // extern "C"
 #endif
 
-/* Fourier Transforms */
+/* FFT Contexts */
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /**
- * \defgroup FourierTransforms Fourier Transforms
- * @{
+ * \defgroup FftContexts FFT Contexts
+ * @{
+ */
+
+/**
+ * @brief Create a complex FFT context object
+ * @return 0 on success, non-zero otherwise
+ * @details An FFT context owns the aligned work array that gn_fft allocates
+ * on every averaged call, sized for a fixed navg, nfft, and window.  Repeated
+ * gn_fc_fft calls reuse it and perform no heap allocation when FFTs run on a
+ * single thread.  Results match gn_fft.  Free the context with gn_mgr_remove.
+ */
+__api int gn_fc_create(const char *obj_key, ///< [in] Object key
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window ///< [in] Window
+);
+
+/**
+ * @brief Create a real FFT context object
+ * @return 0 on success, non-zero otherwise
+ * @details Results of gn_fc_rfft match gn_rfft.
  */
+__api int gn_fc_rcreate(const char *obj_key, ///< [in] Object key
+		size_t navg, ///< [in] FFT averaging number
+		size_t nfft, ///< [in] FFT size
+		GnWindow window, ///< [in] Window
+		GnRfftScale scale ///< [in] Scaling mode
+);
 
 /**
- * @brief Compute the complex FFT of normalized (double) I/Q data
+ * @brief Compute the complex FFT of normalized (double) I/Q data using an FFT
+ * context
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fft(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_fft(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const double *i, ///< [in] In-phase input array pointer
 		size_t i_size, ///< [in] In-phase input array size
 		const double *q, ///< [in] Quadrature input array pointer
-		size_t q_size, ///< [in] Quadrature input array size
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window ///< [in] Window
+		size_t q_size ///< [in] Quadrature input array size
 );
 
 /**
- * @brief Compute the complex FFT of 16-bit quantized I/Q data
+ * @brief Compute the complex FFT of 16-bit quantized I/Q data using an FFT
+ * context
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_fft16(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_fft16(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const int16_t *i, ///< [in] In-phase input array pointer
 		size_t i_size, ///< [in] In-phase input array size
 		const int16_t *q, ///< [in] Quadrature input array pointer
 		size_t q_size, ///< [in] Quadrature input array size
 		int n, ///< [in] Resolution
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window, ///< [in] Window
 		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Compute the complex FFT of 32-bit quantized I/Q data
+ * @brief Compute the complex FFT of 32-bit quantized I/Q data using an FFT
+ * context
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_fft32(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_fft32(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const int32_t *i, ///< [in] In-phase input array pointer
 		size_t i_size, ///< [in] In-phase input array size
 		const int32_t *q, ///< [in] Quadrature input array pointer
 		size_t q_size, ///< [in] Quadrature input array size
 		int n, ///< [in] Resolution
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window, ///< [in] Window
 		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Compute the complex FFT of 64-bit quantized I/Q data
+ * @brief Compute the complex FFT of 64-bit quantized I/Q data using an FFT
+ * context
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_fft64(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_fft64(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const int64_t *i, ///< [in] In-phase input array pointer
 		size_t i_size, ///< [in] In-phase input array size
 		const int64_t *q, ///< [in] Quadrature input array pointer
 		size_t q_size, ///< [in] Quadrature input array size
 		int n, ///< [in] Resolution
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window, ///< [in] Window
 		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Compute the real FFT (one-sided spectrum) of normalized (double) data
+ * @brief Compute the real FFT of normalized (double) data using an FFT context
  * @return 0 on success, non-zero otherwise
- * @details This function will be implemented in the future.
  */
-__api int gn_rfft(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_rfft(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const double *in, ///< [in] Input array pointer
-		size_t in_size, ///< [in] Input array size
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window, ///< [in] Window
-		GnRfftScale scale ///< [in] Scaling mode
+		size_t in_size ///< [in] Input array size
 );
 
 /**
- * @brief Compute the real FFT of 16-bit quantized data
+ * @brief Compute the real FFT of 16-bit quantized data using an FFT context
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_rfft16(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_rfft16(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const int16_t *in, ///< [in] Input array pointer
 		size_t in_size, ///< [in] Input array size
 		int n, ///< [in] Resolution
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window, ///< [in] Window
-		GnCodeFormat format, ///< [in] Code format
-		GnRfftScale scale ///< [in] Scaling mode
+		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Compute the real FFT of 32-bit quantized data
+ * @brief Compute the real FFT of 32-bit quantized data using an FFT context
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_rfft32(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_rfft32(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const int32_t *in, ///< [in] Input array pointer
 		size_t in_size, ///< [in] Input array size
 		int n, ///< [in] Resolution
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft, ///< [in] FFT size
-		GnWindow window, ///< [in] Window
-		GnCodeFormat format, ///< [in] Code format
-		GnRfftScale scale ///< [in] Scaling mode
+		GnCodeFormat format ///< [in] Code format
 );
 
 /**
- * @brief Compute the real FFT of 64-bit quantized data
+ * @brief Compute the real FFT of 64-bit quantized data using an FFT context
  * @return 0 on success, non-zero otherwise
  */
-__api int
-gn_rfft64(double *out, ///< [out] Interleaved Re/Im output array pointer
+__api int gn_fc_rfft64(double *out, ///< [out] Interleaved Re/Im output array pointer
 		size_t out_size, ///< [in] Output array size
+		const char *obj_key, ///< [in] Object key
 		const int64_t *in, ///< [in] Input array pointer
 		size_t in_size, ///< [in] Input array size
 		int n, ///< [in] Resolution
-		size_t navg, ///< [in] FFT averaging number
+		GnCodeFormat format ///< [in] Code format
+);
+
+/**
+ * @brief Create a Fourier analysis context object
+ * @return 0 on success, non-zero otherwise
+ * @details An analysis context keeps the mean-square spectrum and bin masks
+ * built by each analysis, so repeated gn_fft_analysis_ctx and
+ * gn_fft_analysis_select_ctx calls reuse them.  Free the context with
+ * gn_mgr_remove.
+ */
+__api int gn_ac_create(const char *obj_key, ///< [in] Object key
+		size_t nfft ///< [in] FFT size
+);
+
+/**
+ * @brief Run Fourier analysis using an analysis context
+ * @return 0 on success, non-zero otherwise
+ * @details Same as gn_fft_analysis.
+ */
+__api int gn_fft_analysis_ctx(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		const char *ctx_key, ///< [in] Analysis context object key
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nfft, ///< [in] FFT size
+		GnFreqAxisType axis_type ///< [in] Frequency axis type
+);
+
+/**
+ * @brief Run Fourier analysis using an analysis context and return only the
+ * requested result keys
+ * @return 0 on success, non-zero otherwise
+ * @details Same as gn_fft_analysis_select.
+ */
+__api int gn_fft_analysis_select_ctx(
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
+		const char *ctx_key, ///< [in] Analysis context object key
+		const char **rkeys, ///< [in] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t nfft, ///< [in] FFT size
+		GnFreqAxisType axis_type ///< [in] Frequency axis type
+);
+
+/**
+ * @brief Compile a Fourier analysis configuration into an analysis plan
+ * object
+ * @return 0 on success, non-zero otherwise
+ * @details A plan resolves, once, everything in an analysis that does not
+ * depend on the spectrum: the component list, variables, analysis band, and
+ * the bins of fixed components.  gn_fft_analysis_plan then does only the
+ * data-dependent work.  The plan is a snapshot of the configuration; later
+ * changes to it do not affect the plan.  Results match gn_fft_analysis.  Free
+ * the plan with gn_mgr_remove.
+ */
+__api int gn_fa_prepare(const char *plan_key, ///< [in] Plan object key
+		const char *
+				cfg_id, ///< [in] Configuration identifier (filename or object key)
 		size_t nfft, ///< [in] FFT size
+		GnFreqAxisType axis_type, ///< [in] Frequency axis type
+		bool cplx ///< [in] true for complex analysis, false for real analysis
+);
+
+/**
+ * @brief Run Fourier analysis using an analysis plan
+ * @return 0 on success, non-zero otherwise
+ * @details Same as gn_fft_analysis with the plan's configuration, nfft, and
+ * axis type.  Use gn_ap_results_size and gn_ap_results_key_sizes to size the
+ * result arrays.
+ */
+__api int gn_fft_analysis_plan(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *plan_key, ///< [in] Analysis plan object key
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size ///< [in] Input array size
+);
+
+/**
+ * @brief Run Fourier analysis using an analysis plan and return only the
+ * requested result keys
+ * @return 0 on success, non-zero otherwise
+ * @details Same as gn_fft_analysis_select.
+ */
+__api int gn_fft_analysis_select_plan(
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *plan_key, ///< [in] Analysis plan object key
+		const char **rkeys, ///< [in] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const double *in, ///< [in] Interleaved Re/Im input array pointer
+		size_t in_size ///< [in] Input array size
+);
+
+/**
+ * @brief Run Fourier analysis on a batch of spectra using an analysis plan
+ * @return 0 on success, non-zero otherwise
+ * @details The count spectra are stored back to back in in, each in the
+ * format accepted by gn_fft_analysis_plan, and are analyzed on
+ * gn_get_num_threads() threads.  rvalues is filled as a count x K matrix in
+ * row-major order, where K is given by gn_ap_results_size.  Row i holds the
+ * values that gn_fft_analysis_plan returns for spectrum i, and the keys of
+ * the columns are given once by gn_ap_results_keys.
+ */
+__api int gn_fft_analysis_batch(
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size (count * K)
+		const char *plan_key, ///< [in] Analysis plan object key
+		const double *in, ///< [in] Input array pointer (count spectra)
+		size_t in_size, ///< [in] Input array size
+		size_t count ///< [in] Number of spectra
+);
+
+/**
+ * @brief Run Fourier analysis on real time-domain data using an analysis
+ * plan, computing only the spectrum bins of the plan's components
+ * @return 0 on success, non-zero otherwise
+ * @details The plan must be for a real analysis of the whole spectrum, with
+ * no MaxTone or WO components.  The bins of the DC and FixedTone components
+ * are computed directly, and the noise from the total power of the windowed
+ * data.  Results match gn_rfft_msq followed by gn_fft_analysis_plan, up to
+ * floating-point rounding; noise much more than 120 dB below the total power
+ * is not resolved.  Use gn_ap_results_size and gn_ap_results_key_sizes to
+ * size the result arrays.
+ */
+__api int gn_fft_analysis_sparse(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const char *plan_key, ///< [in] Analysis plan object key
+		const double *in, ///< [in] Real time-domain input array pointer
+		size_t in_size, ///< [in] Input array size
+		size_t navg, ///< [in] FFT averaging number
 		GnWindow window, ///< [in] Window
-		GnCodeFormat format, ///< [in] Code format
 		GnRfftScale scale ///< [in] Scaling mode
 );
 
 /**
- * \defgroup FourierTransformHelpers Helpers
+ * \defgroup FftContextHelpers Helpers
  * @{
  */
 
 /**
- * @brief Get the output array size for complex FFT functions
+ * @brief Get the output array size for gn_fc_fft and gn_fc_rfft
  * @return 0 on success, non-zero otherwise
  */
-__api int gn_fft_size(size_t *out_size, ///< [out] Output array size
-		size_t i_size, ///< [in] In-phase input array size
-		size_t q_size, ///< [in] Quadrature input array size
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft ///< [in] FFT size
+__api int gn_fc_size(size_t *out_size, ///< [out] Output array size
+		const char *obj_key ///< [in] Object key
 );
 
 /**
- * @brief Get the output array size for real FFT functions
+ * @brief Get the size of each key string in the results of an analysis plan
  * @return 0 on success, non-zero otherwise
+ * @details See gn_fft_analysis_results_key_sizes.
  */
-__api int gn_rfft_size(size_t *out_size, ///< [out] Output array size
-		size_t in_size, ///< [in] Input array size
-		size_t navg, ///< [in] FFT averaging number
-		size_t nfft ///< [in] FFT size
+__api int gn_ap_results_key_sizes(
+		size_t *key_sizes, ///< [out] Key size array pointer
+		size_t key_sizes_size, ///< [in] Key size array size
+		const char *plan_key ///< [in] Analysis plan object key
 );
 
-/** @} FourierTransformHelpers */
+/**
+ * @brief Get the result keys of an analysis plan
+ * @return 0 on success, non-zero otherwise
+ * @details The keys are in the order of the values returned by
+ * gn_fft_analysis_plan and of the columns returned by gn_fft_analysis_batch.
+ * Use gn_ap_results_size and gn_ap_results_key_sizes to size the array.
+ */
+__api int gn_ap_results_keys(
+		char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		const char *plan_key ///< [in] Analysis plan object key
+);
 
-/** @} FourierTransforms */
+/**
+ * @brief Get the number of key-value pairs in the results of an analysis plan
+ * @return 0 on success, non-zero otherwise
+ */
+__api int gn_ap_results_size(
+		size_t *size, ///< [out] Number of key-value result pairs
+		const char *plan_key ///< [in] Analysis plan object key
+);
+
+/** @} FftContextHelpers */
+
+/** @} FftContexts */
 
 #ifdef __cplusplus
 } // extern "C"
@@ -1616,6 +3107,29 @@ __api int gn_normalize64(double *out, ///< [out] Output array pointer
 		GnCodeFormat format ///< [in] Code format
 );
 
+/**
+ * @brief Convert raw ADC samples to normalized floating-point values
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_hist_raw() for the raw sample format.  Samples are decoded a
+ * block at a time, without an intermediate array, and the result is identical
+ * to gn_normalize32() of the decoded codes.
+ */
+__api int gn_normalize_raw(double *out, ///< [out] Output array pointer
+		size_t out_size, ///< [in] Output array size, i.e. number of samples,
+		///< from the first; at most gn_raw_sample_count()
+		const uint8_t *buf, ///< [in] Raw buffer pointer
+		size_t buf_size, ///< [in] Raw buffer size in bytes
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		int container_bits, ///< [in] Bits per container, from n to 32
+		bool left_justified, ///< [in] If true, the code is in the most
+		///< significant container bits
+		bool big_endian, ///< [in] Byte order of words; bit order of packed
+		///< containers
+		GnCodeFormat format, ///< [in] Code format
+		size_t stride, ///< [in] Containers per sample (e.g. channels)
+		size_t offset ///< [in] Index of the first container (e.g. channel)
+);
+
 /**
  * @brief Evaluate a polynomial at each element of the input array
  * @return 0 on success, non-zero otherwise
@@ -1695,6 +3209,29 @@ __api int gn_fshift_size(size_t *out_size, ///< [out] Output array size
 		size_t q_size ///< [in] Quadrature input array size
 );
 
+/**
+ * @brief Get the number of samples in a raw buffer
+ * @return 0 on success, non-zero otherwise
+ * @details See gn_hist_raw() for the raw sample format.  The count is inferred
+ * from the buffer size, so pad bits after the last sample count as one more
+ * sample if they fill a whole container, e.g. three 4-bit samples in two bytes
+ * count as four.  This happens only for containers narrower than 8 bits;
+ * callers whose buffers are padded pass the true count to gn_hist_raw() or
+ * gn_normalize_raw().
+ */
+__api int gn_raw_sample_count(size_t *count, ///< [out] Number of samples
+		size_t buf_size, ///< [in] Raw buffer size in bytes
+		int n, ///< [in] Code width (i.e. ADC resolution)
+		int container_bits, ///< [in] Bits per container, from n to 32
+		bool left_justified, ///< [in] If true, the code is in the most
+		///< significant container bits
+		bool big_endian, ///< [in] Byte order of words; bit order of packed
+		///< containers
+		GnCodeFormat format, ///< [in] Code format
+		size_t stride, ///< [in] Containers per sample (e.g. channels)
+		size_t offset ///< [in] Index of the first container (e.g. channel)
+);
+
 /** @} SignalProcessingHelpers */
 
 /** @} SignalProcessing */
@@ -1831,6 +3368,92 @@ gn_wf_analysis64(char **rkeys, ///< [out] Result keys array pointer
 		size_t in_size ///< [in] Waveform array size
 );
 
+/**
+ * @brief Fit a sinewave to normalized (double) data by least squares
+ * @return 0 on success, non-zero otherwise
+ * @details Fits ampl * cos(2 * pi * freq * n / fs + phase) + offset to the
+ * data, as in IEEE Std 1057 / 1241.  With fit_freq false, freq is taken as
+ * exact (three-parameter fit).  With fit_freq true, freq is an initial
+ * estimate, refined by Gauss-Newton iteration (four-parameter fit); it should
+ * be within about fs / in_size of the true frequency.  No window is applied,
+ * and the capture need not be coherent.  The results contain the following
+ * key-value pairs (see general description of
+ * \ref AnalysisRoutines "Analysis Routines").
+ * <table>
+ *   <tr><th> Key        <th> Description
+ *   <tr><td> ampl       <td> Amplitude of the fitted tone
+ *   <tr><td> freq       <td> Frequency of the fitted tone (Hz)
+ *   <tr><td> phase      <td> Phase of the fitted tone at sample 0 (rad)
+ *   <tr><td> offset     <td> DC offset
+ *   <tr><td> resid_rms  <td> RMS of the fit residual
+ *   <tr><td> sinad      <td> SINAD: fitted tone RMS / residual RMS (dB)
+ *   <tr><td> enob       <td> ENOB computed from SINAD (bits)
+ *   <tr><td> iterations <td> Number of four-parameter iterations
+ * </table>
+ */
+__api int
+gn_sine_fit_analysis(char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const double *in, ///< [in] Waveform array pointer
+		size_t in_size, ///< [in] Waveform array size
+		double fs, ///< [in] Sample rate (S/s)
+		double freq, ///< [in] Tone frequency or initial estimate (Hz)
+		bool fit_freq ///< [in] If true, also fit the frequency
+);
+
+/**
+ * @brief Fit a sinewave to 16-bit data by least squares
+ * @return 0 on success, non-zero otherwise
+ * @details See description of \ref gn_sine_fit_analysis.
+ */
+__api int
+gn_sine_fit_analysis16(char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const int16_t *in, ///< [in] Waveform array pointer
+		size_t in_size, ///< [in] Waveform array size
+		double fs, ///< [in] Sample rate (S/s)
+		double freq, ///< [in] Tone frequency or initial estimate (Hz)
+		bool fit_freq ///< [in] If true, also fit the frequency
+);
+
+/**
+ * @brief Fit a sinewave to 32-bit data by least squares
+ * @return 0 on success, non-zero otherwise
+ * @details See description of \ref gn_sine_fit_analysis.
+ */
+__api int
+gn_sine_fit_analysis32(char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const int32_t *in, ///< [in] Waveform array pointer
+		size_t in_size, ///< [in] Waveform array size
+		double fs, ///< [in] Sample rate (S/s)
+		double freq, ///< [in] Tone frequency or initial estimate (Hz)
+		bool fit_freq ///< [in] If true, also fit the frequency
+);
+
+/**
+ * @brief Fit a sinewave to 64-bit data by least squares
+ * @return 0 on success, non-zero otherwise
+ * @details See description of \ref gn_sine_fit_analysis.
+ */
+__api int
+gn_sine_fit_analysis64(char **rkeys, ///< [out] Result keys array pointer
+		size_t rkeys_size, ///< [in] Result keys array size
+		double *rvalues, ///< [out] Result values array pointer
+		size_t rvalues_size, ///< [in] Result values array size
+		const int64_t *in, ///< [in] Waveform array pointer
+		size_t in_size, ///< [in] Waveform array size
+		double fs, ///< [in] Sample rate (S/s)
+		double freq, ///< [in] Tone frequency or initial estimate (Hz)
+		bool fit_freq ///< [in] If true, also fit the frequency
+);
+
 /** @} Waveforms */
 
 #ifdef __cplusplus
@@ -5,14 +5,18 @@
 #define CGENALYZER_PRIVATE_H
 #include "cgenalyzer_simplified_beta.h"
 
+#include <analysis_context.hpp>
+#include <analysis_plan.hpp>
 #include <array_ops.hpp>
 #include <code_density.hpp>
+#include <code_density_accumulator.hpp>
 #include <constants.hpp>
 #include <enum_map.hpp>
 #include <enum_maps.hpp>
 #include <enums.hpp>
 #include <exceptions.hpp>
 #include <expression.hpp>
+#include <fft_context.hpp>
 #include <formatted_data.hpp>
 #include <fourier_analysis.hpp>
 #include <fourier_analysis_comp_mask.hpp>
@@ -23,8 +27,13 @@
 #include <json.hpp>
 #include <manager.hpp>
 #include <object.hpp>
+#include <parallel.hpp>
 #include <processes.hpp>
 #include <reductions.hpp>
+#include <sample_format.hpp>
+#include <sine_fit.hpp>
+#include <sparse_histogram.hpp>
+#include <spectrum_averager.hpp>
 #include <type_aliases.hpp>
 #include <utils.hpp>
 #include <version.hpp>
@@ -123,6 +132,13 @@ void fill_string_buffer(
 		size_t dst_size // Size of destination
 );
 std::string get_object_key_from_filename(const std::string &filename);
+
+inline gn::sample_format make_sample_format(int n, int container_bits,
+		bool left_justified, bool big_endian, GnCodeFormat format,
+		size_t stride, size_t offset) {
+	return gn::sample_format{ n, container_bits, left_justified, big_endian,
+		gn::get_enum<gn::CodeFormat>(format), stride, offset };
+}
 } // namespace util
 
 #ifdef __cplusplus
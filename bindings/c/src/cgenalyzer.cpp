@@ -81,6 +81,12 @@ int gn_analysis_results_key_sizes(size_t *key_sizes, size_t key_sizes_size,
 			case gn::AnalysisType::Waveform:
 				keys = gn::wf_analysis_ordered_keys();
 				break;
+			case gn::AnalysisType::SineFit:
+				keys = gn::sine_fit_analysis_ordered_keys();
+				break;
+			case gn::AnalysisType::Linearity:
+				keys = gn::linearity_analysis_ordered_keys();
+				break;
 			default:
 				throw std::runtime_error("Invalid analysis type");
 		}
@@ -115,6 +121,12 @@ int gn_analysis_results_size(size_t *size, GnAnalysisType type) {
 			case gn::AnalysisType::Waveform:
 				*size = gn::wf_analysis_ordered_keys().size();
 				break;
+			case gn::AnalysisType::SineFit:
+				*size = gn::sine_fit_analysis_ordered_keys().size();
+				break;
+			case gn::AnalysisType::Linearity:
+				*size = gn::linearity_analysis_ordered_keys().size();
+				break;
 			default:
 				throw std::runtime_error("Invalid analysis type");
 		}
@@ -161,6 +173,22 @@ int gn_error_string(char *buf, size_t size) {
 	return gn_success;
 }
 
+int gn_get_num_threads(size_t *num_threads) {
+	try {
+		util::check_pointer(num_threads);
+		*num_threads = gn::get_num_threads();
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_get_num_threads : ",
+				e.what());
+	}
+}
+
+int gn_set_num_threads(size_t num_threads) {
+	gn::set_num_threads(num_threads);
+	return gn_success;
+}
+
 int gn_set_string_termination(bool null_terminated) {
 	util::gn_null_terminate = null_terminated;
 	return gn_success;
@@ -386,6 +414,42 @@ int gn_histx64(uint64_t *hist, size_t hist_size, const int64_t *in,
 	return gn_histx("64", hist, hist_size, in, in_size, min, max, preserve);
 }
 
+int gn_hist16_parallel(uint64_t *hist, size_t hist_size, const int16_t *in,
+		size_t in_size, int n, GnCodeFormat format, bool preserve) {
+	try {
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::hist_parallel(hist, hist_size, in, in_size, n, f, preserve);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_hist16_parallel : ", e.what());
+	}
+}
+
+int gn_histx16_parallel(uint64_t *hist, size_t hist_size, const int16_t *in,
+		size_t in_size, int64_t min, int64_t max, bool preserve) {
+	try {
+		gn::histx_parallel(hist, hist_size, in, in_size, min, max, preserve);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_histx16_parallel : ", e.what());
+	}
+}
+
+int gn_hist_raw(uint64_t *hist, size_t hist_size, const uint8_t *buf,
+		size_t buf_size, int n, int container_bits, bool left_justified,
+		bool big_endian, GnCodeFormat format, size_t stride, size_t offset,
+		size_t count, bool preserve) {
+	try {
+		const gn::sample_format fmt = util::make_sample_format(n,
+				container_bits, left_justified, big_endian, format, stride,
+				offset);
+		gn::hist_raw(hist, hist_size, buf, buf_size, fmt, count, preserve);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_hist_raw : ", e.what());
+	}
+}
+
 int gn_hist_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
 		size_t rvalues_size, const uint64_t *hist,
 		size_t hist_size) {
@@ -462,6 +526,105 @@ int gn_inl_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
 	}
 }
 
+namespace {
+
+// Checks the result containers, then fills them with the results of analysis
+template <typename F>
+void linearity_analysis_results(char **rkeys, size_t rkeys_size,
+		double *rvalues, size_t rvalues_size, F analysis) {
+	util::check_pointer(rkeys);
+	util::check_pointer(rvalues);
+	const std::vector<std::string> &keys =
+			gn::linearity_analysis_ordered_keys();
+	if (keys.size() != rkeys_size) {
+		throw std::runtime_error("Size of result key array is wrong");
+	}
+	if (rvalues_size != rkeys_size) {
+		throw std::runtime_error(
+				"Size of result keys does not match size of result values");
+	}
+	gn::linearity_results_values(rvalues, rvalues_size, analysis());
+	for (size_t i = 0; i < keys.size(); ++i) {
+		const std::string &src = keys[i];
+		char *dst = rkeys[i];
+		size_t dst_size = util::terminated_size(src.size());
+		util::fill_string_buffer(src.data(), src.size(), dst, dst_size);
+	}
+}
+
+template <typename T>
+int gn_linearity_analysis_wf(const char *suffix, char **rkeys,
+		size_t rkeys_size, double *rvalues, size_t rvalues_size,
+		uint64_t *hist, size_t hist_size, double *dnl, size_t dnl_size,
+		double *inl, size_t inl_size, const T *in, size_t in_size, int n,
+		GnCodeFormat format, GnDnlSignal type, GnInlLineFit fit) {
+	try {
+		gn::CodeFormat cf = gn::get_enum<gn::CodeFormat>(format);
+		gn::DnlSignal t = gn::get_enum<gn::DnlSignal>(type);
+		gn::InlLineFit f = gn::get_enum<gn::InlLineFit>(fit);
+		linearity_analysis_results(rkeys, rkeys_size, rvalues, rvalues_size,
+				[&]() {
+					return gn::linearity_analysis(hist, hist_size, dnl,
+							dnl_size, inl, inl_size, in, in_size, n, cf, t, f);
+				});
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_linearity_analysis", suffix,
+				" : ", e.what());
+	}
+}
+
+} // namespace
+
+int gn_linearity_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, double *dnl, size_t dnl_size, double *inl,
+		size_t inl_size, const uint64_t *hist, size_t hist_size,
+		GnDnlSignal type, GnInlLineFit fit) {
+	try {
+		gn::DnlSignal t = gn::get_enum<gn::DnlSignal>(type);
+		gn::InlLineFit f = gn::get_enum<gn::InlLineFit>(fit);
+		linearity_analysis_results(rkeys, rkeys_size, rvalues, rvalues_size,
+				[&]() {
+					return gn::linearity_analysis(dnl, dnl_size, inl,
+							inl_size, hist, hist_size, t, f);
+				});
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_linearity_analysis : ",
+				e.what());
+	}
+}
+
+int gn_linearity_analysis16(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, uint64_t *hist, size_t hist_size, double *dnl,
+		size_t dnl_size, double *inl, size_t inl_size, const int16_t *in,
+		size_t in_size, int n, GnCodeFormat format, GnDnlSignal type,
+		GnInlLineFit fit) {
+	return gn_linearity_analysis_wf("16", rkeys, rkeys_size, rvalues,
+			rvalues_size, hist, hist_size, dnl, dnl_size, inl, inl_size, in,
+			in_size, n, format, type, fit);
+}
+
+int gn_linearity_analysis32(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, uint64_t *hist, size_t hist_size, double *dnl,
+		size_t dnl_size, double *inl, size_t inl_size, const int32_t *in,
+		size_t in_size, int n, GnCodeFormat format, GnDnlSignal type,
+		GnInlLineFit fit) {
+	return gn_linearity_analysis_wf("32", rkeys, rkeys_size, rvalues,
+			rvalues_size, hist, hist_size, dnl, dnl_size, inl, inl_size, in,
+			in_size, n, format, type, fit);
+}
+
+int gn_linearity_analysis64(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, uint64_t *hist, size_t hist_size, double *dnl,
+		size_t dnl_size, double *inl, size_t inl_size, const int64_t *in,
+		size_t in_size, int n, GnCodeFormat format, GnDnlSignal type,
+		GnInlLineFit fit) {
+	return gn_linearity_analysis_wf("64", rkeys, rkeys_size, rvalues,
+			rvalues_size, hist, hist_size, dnl, dnl_size, inl, inl_size, in,
+			in_size, n, format, type, fit);
+}
+
 /**************************************************************************/
 /* Code Density Helpers                                                   */
 /**************************************************************************/
@@ -492,796 +655,1993 @@ int gn_code_densityx_size(size_t *size, int64_t min, int64_t max) {
 }
 
 /**************************************************************************/
-/* Fourier Analysis                                                       */
+/* Sparse Histograms                                                      */
 /**************************************************************************/
 
 namespace {
 
-using fa_ptr = std::shared_ptr<gn::fourier_analysis>;
+using sh_ptr = std::shared_ptr<gn::sparse_histogram>;
 
-fa_ptr get_fa_object(const std::string &obj_key) {
+sh_ptr get_sh_object(const std::string &obj_key) {
 	gn::object::pointer pobj = gn::manager::get_object(obj_key);
-	const gn::ObjectType obj_type = gn::ObjectType::FourierAnalysis;
+	const gn::ObjectType obj_type = gn::ObjectType::SparseHistogram;
 	if (obj_type != pobj->object_type()) {
 		throw std::runtime_error(
 				"object '" + obj_key + "' is not of type " +
 				gn::object_type_map.at(static_cast<int>(obj_type)));
 	}
-	return std::static_pointer_cast<gn::fourier_analysis>(pobj);
-}
-
-fa_ptr get_fa_object_or_load_from_file(std::string cfg_id) {
-	if (gn::manager::contains(cfg_id)) {
-		return get_fa_object(cfg_id);
-	} else {
-		return gn::fourier_analysis::load(cfg_id);
-	}
-}
-
-size_t get_fa_result_key_index(const char **rkeys, size_t rkeys_size,
-		const char *rkey) {
-	size_t i = 0;
-	for (; i < rkeys_size; ++i) {
-		if (0 == strcmp(rkeys[i], rkey)) {
-			break;
-		}
-	}
-	if (rkeys_size == i) {
-		throw std::runtime_error("Result key '" + std::string(rkey) +
-				"' not found");
-	}
-	return i;
-}
-
-std::string get_fa_result_string(const char **rkeys, size_t rkeys_size,
-		const double *rvalues, size_t rvalues_size,
-		const char *rkey) {
-	if (rkeys_size != rvalues_size) {
-		throw std::runtime_error(
-				"Size of result keys does not match size of result values");
-	}
-	if (gn::fa_result_map.contains(rkey, true)) {
-		gn::FAResult renum =
-				static_cast<gn::FAResult>(gn::fa_result_map.at(rkey));
-		if (gn::FAResult::CarrierIndex == renum ||
-				gn::FAResult::MaxSpurIndex == renum) {
-			// Caller requests the Carrier or MaxSpur tone key.
-			size_t key_index = get_fa_result_key_index(
-					rkeys, rkeys_size, rkey);
-			size_t order_index =
-					static_cast<size_t>(rvalues[key_index]);
-			int order_index_int =
-					static_cast<int>(gn::FAToneResult::OrderIndex);
-			std::string search_str =
-					":" +
-					gn::fa_tone_result_map.at(order_index_int);
-			const char *search_cstr = search_str.c_str();
-			size_t i = 0;
-			for (; i < rvalues_size; ++i) {
-				if (strstr(rkeys[i], search_cstr)) {
-					if (rvalues[i] == order_index) {
-						break;
-					}
-				}
-			}
-			if (rvalues_size == i) {
-				return "Not Found";
-			} else {
-				return gn::fourier_analysis::split_key(rkeys[i])
-						.first;
-			}
-		}
-	} else {
-		// In the future, there could be a string associated with a tone result.
-	}
-	throw std::runtime_error("no string associated with result key '" +
-			std::string(rkey) + "'");
+	return std::static_pointer_cast<gn::sparse_histogram>(pobj);
 }
 
-int get_fa_single_result(const gn::fourier_analysis_results &results,
-		const char *rkey, double *rvalue) {
-	*rvalue = 0.0;
-	std::pair<std::string, std::string> keys =
-			gn::fourier_analysis::split_key(rkey);
-	if (!keys.first.empty()) {
-		if (keys.second.empty()) {
-			if (gn::fa_result_map.contains(keys.first)) {
-				int i = gn::fa_result_map.at(keys.first);
-				*rvalue = results.get(
-						static_cast<gn::FAResult>(i));
-				return gn_success;
-			}
-		} else {
-			if (results.contains_tone(keys.first)) {
-				const gn::fa_tone_results &tres =
-						results.get_tone(keys.first);
-				if (gn::fa_tone_result_map.at(keys.second)) {
-					int i = gn::fa_tone_result_map.at(
-							keys.second);
-					*rvalue = tres.get(
-							static_cast<gn::FAToneResult>(
-									i));
-					return gn_success;
-				}
-			}
-		}
+template <typename T>
+int gn_sh_addxx(const char *suffix, const char *obj_key, const T *in,
+		size_t in_size) {
+	try {
+		get_sh_object(obj_key)->add(in, in_size);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_sh_add", suffix, " : ",
+				e.what());
 	}
-	return gn_failure;
 }
 
 } // namespace
 
-int gn_fft_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
-		size_t rvalues_size, const char *cfg_id, const double *in,
-		size_t in_size, size_t nfft, GnFreqAxisType axis_type) {
+int gn_sh_create(const char *obj_key, int n, GnCodeFormat format) {
 	try {
-		if (rkeys_size != rvalues_size) {
-			throw std::runtime_error(
-					"Size of result keys does not match size of result values");
-		}
-		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
-		gn::fourier_analysis_results results =
-				obj->analyze(in, in_size, nfft, at);
-		// The rest of this function flattens results into a key-array and
-		// value-array pair
-		size_t i = 0; // index for rkeys, rvalues
-		const std::map<gn::FAResult, double> &rmap = results.results;
-		for (int j = 0; j < static_cast<int>(gn::FAResult::__SIZE__);
-				++j) {
-			const std::string &src = gn::fa_result_map.at(j);
-			char *dst = rkeys[i];
-			size_t dst_size = util::terminated_size(src.size());
-			util::fill_string_buffer(src.data(), src.size(), dst,
-					dst_size);
-			rvalues[i] = rmap.at(static_cast<gn::FAResult>(j));
-			i += 1;
-		}
-		for (const std::string &tkey : results.tone_keys) {
-			const gn::fa_tone_results &tone_results =
-					results.get_tone(tkey);
-			const std::map<gn::FAToneResult, double> &trmap =
-					tone_results.results;
-			for (int j = 0;
-					j < static_cast<int>(gn::FAToneResult::__SIZE__);
-					++j) {
-				std::string src =
-						gn::fourier_analysis::flat_tone_key(
-								tkey, j);
-				char *dst = rkeys[i];
-				size_t dst_size =
-						util::terminated_size(src.size());
-				util::fill_string_buffer(src.data(), src.size(),
-						dst, dst_size);
-				rvalues[i] = trmap.at(
-						static_cast<gn::FAToneResult>(j));
-				i += 1;
-			}
-		}
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::manager::add_object(obj_key, gn::sparse_histogram::create(n, f),
+				false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_execute : ", e.what());
+		return util::return_on_exception("gn_sh_create : ", e.what());
 	}
 }
 
-int gn_fft_analysis_select(double *rvalues, size_t rvalues_size,
-		const char *cfg_id, const char **rkeys,
-		size_t rkeys_size, const double *in, size_t in_size,
-		size_t nfft, GnFreqAxisType axis_type) {
+int gn_sh_createx(const char *obj_key, int64_t min, int64_t max) {
 	try {
-		if (rkeys_size != rvalues_size) {
-			throw std::runtime_error(
-					"Size of result keys does not match size of result values");
-		}
-		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
-		gn::fourier_analysis_results results =
-				obj->analyze(in, in_size, nfft, at);
-		std::string missing_keys{};
-		for (size_t i = 0; i < rkeys_size; ++i) {
-			int error = get_fa_single_result(results, rkeys[i],
-					&rvalues[i]);
-			if (error) {
-				if (!missing_keys.empty()) {
-					missing_keys += ", ";
-				}
-				missing_keys.append(
-						"'" + std::string(rkeys[i]) + "'");
-			}
-		}
-		if (!missing_keys.empty()) {
-			throw std::runtime_error("Keys not found: " +
-					missing_keys);
-		}
+		gn::manager::add_object(obj_key,
+				gn::sparse_histogram::create(min, max), false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_execute2 : ", e.what());
+		return util::return_on_exception("gn_sh_createx : ", e.what());
 	}
 }
 
-int gn_fft_analysis_single(double *rvalue, const char *cfg_id, const char *rkey,
-		const double *in, size_t in_size, size_t nfft,
-		GnFreqAxisType axis_type) {
+int gn_sh_add16(const char *obj_key, const int16_t *in, size_t in_size) {
+	return gn_sh_addxx("16", obj_key, in, in_size);
+}
+
+int gn_sh_add32(const char *obj_key, const int32_t *in, size_t in_size) {
+	return gn_sh_addxx("32", obj_key, in, in_size);
+}
+
+int gn_sh_add64(const char *obj_key, const int64_t *in, size_t in_size) {
+	return gn_sh_addxx("64", obj_key, in, in_size);
+}
+
+int gn_sh_get(uint64_t *hist, size_t hist_size, size_t first,
+		const char *obj_key) {
 	try {
-		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
-		gn::fourier_analysis_results results =
-				obj->analyze(in, in_size, nfft, at);
-		int error = get_fa_single_result(results, rkey, rvalue);
-		if (error) {
-			throw std::runtime_error("Key '" + std::string(rkey) +
-					"' not found");
-		}
+		get_sh_object(obj_key)->get(hist, hist_size, first);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_execute1 : ", e.what());
+		return util::return_on_exception("gn_sh_get : ", e.what());
 	}
 }
 
-/**************************************************************************/
-/* Fourier Analysis Configuration                                         */
-/**************************************************************************/
-
-int gn_fa_analysis_band(const char *obj_key, double center, double width) {
+int gn_sh_reset(const char *obj_key) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		std::string center_s = gn::to_string(center, gn::FPFormat::Eng);
-		std::string width_s = gn::to_string(width, gn::FPFormat::Eng);
-		obj->set_analysis_band(center_s, width_s);
+		get_sh_object(obj_key)->reset();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_analysis_band : ",
-				e.what());
+		return util::return_on_exception("gn_sh_reset : ", e.what());
 	}
 }
 
-int gn_fa_analysis_band_e(const char *obj_key, const char *center,
-		const char *width) {
+int gn_sh_dnl(double *dnl, size_t dnl_size, const char *obj_key,
+		GnDnlSignal type) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_analysis_band(center, width);
+		gn::DnlSignal t = gn::get_enum<gn::DnlSignal>(type);
+		gn::dnl(dnl, dnl_size, *get_sh_object(obj_key), t);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_analysis_band_e : ",
-				e.what());
+		return util::return_on_exception("gn_sh_dnl : ", e.what());
+	}
+}
+
+int gn_sh_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, const char *obj_key) {
+	try {
+		util::check_pointer(rkeys);
+		util::check_pointer(rvalues);
+		const std::vector<std::string> &keys =
+				gn::hist_analysis_ordered_keys();
+		if (keys.size() != rkeys_size) {
+			throw std::runtime_error(
+					"Size of result key array is wrong");
+		}
+		if (rvalues_size != rkeys_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		std::map<std::string, double> results =
+				gn::hist_analysis(*get_sh_object(obj_key));
+		for (size_t i = 0; i < keys.size(); ++i) {
+			const std::string &src = keys[i];
+			char *dst = rkeys[i];
+			size_t dst_size = util::terminated_size(src.size());
+			util::fill_string_buffer(src.data(), src.size(), dst,
+					dst_size);
+			rvalues[i] = results.at(src);
+		}
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_sh_analysis : ", e.what());
+	}
+}
+
+/**************************************************************************/
+/* Sparse Histogram Helpers                                               */
+/**************************************************************************/
+
+int gn_sh_nz_range(size_t *first, size_t *last, const char *obj_key) {
+	try {
+		util::check_pointer(first);
+		util::check_pointer(last);
+		const gn::size_p nz = get_sh_object(obj_key)->nz_range();
+		*first = nz.first;
+		*last = nz.second;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_sh_nz_range : ", e.what());
+	}
+}
+
+int gn_sh_size(size_t *size, const char *obj_key) {
+	try {
+		util::check_pointer(size);
+		*size = get_sh_object(obj_key)->size();
+		return gn_success;
+	} catch (const std::exception &e) {
+		*size = 0;
+		return util::return_on_exception("gn_sh_size : ", e.what());
+	}
+}
+
+/**************************************************************************/
+/* Code Density Accumulators                                              */
+/**************************************************************************/
+
+namespace {
+
+using cda_ptr = std::shared_ptr<gn::code_density_accumulator>;
+
+cda_ptr get_cda_object(const std::string &obj_key) {
+	gn::object::pointer pobj = gn::manager::get_object(obj_key);
+	const gn::ObjectType obj_type = gn::ObjectType::CodeDensityAccumulator;
+	if (obj_type != pobj->object_type()) {
+		throw std::runtime_error(
+				"object '" + obj_key + "' is not of type " +
+				gn::object_type_map.at(static_cast<int>(obj_type)));
+	}
+	return std::static_pointer_cast<gn::code_density_accumulator>(pobj);
+}
+
+template <typename T>
+int gn_cda_pushxx(const char *suffix, const char *obj_key, const T *in,
+		size_t in_size) {
+	try {
+		get_cda_object(obj_key)->push(in, in_size);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_push", suffix, " : ",
+				e.what());
+	}
+}
+
+} // namespace
+
+int gn_cda_create(const char *obj_key, int n, GnCodeFormat format) {
+	try {
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::manager::add_object(obj_key,
+				gn::code_density_accumulator::create(n, f), false);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_create : ", e.what());
+	}
+}
+
+int gn_cda_createx(const char *obj_key, int64_t min, int64_t max) {
+	try {
+		gn::manager::add_object(obj_key,
+				gn::code_density_accumulator::create(min, max), false);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_createx : ", e.what());
+	}
+}
+
+int gn_cda_push16(const char *obj_key, const int16_t *in, size_t in_size) {
+	return gn_cda_pushxx("16", obj_key, in, in_size);
+}
+
+int gn_cda_push32(const char *obj_key, const int32_t *in, size_t in_size) {
+	return gn_cda_pushxx("32", obj_key, in, in_size);
+}
+
+int gn_cda_push64(const char *obj_key, const int64_t *in, size_t in_size) {
+	return gn_cda_pushxx("64", obj_key, in, in_size);
+}
+
+int gn_cda_merge(const char *obj_key, const char *other_key) {
+	try {
+		util::check_pointer(other_key);
+		cda_ptr other = get_cda_object(other_key);
+		get_cda_object(obj_key)->merge(*other);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_merge : ", e.what());
+	}
+}
+
+int gn_cda_reset(const char *obj_key) {
+	try {
+		get_cda_object(obj_key)->reset();
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_reset : ", e.what());
+	}
+}
+
+int gn_cda_snapshot(uint64_t *hist, size_t hist_size, const char *obj_key) {
+	try {
+		get_cda_object(obj_key)->snapshot(hist, hist_size);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_snapshot : ", e.what());
+	}
+}
+
+int gn_cda_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, const char *obj_key) {
+	try {
+		util::check_pointer(rkeys);
+		util::check_pointer(rvalues);
+		const std::vector<std::string> &keys =
+				gn::hist_analysis_ordered_keys();
+		if (keys.size() != rkeys_size) {
+			throw std::runtime_error(
+					"Size of result key array is wrong");
+		}
+		if (rvalues_size != rkeys_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		std::map<std::string, double> results =
+				gn::hist_analysis(*get_cda_object(obj_key));
+		for (size_t i = 0; i < keys.size(); ++i) {
+			const std::string &src = keys[i];
+			char *dst = rkeys[i];
+			size_t dst_size = util::terminated_size(src.size());
+			util::fill_string_buffer(src.data(), src.size(), dst,
+					dst_size);
+			rvalues[i] = results.at(src);
+		}
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_analysis : ", e.what());
+	}
+}
+
+/**************************************************************************/
+/* Code Density Accumulator Helpers                                       */
+/**************************************************************************/
+
+int gn_cda_counts(uint64_t *count, uint64_t *below, uint64_t *above,
+		const char *obj_key) {
+	try {
+		util::check_pointer(count);
+		util::check_pointer(below);
+		util::check_pointer(above);
+		cda_ptr obj = get_cda_object(obj_key);
+		*count = obj->count();
+		*below = obj->below();
+		*above = obj->above();
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_counts : ", e.what());
+	}
+}
+
+int gn_cda_code_range(int64_t *min_code, int64_t *max_code,
+		const char *obj_key) {
+	try {
+		util::check_pointer(min_code);
+		util::check_pointer(max_code);
+		cda_ptr obj = get_cda_object(obj_key);
+		*min_code = obj->min_code();
+		*max_code = obj->max_code();
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_cda_code_range : ", e.what());
+	}
+}
+
+int gn_cda_size(size_t *size, const char *obj_key) {
+	try {
+		util::check_pointer(size);
+		*size = get_cda_object(obj_key)->size();
+		return gn_success;
+	} catch (const std::exception &e) {
+		*size = 0;
+		return util::return_on_exception("gn_cda_size : ", e.what());
+	}
+}
+
+/**************************************************************************/
+/* Fourier Analysis                                                       */
+/**************************************************************************/
+
+namespace {
+
+using fa_ptr = std::shared_ptr<gn::fourier_analysis>;
+
+fa_ptr get_fa_object(const std::string &obj_key) {
+	gn::object::pointer pobj = gn::manager::get_object(obj_key);
+	const gn::ObjectType obj_type = gn::ObjectType::FourierAnalysis;
+	if (obj_type != pobj->object_type()) {
+		throw std::runtime_error(
+				"object '" + obj_key + "' is not of type " +
+				gn::object_type_map.at(static_cast<int>(obj_type)));
+	}
+	return std::static_pointer_cast<gn::fourier_analysis>(pobj);
+}
+
+fa_ptr get_fa_object_or_load_from_file(std::string cfg_id) {
+	if (gn::manager::contains(cfg_id)) {
+		return get_fa_object(cfg_id);
+	} else {
+		return gn::fourier_analysis::load(cfg_id);
+	}
+}
+
+size_t get_fa_result_key_index(const char **rkeys, size_t rkeys_size,
+		const char *rkey) {
+	size_t i = 0;
+	for (; i < rkeys_size; ++i) {
+		if (0 == strcmp(rkeys[i], rkey)) {
+			break;
+		}
+	}
+	if (rkeys_size == i) {
+		throw std::runtime_error("Result key '" + std::string(rkey) +
+				"' not found");
+	}
+	return i;
+}
+
+std::string get_fa_result_string(const char **rkeys, size_t rkeys_size,
+		const double *rvalues, size_t rvalues_size,
+		const char *rkey) {
+	if (rkeys_size != rvalues_size) {
+		throw std::runtime_error(
+				"Size of result keys does not match size of result values");
+	}
+	if (gn::fa_result_map.contains(rkey, true)) {
+		gn::FAResult renum =
+				static_cast<gn::FAResult>(gn::fa_result_map.at(rkey));
+		if (gn::FAResult::CarrierIndex == renum ||
+				gn::FAResult::MaxSpurIndex == renum) {
+			// Caller requests the Carrier or MaxSpur tone key.
+			size_t key_index = get_fa_result_key_index(
+					rkeys, rkeys_size, rkey);
+			size_t order_index =
+					static_cast<size_t>(rvalues[key_index]);
+			int order_index_int =
+					static_cast<int>(gn::FAToneResult::OrderIndex);
+			std::string search_str =
+					":" +
+					gn::fa_tone_result_map.at(order_index_int);
+			const char *search_cstr = search_str.c_str();
+			size_t i = 0;
+			for (; i < rvalues_size; ++i) {
+				if (strstr(rkeys[i], search_cstr)) {
+					if (rvalues[i] == order_index) {
+						break;
+					}
+				}
+			}
+			if (rvalues_size == i) {
+				return "Not Found";
+			} else {
+				return gn::fourier_analysis::split_key(rkeys[i])
+						.first;
+			}
+		}
+	} else {
+		// In the future, there could be a string associated with a tone result.
+	}
+	throw std::runtime_error("no string associated with result key '" +
+			std::string(rkey) + "'");
+}
+
+int get_fa_single_result(const gn::fourier_analysis_results &results,
+		const char *rkey, double *rvalue) {
+	*rvalue = 0.0;
+	std::pair<std::string, std::string> keys =
+			gn::fourier_analysis::split_key(rkey);
+	if (!keys.first.empty()) {
+		if (keys.second.empty()) {
+			if (gn::fa_result_map.contains(keys.first)) {
+				int i = gn::fa_result_map.at(keys.first);
+				*rvalue = results.get(
+						static_cast<gn::FAResult>(i));
+				return gn_success;
+			}
+		} else {
+			size_t t = results.tone_index(keys.first);
+			if (t < results.tone_count()) {
+				if (gn::fa_tone_result_map.at(keys.second)) {
+					int i = gn::fa_tone_result_map.at(
+							keys.second);
+					*rvalue = results.get_tone(t,
+							static_cast<gn::FAToneResult>(
+									i));
+					return gn_success;
+				}
+			}
+		}
+	}
+	return gn_failure;
+}
+
+// Flattens results into a key-array and value-array pair
+void flatten_fa_results(const gn::fourier_analysis_results &results,
+		char **rkeys, double *rvalues) {
+	size_t i = 0; // index for rkeys, rvalues
+	for (int j = 0; j < static_cast<int>(gn::FAResult::__SIZE__);
+			++j) {
+		const std::string &src = gn::fa_result_map.at(j);
+		char *dst = rkeys[i];
+		size_t dst_size = util::terminated_size(src.size());
+		util::fill_string_buffer(src.data(), src.size(), dst,
+				dst_size);
+		rvalues[i] = results.get(static_cast<gn::FAResult>(j));
+		i += 1;
+	}
+	for (size_t t = 0; t < results.tone_count(); ++t) {
+		const std::string &tkey = results.tone_keys[t];
+		for (int j = 0;
+				j < static_cast<int>(gn::FAToneResult::__SIZE__);
+				++j) {
+			std::string src =
+					gn::fourier_analysis::flat_tone_key(
+							tkey, j);
+			char *dst = rkeys[i];
+			size_t dst_size =
+					util::terminated_size(src.size());
+			util::fill_string_buffer(src.data(), src.size(),
+					dst, dst_size);
+			rvalues[i] = results.get_tone(t,
+					static_cast<gn::FAToneResult>(j));
+			i += 1;
+		}
+	}
+}
+
+void select_fa_results(const gn::fourier_analysis_results &results,
+		const char **rkeys, size_t rkeys_size, double *rvalues) {
+	std::string missing_keys{};
+	for (size_t i = 0; i < rkeys_size; ++i) {
+		int error = get_fa_single_result(results, rkeys[i],
+				&rvalues[i]);
+		if (error) {
+			if (!missing_keys.empty()) {
+				missing_keys += ", ";
+			}
+			missing_keys.append(
+					"'" + std::string(rkeys[i]) + "'");
+		}
+	}
+	if (!missing_keys.empty()) {
+		throw std::runtime_error("Keys not found: " +
+				missing_keys);
+	}
+}
+
+} // namespace
+
+int gn_fft_analysis(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, const char *cfg_id, const double *in,
+		size_t in_size, size_t nfft, GnFreqAxisType axis_type) {
+	try {
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
+		gn::fourier_analysis_results results =
+				obj->analyze(in, in_size, nfft, at);
+		flatten_fa_results(results, rkeys, rvalues);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_execute : ", e.what());
+	}
+}
+
+int gn_fft_analysis_select(double *rvalues, size_t rvalues_size,
+		const char *cfg_id, const char **rkeys,
+		size_t rkeys_size, const double *in, size_t in_size,
+		size_t nfft, GnFreqAxisType axis_type) {
+	try {
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
+		gn::fourier_analysis_results results =
+				obj->analyze(in, in_size, nfft, at);
+		select_fa_results(results, rkeys, rkeys_size, rvalues);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_execute2 : ", e.what());
+	}
+}
+
+int gn_fft_analysis_single(double *rvalue, const char *cfg_id, const char *rkey,
+		const double *in, size_t in_size, size_t nfft,
+		GnFreqAxisType axis_type) {
+	try {
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
+		gn::fourier_analysis_results results =
+				obj->analyze(in, in_size, nfft, at);
+		int error = get_fa_single_result(results, rkey, rvalue);
+		if (error) {
+			throw std::runtime_error("Key '" + std::string(rkey) +
+					"' not found");
+		}
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_execute1 : ", e.what());
+	}
+}
+
+/**************************************************************************/
+/* Fourier Analysis Configuration                                         */
+/**************************************************************************/
+
+int gn_fa_analysis_band(const char *obj_key, double center, double width) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		std::string center_s = gn::to_string(center, gn::FPFormat::Eng);
+		std::string width_s = gn::to_string(width, gn::FPFormat::Eng);
+		obj->set_analysis_band(center_s, width_s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_analysis_band : ",
+				e.what());
+	}
+}
+
+int gn_fa_analysis_band_e(const char *obj_key, const char *center,
+		const char *width) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_analysis_band(center, width);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_analysis_band_e : ",
+				e.what());
 	}
 }
 
 int gn_fa_clk(const char *obj_key, const int *clk, size_t clk_size,
 		bool as_noise) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		std::set<int> clk2(clk, clk + clk_size);
-		obj->set_clk(clk2);
-		obj->clk_as_noise = as_noise;
+		fa_ptr obj = get_fa_object(obj_key);
+		std::set<int> clk2(clk, clk + clk_size);
+		obj->set_clk(clk2);
+		obj->clk_as_noise = as_noise;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_clk : ", e.what());
+	}
+}
+
+int gn_fa_conv_offset(const char *obj_key, bool enable) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->en_conv_offset = enable;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_conv_offset : ",
+				e.what());
+	}
+}
+
+int gn_fa_create(const char *obj_key) {
+	try {
+		gn::manager::add_object(obj_key, gn::fourier_analysis::create(),
+				false);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_create : ", e.what());
+	}
+}
+
+int gn_fa_dc(const char *obj_key, bool as_dist) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->dc_as_dist = as_dist;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_dc : ", e.what());
+	}
+}
+
+int gn_fa_fdata(const char *obj_key, double f) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		std::string f_s = gn::to_string(f, gn::FPFormat::Eng);
+		obj->set_fdata(f_s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fdata : ", e.what());
+	}
+}
+
+int gn_fa_fdata_e(const char *obj_key, const char *f) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_fdata(f);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fdata_e : ", e.what());
+	}
+}
+
+int gn_fa_fixed_tone(const char *obj_key, const char *comp_key, GnFACompTag tag,
+		double freq, int ssb) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		gn::FACompTag t = gn::get_enum<gn::FACompTag>(tag);
+		std::string freq_s = gn::to_string(freq, gn::FPFormat::Eng);
+		obj->add_fixed_tone(comp_key, t, freq_s, ssb);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fixed_tone : ",
+				e.what());
+	}
+}
+
+int gn_fa_fixed_tone_e(const char *obj_key, const char *comp_key,
+		GnFACompTag tag, const char *freq, int ssb) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		gn::FACompTag t = gn::get_enum<gn::FACompTag>(tag);
+		obj->add_fixed_tone(comp_key, t, freq, ssb);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fixed_tone_e : ",
+				e.what());
+	}
+}
+
+int gn_fa_fsample(const char *obj_key, double f) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		std::string f_s = gn::to_string(f, gn::FPFormat::Eng);
+		obj->set_fsample(f_s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fsample : ", e.what());
+	}
+}
+
+int gn_fa_fsample_e(const char *obj_key, const char *f) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_fsample(f);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fsample_e : ",
+				e.what());
+	}
+}
+
+int gn_fa_fshift(const char *obj_key, double f) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		std::string f_s = gn::to_string(f, gn::FPFormat::Eng);
+		obj->set_fshift(f_s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fshift : ", e.what());
+	}
+}
+
+int gn_fa_fshift_e(const char *obj_key, const char *f) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_fshift(f);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fshift_e : ", e.what());
+	}
+}
+
+int gn_fa_fund_images(const char *obj_key, bool enable) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->en_fund_images = enable;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_fund_images : ",
+				e.what());
+	}
+}
+
+int gn_fa_hd(const char *obj_key, int n) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_hd(n);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_hd : ", e.what());
+	}
+}
+
+int gn_fa_ilv(const char *obj_key, const int *ilv, size_t ilv_size,
+		bool as_noise) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		std::set<int> ilv2(ilv, ilv + ilv_size);
+		obj->set_ilv(ilv2);
+		obj->ilv_as_noise = as_noise;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_ilv : ", e.what());
+	}
+}
+
+int gn_fa_imd(const char *obj_key, int n) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_imd(n);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_imd : ", e.what());
+	}
+}
+
+int gn_fa_imd_tones(const char *obj_key, bool enable) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->en_imd_tones = enable;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_imd_tones : ", e.what());
+	}
+}
+
+int gn_fa_load(char *buf, size_t size, const char *filename,
+		const char *obj_key) {
+	try {
+		std::string key(obj_key);
+		if (key.empty()) {
+			key = util::get_object_key_from_filename(filename);
+		}
+		gn::manager::add_object(
+				key, gn::fourier_analysis::load(filename), true);
+		util::fill_string_buffer(key.data(), key.size(), buf, size);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_load : ", e.what());
+	}
+}
+
+int gn_fa_max_tone(const char *obj_key, const char *comp_key, GnFACompTag tag,
+		int ssb) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		gn::FACompTag t = gn::get_enum<gn::FACompTag>(tag);
+		obj->add_max_tone(comp_key, t, "0.0", "fdata", ssb);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_max_tone : ", e.what());
+	}
+}
+
+int gn_fa_preview(char *buf, size_t size, const char *cfg_id, bool cplx) {
+	try {
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		std::string s = obj->preview(cplx);
+		util::fill_string_buffer(s.data(), s.size(), buf, size);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_preview : ", e.what());
+	}
+}
+
+int gn_fa_quad_errors(const char *obj_key, bool enable) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->en_quad_errors = enable;
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_quad_errors : ",
+				e.what());
+	}
+}
+
+int gn_fa_remove_comp(const char *obj_key, const char *comp_key) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->remove_comp(comp_key);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_remove_comp : ",
+				e.what());
+	}
+}
+
+int gn_fa_reset(const char *obj_key) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->reset();
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_reset : ", e.what());
+	}
+}
+
+int gn_fa_ssb(const char *obj_key, GnFASsb group, int ssb) {
+	try {
+		gn::FASsb g = gn::get_enum<gn::FASsb>(group);
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_ssb(g, ssb);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_ssb_dc : ", e.what());
+	}
+}
+
+int gn_fa_var(const char *obj_key, const char *name, double value) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_var(name, value);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_var : ", e.what());
+	}
+}
+
+int gn_fa_wo(const char *obj_key, int n) {
+	try {
+		fa_ptr obj = get_fa_object(obj_key);
+		obj->set_wo(n);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_wo : ", e.what());
+	}
+}
+
+/**************************************************************************/
+/* Fourier Analysis Results                                               */
+/**************************************************************************/
+
+int gn_fa_result(double *result, const char **rkeys, size_t rkeys_size,
+		const double *rvalues, size_t rvalues_size, const char *rkey) {
+	try {
+		util::check_pointer(result);
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		size_t key_index =
+				get_fa_result_key_index(rkeys, rkeys_size, rkey);
+		*result = rvalues[key_index];
+		return gn_success;
+	} catch (const std::exception &e) {
+		*result = 0.0;
+		return util::return_on_exception("gn_fa_result : ", e.what());
+	}
+}
+
+int gn_fa_result_string(char *result, size_t result_size, const char **rkeys,
+		size_t rkeys_size, const double *rvalues,
+		size_t rvalues_size, const char *rkey) {
+	try {
+		util::check_pointer(result);
+		std::string rstr = get_fa_result_string(
+				rkeys, rkeys_size, rvalues, rvalues_size, rkey);
+		util::fill_string_buffer(rstr.data(), rstr.size(), result,
+				result_size);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fa_result_string : ",
+				e.what());
+	}
+}
+
+/**************************************************************************/
+/* Fourier Analysis Helpers                                               */
+/**************************************************************************/
+
+int gn_fa_load_key_size(size_t *size, const char *filename, const char *obj_key) {
+	try {
+		util::check_pointer(size);
+		std::string key(obj_key);
+		if (key.empty()) {
+			key = util::get_object_key_from_filename(filename);
+		}
+		*size = util::terminated_size(key.size());
+		return gn_success;
+	} catch (const std::exception &e) {
+		*size = 0;
+		return util::return_on_exception("gn_fa_load_key_size : ",
+				e.what());
+	}
+}
+
+int gn_fa_preview_size(size_t *size, const char *cfg_id, bool cplx) {
+	try {
+		util::check_pointer(size);
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		std::string s = obj->preview(cplx);
+		*size = util::terminated_size(s.size());
+		return gn_success;
+	} catch (const std::exception &e) {
+		*size = 0;
+		return util::return_on_exception("gn_fa_preview_size : ",
+				e.what());
+	}
+}
+
+int gn_fa_result_string_size(size_t *size, const char **rkeys,
+		size_t rkeys_size, const double *rvalues,
+		size_t rvalues_size, const char *rkey) {
+	try {
+		util::check_pointer(size);
+		std::string rstr = get_fa_result_string(
+				rkeys, rkeys_size, rvalues, rvalues_size, rkey);
+		*size = util::terminated_size(rstr.size());
+		return gn_success;
+	} catch (const std::exception &e) {
+		*size = 0;
+		return util::return_on_exception("gn_fa_result_string_size : ",
+				e.what());
+	}
+}
+
+int gn_fft_analysis_results_key_sizes(size_t *key_sizes, size_t key_sizes_size,
+		const char *cfg_id, size_t in_size,
+		size_t nfft) {
+	try {
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		std::vector<size_t> key_sizes_src =
+				obj->result_key_lengths(in_size, nfft);
+		if (key_sizes_src.size() != key_sizes_size) {
+			throw std::runtime_error(
+					"Number of keys does not match output array size");
+		}
+		for (size_t i = 0; i < key_sizes_size; ++i) {
+			key_sizes[i] = util::terminated_size(key_sizes_src[i]);
+		}
+		return gn_success;
+	} catch (const std::exception &e) {
+		std::fill(key_sizes, key_sizes + key_sizes_size, 0);
+		return util::return_on_exception("gn_fa_results_key_sizes : ",
+				e.what());
+	}
+}
+
+int gn_fft_analysis_results_size(size_t *size, const char *cfg_id,
+		size_t in_size, size_t nfft) {
+	try {
+		util::check_pointer(size);
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		*size = obj->results_size(in_size, nfft);
+		return gn_success;
+	} catch (const std::exception &e) {
+		*size = 0;
+		return util::return_on_exception("gn_fa_results_size : ",
+				e.what());
+	}
+}
+
+/**************************************************************************/
+/* Fourier Transforms                                                     */
+/**************************************************************************/
+
+namespace {
+
+template <typename T, typename R>
+int gn_fftxx(const char *suffix, R *out, size_t out_size, const T *i,
+		size_t i_size, const T *q, size_t q_size, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::fft(i, i_size, q, q_size, out, out_size, n, navg, nfft, w,
+				f);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_clk : ", e.what());
+		return util::return_on_exception("gn_fft", suffix, " : ",
+				e.what());
 	}
 }
 
-int gn_fa_conv_offset(const char *obj_key, bool enable) {
+template <typename T, typename R>
+int gn_rfftxx(const char *suffix, R *out, size_t out_size, const T *in,
+		size_t in_size, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->en_conv_offset = enable;
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::rfft(in, in_size, out, out_size, n, navg, nfft, w, f, s);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_conv_offset : ",
+		return util::return_on_exception("gn_rfft", suffix, " : ",
+				e.what());
+	}
+}
+
+template <typename T>
+int gn_fft_msqxx(const char *suffix, double *out, size_t out_size, const T *i,
+		size_t i_size, const T *q, size_t q_size, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::fft_msq(i, i_size, q, q_size, out, out_size, n, navg, nfft, w,
+				f);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_msq", suffix, " : ",
+				e.what());
+	}
+}
+
+template <typename T>
+int gn_rfft_msqxx(const char *suffix, double *out, size_t out_size,
+		const T *in, size_t in_size, int n, size_t navg, size_t nfft,
+		GnWindow window, GnCodeFormat format, GnRfftScale scale) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::rfft_msq(in, in_size, out, out_size, n, navg, nfft, w, f, s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_rfft_msq", suffix, " : ",
+				e.what());
+	}
+}
+
+template <typename T>
+int gn_fft_batchxx(const char *suffix, double *out, size_t out_size,
+		const T *i, size_t i_size, const T *q, size_t q_size, size_t nch,
+		size_t stride, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::fft_batch(i, i_size, q, q_size, nch, stride, out, out_size, n,
+				navg, nfft, w, f);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_batch", suffix, " : ",
+				e.what());
+	}
+}
+
+template <typename T>
+int gn_rfft_batchxx(const char *suffix, double *out, size_t out_size,
+		const T *in, size_t in_size, size_t nch, size_t stride, int n,
+		size_t navg, size_t nfft, GnWindow window, GnCodeFormat format,
+		GnRfftScale scale) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::rfft_batch(in, in_size, nch, stride, out, out_size, n, navg,
+				nfft, w, f, s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_rfft_batch", suffix, " : ",
+				e.what());
+	}
+}
+
+} // namespace
+
+int gn_fft(double *out, size_t out_size, const double *i, size_t i_size,
+		const double *q, size_t q_size, size_t navg, size_t nfft,
+		GnWindow window) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::fft(i, i_size, q, q_size, out, out_size, navg, nfft, w);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft : ", e.what());
+	}
+}
+
+int gn_fft16(double *out, size_t out_size, const int16_t *i, size_t i_size,
+		const int16_t *q, size_t q_size, int n, size_t navg, size_t nfft,
+		GnWindow window, GnCodeFormat format) {
+	return gn_fftxx("16", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_fft32(double *out, size_t out_size, const int32_t *i, size_t i_size,
+		const int32_t *q, size_t q_size, int n, size_t navg, size_t nfft,
+		GnWindow window, GnCodeFormat format) {
+	return gn_fftxx("32", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_fft64(double *out, size_t out_size, const int64_t *i, size_t i_size,
+		const int64_t *q, size_t q_size, int n, size_t navg, size_t nfft,
+		GnWindow window, GnCodeFormat format) {
+	return gn_fftxx("64", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_fft16f(float *out, size_t out_size, const int16_t *i, size_t i_size,
+		const int16_t *q, size_t q_size, int n, size_t navg, size_t nfft,
+		GnWindow window, GnCodeFormat format) {
+	return gn_fftxx("16f", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_rfft(double *out, size_t out_size, const double *in, size_t in_size,
+		size_t navg, size_t nfft, GnWindow window, GnRfftScale scale) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::rfft(in, in_size, out, out_size, navg, nfft, w, s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_rfft : ", e.what());
+	}
+}
+
+int gn_rfft16(double *out, size_t out_size, const int16_t *in, size_t in_size,
+		int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfftxx("16", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_rfft32(double *out, size_t out_size, const int32_t *in, size_t in_size,
+		int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfftxx("32", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_rfft64(double *out, size_t out_size, const int64_t *in, size_t in_size,
+		int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfftxx("64", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_rfft16f(float *out, size_t out_size, const int16_t *in, size_t in_size,
+		int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfftxx("16f", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_fft_msq(double *out, size_t out_size, const double *i, size_t i_size,
+		const double *q, size_t q_size, size_t navg, size_t nfft,
+		GnWindow window) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::fft_msq(i, i_size, q, q_size, out, out_size, navg, nfft, w);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_msq : ", e.what());
+	}
+}
+
+int gn_fft_msq16(double *out, size_t out_size, const int16_t *i,
+		size_t i_size, const int16_t *q, size_t q_size, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format) {
+	return gn_fft_msqxx("16", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_fft_msq32(double *out, size_t out_size, const int32_t *i,
+		size_t i_size, const int32_t *q, size_t q_size, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format) {
+	return gn_fft_msqxx("32", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_fft_msq64(double *out, size_t out_size, const int64_t *i,
+		size_t i_size, const int64_t *q, size_t q_size, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format) {
+	return gn_fft_msqxx("64", out, out_size, i, i_size, q, q_size, n, navg,
+			nfft, window, format);
+}
+
+int gn_rfft_msq(double *out, size_t out_size, const double *in,
+		size_t in_size, size_t navg, size_t nfft, GnWindow window,
+		GnRfftScale scale) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::rfft_msq(in, in_size, out, out_size, navg, nfft, w, s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_rfft_msq : ", e.what());
+	}
+}
+
+int gn_rfft_msq16(double *out, size_t out_size, const int16_t *in,
+		size_t in_size, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfft_msqxx("16", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_rfft_msq32(double *out, size_t out_size, const int32_t *in,
+		size_t in_size, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfft_msqxx("32", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_rfft_msq64(double *out, size_t out_size, const int64_t *in,
+		size_t in_size, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format, GnRfftScale scale) {
+	return gn_rfft_msqxx("64", out, out_size, in, in_size, n, navg, nfft,
+			window, format, scale);
+}
+
+int gn_fft_batch(double *out, size_t out_size, const double *i,
+		size_t i_size, const double *q, size_t q_size, size_t nch,
+		size_t stride, size_t navg, size_t nfft, GnWindow window) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::fft_batch(i, i_size, q, q_size, nch, stride, out, out_size,
+				navg, nfft, w);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_batch : ", e.what());
+	}
+}
+
+int gn_fft_batch16(double *out, size_t out_size, const int16_t *i,
+		size_t i_size, const int16_t *q, size_t q_size, size_t nch,
+		size_t stride, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format) {
+	return gn_fft_batchxx("16", out, out_size, i, i_size, q, q_size, nch,
+			stride, n, navg, nfft, window, format);
+}
+
+int gn_fft_batch32(double *out, size_t out_size, const int32_t *i,
+		size_t i_size, const int32_t *q, size_t q_size, size_t nch,
+		size_t stride, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format) {
+	return gn_fft_batchxx("32", out, out_size, i, i_size, q, q_size, nch,
+			stride, n, navg, nfft, window, format);
+}
+
+int gn_fft_batch64(double *out, size_t out_size, const int64_t *i,
+		size_t i_size, const int64_t *q, size_t q_size, size_t nch,
+		size_t stride, int n, size_t navg, size_t nfft, GnWindow window,
+		GnCodeFormat format) {
+	return gn_fft_batchxx("64", out, out_size, i, i_size, q, q_size, nch,
+			stride, n, navg, nfft, window, format);
+}
+
+int gn_rfft_batch(double *out, size_t out_size, const double *in,
+		size_t in_size, size_t nch, size_t stride, size_t navg, size_t nfft,
+		GnWindow window, GnRfftScale scale) {
+	try {
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::rfft_batch(in, in_size, nch, stride, out, out_size, navg, nfft,
+				w, s);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_rfft_batch : ", e.what());
+	}
+}
+
+int gn_rfft_batch16(double *out, size_t out_size, const int16_t *in,
+		size_t in_size, size_t nch, size_t stride, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format,
+		GnRfftScale scale) {
+	return gn_rfft_batchxx("16", out, out_size, in, in_size, nch, stride,
+			n, navg, nfft, window, format, scale);
+}
+
+int gn_rfft_batch32(double *out, size_t out_size, const int32_t *in,
+		size_t in_size, size_t nch, size_t stride, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format,
+		GnRfftScale scale) {
+	return gn_rfft_batchxx("32", out, out_size, in, in_size, nch, stride,
+			n, navg, nfft, window, format, scale);
+}
+
+int gn_rfft_batch64(double *out, size_t out_size, const int64_t *in,
+		size_t in_size, size_t nch, size_t stride, int n, size_t navg,
+		size_t nfft, GnWindow window, GnCodeFormat format,
+		GnRfftScale scale) {
+	return gn_rfft_batchxx("64", out, out_size, in, in_size, nch, stride,
+			n, navg, nfft, window, format, scale);
+}
+
+int gn_fft_get_planner(GnFftPlanner *planner) {
+	try {
+		util::check_pointer(planner);
+		*planner = static_cast<GnFftPlanner>(gn::get_fft_planner());
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_get_planner : ",
+				e.what());
+	}
+}
+
+int gn_fft_set_planner(GnFftPlanner planner) {
+	try {
+		gn::FftPlanner p = gn::get_enum<gn::FftPlanner>(planner);
+		gn::set_fft_planner(p);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_set_planner : ",
+				e.what());
+	}
+}
+
+int gn_fft_wisdom_export(const char *filename) {
+	try {
+		util::check_pointer(filename);
+		gn::fft_wisdom_export(filename);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_wisdom_export : ",
+				e.what());
+	}
+}
+
+int gn_fft_wisdom_import(const char *filename) {
+	try {
+		util::check_pointer(filename);
+		gn::fft_wisdom_import(filename);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_fft_wisdom_import : ",
 				e.what());
 	}
 }
 
-int gn_fa_create(const char *obj_key) {
+int gn_fft_wisdom_forget() {
 	try {
-		gn::manager::add_object(obj_key, gn::fourier_analysis::create(),
-				false);
+		gn::fft_wisdom_forget();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_create : ", e.what());
+		return util::return_on_exception("gn_fft_wisdom_forget : ",
+				e.what());
 	}
 }
 
-int gn_fa_dc(const char *obj_key, bool as_dist) {
+/**************************************************************************/
+/* Fourier Transform Helpers                                              */
+/**************************************************************************/
+
+int gn_fft_size(size_t *out_size, size_t i_size, size_t q_size, size_t navg,
+		size_t nfft) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->dc_as_dist = as_dist;
+		util::check_pointer(out_size);
+		*out_size = gn::fft_size(i_size, q_size, navg, nfft);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_dc : ", e.what());
+		*out_size = 0;
+		return util::return_on_exception("gn_fft_size : ", e.what());
 	}
 }
 
-int gn_fa_fdata(const char *obj_key, double f) {
+int gn_rfft_size(size_t *out_size, size_t in_size, size_t navg, size_t nfft) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		std::string f_s = gn::to_string(f, gn::FPFormat::Eng);
-		obj->set_fdata(f_s);
+		util::check_pointer(out_size);
+		*out_size = gn::rfft_size(in_size, navg, nfft);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fdata : ", e.what());
+		*out_size = 0;
+		return util::return_on_exception("gn_rfft_size : ", e.what());
 	}
 }
 
-int gn_fa_fdata_e(const char *obj_key, const char *f) {
+int gn_fft_batch_size(size_t *out_size, size_t nch, size_t nfft) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_fdata(f);
+		util::check_pointer(out_size);
+		*out_size = gn::fft_batch_size(nch, nfft);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fdata_e : ", e.what());
+		return util::return_on_exception("gn_fft_batch_size : ", e.what());
 	}
 }
 
-int gn_fa_fixed_tone(const char *obj_key, const char *comp_key, GnFACompTag tag,
-		double freq, int ssb) {
+int gn_rfft_batch_size(size_t *out_size, size_t nch, size_t nfft) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		gn::FACompTag t = gn::get_enum<gn::FACompTag>(tag);
-		std::string freq_s = gn::to_string(freq, gn::FPFormat::Eng);
-		obj->add_fixed_tone(comp_key, t, freq_s, ssb);
+		util::check_pointer(out_size);
+		*out_size = gn::rfft_batch_size(nch, nfft);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fixed_tone : ",
+		return util::return_on_exception("gn_rfft_batch_size : ",
 				e.what());
 	}
 }
 
-int gn_fa_fixed_tone_e(const char *obj_key, const char *comp_key,
-		GnFACompTag tag, const char *freq, int ssb) {
+int gn_fft_window_cache_clear() {
+	gn::window_cache_clear();
+	return gn_success;
+}
+
+int gn_fft_window_cache_size(size_t *size) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		gn::FACompTag t = gn::get_enum<gn::FACompTag>(tag);
-		obj->add_fixed_tone(comp_key, t, freq, ssb);
+		util::check_pointer(size);
+		*size = gn::window_cache_size();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fixed_tone_e : ",
+		return util::return_on_exception("gn_fft_window_cache_size : ",
 				e.what());
 	}
 }
 
-int gn_fa_fsample(const char *obj_key, double f) {
+int gn_fft_window_cache_warm(GnWindow window, size_t nfft, GnRfftScale scale) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		std::string f_s = gn::to_string(f, gn::FPFormat::Eng);
-		obj->set_fsample(f_s);
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::window_cache_warm(w, nfft, s);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fsample : ", e.what());
+		return util::return_on_exception("gn_fft_window_cache_warm : ",
+				e.what());
 	}
 }
 
-int gn_fa_fsample_e(const char *obj_key, const char *f) {
+/**************************************************************************/
+/* Spectrum Averager                                                      */
+/**************************************************************************/
+
+namespace {
+
+using sa_ptr = std::shared_ptr<gn::spectrum_averager>;
+
+sa_ptr get_sa_object(const std::string &obj_key) {
+	gn::object::pointer pobj = gn::manager::get_object(obj_key);
+	const gn::ObjectType obj_type = gn::ObjectType::SpectrumAverager;
+	if (obj_type != pobj->object_type()) {
+		throw std::runtime_error(
+				"object '" + obj_key + "' is not of type " +
+				gn::object_type_map.at(static_cast<int>(obj_type)));
+	}
+	return std::static_pointer_cast<gn::spectrum_averager>(pobj);
+}
+
+template <typename T>
+int gn_sa_addxx(const char *suffix, const char *obj_key, const T *i,
+		size_t i_size, const T *q, size_t q_size, int n,
+		GnCodeFormat format) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_fsample(f);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		get_sa_object(obj_key)->add(i, i_size, q, q_size, n, f);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fsample_e : ",
+		return util::return_on_exception("gn_sa_add", suffix, " : ",
 				e.what());
 	}
 }
 
-int gn_fa_fshift(const char *obj_key, double f) {
+template <typename T>
+int gn_sa_raddxx(const char *suffix, const char *obj_key, const T *in,
+		size_t in_size, int n, GnCodeFormat format) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		std::string f_s = gn::to_string(f, gn::FPFormat::Eng);
-		obj->set_fshift(f_s);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		get_sa_object(obj_key)->radd(in, in_size, n, f);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fshift : ", e.what());
+		return util::return_on_exception("gn_sa_radd", suffix, " : ",
+				e.what());
 	}
 }
 
-int gn_fa_fshift_e(const char *obj_key, const char *f) {
+} // namespace
+
+int gn_sa_create(const char *obj_key, size_t nfft, GnWindow window) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_fshift(f);
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::manager::add_object(obj_key,
+				gn::spectrum_averager::create(
+						true, nfft, w, gn::RfftScale::Native),
+				false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fshift_e : ", e.what());
+		return util::return_on_exception("gn_sa_create : ", e.what());
 	}
 }
 
-int gn_fa_fund_images(const char *obj_key, bool enable) {
+int gn_sa_rcreate(const char *obj_key, size_t nfft, GnWindow window,
+		GnRfftScale scale) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->en_fund_images = enable;
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::manager::add_object(obj_key,
+				gn::spectrum_averager::create(false, nfft, w, s), false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_fund_images : ",
-				e.what());
+		return util::return_on_exception("gn_sa_rcreate : ", e.what());
 	}
 }
 
-int gn_fa_hd(const char *obj_key, int n) {
+int gn_sa_add(const char *obj_key, const double *i, size_t i_size,
+		const double *q, size_t q_size) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_hd(n);
+		get_sa_object(obj_key)->add(i, i_size, q, q_size);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_hd : ", e.what());
+		return util::return_on_exception("gn_sa_add : ", e.what());
 	}
 }
 
-int gn_fa_ilv(const char *obj_key, const int *ilv, size_t ilv_size,
-		bool as_noise) {
+int gn_sa_add16(const char *obj_key, const int16_t *i, size_t i_size,
+		const int16_t *q, size_t q_size, int n, GnCodeFormat format) {
+	return gn_sa_addxx("16", obj_key, i, i_size, q, q_size, n, format);
+}
+
+int gn_sa_add32(const char *obj_key, const int32_t *i, size_t i_size,
+		const int32_t *q, size_t q_size, int n, GnCodeFormat format) {
+	return gn_sa_addxx("32", obj_key, i, i_size, q, q_size, n, format);
+}
+
+int gn_sa_add64(const char *obj_key, const int64_t *i, size_t i_size,
+		const int64_t *q, size_t q_size, int n, GnCodeFormat format) {
+	return gn_sa_addxx("64", obj_key, i, i_size, q, q_size, n, format);
+}
+
+int gn_sa_radd(const char *obj_key, const double *in, size_t in_size) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		std::set<int> ilv2(ilv, ilv + ilv_size);
-		obj->set_ilv(ilv2);
-		obj->ilv_as_noise = as_noise;
+		get_sa_object(obj_key)->radd(in, in_size);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_ilv : ", e.what());
+		return util::return_on_exception("gn_sa_radd : ", e.what());
 	}
 }
 
-int gn_fa_imd(const char *obj_key, int n) {
+int gn_sa_radd16(const char *obj_key, const int16_t *in, size_t in_size,
+		int n, GnCodeFormat format) {
+	return gn_sa_raddxx("16", obj_key, in, in_size, n, format);
+}
+
+int gn_sa_radd32(const char *obj_key, const int32_t *in, size_t in_size,
+		int n, GnCodeFormat format) {
+	return gn_sa_raddxx("32", obj_key, in, in_size, n, format);
+}
+
+int gn_sa_radd64(const char *obj_key, const int64_t *in, size_t in_size,
+		int n, GnCodeFormat format) {
+	return gn_sa_raddxx("64", obj_key, in, in_size, n, format);
+}
+
+int gn_sa_get(double *out, size_t out_size, const char *obj_key) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_imd(n);
+		get_sa_object(obj_key)->get(out, out_size);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_imd : ", e.what());
+		return util::return_on_exception("gn_sa_get : ", e.what());
 	}
 }
 
-int gn_fa_load(char *buf, size_t size, const char *filename,
-		const char *obj_key) {
+int gn_sa_reset(const char *obj_key) {
 	try {
-		std::string key(obj_key);
-		if (key.empty()) {
-			key = util::get_object_key_from_filename(filename);
-		}
-		gn::manager::add_object(
-				key, gn::fourier_analysis::load(filename), true);
-		util::fill_string_buffer(key.data(), key.size(), buf, size);
+		get_sa_object(obj_key)->reset();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_load : ", e.what());
+		return util::return_on_exception("gn_sa_reset : ", e.what());
 	}
 }
 
-int gn_fa_max_tone(const char *obj_key, const char *comp_key, GnFACompTag tag,
-		int ssb) {
+/**************************************************************************/
+/* Spectrum Averager Helpers                                              */
+/**************************************************************************/
+
+int gn_sa_count(size_t *count, const char *obj_key) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		gn::FACompTag t = gn::get_enum<gn::FACompTag>(tag);
-		obj->add_max_tone(comp_key, t, "0.0", "fdata", ssb);
+		util::check_pointer(count);
+		*count = get_sa_object(obj_key)->count();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_max_tone : ", e.what());
+		return util::return_on_exception("gn_sa_count : ", e.what());
 	}
 }
 
-int gn_fa_preview(char *buf, size_t size, const char *cfg_id, bool cplx) {
+int gn_sa_size(size_t *out_size, const char *obj_key) {
 	try {
-		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		std::string s = obj->preview(cplx);
-		util::fill_string_buffer(s.data(), s.size(), buf, size);
+		util::check_pointer(out_size);
+		*out_size = get_sa_object(obj_key)->size();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_preview : ", e.what());
+		return util::return_on_exception("gn_sa_size : ", e.what());
 	}
 }
 
-int gn_fa_quad_errors(const char *obj_key, bool enable) {
-	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->en_quad_errors = enable;
-		return gn_success;
-	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_quad_errors : ",
-				e.what());
+/**************************************************************************/
+/* FFT Contexts                                                           */
+/**************************************************************************/
+
+namespace {
+
+using fc_ptr = std::shared_ptr<gn::fft_context>;
+using ac_ptr = std::shared_ptr<gn::analysis_context>;
+using ap_ptr = std::shared_ptr<gn::analysis_plan>;
+
+fc_ptr get_fc_object(const std::string &obj_key) {
+	gn::object::pointer pobj = gn::manager::get_object(obj_key);
+	const gn::ObjectType obj_type = gn::ObjectType::FftContext;
+	if (obj_type != pobj->object_type()) {
+		throw std::runtime_error(
+				"object '" + obj_key + "' is not of type " +
+				gn::object_type_map.at(static_cast<int>(obj_type)));
 	}
+	return std::static_pointer_cast<gn::fft_context>(pobj);
 }
 
-int gn_fa_remove_comp(const char *obj_key, const char *comp_key) {
+ac_ptr get_ac_object(const std::string &obj_key) {
+	gn::object::pointer pobj = gn::manager::get_object(obj_key);
+	const gn::ObjectType obj_type = gn::ObjectType::AnalysisContext;
+	if (obj_type != pobj->object_type()) {
+		throw std::runtime_error(
+				"object '" + obj_key + "' is not of type " +
+				gn::object_type_map.at(static_cast<int>(obj_type)));
+	}
+	return std::static_pointer_cast<gn::analysis_context>(pobj);
+}
+
+ap_ptr get_ap_object(const std::string &obj_key) {
+	gn::object::pointer pobj = gn::manager::get_object(obj_key);
+	const gn::ObjectType obj_type = gn::ObjectType::AnalysisPlan;
+	if (obj_type != pobj->object_type()) {
+		throw std::runtime_error(
+				"object '" + obj_key + "' is not of type " +
+				gn::object_type_map.at(static_cast<int>(obj_type)));
+	}
+	return std::static_pointer_cast<gn::analysis_plan>(pobj);
+}
+
+template <typename T>
+int gn_fc_fftxx(const char *suffix, double *out, size_t out_size,
+		const char *obj_key, const T *i, size_t i_size, const T *q,
+		size_t q_size, int n, GnCodeFormat format) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->remove_comp(comp_key);
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		get_fc_object(obj_key)->fft(i, i_size, q, q_size, out, out_size, n,
+				f);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_remove_comp : ",
+		return util::return_on_exception("gn_fc_fft", suffix, " : ",
 				e.what());
 	}
 }
 
-int gn_fa_reset(const char *obj_key) {
+template <typename T>
+int gn_fc_rfftxx(const char *suffix, double *out, size_t out_size,
+		const char *obj_key, const T *in, size_t in_size, int n,
+		GnCodeFormat format) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->reset();
+		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
+		get_fc_object(obj_key)->rfft(in, in_size, out, out_size, n, f);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_reset : ", e.what());
+		return util::return_on_exception("gn_fc_rfft", suffix, " : ",
+				e.what());
 	}
 }
 
-int gn_fa_ssb(const char *obj_key, GnFASsb group, int ssb) {
+} // namespace
+
+int gn_fc_create(const char *obj_key, size_t navg, size_t nfft,
+		GnWindow window) {
 	try {
-		gn::FASsb g = gn::get_enum<gn::FASsb>(group);
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_ssb(g, ssb);
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::manager::add_object(obj_key,
+				gn::fft_context::create(
+						true, navg, nfft, w, gn::RfftScale::Native),
+				false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_ssb_dc : ", e.what());
+		return util::return_on_exception("gn_fc_create : ", e.what());
 	}
 }
 
-int gn_fa_var(const char *obj_key, const char *name, double value) {
+int gn_fc_rcreate(const char *obj_key, size_t navg, size_t nfft,
+		GnWindow window, GnRfftScale scale) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_var(name, value);
+		gn::Window w = gn::get_enum<gn::Window>(window);
+		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
+		gn::manager::add_object(obj_key,
+				gn::fft_context::create(false, navg, nfft, w, s), false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_var : ", e.what());
+		return util::return_on_exception("gn_fc_rcreate : ", e.what());
 	}
 }
 
-int gn_fa_wo(const char *obj_key, int n) {
+int gn_fc_fft(double *out, size_t out_size, const char *obj_key,
+		const double *i, size_t i_size, const double *q, size_t q_size) {
 	try {
-		fa_ptr obj = get_fa_object(obj_key);
-		obj->set_wo(n);
+		get_fc_object(obj_key)->fft(i, i_size, q, q_size, out, out_size);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_wo : ", e.what());
+		return util::return_on_exception("gn_fc_fft : ", e.what());
 	}
 }
 
-/**************************************************************************/
-/* Fourier Analysis Results                                               */
-/**************************************************************************/
+int gn_fc_fft16(double *out, size_t out_size, const char *obj_key,
+		const int16_t *i, size_t i_size, const int16_t *q, size_t q_size,
+		int n, GnCodeFormat format) {
+	return gn_fc_fftxx("16", out, out_size, obj_key, i, i_size, q, q_size, n,
+			format);
+}
 
-int gn_fa_result(double *result, const char **rkeys, size_t rkeys_size,
-		const double *rvalues, size_t rvalues_size, const char *rkey) {
+int gn_fc_fft32(double *out, size_t out_size, const char *obj_key,
+		const int32_t *i, size_t i_size, const int32_t *q, size_t q_size,
+		int n, GnCodeFormat format) {
+	return gn_fc_fftxx("32", out, out_size, obj_key, i, i_size, q, q_size, n,
+			format);
+}
+
+int gn_fc_fft64(double *out, size_t out_size, const char *obj_key,
+		const int64_t *i, size_t i_size, const int64_t *q, size_t q_size,
+		int n, GnCodeFormat format) {
+	return gn_fc_fftxx("64", out, out_size, obj_key, i, i_size, q, q_size, n,
+			format);
+}
+
+int gn_fc_rfft(double *out, size_t out_size, const char *obj_key,
+		const double *in, size_t in_size) {
 	try {
-		util::check_pointer(result);
-		if (rkeys_size != rvalues_size) {
-			throw std::runtime_error(
-					"Size of result keys does not match size of result values");
-		}
-		size_t key_index =
-				get_fa_result_key_index(rkeys, rkeys_size, rkey);
-		*result = rvalues[key_index];
+		get_fc_object(obj_key)->rfft(in, in_size, out, out_size);
 		return gn_success;
 	} catch (const std::exception &e) {
-		*result = 0.0;
-		return util::return_on_exception("gn_fa_result : ", e.what());
+		return util::return_on_exception("gn_fc_rfft : ", e.what());
 	}
 }
 
-int gn_fa_result_string(char *result, size_t result_size, const char **rkeys,
-		size_t rkeys_size, const double *rvalues,
-		size_t rvalues_size, const char *rkey) {
+int gn_fc_rfft16(double *out, size_t out_size, const char *obj_key,
+		const int16_t *in, size_t in_size, int n, GnCodeFormat format) {
+	return gn_fc_rfftxx("16", out, out_size, obj_key, in, in_size, n, format);
+}
+
+int gn_fc_rfft32(double *out, size_t out_size, const char *obj_key,
+		const int32_t *in, size_t in_size, int n, GnCodeFormat format) {
+	return gn_fc_rfftxx("32", out, out_size, obj_key, in, in_size, n, format);
+}
+
+int gn_fc_rfft64(double *out, size_t out_size, const char *obj_key,
+		const int64_t *in, size_t in_size, int n, GnCodeFormat format) {
+	return gn_fc_rfftxx("64", out, out_size, obj_key, in, in_size, n, format);
+}
+
+int gn_ac_create(const char *obj_key, size_t nfft) {
 	try {
-		util::check_pointer(result);
-		std::string rstr = get_fa_result_string(
-				rkeys, rkeys_size, rvalues, rvalues_size, rkey);
-		util::fill_string_buffer(rstr.data(), rstr.size(), result,
-				result_size);
+		gn::manager::add_object(obj_key, gn::analysis_context::create(nfft),
+				false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fa_result_string : ",
-				e.what());
+		return util::return_on_exception("gn_ac_create : ", e.what());
 	}
 }
 
-/**************************************************************************/
-/* Fourier Analysis Helpers                                               */
-/**************************************************************************/
-
-int gn_fa_load_key_size(size_t *size, const char *filename, const char *obj_key) {
+int gn_fft_analysis_ctx(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, const char *cfg_id, const char *ctx_key,
+		const double *in, size_t in_size, size_t nfft,
+		GnFreqAxisType axis_type) {
 	try {
-		util::check_pointer(size);
-		std::string key(obj_key);
-		if (key.empty()) {
-			key = util::get_object_key_from_filename(filename);
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
 		}
-		*size = util::terminated_size(key.size());
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		ac_ptr ctx = get_ac_object(ctx_key);
+		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
+		gn::fourier_analysis_results results =
+				obj->analyze(in, in_size, nfft, at, *ctx);
+		flatten_fa_results(results, rkeys, rvalues);
 		return gn_success;
 	} catch (const std::exception &e) {
-		*size = 0;
-		return util::return_on_exception("gn_fa_load_key_size : ",
+		return util::return_on_exception("gn_fft_analysis_ctx : ",
 				e.what());
 	}
 }
 
-int gn_fa_preview_size(size_t *size, const char *cfg_id, bool cplx) {
+int gn_fft_analysis_select_ctx(double *rvalues, size_t rvalues_size,
+		const char *cfg_id, const char *ctx_key, const char **rkeys,
+		size_t rkeys_size, const double *in, size_t in_size, size_t nfft,
+		GnFreqAxisType axis_type) {
 	try {
-		util::check_pointer(size);
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
 		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		std::string s = obj->preview(cplx);
-		*size = util::terminated_size(s.size());
+		ac_ptr ctx = get_ac_object(ctx_key);
+		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
+		gn::fourier_analysis_results results =
+				obj->analyze(in, in_size, nfft, at, *ctx);
+		select_fa_results(results, rkeys, rkeys_size, rvalues);
 		return gn_success;
 	} catch (const std::exception &e) {
-		*size = 0;
-		return util::return_on_exception("gn_fa_preview_size : ",
+		return util::return_on_exception("gn_fft_analysis_select_ctx : ",
 				e.what());
 	}
 }
 
-int gn_fa_result_string_size(size_t *size, const char **rkeys,
-		size_t rkeys_size, const double *rvalues,
-		size_t rvalues_size, const char *rkey) {
+int gn_fa_prepare(const char *plan_key, const char *cfg_id, size_t nfft,
+		GnFreqAxisType axis_type, bool cplx) {
 	try {
-		util::check_pointer(size);
-		std::string rstr = get_fa_result_string(
-				rkeys, rkeys_size, rvalues, rvalues_size, rkey);
-		*size = util::terminated_size(rstr.size());
+		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
+		gn::FreqAxisType at = gn::get_enum<gn::FreqAxisType>(axis_type);
+		gn::manager::add_object(plan_key, obj->prepare(nfft, at, cplx),
+				false);
 		return gn_success;
 	} catch (const std::exception &e) {
-		*size = 0;
-		return util::return_on_exception("gn_fa_result_string_size : ",
-				e.what());
+		return util::return_on_exception("gn_fa_prepare : ", e.what());
 	}
 }
 
-int gn_fft_analysis_results_key_sizes(size_t *key_sizes, size_t key_sizes_size,
-		const char *cfg_id, size_t in_size,
-		size_t nfft) {
+int gn_fft_analysis_plan(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, const char *plan_key, const double *in,
+		size_t in_size) {
 	try {
-		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		std::vector<size_t> key_sizes_src =
-				obj->result_key_lengths(in_size, nfft);
-		if (key_sizes_src.size() != key_sizes_size) {
+		if (rkeys_size != rvalues_size) {
 			throw std::runtime_error(
-					"Number of keys does not match output array size");
-		}
-		for (size_t i = 0; i < key_sizes_size; ++i) {
-			key_sizes[i] = util::terminated_size(key_sizes_src[i]);
+					"Size of result keys does not match size of result values");
 		}
+		gn::fourier_analysis_results results =
+				get_ap_object(plan_key)->analyze(in, in_size);
+		flatten_fa_results(results, rkeys, rvalues);
 		return gn_success;
 	} catch (const std::exception &e) {
-		std::fill(key_sizes, key_sizes + key_sizes_size, 0);
-		return util::return_on_exception("gn_fa_results_key_sizes : ",
+		return util::return_on_exception("gn_fft_analysis_plan : ",
 				e.what());
 	}
 }
 
-int gn_fft_analysis_results_size(size_t *size, const char *cfg_id,
-		size_t in_size, size_t nfft) {
+int gn_fft_analysis_select_plan(double *rvalues, size_t rvalues_size,
+		const char *plan_key, const char **rkeys, size_t rkeys_size,
+		const double *in, size_t in_size) {
 	try {
-		util::check_pointer(size);
-		fa_ptr obj = get_fa_object_or_load_from_file(cfg_id);
-		*size = obj->results_size(in_size, nfft);
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		gn::fourier_analysis_results results =
+				get_ap_object(plan_key)->analyze(in, in_size);
+		select_fa_results(results, rkeys, rkeys_size, rvalues);
 		return gn_success;
 	} catch (const std::exception &e) {
-		*size = 0;
-		return util::return_on_exception("gn_fa_results_size : ",
+		return util::return_on_exception("gn_fft_analysis_select_plan : ",
 				e.what());
 	}
 }
 
-/**************************************************************************/
-/* Fourier Transforms                                                     */
-/**************************************************************************/
-
-namespace {
-
-template <typename T>
-int gn_fftxx(const char *suffix, double *out, size_t out_size, const T *i,
-		size_t i_size, const T *q, size_t q_size, int n, size_t navg,
-		size_t nfft, GnWindow window, GnCodeFormat format) {
+int gn_fft_analysis_sparse(char **rkeys, size_t rkeys_size, double *rvalues,
+		size_t rvalues_size, const char *plan_key, const double *in,
+		size_t in_size, size_t navg, GnWindow window, GnRfftScale scale) {
 	try {
-		gn::Window w = gn::get_enum<gn::Window>(window);
-		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
-		gn::fft(i, i_size, q, q_size, out, out_size, n, navg, nfft, w,
-				f);
+		if (rkeys_size != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		gn::fourier_analysis_results results =
+				get_ap_object(plan_key)->analyze_sparse(in, in_size, navg,
+						gn::get_enum<gn::Window>(window),
+						gn::get_enum<gn::RfftScale>(scale));
+		flatten_fa_results(results, rkeys, rvalues);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fft", suffix, " : ",
+		return util::return_on_exception("gn_fft_analysis_sparse : ",
 				e.what());
 	}
 }
 
-template <typename T>
-int gn_rfftxx(const char *suffix, double *out, size_t out_size, const T *in,
-		size_t in_size, int n, size_t navg, size_t nfft, GnWindow window,
-		GnCodeFormat format, GnRfftScale scale) {
+int gn_fft_analysis_batch(double *rvalues, size_t rvalues_size,
+		const char *plan_key, const double *in, size_t in_size,
+		size_t count) {
 	try {
-		gn::Window w = gn::get_enum<gn::Window>(window);
-		gn::CodeFormat f = gn::get_enum<gn::CodeFormat>(format);
-		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
-		gn::rfft(in, in_size, out, out_size, n, navg, nfft, w, f, s);
+		util::check_pointer(rvalues);
+		ap_ptr plan = get_ap_object(plan_key);
+		if (count * plan->results_size() != rvalues_size) {
+			throw std::runtime_error(
+					"Size of result values does not match count * results size");
+		}
+		gn::fourier_analysis_batch_results batch =
+				plan->analyze_batch(in, in_size, count);
+		std::copy(batch.values.begin(), batch.values.end(), rvalues);
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_rfft", suffix, " : ",
+		return util::return_on_exception("gn_fft_analysis_batch : ",
 				e.what());
 	}
 }
 
-} // namespace
+/**************************************************************************/
+/* FFT Context Helpers                                                    */
+/**************************************************************************/
 
-int gn_fft(double *out, size_t out_size, const double *i, size_t i_size,
-		const double *q, size_t q_size, size_t navg, size_t nfft,
-		GnWindow window) {
+int gn_fc_size(size_t *out_size, const char *obj_key) {
 	try {
-		gn::Window w = gn::get_enum<gn::Window>(window);
-		gn::fft(i, i_size, q, q_size, out, out_size, navg, nfft, w);
+		util::check_pointer(out_size);
+		*out_size = get_fc_object(obj_key)->size();
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_fft : ", e.what());
+		return util::return_on_exception("gn_fc_size : ", e.what());
 	}
 }
 
-int gn_fft16(double *out, size_t out_size, const int16_t *i, size_t i_size,
-		const int16_t *q, size_t q_size, int n, size_t navg, size_t nfft,
-		GnWindow window, GnCodeFormat format) {
-	return gn_fftxx("16", out, out_size, i, i_size, q, q_size, n, navg,
-			nfft, window, format);
-}
-
-int gn_fft32(double *out, size_t out_size, const int32_t *i, size_t i_size,
-		const int32_t *q, size_t q_size, int n, size_t navg, size_t nfft,
-		GnWindow window, GnCodeFormat format) {
-	return gn_fftxx("32", out, out_size, i, i_size, q, q_size, n, navg,
-			nfft, window, format);
-}
-
-int gn_fft64(double *out, size_t out_size, const int64_t *i, size_t i_size,
-		const int64_t *q, size_t q_size, int n, size_t navg, size_t nfft,
-		GnWindow window, GnCodeFormat format) {
-	return gn_fftxx("64", out, out_size, i, i_size, q, q_size, n, navg,
-			nfft, window, format);
-}
-
-int gn_rfft(double *out, size_t out_size, const double *in, size_t in_size,
-		size_t navg, size_t nfft, GnWindow window, GnRfftScale scale) {
+int gn_ap_results_key_sizes(size_t *key_sizes, size_t key_sizes_size,
+		const char *plan_key) {
 	try {
-		gn::Window w = gn::get_enum<gn::Window>(window);
-		gn::RfftScale s = gn::get_enum<gn::RfftScale>(scale);
-		gn::rfft(in, in_size, out, out_size, navg, nfft, w, s);
+		std::vector<size_t> key_sizes_src =
+				get_ap_object(plan_key)->result_key_lengths();
+		if (key_sizes_src.size() != key_sizes_size) {
+			throw std::runtime_error(
+					"Number of keys does not match output array size");
+		}
+		for (size_t i = 0; i < key_sizes_size; ++i) {
+			key_sizes[i] = util::terminated_size(key_sizes_src[i]);
+		}
 		return gn_success;
 	} catch (const std::exception &e) {
-		return util::return_on_exception("gn_rfft : ", e.what());
+		std::fill(key_sizes, key_sizes + key_sizes_size, 0);
+		return util::return_on_exception("gn_ap_results_key_sizes : ",
+				e.what());
 	}
 }
 
-int gn_rfft16(double *out, size_t out_size, const int16_t *in, size_t in_size,
-		int n, size_t navg, size_t nfft, GnWindow window,
-		GnCodeFormat format, GnRfftScale scale) {
-	return gn_rfftxx("16", out, out_size, in, in_size, n, navg, nfft,
-			window, format, scale);
-}
-
-int gn_rfft32(double *out, size_t out_size, const int32_t *in, size_t in_size,
-		int n, size_t navg, size_t nfft, GnWindow window,
-		GnCodeFormat format, GnRfftScale scale) {
-	return gn_rfftxx("32", out, out_size, in, in_size, n, navg, nfft,
-			window, format, scale);
-}
-
-int gn_rfft64(double *out, size_t out_size, const int64_t *in, size_t in_size,
-		int n, size_t navg, size_t nfft, GnWindow window,
-		GnCodeFormat format, GnRfftScale scale) {
-	return gn_rfftxx("64", out, out_size, in, in_size, n, navg, nfft,
-			window, format, scale);
-}
-
-/**************************************************************************/
-/* Fourier Transform Helpers                                              */
-/**************************************************************************/
-
-int gn_fft_size(size_t *out_size, size_t i_size, size_t q_size, size_t navg,
-		size_t nfft) {
+int gn_ap_results_keys(char **rkeys, size_t rkeys_size,
+		const char *plan_key) {
 	try {
-		util::check_pointer(out_size);
-		*out_size = gn::fft_size(i_size, q_size, navg, nfft);
+		util::check_pointer(rkeys);
+		std::vector<std::string> keys_src =
+				get_ap_object(plan_key)->result_keys();
+		if (keys_src.size() != rkeys_size) {
+			throw std::runtime_error(
+					"Number of keys does not match output array size");
+		}
+		for (size_t i = 0; i < rkeys_size; ++i) {
+			const std::string &src = keys_src[i];
+			util::fill_string_buffer(src.data(), src.size(), rkeys[i],
+					util::terminated_size(src.size()));
+		}
 		return gn_success;
 	} catch (const std::exception &e) {
-		*out_size = 0;
-		return util::return_on_exception("gn_fft_size : ", e.what());
+		return util::return_on_exception("gn_ap_results_keys : ", e.what());
 	}
 }
 
-int gn_rfft_size(size_t *out_size, size_t in_size, size_t navg, size_t nfft) {
+int gn_ap_results_size(size_t *size, const char *plan_key) {
 	try {
-		util::check_pointer(out_size);
-		*out_size = gn::rfft_size(in_size, navg, nfft);
+		util::check_pointer(size);
+		*size = get_ap_object(plan_key)->results_size();
 		return gn_success;
 	} catch (const std::exception &e) {
-		*out_size = 0;
-		return util::return_on_exception("gn_rfft_size : ", e.what());
+		*size = 0;
+		return util::return_on_exception("gn_ap_results_size : ", e.what());
 	}
 }
 
@@ -1603,6 +2963,20 @@ int gn_normalize64(double *out, size_t out_size, const int64_t *in,
 	return gn_normalize("64", out, out_size, in, in_size, n, format);
 }
 
+int gn_normalize_raw(double *out, size_t out_size, const uint8_t *buf,
+		size_t buf_size, int n, int container_bits, bool left_justified,
+		bool big_endian, GnCodeFormat format, size_t stride, size_t offset) {
+	try {
+		const gn::sample_format fmt = util::make_sample_format(n,
+				container_bits, left_justified, big_endian, format, stride,
+				offset);
+		gn::normalize_raw(buf, buf_size, out, out_size, fmt);
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_normalize_raw : ", e.what());
+	}
+}
+
 int gn_polyval(double *out, size_t out_size, const double *in, size_t in_size,
 		const double *c, size_t c_size) {
 	try {
@@ -1662,6 +3036,23 @@ int gn_fshift_size(size_t *out_size, size_t i_size, size_t q_size) {
 	}
 }
 
+int gn_raw_sample_count(size_t *count, size_t buf_size, int n,
+		int container_bits, bool left_justified, bool big_endian,
+		GnCodeFormat format, size_t stride, size_t offset) {
+	try {
+		util::check_pointer(count);
+		const gn::sample_format fmt = util::make_sample_format(n,
+				container_bits, left_justified, big_endian, format, stride,
+				offset);
+		*count = gn::raw_sample_count(buf_size, fmt);
+		return gn_success;
+	} catch (const std::exception &e) {
+		*count = 0;
+		return util::return_on_exception("gn_raw_sample_count : ",
+				e.what());
+	}
+}
+
 /**************************************************************************/
 /* Waveforms                                                              */
 /**************************************************************************/
@@ -1702,6 +3093,41 @@ int gn_wf_analysisx(const char *suffix, char **rkeys, size_t rkeys_size,
 	}
 }
 
+template <typename T>
+int gn_sine_fit_analysisx(const char *suffix, char **rkeys,
+		size_t rkeys_size, double *rvalues, size_t rvalues_size,
+		const T *in, size_t in_size, double fs, double freq,
+		bool fit_freq) {
+	try {
+		util::check_pointer(rkeys);
+		util::check_pointer(rvalues);
+		const std::vector<std::string> &keys =
+				gn::sine_fit_analysis_ordered_keys();
+		if (keys.size() != rkeys_size) {
+			throw std::runtime_error(
+					"Size of result key array is wrong");
+		}
+		if (rvalues_size != rkeys_size) {
+			throw std::runtime_error(
+					"Size of result keys does not match size of result values");
+		}
+		std::map<std::string, double> results =
+				gn::sine_fit_analysis(in, in_size, fs, freq, fit_freq);
+		for (size_t i = 0; i < keys.size(); ++i) {
+			const std::string &src = keys[i];
+			char *dst = rkeys[i];
+			size_t dst_size = util::terminated_size(src.size());
+			util::fill_string_buffer(src.data(), src.size(), dst,
+					dst_size);
+			rvalues[i] = results.at(src);
+		}
+		return gn_success;
+	} catch (const std::exception &e) {
+		return util::return_on_exception("gn_sine_fit_analysis", suffix,
+				" : ", e.what());
+	}
+}
+
 } // namespace
 
 int gn_cos(double *out, size_t size, double fs, double ampl, double freq,
@@ -1764,4 +3190,32 @@ int gn_wf_analysis64(char **rkeys, size_t rkeys_size, double *rvalues,
 		size_t rvalues_size, const int64_t *in, size_t in_size) {
 	return gn_wf_analysisx("64", rkeys, rkeys_size, rvalues, rvalues_size,
 			in, in_size);
+}
+
+int gn_sine_fit_analysis(char **rkeys, size_t rkeys_size,
+		double *rvalues, size_t rvalues_size, const double *in,
+		size_t in_size, double fs, double freq, bool fit_freq) {
+	return gn_sine_fit_analysisx("", rkeys, rkeys_size, rvalues,
+			rvalues_size, in, in_size, fs, freq, fit_freq);
+}
+
+int gn_sine_fit_analysis16(char **rkeys, size_t rkeys_size,
+		double *rvalues, size_t rvalues_size, const int16_t *in,
+		size_t in_size, double fs, double freq, bool fit_freq) {
+	return gn_sine_fit_analysisx("16", rkeys, rkeys_size, rvalues,
+			rvalues_size, in, in_size, fs, freq, fit_freq);
+}
+
+int gn_sine_fit_analysis32(char **rkeys, size_t rkeys_size,
+		double *rvalues, size_t rvalues_size, const int32_t *in,
+		size_t in_size, double fs, double freq, bool fit_freq) {
+	return gn_sine_fit_analysisx("32", rkeys, rkeys_size, rvalues,
+			rvalues_size, in, in_size, fs, freq, fit_freq);
+}
+
+int gn_sine_fit_analysis64(char **rkeys, size_t rkeys_size,
+		double *rvalues, size_t rvalues_size, const int64_t *in,
+		size_t in_size, double fs, double freq, bool fit_freq) {
+	return gn_sine_fit_analysisx("64", rkeys, rkeys_size, rvalues,
+			rvalues_size, in, in_size, fs, freq, fit_freq);
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Genalyzer
+{
+    /// <summary>
+    /// Reusable scratch storage for Fourier analysis of a fixed FFT size.
+    /// Results match FourierAnalysis.Analyze/AnalyzeSelect.  Free a context
+    /// with Manager.Remove.
+    /// </summary>
+    public static class AnalysisContext
+    {
+        /// <summary>Creates an analysis context with the given key.</summary>
+        public static void Create(string objKey, int nfft)
+            => Util.Check(NativeMethods.gn_ac_create(objKey, (UIntPtr)nfft));
+
+        /// <summary>
+        /// Executes Fourier analysis using the context and returns all
+        /// results as a dictionary.
+        /// </summary>
+        public static Dictionary<string, double> Analyze(
+            string cfgId, string ctxKey, double[] fftData, int nfft,
+            FreqAxisType axisType = FreqAxisType.DcLeft)
+        {
+            Util.Check(NativeMethods.gn_fft_analysis_results_size(
+                out UIntPtr sz, cfgId,
+                (UIntPtr)fftData.Length, (UIntPtr)nfft));
+            int n = (int)sz;
+
+            var keySizes = new UIntPtr[n];
+            Util.Check(NativeMethods.gn_fft_analysis_results_key_sizes(
+                keySizes, (UIntPtr)n, cfgId,
+                (UIntPtr)fftData.Length, (UIntPtr)nfft));
+
+            var (handles, pins) = Util.AllocKeyBuffers(keySizes);
+            var values = new double[n];
+            try
+            {
+                Util.Check(NativeMethods.gn_fft_analysis_ctx(
+                    handles, (UIntPtr)n,
+                    values,  (UIntPtr)n,
+                    cfgId, ctxKey, fftData, (UIntPtr)fftData.Length,
+                    (UIntPtr)nfft, (int)axisType));
+                string[] keys = Util.KeysToStrings(handles, n);
+                return Util.MakeResultDictionary(keys, values);
+            }
+            finally
+            {
+                Util.FreeKeyBuffers(pins);
+            }
+        }
+
+        /// <summary>
+        /// Executes Fourier analysis using the context and returns only the
+        /// requested result keys.
+        /// </summary>
+        public static double[] AnalyzeSelect(
+            string cfgId, string ctxKey, double[] fftData, int nfft,
+            string[] requestedKeys,
+            FreqAxisType axisType = FreqAxisType.DcLeft)
+        {
+            int n = requestedKeys.Length;
+            var pins    = new GCHandle[n];
+            var ptrKeys = new IntPtr[n];
+            for (int i = 0; i < n; i++)
+            {
+                byte[] b = Encoding.UTF8.GetBytes(requestedKeys[i] + '\0');
+                pins[i]    = GCHandle.Alloc(b, GCHandleType.Pinned);
+                ptrKeys[i] = pins[i].AddrOfPinnedObject();
+            }
+            var values = new double[n];
+            try
+            {
+                Util.Check(NativeMethods.gn_fft_analysis_select_ctx(
+                    values, (UIntPtr)n,
+                    cfgId, ctxKey, ptrKeys, (UIntPtr)n,
+                    fftData, (UIntPtr)fftData.Length,
+                    (UIntPtr)nfft, (int)axisType));
+            }
+            finally
+            {
+                Util.FreeKeyBuffers(pins);
+            }
+            return values;
+        }
+    }
+}
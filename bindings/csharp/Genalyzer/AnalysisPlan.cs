@@ -0,0 +1,168 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Genalyzer
+{
+    /// <summary>
+    /// Compiled Fourier analysis configuration for a fixed FFT size, axis
+    /// type, and signal type.  Everything that does not depend on the
+    /// spectrum is resolved once, when the plan is created.  Results match
+    /// FourierAnalysis.Analyze/AnalyzeSelect.  Free a plan with
+    /// Manager.Remove.
+    /// </summary>
+    public static class AnalysisPlan
+    {
+        /// <summary>
+        /// Creates an analysis plan with the given key from a Fourier
+        /// analysis configuration.
+        /// </summary>
+        public static void Create(string planKey, string cfgId, int nfft,
+            FreqAxisType axisType = FreqAxisType.DcLeft, bool cplx = true)
+            => Util.Check(NativeMethods.gn_fa_prepare(
+                planKey, cfgId, (UIntPtr)nfft, (int)axisType, cplx));
+
+        /// <summary>
+        /// Executes Fourier analysis using the plan and returns all results
+        /// as a dictionary.
+        /// </summary>
+        public static Dictionary<string, double> Analyze(
+            string planKey, double[] fftData)
+        {
+            Util.Check(NativeMethods.gn_ap_results_size(
+                out UIntPtr sz, planKey));
+            int n = (int)sz;
+
+            var keySizes = new UIntPtr[n];
+            Util.Check(NativeMethods.gn_ap_results_key_sizes(
+                keySizes, (UIntPtr)n, planKey));
+
+            var (handles, pins) = Util.AllocKeyBuffers(keySizes);
+            var values = new double[n];
+            try
+            {
+                Util.Check(NativeMethods.gn_fft_analysis_plan(
+                    handles, (UIntPtr)n,
+                    values,  (UIntPtr)n,
+                    planKey, fftData, (UIntPtr)fftData.Length));
+                string[] keys = Util.KeysToStrings(handles, n);
+                return Util.MakeResultDictionary(keys, values);
+            }
+            finally
+            {
+                Util.FreeKeyBuffers(pins);
+            }
+        }
+
+        /// <summary>
+        /// Executes Fourier analysis on count spectra, stored back to back in
+        /// fftData, using the plan.  Returns a count x keys.Length matrix of
+        /// result values in row-major order; row i holds the values that
+        /// Analyze returns for spectrum i.
+        /// </summary>
+        public static double[] AnalyzeBatch(
+            string planKey, double[] fftData, int count, out string[] keys)
+        {
+            Util.Check(NativeMethods.gn_ap_results_size(
+                out UIntPtr sz, planKey));
+            int n = (int)sz;
+
+            var keySizes = new UIntPtr[n];
+            Util.Check(NativeMethods.gn_ap_results_key_sizes(
+                keySizes, (UIntPtr)n, planKey));
+
+            var (handles, pins) = Util.AllocKeyBuffers(keySizes);
+            try
+            {
+                Util.Check(NativeMethods.gn_ap_results_keys(
+                    handles, (UIntPtr)n, planKey));
+                keys = Util.KeysToStrings(handles, n);
+            }
+            finally
+            {
+                Util.FreeKeyBuffers(pins);
+            }
+
+            var values = new double[count * n];
+            Util.Check(NativeMethods.gn_fft_analysis_batch(
+                values, (UIntPtr)values.Length,
+                planKey, fftData, (UIntPtr)fftData.Length,
+                (UIntPtr)count));
+            return values;
+        }
+
+        /// <summary>
+        /// Executes Fourier analysis on real time-domain data using the plan,
+        /// computing only the spectrum bins of the plan's DC and FixedTone
+        /// components.  The plan must be for a real analysis of the whole
+        /// spectrum, with no MaxTone or WO components.  Results match
+        /// FourierTransforms.RfftMsq followed by Analyze.
+        /// </summary>
+        public static Dictionary<string, double> AnalyzeSparse(
+            string planKey, double[] data, int navg = 1,
+            Window window = Window.NoWindow,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            Util.Check(NativeMethods.gn_ap_results_size(
+                out UIntPtr sz, planKey));
+            int n = (int)sz;
+
+            var keySizes = new UIntPtr[n];
+            Util.Check(NativeMethods.gn_ap_results_key_sizes(
+                keySizes, (UIntPtr)n, planKey));
+
+            var (handles, pins) = Util.AllocKeyBuffers(keySizes);
+            var values = new double[n];
+            try
+            {
+                Util.Check(NativeMethods.gn_fft_analysis_sparse(
+                    handles, (UIntPtr)n,
+                    values,  (UIntPtr)n,
+                    planKey, data, (UIntPtr)data.Length,
+                    (UIntPtr)navg, (int)window, (int)scale));
+                string[] keys = Util.KeysToStrings(handles, n);
+                return Util.MakeResultDictionary(keys, values);
+            }
+            finally
+            {
+                Util.FreeKeyBuffers(pins);
+            }
+        }
+
+        /// <summary>
+        /// Executes Fourier analysis using the plan and returns only the
+        /// requested result keys.
+        /// </summary>
+        public static double[] AnalyzeSelect(
+            string planKey, double[] fftData, string[] requestedKeys)
+        {
+            int n = requestedKeys.Length;
+            var pins    = new GCHandle[n];
+            var ptrKeys = new IntPtr[n];
+            for (int i = 0; i < n; i++)
+            {
+                byte[] b = Encoding.UTF8.GetBytes(requestedKeys[i] + '\0');
+                pins[i]    = GCHandle.Alloc(b, GCHandleType.Pinned);
+                ptrKeys[i] = pins[i].AddrOfPinnedObject();
+            }
+            var values = new double[n];
+            try
+            {
+                Util.Check(NativeMethods.gn_fft_analysis_select_plan(
+                    values, (UIntPtr)n,
+                    planKey, ptrKeys, (UIntPtr)n,
+                    fftData, (UIntPtr)fftData.Length));
+            }
+            finally
+            {
+                Util.FreeKeyBuffers(pins);
+            }
+            return values;
+        }
+    }
+}
@@ -53,6 +53,22 @@ namespace Genalyzer
             return Util.BytesToString(buf);
         }
 
+        /// <summary>
+        /// Returns the number of threads used by parallel algorithms.
+        /// </summary>
+        public static int GetNumThreads()
+        {
+            Util.Check(NativeMethods.gn_get_num_threads(out UIntPtr n));
+            return (int)n;
+        }
+
+        /// <summary>
+        /// Sets the number of threads used by parallel algorithms
+        /// (0 selects the hardware concurrency; the default is 1).
+        /// </summary>
+        public static void SetNumThreads(int numThreads)
+            => NativeMethods.gn_set_num_threads((UIntPtr)numThreads);
+
         /// <summary>Returns the underlying integer value of an enumeration member.</summary>
         public static int EnumValue(string enumeration, string enumerator)
         {
@@ -166,6 +166,62 @@ namespace Genalyzer
             return hist;
         }
 
+        /// <summary>
+        /// Computes the histogram of a 16-bit input waveform on multiple threads.
+        /// </summary>
+        public static ulong[] HistParallel(short[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            bool preserve = false)
+        {
+            int size = CodeDensitySize(n, format);
+            var hist = new ulong[size];
+            Util.Check(NativeMethods.gn_hist16_parallel(
+                hist, (UIntPtr)size,
+                input, (UIntPtr)input.Length,
+                n, (int)format, preserve));
+            return hist;
+        }
+
+        /// <summary>
+        /// Computes the histogram of a 16-bit waveform over [min, max] on multiple threads.
+        /// </summary>
+        public static ulong[] HistXParallel(short[] input, long min, long max,
+            bool preserve = false)
+        {
+            int size = CodeDensityXSize(min, max);
+            var hist = new ulong[size];
+            Util.Check(NativeMethods.gn_histx16_parallel(
+                hist, (UIntPtr)size,
+                input, (UIntPtr)input.Length,
+                min, max, preserve));
+            return hist;
+        }
+
+        /// <summary>
+        /// Computes the histogram of raw ADC samples without unpacking them;
+        /// see SignalProcessing.NormalizeRaw for the format parameters and
+        /// the sample count.
+        /// </summary>
+        public static ulong[] HistRaw(byte[] buf, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            int containerBits = 0, bool leftJustified = false,
+            bool bigEndian = false, long stride = 1, long offset = 0,
+            long count = -1)
+        {
+            int cb = containerBits > 0 ? containerBits : n;
+            if (count < 0)
+                count = SignalProcessing.RawSampleCount(buf.Length, n, format,
+                    cb, leftJustified, bigEndian, stride, offset);
+            int size = CodeDensitySize(n, format);
+            var hist = new ulong[size];
+            Util.Check(NativeMethods.gn_hist_raw(
+                hist, (UIntPtr)size,
+                buf, (UIntPtr)buf.Length,
+                n, cb, leftJustified, bigEndian, (int)format,
+                (UIntPtr)stride, (UIntPtr)offset, (UIntPtr)count, false));
+            return hist;
+        }
+
         // ---------------------------------------------------------------
         // DNL / INL
         // ---------------------------------------------------------------
@@ -242,15 +298,114 @@ namespace Genalyzer
                         inl, (UIntPtr)inl.Length));
         }
 
+        /// <summary>
+        /// Computes DNL, INL, and their summary statistics from a histogram
+        /// array, with the results of HistAnalysis, Dnl, DnlAnalysis, Inl, and
+        /// InlAnalysis.  Keys: those of the three analyses, prefixed with
+        /// hist_, dnl_, and inl_.
+        /// </summary>
+        public static (double[] Dnl, double[] Inl,
+            Dictionary<string, double> Results) LinearityAnalysis(
+            ulong[] hist, DnlSignal signalType = DnlSignal.Tone,
+            InlLineFit fit = InlLineFit.BestFit)
+        {
+            var dnl = new double[hist.Length];
+            var inl = new double[hist.Length];
+            var results = RunAnalysis(AnalysisType.Linearity,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_linearity_analysis(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        dnl, (UIntPtr)dnl.Length,
+                        inl, (UIntPtr)inl.Length,
+                        hist, (UIntPtr)hist.Length,
+                        (int)signalType, (int)fit));
+            return (dnl, inl, results);
+        }
+
+        /// <summary>
+        /// Computes the histogram, DNL, INL, and their summary statistics from
+        /// a quantized waveform; see LinearityAnalysis(ulong[], ...).
+        /// </summary>
+        public static (ulong[] Hist, double[] Dnl, double[] Inl,
+            Dictionary<string, double> Results) LinearityAnalysis(
+            short[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            DnlSignal signalType = DnlSignal.Tone,
+            InlLineFit fit = InlLineFit.BestFit)
+        {
+            int size = CodeDensitySize(n, format);
+            var hist = new ulong[size];
+            var dnl = new double[size];
+            var inl = new double[size];
+            var results = RunAnalysis(AnalysisType.Linearity,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_linearity_analysis16(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        hist, (UIntPtr)size, dnl, (UIntPtr)size,
+                        inl, (UIntPtr)size, input, (UIntPtr)input.Length,
+                        n, (int)format, (int)signalType, (int)fit));
+            return (hist, dnl, inl, results);
+        }
+
+        /// <summary>
+        /// Computes the histogram, DNL, INL, and their summary statistics from
+        /// a quantized waveform; see LinearityAnalysis(ulong[], ...).
+        /// </summary>
+        public static (ulong[] Hist, double[] Dnl, double[] Inl,
+            Dictionary<string, double> Results) LinearityAnalysis(
+            int[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            DnlSignal signalType = DnlSignal.Tone,
+            InlLineFit fit = InlLineFit.BestFit)
+        {
+            int size = CodeDensitySize(n, format);
+            var hist = new ulong[size];
+            var dnl = new double[size];
+            var inl = new double[size];
+            var results = RunAnalysis(AnalysisType.Linearity,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_linearity_analysis32(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        hist, (UIntPtr)size, dnl, (UIntPtr)size,
+                        inl, (UIntPtr)size, input, (UIntPtr)input.Length,
+                        n, (int)format, (int)signalType, (int)fit));
+            return (hist, dnl, inl, results);
+        }
+
+        /// <summary>
+        /// Computes the histogram, DNL, INL, and their summary statistics from
+        /// a quantized waveform; see LinearityAnalysis(ulong[], ...).
+        /// </summary>
+        public static (ulong[] Hist, double[] Dnl, double[] Inl,
+            Dictionary<string, double> Results) LinearityAnalysis(
+            long[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            DnlSignal signalType = DnlSignal.Tone,
+            InlLineFit fit = InlLineFit.BestFit)
+        {
+            int size = CodeDensitySize(n, format);
+            var hist = new ulong[size];
+            var dnl = new double[size];
+            var inl = new double[size];
+            var results = RunAnalysis(AnalysisType.Linearity,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_linearity_analysis64(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        hist, (UIntPtr)size, dnl, (UIntPtr)size,
+                        inl, (UIntPtr)size, input, (UIntPtr)input.Length,
+                        n, (int)format, (int)signalType, (int)fit));
+            return (hist, dnl, inl, results);
+        }
+
         // ---------------------------------------------------------------
-        // Private helper
+        // Internal helper
         // ---------------------------------------------------------------
 
-        private delegate int AnalysisFunc(
+        internal delegate int AnalysisFunc(
             System.IntPtr[] rkeys, UIntPtr rkeysSize,
             double[] rvalues, UIntPtr rvaluesSize);
 
-        private static Dictionary<string, double> RunAnalysis(
+        internal static Dictionary<string, double> RunAnalysis(
             AnalysisType type, AnalysisFunc fn)
         {
             int n = ApiUtilities.AnalysisResultsSize(type);
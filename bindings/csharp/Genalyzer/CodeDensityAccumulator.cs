@@ -0,0 +1,109 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+using System.Collections.Generic;
+
+namespace Genalyzer
+{
+    /// <summary>
+    /// Streaming code-density histogram.  Waveforms are pushed in chunks, and
+    /// accumulators filled by separate workers are combined with Merge.  Bins
+    /// are indexed like the array returned by CodeDensity.Hist.
+    /// </summary>
+    public static class CodeDensityAccumulator
+    {
+        // ---------------------------------------------------------------
+        // Creation
+        // ---------------------------------------------------------------
+
+        /// <summary>Creates an accumulator for a resolution and code format.</summary>
+        public static void Create(string objKey, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_cda_create(objKey, n, (int)format));
+
+        /// <summary>Creates an accumulator over [min, max].</summary>
+        public static void CreateX(string objKey, long min, long max)
+            => Util.Check(NativeMethods.gn_cda_createx(objKey, min, max));
+
+        // ---------------------------------------------------------------
+        // Accumulation
+        // ---------------------------------------------------------------
+
+        /// <summary>Pushes a 16-bit waveform.</summary>
+        public static void Push(string objKey, short[] input)
+            => Util.Check(NativeMethods.gn_cda_push16(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Pushes a 32-bit waveform.</summary>
+        public static void Push(string objKey, int[] input)
+            => Util.Check(NativeMethods.gn_cda_push32(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Pushes a 64-bit waveform.</summary>
+        public static void Push(string objKey, long[] input)
+            => Util.Check(NativeMethods.gn_cda_push64(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Adds another accumulator with the same code range.</summary>
+        public static void Merge(string objKey, string otherKey)
+            => Util.Check(NativeMethods.gn_cda_merge(objKey, otherKey));
+
+        /// <summary>Discards all samples pushed so far.</summary>
+        public static void Reset(string objKey)
+            => Util.Check(NativeMethods.gn_cda_reset(objKey));
+
+        // ---------------------------------------------------------------
+        // Results
+        // ---------------------------------------------------------------
+
+        /// <summary>Returns the histogram of all samples pushed so far.</summary>
+        public static ulong[] Snapshot(string objKey)
+        {
+            var hist = new ulong[Size(objKey)];
+            Util.Check(NativeMethods.gn_cda_snapshot(
+                hist, (UIntPtr)hist.Length, objKey));
+            return hist;
+        }
+
+        /// <summary>
+        /// Runs histogram analysis in constant time and returns a result
+        /// dictionary.  Keys: sum, first_nz_index, last_nz_index, nz_range.
+        /// </summary>
+        public static Dictionary<string, double> Analysis(string objKey)
+        {
+            return CodeDensity.RunAnalysis(AnalysisType.Histogram,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_cda_analysis(
+                        rkeys, rkeysSize, rvalues, rvaluesSize, objKey));
+        }
+
+        // ---------------------------------------------------------------
+        // Helpers
+        // ---------------------------------------------------------------
+
+        /// <summary>Returns the total, below-range, and above-range sample counts.</summary>
+        public static (ulong Count, ulong Below, ulong Above) Counts(string objKey)
+        {
+            Util.Check(NativeMethods.gn_cda_counts(
+                out ulong count, out ulong below, out ulong above, objKey));
+            return (count, below, above);
+        }
+
+        /// <summary>Returns the smallest and largest codes pushed.</summary>
+        public static (long MinCode, long MaxCode) CodeRange(string objKey)
+        {
+            Util.Check(NativeMethods.gn_cda_code_range(
+                out long minCode, out long maxCode, objKey));
+            return (minCode, maxCode);
+        }
+
+        /// <summary>Returns the number of bins.</summary>
+        public static long Size(string objKey)
+        {
+            Util.Check(NativeMethods.gn_cda_size(out UIntPtr size, objKey));
+            return (long)size;
+        }
+    }
+}
@@ -11,7 +11,9 @@ namespace Genalyzer
         Fourier   = 1,
         Histogram = 2,
         INL       = 3,
-        Waveform  = 4
+        Waveform  = 4,
+        SineFit   = 5,
+        Linearity = 6
     }
 
     /// <summary>Enumerates binary code formats.</summary>
@@ -71,6 +73,17 @@ namespace Genalyzer
         WO      = 3
     }
 
+    /// <summary>Enumerates FFTW planner effort levels.</summary>
+    public enum FftPlanner
+    {
+        /// <summary>Heuristic plan (FFTW_ESTIMATE)</summary>
+        Estimate = 0,
+        /// <summary>Measured plan (FFTW_MEASURE)</summary>
+        Measure  = 1,
+        /// <summary>Exhaustively measured plan (FFTW_PATIENT)</summary>
+        Patient  = 2
+    }
+
     /// <summary>Enumerates frequency axis formats.</summary>
     public enum FreqAxisFormat
     {
@@ -0,0 +1,140 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+
+namespace Genalyzer
+{
+    /// <summary>
+    /// Reusable FFT workspace for a fixed navg, nfft, and window.  Results
+    /// match Fft/Rfft; repeated calls do not reallocate the averaging work
+    /// array.  Free a context with Manager.Remove.
+    /// </summary>
+    public static class FftContext
+    {
+        // ---------------------------------------------------------------
+        // Creation
+        // ---------------------------------------------------------------
+
+        /// <summary>Creates a complex FFT context with the given key.</summary>
+        public static void Create(string objKey, int navg, int nfft,
+            Window window = Window.NoWindow)
+            => Util.Check(NativeMethods.gn_fc_create(
+                objKey, (UIntPtr)navg, (UIntPtr)nfft, (int)window));
+
+        /// <summary>Creates a real FFT context with the given key.</summary>
+        public static void RCreate(string objKey, int navg, int nfft,
+            Window window = Window.NoWindow,
+            RfftScale scale = RfftScale.DbfsSin)
+            => Util.Check(NativeMethods.gn_fc_rcreate(
+                objKey, (UIntPtr)navg, (UIntPtr)nfft, (int)window,
+                (int)scale));
+
+        // ---------------------------------------------------------------
+        // Complex FFT
+        // ---------------------------------------------------------------
+
+        /// <summary>FFT of split normalized I/Q data.</summary>
+        public static double[] Fft(string objKey, double[] i, double[] q)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_fft(output, (UIntPtr)output.Length,
+                objKey, i, (UIntPtr)i.Length, q, (UIntPtr)q.Length));
+            return output;
+        }
+
+        /// <summary>FFT of split 16-bit quantized I/Q data.</summary>
+        public static double[] Fft(string objKey, short[] i, short[] q, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_fft16(output,
+                (UIntPtr)output.Length, objKey, i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length, n, (int)format));
+            return output;
+        }
+
+        /// <summary>FFT of split 32-bit quantized I/Q data.</summary>
+        public static double[] Fft(string objKey, int[] i, int[] q, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_fft32(output,
+                (UIntPtr)output.Length, objKey, i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length, n, (int)format));
+            return output;
+        }
+
+        /// <summary>FFT of split 64-bit quantized I/Q data.</summary>
+        public static double[] Fft(string objKey, long[] i, long[] q, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_fft64(output,
+                (UIntPtr)output.Length, objKey, i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length, n, (int)format));
+            return output;
+        }
+
+        // ---------------------------------------------------------------
+        // Real FFT
+        // ---------------------------------------------------------------
+
+        /// <summary>Real FFT of normalized data.</summary>
+        public static double[] Rfft(string objKey, double[] input)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_rfft(output, (UIntPtr)output.Length,
+                objKey, input, (UIntPtr)input.Length));
+            return output;
+        }
+
+        /// <summary>Real FFT of 16-bit quantized data.</summary>
+        public static double[] Rfft(string objKey, short[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_rfft16(output,
+                (UIntPtr)output.Length, objKey, input, (UIntPtr)input.Length,
+                n, (int)format));
+            return output;
+        }
+
+        /// <summary>Real FFT of 32-bit quantized data.</summary>
+        public static double[] Rfft(string objKey, int[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_rfft32(output,
+                (UIntPtr)output.Length, objKey, input, (UIntPtr)input.Length,
+                n, (int)format));
+            return output;
+        }
+
+        /// <summary>Real FFT of 64-bit quantized data.</summary>
+        public static double[] Rfft(string objKey, long[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            var output = Output(objKey);
+            Util.Check(NativeMethods.gn_fc_rfft64(output,
+                (UIntPtr)output.Length, objKey, input, (UIntPtr)input.Length,
+                n, (int)format));
+            return output;
+        }
+
+        // ---------------------------------------------------------------
+        // Helpers
+        // ---------------------------------------------------------------
+
+        /// <summary>Returns the output array size (interleaved Re/Im).</summary>
+        public static int Size(string objKey)
+        {
+            Util.Check(NativeMethods.gn_fc_size(out UIntPtr sz, objKey));
+            return (int)sz;
+        }
+
+        private static double[] Output(string objKey)
+            => new double[Size(objKey)];
+    }
+}
@@ -102,6 +102,10 @@ namespace Genalyzer
         public static void SetImd(string objKey, int n)
             => Util.Check(NativeMethods.gn_fa_imd(objKey, n));
 
+        /// <summary>Enables or disables IMD tone results.</summary>
+        public static void SetImdTones(string objKey, bool enable)
+            => Util.Check(NativeMethods.gn_fa_imd_tones(objKey, enable));
+
         /// <summary>Adds a maximum-search tone component.</summary>
         public static void AddMaxTone(string objKey, string compKey,
             FACompTag tag, int ssb = -1)
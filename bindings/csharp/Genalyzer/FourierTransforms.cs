@@ -9,7 +9,8 @@ namespace Genalyzer
     /// <summary>
     /// Fourier transforms: complex FFT and real FFT for normalized (double)
     /// and quantized (int16/int32/int64) input data.
-    /// All output arrays contain interleaved Re/Im doubles.
+    /// All output arrays contain interleaved Re/Im doubles, or floats for the
+    /// single-precision functions.
     /// </summary>
     public static class FourierTransforms
     {
@@ -40,6 +41,75 @@ namespace Genalyzer
             return (int)sz;
         }
 
+        // ---------------------------------------------------------------
+        // FFTW planner
+        // ---------------------------------------------------------------
+
+        /// <summary>
+        /// Sets the FFTW planner effort used for new FFT plans.
+        /// </summary>
+        public static void SetPlanner(FftPlanner planner)
+            => Util.Check(NativeMethods.gn_fft_set_planner((int)planner));
+
+        /// <summary>
+        /// Gets the FFTW planner effort used for new FFT plans.
+        /// </summary>
+        public static FftPlanner GetPlanner()
+        {
+            Util.Check(NativeMethods.gn_fft_get_planner(out int planner));
+            return (FftPlanner)planner;
+        }
+
+        /// <summary>
+        /// Saves accumulated FFTW wisdom to a file. Single-precision wisdom,
+        /// when available, is saved to filename with ".float" appended.
+        /// </summary>
+        public static void WisdomExport(string filename)
+            => Util.Check(NativeMethods.gn_fft_wisdom_export(filename));
+
+        /// <summary>
+        /// Loads FFTW wisdom from a file. Single-precision wisdom, when
+        /// available, is also loaded from filename with ".float" appended,
+        /// if that file exists.
+        /// </summary>
+        public static void WisdomImport(string filename)
+            => Util.Check(NativeMethods.gn_fft_wisdom_import(filename));
+
+        /// <summary>
+        /// Discards all accumulated FFTW wisdom. Cached plans are kept; only
+        /// plans created afterwards are affected.
+        /// </summary>
+        public static void WisdomForget()
+            => Util.Check(NativeMethods.gn_fft_wisdom_forget());
+
+        // ---------------------------------------------------------------
+        // Window coefficient cache
+        // ---------------------------------------------------------------
+
+        /// <summary>Removes all cached window coefficient tables.</summary>
+        public static void WindowCacheClear()
+            => NativeMethods.gn_fft_window_cache_clear();
+
+        /// <summary>
+        /// Returns the number of cached window coefficient tables.
+        /// </summary>
+        public static int WindowCacheSize()
+        {
+            Util.Check(NativeMethods.gn_fft_window_cache_size(out UIntPtr sz));
+            return (int)sz;
+        }
+
+        /// <summary>
+        /// Precomputes and caches the window coefficient table for an FFT
+        /// size. Complex FFTs use the <see cref="RfftScale.Native"/> table.
+        /// </summary>
+        public static void WindowCacheWarm(Window window, int nfft,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            Util.Check(NativeMethods.gn_fft_window_cache_warm(
+                (int)window, (UIntPtr)nfft, (int)scale));
+        }
+
         // ---------------------------------------------------------------
         // Complex FFT  -  normalized double input
         // ---------------------------------------------------------------
@@ -204,5 +274,412 @@ namespace Genalyzer
                 (int)window, (int)format, (int)scale));
             return output;
         }
+
+        // ---------------------------------------------------------------
+        // Single precision  -  16-bit quantized input
+        //
+        // Same as Fft / Rfft, but the transform and the output are single
+        // precision.  Requires genalyzer to be built with the FFTW float
+        // library.
+        // ---------------------------------------------------------------
+
+        /// <summary>
+        /// Computes the complex FFT of split 16-bit quantized I/Q arrays in
+        /// single precision.
+        /// </summary>
+        public static float[] FftSingle(short[] i, short[] q,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftSize(i.Length, q.Length, navg, nfft);
+            var output  = new float[outSize];
+            Util.Check(NativeMethods.gn_fft16f(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the real FFT of a 16-bit quantized input array in single
+        /// precision.
+        /// </summary>
+        public static float[] RfftSingle(short[] input,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftSize(input.Length, navg, nfft);
+            var output  = new float[outSize];
+            Util.Check(NativeMethods.gn_rfft16f(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
+
+        // ---------------------------------------------------------------
+        // Mean-square spectrum
+        //
+        // Same as Fft / Rfft, but each output element is the mean-square
+        // magnitude of one bin; the averaged phase is not computed.  The
+        // output can be passed to FourierAnalysis as is.
+        // ---------------------------------------------------------------
+
+        /// <summary>
+        /// Computes the mean-square spectrum of split normalized I/Q double
+        /// arrays.
+        /// </summary>
+        public static double[] FftMsq(double[] i, double[] q,
+            int navg, int nfft,
+            Window window = Window.NoWindow)
+        {
+            int outSize = FftSize(i.Length, q.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_msq(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                (UIntPtr)navg, (UIntPtr)nfft, (int)window));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square spectrum of split 16-bit quantized I/Q
+        /// arrays.
+        /// </summary>
+        public static double[] FftMsq(short[] i, short[] q,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftSize(i.Length, q.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_msq16(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square spectrum of split 32-bit quantized I/Q
+        /// arrays.
+        /// </summary>
+        public static double[] FftMsq(int[] i, int[] q,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftSize(i.Length, q.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_msq32(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square spectrum of split 64-bit quantized I/Q
+        /// arrays.
+        /// </summary>
+        public static double[] FftMsq(long[] i, long[] q,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftSize(i.Length, q.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_msq64(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square one-sided spectrum of a normalized
+        /// double array.
+        /// </summary>
+        public static double[] RfftMsq(double[] input,
+            int navg, int nfft,
+            Window window = Window.NoWindow,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftSize(input.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_msq(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)scale));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square one-sided spectrum of a 16-bit
+        /// quantized input array.
+        /// </summary>
+        public static double[] RfftMsq(short[] input,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftSize(input.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_msq16(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square one-sided spectrum of a 32-bit
+        /// quantized input array.
+        /// </summary>
+        public static double[] RfftMsq(int[] input,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftSize(input.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_msq32(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the mean-square one-sided spectrum of a 64-bit
+        /// quantized input array.
+        /// </summary>
+        public static double[] RfftMsq(long[] input,
+            int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftSize(input.Length, navg, nfft) / 2;
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_msq64(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
+
+        // ---------------------------------------------------------------
+        // Batched multi-channel FFT
+        //
+        // Input arrays hold nch channels in channel-major order, each
+        // navg * nfft samples, the first sample of each channel stride
+        // elements after that of the previous one (0 for contiguous
+        // channels).  Output row c matches Fft / Rfft of channel c alone.
+        // ---------------------------------------------------------------
+
+        /// <summary>
+        /// Returns the output array length for a batched complex FFT.
+        /// </summary>
+        public static int FftBatchSize(int nch, int nfft)
+        {
+            Util.Check(NativeMethods.gn_fft_batch_size(
+                out UIntPtr sz, (UIntPtr)nch, (UIntPtr)nfft));
+            return (int)sz;
+        }
+
+        /// <summary>
+        /// Returns the output array length for a batched real FFT.
+        /// </summary>
+        public static int RfftBatchSize(int nch, int nfft)
+        {
+            Util.Check(NativeMethods.gn_rfft_batch_size(
+                out UIntPtr sz, (UIntPtr)nch, (UIntPtr)nfft));
+            return (int)sz;
+        }
+
+        /// <summary>
+        /// Computes the complex FFTs of nch channels of split normalized
+        /// I/Q double arrays.
+        /// </summary>
+        public static double[] FftBatch(double[] i, double[] q,
+            int nch, int stride, int navg, int nfft,
+            Window window = Window.NoWindow)
+        {
+            int outSize = FftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_batch(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                (UIntPtr)navg, (UIntPtr)nfft, (int)window));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the complex FFTs of nch channels of split 16-bit
+        /// quantized I/Q arrays.
+        /// </summary>
+        public static double[] FftBatch(short[] i, short[] q,
+            int nch, int stride, int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_batch16(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the complex FFTs of nch channels of split 32-bit
+        /// quantized I/Q arrays.
+        /// </summary>
+        public static double[] FftBatch(int[] i, int[] q,
+            int nch, int stride, int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_batch32(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the complex FFTs of nch channels of split 64-bit
+        /// quantized I/Q arrays.
+        /// </summary>
+        public static double[] FftBatch(long[] i, long[] q,
+            int nch, int stride, int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement)
+        {
+            int outSize = FftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_fft_batch64(
+                output, (UIntPtr)outSize,
+                i, (UIntPtr)i.Length,
+                q, (UIntPtr)q.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the real FFTs of nch channels of a normalized double
+        /// array.
+        /// </summary>
+        public static double[] RfftBatch(double[] input,
+            int nch, int stride, int navg, int nfft,
+            Window window = Window.NoWindow,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_batch(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)scale));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the real FFTs of nch channels of a 16-bit quantized
+        /// input array.
+        /// </summary>
+        public static double[] RfftBatch(short[] input,
+            int nch, int stride, int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_batch16(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the real FFTs of nch channels of a 32-bit quantized
+        /// input array.
+        /// </summary>
+        public static double[] RfftBatch(int[] input,
+            int nch, int stride, int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_batch32(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
+
+        /// <summary>
+        /// Computes the real FFTs of nch channels of a 64-bit quantized
+        /// input array.
+        /// </summary>
+        public static double[] RfftBatch(long[] input,
+            int nch, int stride, int n, int navg, int nfft,
+            Window window = Window.NoWindow,
+            CodeFormat format = CodeFormat.TwosComplement,
+            RfftScale scale = RfftScale.DbfsSin)
+        {
+            int outSize = RfftBatchSize(nch, nfft);
+            var output  = new double[outSize];
+            Util.Check(NativeMethods.gn_rfft_batch64(
+                output, (UIntPtr)outSize,
+                input,  (UIntPtr)input.Length,
+                (UIntPtr)nch, (UIntPtr)stride,
+                n, (UIntPtr)navg, (UIntPtr)nfft,
+                (int)window, (int)format, (int)scale));
+            return output;
+        }
     }
 }
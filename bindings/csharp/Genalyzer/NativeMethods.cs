@@ -155,6 +155,12 @@ namespace Genalyzer
         internal static extern int gn_error_string_size(
             out UIntPtr size);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_get_num_threads(out UIntPtr numThreads);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_set_num_threads(UIntPtr numThreads);
+
         [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern int gn_set_string_termination(
             [MarshalAs(UnmanagedType.I1)] bool nullTerminated);
@@ -278,6 +284,30 @@ namespace Genalyzer
             long min, long max,
             [MarshalAs(UnmanagedType.I1)] bool preserve);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_hist16_parallel(
+            [Out] ulong[]  hist, UIntPtr histSize,
+            [In]  short[]  input, UIntPtr inSize,
+            int n, int format,
+            [MarshalAs(UnmanagedType.I1)] bool preserve);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_histx16_parallel(
+            [Out] ulong[]  hist, UIntPtr histSize,
+            [In]  short[]  input, UIntPtr inSize,
+            long min, long max,
+            [MarshalAs(UnmanagedType.I1)] bool preserve);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_hist_raw(
+            [Out] ulong[]  hist, UIntPtr histSize,
+            [In]  byte[]   buf, UIntPtr bufSize,
+            int n, int containerBits,
+            [MarshalAs(UnmanagedType.I1)] bool leftJustified,
+            [MarshalAs(UnmanagedType.I1)] bool bigEndian,
+            int format, UIntPtr stride, UIntPtr offset, UIntPtr count,
+            [MarshalAs(UnmanagedType.I1)] bool preserve);
+
         [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern int gn_hist_analysis(
             [In, Out] IntPtr[] rkeys, UIntPtr rkeysSize,
@@ -296,6 +326,45 @@ namespace Genalyzer
             [Out]     double[] rvalues, UIntPtr rvaluesSize,
             [In]      double[] inl,  UIntPtr inlSize);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_linearity_analysis(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [Out]     double[] dnl,     UIntPtr dnlSize,
+            [Out]     double[] inl,     UIntPtr inlSize,
+            [In]      ulong[]  hist,    UIntPtr histSize,
+            int type, int fit);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_linearity_analysis16(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [Out]     ulong[]  hist,    UIntPtr histSize,
+            [Out]     double[] dnl,     UIntPtr dnlSize,
+            [Out]     double[] inl,     UIntPtr inlSize,
+            [In]      short[]  input,   UIntPtr inSize,
+            int n, int format, int type, int fit);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_linearity_analysis32(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [Out]     ulong[]  hist,    UIntPtr histSize,
+            [Out]     double[] dnl,     UIntPtr dnlSize,
+            [Out]     double[] inl,     UIntPtr inlSize,
+            [In]      int[]    input,   UIntPtr inSize,
+            int n, int format, int type, int fit);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_linearity_analysis64(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [Out]     ulong[]  hist,    UIntPtr histSize,
+            [Out]     double[] dnl,     UIntPtr dnlSize,
+            [Out]     double[] inl,     UIntPtr inlSize,
+            [In]      long[]   input,   UIntPtr inSize,
+            int n, int format, int type, int fit);
+
         // ===============================================================
         // Fourier Analysis
         // ===============================================================
@@ -438,6 +507,11 @@ namespace Genalyzer
             [MarshalAs(UnmanagedType.LPStr)] string objKey,
             int n);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fa_imd_tones(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [MarshalAs(UnmanagedType.I1)] bool enable);
+
         [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern int gn_fa_load(
             [Out] byte[] buf, UIntPtr size,
@@ -551,6 +625,13 @@ namespace Genalyzer
             [In]  long[]   q,      UIntPtr qSize,
             int n, UIntPtr navg, UIntPtr nfft, int window, int format);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft16f(
+            [Out] float[]  output, UIntPtr outSize,
+            [In]  short[]  i,      UIntPtr iSize,
+            [In]  short[]  q,      UIntPtr qSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
         [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern int gn_fft_size(
             out UIntPtr outSize,
@@ -581,11 +662,525 @@ namespace Genalyzer
             [In]  long[]   input,  UIntPtr inSize,
             int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft16f(
+            [Out] float[]  output, UIntPtr outSize,
+            [In]  short[]  input,  UIntPtr inSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
         [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern int gn_rfft_size(
             out UIntPtr outSize,
             UIntPtr inSize, UIntPtr navg, UIntPtr nfft);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_msq(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  double[] i,      UIntPtr iSize,
+            [In]  double[] q,      UIntPtr qSize,
+            UIntPtr navg, UIntPtr nfft, int window);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_msq16(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  short[] i,      UIntPtr iSize,
+            [In]  short[] q,      UIntPtr qSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_msq32(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  int[]   i,      UIntPtr iSize,
+            [In]  int[]   q,      UIntPtr qSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_msq64(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  long[]  i,      UIntPtr iSize,
+            [In]  long[]  q,      UIntPtr qSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_msq(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  double[] input,  UIntPtr inSize,
+            UIntPtr navg, UIntPtr nfft, int window, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_msq16(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  short[] input,  UIntPtr inSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_msq32(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  int[]   input,  UIntPtr inSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_msq64(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  long[]  input,  UIntPtr inSize,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_batch(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  double[] i,      UIntPtr iSize,
+            [In]  double[] q,      UIntPtr qSize,
+            UIntPtr nch, UIntPtr stride,
+            UIntPtr navg, UIntPtr nfft, int window);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_batch16(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  short[] i,      UIntPtr iSize,
+            [In]  short[] q,      UIntPtr qSize,
+            UIntPtr nch, UIntPtr stride,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_batch32(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  int[]   i,      UIntPtr iSize,
+            [In]  int[]   q,      UIntPtr qSize,
+            UIntPtr nch, UIntPtr stride,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_batch64(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  long[]  i,      UIntPtr iSize,
+            [In]  long[]  q,      UIntPtr qSize,
+            UIntPtr nch, UIntPtr stride,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_batch_size(
+            out UIntPtr outSize, UIntPtr nch, UIntPtr nfft);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_batch(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  double[] input,  UIntPtr inSize,
+            UIntPtr nch, UIntPtr stride,
+            UIntPtr navg, UIntPtr nfft, int window, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_batch16(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  short[] input,  UIntPtr inSize,
+            UIntPtr nch, UIntPtr stride,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_batch32(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  int[]   input,  UIntPtr inSize,
+            UIntPtr nch, UIntPtr stride,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_batch64(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  long[]  input,  UIntPtr inSize,
+            UIntPtr nch, UIntPtr stride,
+            int n, UIntPtr navg, UIntPtr nfft, int window, int format, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_rfft_batch_size(
+            out UIntPtr outSize, UIntPtr nch, UIntPtr nfft);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_set_planner(int planner);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_get_planner(out int planner);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_wisdom_export(
+            [MarshalAs(UnmanagedType.LPStr)] string filename);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_wisdom_import(
+            [MarshalAs(UnmanagedType.LPStr)] string filename);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_wisdom_forget();
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_window_cache_clear();
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_window_cache_size(out UIntPtr size);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_window_cache_warm(
+            int window, UIntPtr nfft, int scale);
+
+        // ===============================================================
+        // Spectrum Averager
+        // ===============================================================
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_create(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            UIntPtr nfft, int window);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_rcreate(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            UIntPtr nfft, int window, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_add(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] double[] i, UIntPtr iSize,
+            [In] double[] q, UIntPtr qSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_add16(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] short[] i, UIntPtr iSize,
+            [In] short[] q, UIntPtr qSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_add32(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] int[] i, UIntPtr iSize,
+            [In] int[] q, UIntPtr qSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_add64(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] long[] i, UIntPtr iSize,
+            [In] long[] q, UIntPtr qSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_radd(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] double[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_radd16(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] short[] input, UIntPtr inSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_radd32(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] int[] input, UIntPtr inSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_radd64(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] long[] input, UIntPtr inSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_get(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_reset(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_count(
+            out UIntPtr count,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sa_size(
+            out UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        // ===============================================================
+        // Sparse Histograms
+        // ===============================================================
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_create(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_createx(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            long min, long max);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_add16(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] short[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_add32(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] int[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_add64(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] long[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_get(
+            [Out] ulong[] hist, UIntPtr histSize, UIntPtr first,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_reset(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_dnl(
+            [Out] double[] dnl, UIntPtr dnlSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            int type);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_analysis(
+            [In, Out] IntPtr[] rkeys, UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_nz_range(
+            out UIntPtr first, out UIntPtr last,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sh_size(
+            out UIntPtr size,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        // ===============================================================
+        // Code Density Accumulators
+        // ===============================================================
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_create(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_createx(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            long min, long max);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_push16(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] short[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_push32(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] int[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_push64(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] long[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_merge(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [MarshalAs(UnmanagedType.LPStr)] string otherKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_reset(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_snapshot(
+            [Out] ulong[] hist, UIntPtr histSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_analysis(
+            [In, Out] IntPtr[] rkeys, UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_counts(
+            out ulong count, out ulong below, out ulong above,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_code_range(
+            out long minCode, out long maxCode,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_cda_size(
+            out UIntPtr size,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        // ===============================================================
+        // FFT Contexts
+        // ===============================================================
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_create(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            UIntPtr navg, UIntPtr nfft, int window);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_rcreate(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            UIntPtr navg, UIntPtr nfft, int window, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_fft(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] double[] i, UIntPtr iSize,
+            [In] double[] q, UIntPtr qSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_fft16(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] short[] i, UIntPtr iSize,
+            [In] short[] q, UIntPtr qSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_fft32(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] int[] i, UIntPtr iSize,
+            [In] int[] q, UIntPtr qSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_fft64(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] long[] i, UIntPtr iSize,
+            [In] long[] q, UIntPtr qSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_rfft(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] double[] input, UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_rfft16(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] short[] input, UIntPtr inSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_rfft32(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] int[] input, UIntPtr inSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_rfft64(
+            [Out] double[] output, UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            [In] long[] input, UIntPtr inSize,
+            int n, int format);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_ac_create(
+            [MarshalAs(UnmanagedType.LPStr)] string objKey,
+            UIntPtr nfft);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_analysis_ctx(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string cfgId,
+            [MarshalAs(UnmanagedType.LPStr)] string ctxKey,
+            [In]      double[] input,   UIntPtr inSize,
+            UIntPtr nfft,
+            int axisType);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_analysis_select_ctx(
+            [Out] double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string cfgId,
+            [MarshalAs(UnmanagedType.LPStr)] string ctxKey,
+            [In]  IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [In]  double[] input,   UIntPtr inSize,
+            UIntPtr nfft,
+            int axisType);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fa_prepare(
+            [MarshalAs(UnmanagedType.LPStr)] string planKey,
+            [MarshalAs(UnmanagedType.LPStr)] string cfgId,
+            UIntPtr nfft,
+            int axisType,
+            [MarshalAs(UnmanagedType.I1)] bool cplx);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_analysis_plan(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey,
+            [In]      double[] input,   UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_analysis_select_plan(
+            [Out] double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey,
+            [In]  IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [In]  double[] input,   UIntPtr inSize);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_analysis_batch(
+            [Out] double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey,
+            [In]  double[] input,   UIntPtr inSize,
+            UIntPtr count);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fft_analysis_sparse(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey,
+            [In]      double[] input,   UIntPtr inSize,
+            UIntPtr navg, int window, int scale);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_fc_size(
+            out UIntPtr outSize,
+            [MarshalAs(UnmanagedType.LPStr)] string objKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_ap_results_key_sizes(
+            [Out] UIntPtr[] keySizes, UIntPtr keySizesSize,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_ap_results_keys(
+            [In, Out] IntPtr[] rkeys, UIntPtr rkeysSize,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_ap_results_size(
+            out UIntPtr size,
+            [MarshalAs(UnmanagedType.LPStr)] string planKey);
+
         // ===============================================================
         // Fourier Utilities
         // ===============================================================
@@ -768,6 +1363,23 @@ namespace Genalyzer
             [In]  long[]   input,  UIntPtr inSize,
             int n, int format);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_normalize_raw(
+            [Out] double[] output, UIntPtr outSize,
+            [In]  byte[]   buf,    UIntPtr bufSize,
+            int n, int containerBits,
+            [MarshalAs(UnmanagedType.I1)] bool leftJustified,
+            [MarshalAs(UnmanagedType.I1)] bool bigEndian,
+            int format, UIntPtr stride, UIntPtr offset);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_raw_sample_count(
+            out UIntPtr count, UIntPtr bufSize,
+            int n, int containerBits,
+            [MarshalAs(UnmanagedType.I1)] bool leftJustified,
+            [MarshalAs(UnmanagedType.I1)] bool bigEndian,
+            int format, UIntPtr stride, UIntPtr offset);
+
         [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern int gn_polyval(
             [Out] double[] output, UIntPtr outSize,
@@ -842,6 +1454,38 @@ namespace Genalyzer
             [Out]     double[] rvalues, UIntPtr rvaluesSize,
             [In]      long[]   input,   UIntPtr inSize);
 
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sine_fit_analysis(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [In]      double[] input,   UIntPtr inSize,
+            double fs, double freq,
+            [MarshalAs(UnmanagedType.I1)] bool fitFreq);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sine_fit_analysis16(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [In]      short[]  input,   UIntPtr inSize,
+            double fs, double freq,
+            [MarshalAs(UnmanagedType.I1)] bool fitFreq);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sine_fit_analysis32(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [In]      int[]    input,   UIntPtr inSize,
+            double fs, double freq,
+            [MarshalAs(UnmanagedType.I1)] bool fitFreq);
+
+        [DllImport(LibName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int gn_sine_fit_analysis64(
+            [In, Out] IntPtr[] rkeys,   UIntPtr rkeysSize,
+            [Out]     double[] rvalues, UIntPtr rvaluesSize,
+            [In]      long[]   input,   UIntPtr inSize,
+            double fs, double freq,
+            [MarshalAs(UnmanagedType.I1)] bool fitFreq);
+
         // ===============================================================
         // Simplified Beta API  (cgenalyzer_simplified_beta.h)
         // ===============================================================
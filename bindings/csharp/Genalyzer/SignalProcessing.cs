@@ -194,6 +194,52 @@ namespace Genalyzer
             return output;
         }
 
+        /// <summary>
+        /// Normalizes raw ADC samples to [-1, 1] doubles without unpacking
+        /// them.  Sample j is container offset + j * stride of containerBits
+        /// bits (default n): 8, 16, 24, or 32 bits are words, other widths are
+        /// packed back to back.  The first count samples are decoded (default:
+        /// RawSampleCount); pass count if pad bits after the last sample fill
+        /// a whole container.
+        /// </summary>
+        public static double[] NormalizeRaw(byte[] buf, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            int containerBits = 0, bool leftJustified = false,
+            bool bigEndian = false, long stride = 1, long offset = 0,
+            long count = -1)
+        {
+            int cb = containerBits > 0 ? containerBits : n;
+            if (count < 0)
+                count = RawSampleCount(buf.Length, n, format, cb,
+                    leftJustified, bigEndian, stride, offset);
+            var output = new double[count];
+            Util.Check(NativeMethods.gn_normalize_raw(
+                output, (UIntPtr)output.Length,
+                buf,    (UIntPtr)buf.Length,
+                n, cb, leftJustified, bigEndian, (int)format,
+                (UIntPtr)stride, (UIntPtr)offset));
+            return output;
+        }
+
+        /// <summary>
+        /// Returns the number of samples in a raw buffer; see NormalizeRaw.
+        /// Pad bits after the last sample count as one more sample if they
+        /// fill a whole container, e.g. three 4-bit samples in two bytes
+        /// count as four.
+        /// </summary>
+        public static long RawSampleCount(long bufSize, int n,
+            CodeFormat format = CodeFormat.TwosComplement,
+            int containerBits = 0, bool leftJustified = false,
+            bool bigEndian = false, long stride = 1, long offset = 0)
+        {
+            Util.Check(NativeMethods.gn_raw_sample_count(
+                out UIntPtr count, (UIntPtr)bufSize,
+                n, containerBits > 0 ? containerBits : n,
+                leftJustified, bigEndian, (int)format,
+                (UIntPtr)stride, (UIntPtr)offset));
+            return (long)count;
+        }
+
         // ---------------------------------------------------------------
         // Polynomial distortion
         // ---------------------------------------------------------------
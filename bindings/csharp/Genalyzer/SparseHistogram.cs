@@ -0,0 +1,111 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+using System.Collections.Generic;
+
+namespace Genalyzer
+{
+    /// <summary>
+    /// Code-density histogram that stores counts only for the code range that
+    /// is hit, for 20- to 30-bit converters.  Bins are indexed like the array
+    /// returned by CodeDensity.Hist.
+    /// </summary>
+    public static class SparseHistogram
+    {
+        // ---------------------------------------------------------------
+        // Creation
+        // ---------------------------------------------------------------
+
+        /// <summary>Creates a sparse histogram for a resolution and code format.</summary>
+        public static void Create(string objKey, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sh_create(objKey, n, (int)format));
+
+        /// <summary>Creates a sparse histogram over [min, max].</summary>
+        public static void CreateX(string objKey, long min, long max)
+            => Util.Check(NativeMethods.gn_sh_createx(objKey, min, max));
+
+        // ---------------------------------------------------------------
+        // Counting
+        // ---------------------------------------------------------------
+
+        /// <summary>Adds a 16-bit waveform; codes out of range are ignored.</summary>
+        public static void Add(string objKey, short[] input)
+            => Util.Check(NativeMethods.gn_sh_add16(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Adds a 32-bit waveform; codes out of range are ignored.</summary>
+        public static void Add(string objKey, int[] input)
+            => Util.Check(NativeMethods.gn_sh_add32(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Adds a 64-bit waveform; codes out of range are ignored.</summary>
+        public static void Add(string objKey, long[] input)
+            => Util.Check(NativeMethods.gn_sh_add64(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Clears all counts.</summary>
+        public static void Reset(string objKey)
+            => Util.Check(NativeMethods.gn_sh_reset(objKey));
+
+        // ---------------------------------------------------------------
+        // Results
+        // ---------------------------------------------------------------
+
+        /// <summary>Returns the counts of bins [first, first + size).</summary>
+        public static ulong[] Get(string objKey, long first, int size)
+        {
+            var hist = new ulong[size];
+            Util.Check(NativeMethods.gn_sh_get(
+                hist, (UIntPtr)size, (UIntPtr)first, objKey));
+            return hist;
+        }
+
+        /// <summary>
+        /// Computes the DNL of bins first to last (see NzRange); all other
+        /// bins are -1.
+        /// </summary>
+        public static double[] Dnl(string objKey,
+            DnlSignal signalType = DnlSignal.Tone)
+        {
+            var (first, last) = NzRange(objKey);
+            var dnl = new double[last - first + 1];
+            Util.Check(NativeMethods.gn_sh_dnl(
+                dnl, (UIntPtr)dnl.Length, objKey, (int)signalType));
+            return dnl;
+        }
+
+        /// <summary>
+        /// Runs histogram analysis and returns a result dictionary.
+        /// Keys: sum, first_nz_index, last_nz_index, nz_range.
+        /// </summary>
+        public static Dictionary<string, double> Analysis(string objKey)
+        {
+            return CodeDensity.RunAnalysis(AnalysisType.Histogram,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_sh_analysis(
+                        rkeys, rkeysSize, rvalues, rvaluesSize, objKey));
+        }
+
+        // ---------------------------------------------------------------
+        // Helpers
+        // ---------------------------------------------------------------
+
+        /// <summary>Returns the first and last non-zero bins.</summary>
+        public static (long First, long Last) NzRange(string objKey)
+        {
+            Util.Check(NativeMethods.gn_sh_nz_range(
+                out UIntPtr first, out UIntPtr last, objKey));
+            return ((long)first, (long)last);
+        }
+
+        /// <summary>Returns the number of bins.</summary>
+        public static long Size(string objKey)
+        {
+            Util.Check(NativeMethods.gn_sh_size(out UIntPtr size, objKey));
+            return (long)size;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+
+namespace Genalyzer
+{
+    /// <summary>
+    /// Streaming spectrum averaging: records are added one at a time, or in
+    /// chunks of whole records, and only running per-bin sums are kept.
+    /// The averaged spectrum matches Fft/Rfft with navg equal to Count.
+    /// </summary>
+    public static class SpectrumAverager
+    {
+        // ---------------------------------------------------------------
+        // Creation
+        // ---------------------------------------------------------------
+
+        /// <summary>Creates a complex spectrum averager with the given key.</summary>
+        public static void Create(string objKey, int nfft,
+            Window window = Window.NoWindow)
+            => Util.Check(NativeMethods.gn_sa_create(
+                objKey, (UIntPtr)nfft, (int)window));
+
+        /// <summary>Creates a real spectrum averager with the given key.</summary>
+        public static void RCreate(string objKey, int nfft,
+            Window window = Window.NoWindow,
+            RfftScale scale = RfftScale.DbfsSin)
+            => Util.Check(NativeMethods.gn_sa_rcreate(
+                objKey, (UIntPtr)nfft, (int)window, (int)scale));
+
+        // ---------------------------------------------------------------
+        // Complex records
+        // ---------------------------------------------------------------
+
+        /// <summary>Adds records of split normalized I/Q data.</summary>
+        public static void Add(string objKey, double[] i, double[] q)
+            => Util.Check(NativeMethods.gn_sa_add(objKey,
+                i, (UIntPtr)i.Length, q, (UIntPtr)q.Length));
+
+        /// <summary>Adds records of split 16-bit quantized I/Q data.</summary>
+        public static void Add(string objKey, short[] i, short[] q, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sa_add16(objKey,
+                i, (UIntPtr)i.Length, q, (UIntPtr)q.Length, n, (int)format));
+
+        /// <summary>Adds records of split 32-bit quantized I/Q data.</summary>
+        public static void Add(string objKey, int[] i, int[] q, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sa_add32(objKey,
+                i, (UIntPtr)i.Length, q, (UIntPtr)q.Length, n, (int)format));
+
+        /// <summary>Adds records of split 64-bit quantized I/Q data.</summary>
+        public static void Add(string objKey, long[] i, long[] q, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sa_add64(objKey,
+                i, (UIntPtr)i.Length, q, (UIntPtr)q.Length, n, (int)format));
+
+        // ---------------------------------------------------------------
+        // Real records
+        // ---------------------------------------------------------------
+
+        /// <summary>Adds records of normalized real data.</summary>
+        public static void RAdd(string objKey, double[] input)
+            => Util.Check(NativeMethods.gn_sa_radd(objKey,
+                input, (UIntPtr)input.Length));
+
+        /// <summary>Adds records of 16-bit quantized real data.</summary>
+        public static void RAdd(string objKey, short[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sa_radd16(objKey,
+                input, (UIntPtr)input.Length, n, (int)format));
+
+        /// <summary>Adds records of 32-bit quantized real data.</summary>
+        public static void RAdd(string objKey, int[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sa_radd32(objKey,
+                input, (UIntPtr)input.Length, n, (int)format));
+
+        /// <summary>Adds records of 64-bit quantized real data.</summary>
+        public static void RAdd(string objKey, long[] input, int n,
+            CodeFormat format = CodeFormat.TwosComplement)
+            => Util.Check(NativeMethods.gn_sa_radd64(objKey,
+                input, (UIntPtr)input.Length, n, (int)format));
+
+        // ---------------------------------------------------------------
+        // Results and state
+        // ---------------------------------------------------------------
+
+        /// <summary>
+        /// Returns the averaged spectrum (interleaved Re/Im) of all records
+        /// added so far.
+        /// </summary>
+        public static double[] Get(string objKey)
+        {
+            Util.Check(NativeMethods.gn_sa_size(out UIntPtr sz, objKey));
+            var output = new double[(int)sz];
+            Util.Check(NativeMethods.gn_sa_get(output, sz, objKey));
+            return output;
+        }
+
+        /// <summary>Discards all records added so far.</summary>
+        public static void Reset(string objKey)
+            => Util.Check(NativeMethods.gn_sa_reset(objKey));
+
+        /// <summary>Returns the number of records added so far.</summary>
+        public static int Count(string objKey)
+        {
+            Util.Check(NativeMethods.gn_sa_count(out UIntPtr count, objKey));
+            return (int)count;
+        }
+    }
+}
@@ -142,6 +142,63 @@ namespace Genalyzer
                         input, (UIntPtr)input.Length));
         }
 
+        /// <summary>
+        /// Fits a sinewave to a normalized double array by least squares
+        /// (IEEE Std 1057 / 1241).  With fitFreq false, freq is exact
+        /// (three-parameter fit); with fitFreq true, freq is an initial
+        /// estimate that is refined (four-parameter fit).
+        /// Keys: ampl, freq, phase, offset, resid_rms, sinad, enob,
+        ///       iterations.
+        /// </summary>
+        public static Dictionary<string, double> SineFitAnalysis(
+            double[] input, double fs, double freq, bool fitFreq = true)
+        {
+            return RunWfAnalysis(AnalysisType.SineFit,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_sine_fit_analysis(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        input, (UIntPtr)input.Length, fs, freq, fitFreq));
+        }
+
+        /// <summary>
+        /// Fits a sinewave to a 16-bit integer array by least squares.
+        /// </summary>
+        public static Dictionary<string, double> SineFitAnalysis(
+            short[] input, double fs, double freq, bool fitFreq = true)
+        {
+            return RunWfAnalysis(AnalysisType.SineFit,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_sine_fit_analysis16(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        input, (UIntPtr)input.Length, fs, freq, fitFreq));
+        }
+
+        /// <summary>
+        /// Fits a sinewave to a 32-bit integer array by least squares.
+        /// </summary>
+        public static Dictionary<string, double> SineFitAnalysis(
+            int[] input, double fs, double freq, bool fitFreq = true)
+        {
+            return RunWfAnalysis(AnalysisType.SineFit,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_sine_fit_analysis32(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        input, (UIntPtr)input.Length, fs, freq, fitFreq));
+        }
+
+        /// <summary>
+        /// Fits a sinewave to a 64-bit integer array by least squares.
+        /// </summary>
+        public static Dictionary<string, double> SineFitAnalysis(
+            long[] input, double fs, double freq, bool fitFreq = true)
+        {
+            return RunWfAnalysis(AnalysisType.SineFit,
+                (rkeys, rkeysSize, rvalues, rvaluesSize) =>
+                    NativeMethods.gn_sine_fit_analysis64(
+                        rkeys, rkeysSize, rvalues, rvaluesSize,
+                        input, (UIntPtr)input.Length, fs, freq, fitFreq));
+        }
+
         // ---------------------------------------------------------------
         // Private helpers
         // ---------------------------------------------------------------
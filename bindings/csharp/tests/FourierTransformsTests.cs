@@ -0,0 +1,100 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+
+using System;
+using Genalyzer;
+using Xunit;
+
+namespace Genalyzer.Tests
+{
+    [Collection("Genalyzer")]
+    public sealed class FourierTransformsTests
+    {
+        private const int Res = 12;
+
+        // A 12-bit tone with noise, as split I/Q codes.
+        private static (short[] I, short[] Q) Codes(int size)
+        {
+            var rng = new Random(5);
+            var i = new short[size];
+            var q = new short[size];
+            for (int k = 0; k < size; k++)
+            {
+                double u = rng.NextDouble() - 0.5;
+                i[k] = (short)Math.Round(1800.0 * Math.Sin(0.0913 * k) + u);
+                q[k] = (short)Math.Round(1800.0 * Math.Cos(0.0913 * k) + u);
+            }
+            return (i, q);
+        }
+
+        // Single-precision results must be within float rounding of the
+        // double results, relative to the largest output.  Averaged spectra
+        // hold the mean phase of the records, which jumps when one record
+        // wraps at +/-pi, so only their magnitudes are compared.
+        private static void AssertClose(float[] single, double[] dbl, int navg,
+            int nfft)
+        {
+            Assert.Equal(dbl.Length, single.Length);
+            double peak = 0.0;
+            foreach (double x in dbl)
+                peak = Math.Max(peak, Math.Abs(x));
+            double tol = 4.0 * Math.Log2(nfft) * 1.2e-7 * peak;
+            for (int k = 0; k < dbl.Length; k += 2)
+            {
+                if (1 == navg)
+                {
+                    Assert.InRange(single[k] - dbl[k], -tol, tol);
+                    Assert.InRange(single[k + 1] - dbl[k + 1], -tol, tol);
+                }
+                else
+                {
+                    double m1 = Math.Sqrt((double)single[k] * single[k]
+                        + (double)single[k + 1] * single[k + 1]);
+                    double m2 = Math.Sqrt(dbl[k] * dbl[k] + dbl[k + 1] * dbl[k + 1]);
+                    Assert.InRange(m1 - m2, -tol, tol);
+                }
+            }
+        }
+
+        [Theory]
+        [InlineData(1, 1024)]
+        [InlineData(4, 1024)]
+        public void SinglePrecision_MatchesDouble(int navg, int nfft)
+        {
+            (short[] i, short[] q) = Codes(navg * nfft);
+            float[] fft;
+            try
+            {
+                fft = FourierTransforms.FftSingle(i, q, Res, navg, nfft,
+                    Window.BlackmanHarris);
+            }
+            catch (GenalyzerException e)
+                when (e.Message.Contains("single-precision FFTs are not available"))
+            {
+                // Built without the FFTW float library: the real FFT must
+                // fail the same way.
+                Assert.Throws<GenalyzerException>(() =>
+                    FourierTransforms.RfftSingle(i, Res, navg, nfft));
+                return;
+            }
+            AssertClose(fft, FourierTransforms.Fft(i, q, Res, navg, nfft,
+                Window.BlackmanHarris), navg, nfft);
+            AssertClose(FourierTransforms.RfftSingle(i, Res, navg, nfft,
+                    Window.Hann, CodeFormat.TwosComplement, RfftScale.DbfsSin),
+                FourierTransforms.Rfft(i, Res, navg, nfft,
+                    Window.Hann, CodeFormat.TwosComplement, RfftScale.DbfsSin),
+                navg, nfft);
+        }
+
+        [Fact]
+        public void Planner_GetterRestoresPreviousSetting()
+        {
+            FftPlanner saved = FourierTransforms.GetPlanner();
+            FourierTransforms.SetPlanner(FftPlanner.Measure);
+            Assert.Equal(FftPlanner.Measure, FourierTransforms.GetPlanner());
+            FourierTransforms.SetPlanner(saved);
+            Assert.Equal(saved, FourierTransforms.GetPlanner());
+        }
+    }
+}
@@ -8,6 +8,8 @@ __author__ = "Analog Devices, Inc."
 
 
 from .pygenalyzer import (
+    get_num_threads,
+    set_num_threads,
     abs,
     angle,
     db,
@@ -20,9 +22,12 @@ from .pygenalyzer import (
     dnl_analysis,
     hist,
     histx,
+    hist_raw,
     hist_analysis,
     inl,
     inl_analysis,
+    linearity_analysis,
+    linearity_analysis_wf,
     fft_analysis,
     fa_analysis_band,
     fa_clk,
@@ -37,6 +42,7 @@ from .pygenalyzer import (
     fa_hd,
     fa_ilv,
     fa_imd,
+    fa_imd_tones,
     fa_load,
     fa_max_tone,
     fa_preview,
@@ -53,6 +59,56 @@ from .pygenalyzer import (
     fa_result_string,
     fft,
     rfft,
+    fft16f,
+    rfft16f,
+    fft_msq,
+    rfft_msq,
+    fft_batch,
+    rfft_batch,
+    fft_get_planner,
+    fft_set_planner,
+    fft_wisdom_export,
+    fft_wisdom_import,
+    fft_wisdom_forget,
+    fft_window_cache_clear,
+    fft_window_cache_size,
+    fft_window_cache_warm,
+    sa_create,
+    sa_rcreate,
+    sa_add,
+    sa_radd,
+    sa_get,
+    sa_reset,
+    sa_count,
+    sh_create,
+    sh_createx,
+    sh_add,
+    sh_get,
+    sh_reset,
+    sh_dnl,
+    sh_analysis,
+    sh_nz_range,
+    sh_size,
+    cda_create,
+    cda_createx,
+    cda_push,
+    cda_merge,
+    cda_reset,
+    cda_snapshot,
+    cda_analysis,
+    cda_counts,
+    cda_code_range,
+    cda_size,
+    fc_create,
+    fc_rcreate,
+    fc_fft,
+    fc_rfft,
+    ac_create,
+    fft_analysis_ctx,
+    fa_prepare,
+    fft_analysis_plan,
+    fft_analysis_batch,
+    fft_analysis_sparse,
     alias,
     coherent,
     fftshift,
@@ -69,6 +125,8 @@ from .pygenalyzer import (
     downsample,
     fshift,
     normalize,
+    normalize_raw,
+    raw_sample_count,
     polyval,
     quantize16,
     quantize32,
@@ -78,11 +136,13 @@ from .pygenalyzer import (
     gaussian,
     ramp,
     sin,
+    sine_fit_analysis,
     wf_analysis,
     CodeFormat,
     DnlSignal,
     FaCompTag,
     FaSsb,
+    FftPlanner,
     FreqAxisFormat,
     FreqAxisType,
     InlLineFit,
@@ -25,12 +25,17 @@ _c_int16 = _ctypes.c_int16
 _c_int32 = _ctypes.c_int32
 _c_int64 = _ctypes.c_int64
 _c_size_t = _ctypes.c_size_t
+_c_uint64 = _ctypes.c_uint64
 
 _c_bool_p = _ctypes.POINTER(_c_bool)
 _c_char_p_p = _ctypes.POINTER(_c_char_p)
 _c_double_p = _ctypes.POINTER(_c_double)
+_c_int_p = _ctypes.POINTER(_c_int)
+_c_int64_p = _ctypes.POINTER(_c_int64)
 _c_size_t_p = _ctypes.POINTER(_c_size_t)
+_c_uint64_p = _ctypes.POINTER(_c_uint64)
 
+_ndptr_f32_1d = _ndptr(dtype=_np.float32, ndim=1)
 _ndptr_f64_1d = _ndptr(dtype=_np.float64, ndim=1)
 _ndptr_i16_1d = _ndptr(dtype=_np.int16, ndim=1)
 _ndptr_i32_1d = _ndptr(dtype=_np.int32, ndim=1)
@@ -38,6 +43,7 @@ _ndptr_i64_1d = _ndptr(dtype=_np.int64, ndim=1)
 _ndptr_u16_1d = _ndptr(dtype=_np.uint16, ndim=1)
 _ndptr_u32_1d = _ndptr(dtype=_np.uint32, ndim=1)
 _ndptr_u64_1d = _ndptr(dtype=_np.uint64, ndim=1)
+_ndptr_u8_1d = _ndptr(dtype=_np.uint8, ndim=1)
 del _ndptr
 
 _lib, _libpath = _load_genalyzer_library()
@@ -144,6 +150,8 @@ class _AnalysisType(_IntEnum):  # Intentionally private
     HISTOGRAM = _enum_value("AnalysisType", "Histogram")
     INL = _enum_value("AnalysisType", "INL")
     WAVEFORM = _enum_value("AnalysisType", "Waveform")
+    SINE_FIT = _enum_value("AnalysisType", "SineFit")
+    LINEARITY = _enum_value("AnalysisType", "Linearity")
 
 
 class CodeFormat(_IntEnum):
@@ -228,6 +236,22 @@ class FaSsb(_IntEnum):
     WO = _enum_value("FASsb", "WO")
 
 
+class FftPlanner(_IntEnum):
+    """Specifies the FFTW planner effort used when creating FFT plans.
+
+    Attributes:
+        ``ESTIMATE`` : Heuristic plan, no measurement (default)
+
+        ``MEASURE`` : Time several candidate plans
+
+        ``PATIENT`` : Time a wider range of candidate plans
+    """
+
+    ESTIMATE = _enum_value("FftPlanner", "Estimate")
+    MEASURE = _enum_value("FftPlanner", "Measure")
+    PATIENT = _enum_value("FftPlanner", "Patient")
+
+
 class FreqAxisFormat(_IntEnum):
     """Enumerates frequency axis formats
 
@@ -317,6 +341,32 @@ del _IntEnum
 API Utilities
 """
 
+_lib.gn_get_num_threads.argtypes = [_c_size_t_p]
+_lib.gn_set_num_threads.argtypes = [_c_size_t]
+
+
+def get_num_threads():
+    """
+    Get the number of threads used by parallel algorithms
+
+    Returns:
+        ``num_threads`` (``int``) : Thread count
+    """
+    num_threads = _c_size_t(0)
+    result = _lib.gn_get_num_threads(_ctypes.byref(num_threads))
+    _raise_exception_on_failure(result)
+    return num_threads.value
+
+
+def set_num_threads(num_threads):
+    """
+    Set the number of threads used by parallel algorithms
+
+    Args:
+        ``num_threads`` (``int``) : Thread count; 0 selects the hardware concurrency. The default, 1, keeps all computation on the calling thread.
+    """
+    _lib.gn_set_num_threads(num_threads)
+
 
 def _version_string():
     size = _c_size_t(0)
@@ -552,6 +602,39 @@ _lib.gn_histx64.argtypes = [
     _c_int64,
     _c_bool,
 ]
+_lib.gn_hist16_parallel.argtypes = [
+    _ndptr_u64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_bool,
+]
+_lib.gn_histx16_parallel.argtypes = [
+    _ndptr_u64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int64,
+    _c_int64,
+    _c_bool,
+]
+_lib.gn_hist_raw.argtypes = [
+    _ndptr_u64_1d,
+    _c_size_t,
+    _ndptr_u8_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_bool,
+    _c_bool,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_bool,
+]
 _lib.gn_hist_analysis.argtypes = [
     _c_char_p_p,
     _c_size_t,
@@ -569,6 +652,74 @@ _lib.gn_inl_analysis.argtypes = [
     _ndptr_f64_1d,
     _c_size_t,
 ]
+_lib.gn_linearity_analysis.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_u64_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_linearity_analysis16.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_u64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_linearity_analysis32.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_u64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_linearity_analysis64.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_u64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+    _c_int,
+]
 
 
 def code_axis(n, fmt=CodeFormat.TWOS_COMPLEMENT):
@@ -689,7 +840,7 @@ def dnl_analysis(a):
     return results
 
 
-def hist(a, n, fmt=CodeFormat.TWOS_COMPLEMENT):
+def hist(a, n, fmt=CodeFormat.TWOS_COMPLEMENT, parallel=False):
     """Compute a code density histogram of a quantized waveform.
 
     Each bin counts the number of occurrences of each code value. Used as
@@ -703,6 +854,9 @@ def hist(a, n, fmt=CodeFormat.TWOS_COMPLEMENT):
         ADC resolution in bits.
     fmt : CodeFormat
         Binary code format (default: TWOS_COMPLEMENT).
+    parallel : bool
+        If True and ``a`` is 'int16', count on ``get_num_threads()`` threads
+        (default: False).  The result is the same.
 
     Returns
     -------
@@ -715,7 +869,9 @@ def hist(a, n, fmt=CodeFormat.TWOS_COMPLEMENT):
     result = _lib.gn_code_density_size(_ctypes.byref(size), n, fmt)
     _raise_exception_on_failure(result)
     out = _np.zeros(size.value, dtype="uint64")
-    if "int16" == dtype:
+    if "int16" == dtype and parallel:
+        result = _lib.gn_hist16_parallel(out, out.size, a, a.size, n, fmt, False)
+    elif "int16" == dtype:
         result = _lib.gn_hist16(out, out.size, a, a.size, n, fmt, False)
     elif "int32" == dtype:
         result = _lib.gn_hist32(out, out.size, a, a.size, n, fmt, False)
@@ -725,7 +881,7 @@ def hist(a, n, fmt=CodeFormat.TWOS_COMPLEMENT):
     return out
 
 
-def histx(a, min_code, max_code):
+def histx(a, min_code, max_code, parallel=False):
     """Compute a code density histogram using explicit code bounds.
 
     Each bin counts occurrences of codes from min_code to max_code. Use this
@@ -739,6 +895,9 @@ def histx(a, min_code, max_code):
         Minimum code value.
     max_code : int
         Maximum code value.
+    parallel : bool
+        If True and ``a`` is 'int16', count on ``get_num_threads()`` threads
+        (default: False).  The result is the same.
 
     Returns
     -------
@@ -751,12 +910,95 @@ def histx(a, min_code, max_code):
     result = _lib.gn_code_densityx_size(_ctypes.byref(size), min_code, max_code)
     _raise_exception_on_failure(result)
     out = _np.zeros(size.value, dtype="uint64")
-    if "int16" == dtype:
-        result = _lib.gn_histx16(out, out.size, a, a.size, min, max, False)
+    if "int16" == dtype and parallel:
+        result = _lib.gn_histx16_parallel(
+            out, out.size, a, a.size, min_code, max_code, False
+        )
+    elif "int16" == dtype:
+        result = _lib.gn_histx16(out, out.size, a, a.size, min_code, max_code, False)
     elif "int32" == dtype:
-        result = _lib.gn_histx32(out, out.size, a, a.size, min, max, False)
+        result = _lib.gn_histx32(out, out.size, a, a.size, min_code, max_code, False)
     else:
-        result = _lib.gn_histx64(out, out.size, a, a.size, min, max, False)
+        result = _lib.gn_histx64(out, out.size, a, a.size, min_code, max_code, False)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def hist_raw(
+    buf,
+    n,
+    fmt=CodeFormat.TWOS_COMPLEMENT,
+    container_bits=None,
+    left_justified=False,
+    big_endian=False,
+    stride=1,
+    offset=0,
+    count=None,
+):
+    """Compute a code density histogram directly from raw ADC samples.
+
+    The buffer is a stream of containers of ``container_bits`` bits each;
+    sample j is container ``offset + j * stride``.  With 8, 16, 24, or 32
+    container bits, containers are words of that many bytes; otherwise they
+    are packed back to back, e.g. two 12-bit samples in three bytes.  Samples
+    are decoded a block at a time, without an intermediate array.
+
+    Parameters
+    ----------
+    buf : ndarray of dtype 'uint8'
+        Raw sample buffer (e.g. ``a.view('uint8')`` of another array).
+    n : int
+        ADC resolution in bits.
+    fmt : CodeFormat
+        Binary code format (default: TWOS_COMPLEMENT).
+    container_bits : int
+        Bits per container, from ``n`` to 32 (default: ``n``, i.e. packed).
+    left_justified : bool
+        If True, codes are in the most significant container bits (default:
+        False).
+    big_endian : bool
+        Byte order of words, or bit order of packed containers (default:
+        False).
+    stride : int
+        Containers per sample, e.g. the number of interleaved channels
+        (default: 1).
+    offset : int
+        Index of the first container, e.g. the channel (default: 0).
+    count : int
+        Number of samples, from the first (default: ``raw_sample_count``).
+        Pass it if pad bits after the last sample fill a whole container.
+
+    Returns
+    -------
+    out : ndarray of dtype 'uint64'
+        Array of bin counts, identical to ``hist`` of the decoded codes.
+
+    """
+    _check_ndarray(buf, "uint8")
+    container_bits = n if container_bits is None else container_bits
+    if count is None:
+        count = raw_sample_count(
+            buf.size, n, fmt, container_bits, left_justified, big_endian, stride, offset
+        )
+    size = _c_size_t(0)
+    result = _lib.gn_code_density_size(_ctypes.byref(size), n, fmt)
+    _raise_exception_on_failure(result)
+    out = _np.zeros(size.value, dtype="uint64")
+    result = _lib.gn_hist_raw(
+        out,
+        out.size,
+        buf,
+        buf.size,
+        n,
+        container_bits,
+        left_justified,
+        big_endian,
+        fmt,
+        stride,
+        offset,
+        count,
+        False,
+    )
     _raise_exception_on_failure(result)
     return out
 
@@ -853,6 +1095,130 @@ def inl_analysis(a):
     return results
 
 
+def linearity_analysis(a, signal_type=DnlSignal.TONE, fit=InlLineFit.BEST_FIT):
+    """Compute DNL, INL, and their summary statistics from a histogram array.
+
+    Equivalent to ``hist_analysis()``, ``dnl()``, ``dnl_analysis()``,
+    ``inl()``, and ``inl_analysis()``, with identical results, in fewer passes
+    over the histogram.
+
+    Parameters
+    ----------
+    a : ndarray of dtype 'uint64'
+        Histogram data (from ``hist()`` or ``histx()``).
+    signal_type : DnlSignal
+        Type of stimulus signal used to generate the histogram (RAMP or TONE).
+    fit : InlLineFit
+        Line fitting method (default: BEST_FIT).
+
+    Returns
+    -------
+    dnl : ndarray of dtype 'float64'
+        DNL values in LSBs.
+    inl : ndarray of dtype 'float64'
+        INL values in LSBs.
+    results : dict
+        Every Key:Value pair in the dictionary is str:float.  The keys are
+        those of ``hist_analysis()``, ``dnl_analysis()``, and
+        ``inl_analysis()``, prefixed with 'hist_', 'dnl_', and 'inl_'.
+
+    """
+    _check_ndarray(a, "uint64")
+    dnl = _np.empty(a.size, dtype="float64")
+    inl = _np.empty(a.size, dtype="float64")
+    keys, values = _get_analysis_containers(_AnalysisType.LINEARITY)
+    result = _lib.gn_linearity_analysis(
+        keys,
+        len(keys),
+        values,
+        len(values),
+        dnl,
+        dnl.size,
+        inl,
+        inl.size,
+        a,
+        a.size,
+        signal_type,
+        fit,
+    )
+    _raise_exception_on_failure(result)
+    return dnl, inl, _make_results_dict(keys, values)
+
+
+def linearity_analysis_wf(
+    a,
+    n,
+    fmt=CodeFormat.TWOS_COMPLEMENT,
+    signal_type=DnlSignal.TONE,
+    fit=InlLineFit.BEST_FIT,
+):
+    """Compute the histogram, DNL, INL, and their summary statistics from a
+    quantized waveform.
+
+    Equivalent to ``hist()`` followed by ``linearity_analysis()``, with
+    identical results.
+
+    Parameters
+    ----------
+    a : ndarray of dtype 'int16', 'int32', or 'int64'
+        Quantized waveform.
+    n : int
+        ADC resolution in bits.
+    fmt : CodeFormat
+        Binary code format (default: TWOS_COMPLEMENT).
+    signal_type : DnlSignal
+        Type of stimulus signal (RAMP or TONE).
+    fit : InlLineFit
+        Line fitting method (default: BEST_FIT).
+
+    Returns
+    -------
+    hist : ndarray of dtype 'uint64'
+        Array of bin counts, one per code value.
+    dnl : ndarray of dtype 'float64'
+        DNL values in LSBs.
+    inl : ndarray of dtype 'float64'
+        INL values in LSBs.
+    results : dict
+        See ``linearity_analysis()``.
+
+    """
+    dtype = _check_ndarray(a, ["int16", "int32", "int64"])
+    size = _c_size_t(0)
+    result = _lib.gn_code_density_size(_ctypes.byref(size), n, fmt)
+    _raise_exception_on_failure(result)
+    hist = _np.empty(size.value, dtype="uint64")
+    dnl = _np.empty(size.value, dtype="float64")
+    inl = _np.empty(size.value, dtype="float64")
+    keys, values = _get_analysis_containers(_AnalysisType.LINEARITY)
+    if "int16" == dtype:
+        fn = _lib.gn_linearity_analysis16
+    elif "int32" == dtype:
+        fn = _lib.gn_linearity_analysis32
+    else:
+        fn = _lib.gn_linearity_analysis64
+    result = fn(
+        keys,
+        len(keys),
+        values,
+        len(values),
+        hist,
+        hist.size,
+        dnl,
+        dnl.size,
+        inl,
+        inl.size,
+        a,
+        a.size,
+        n,
+        fmt,
+        signal_type,
+        fit,
+    )
+    _raise_exception_on_failure(result)
+    return hist, dnl, inl, _make_results_dict(keys, values)
+
+
 """
 Fourier Analysis
 """
@@ -1262,6 +1628,25 @@ def fa_imd(test_key, n):
     _raise_exception_on_failure(result)
 
 
+def fa_imd_tones(test_key, enable):
+    """Enable or disable IMD tone results.
+
+    When disabled, IMD products are enumerated numerically when the analysis
+    is compiled, dropped if outside the analysis band, and merged if they land
+    on the same bins.  They still contribute to the IMD, THD, and distortion
+    results and to SFDR, but have no tone results.  Use for configurations
+    with many signal tones.
+
+    Args:
+        ``test_key`` (``str``) : Test key (key to a Fourier Analysis object)
+
+        ``enable`` (``bool``) : If True, report each IMD product as a tone
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_fa_imd_tones(test_key, enable)
+    _raise_exception_on_failure(result)
+
+
 def fa_load(filename, test_key=""):
     """Load a Fourier analysis configuration from a JSON file.
 
@@ -1701,6 +2086,19 @@ _lib.gn_fft16.argtypes = [
     _c_int,
     _c_int,
 ]
+_lib.gn_fft16f.argtypes = [
+    _ndptr_f32_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
 _lib.gn_fft32.argtypes = [
     _ndptr_f64_1d,
     _c_size_t,
@@ -1750,6 +2148,18 @@ _lib.gn_rfft16.argtypes = [
     _c_int,
     _c_int,
 ]
+_lib.gn_rfft16f.argtypes = [
+    _ndptr_f32_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
 _lib.gn_rfft32.argtypes = [
     _ndptr_f64_1d,
     _c_size_t,
@@ -1775,32 +2185,248 @@ _lib.gn_rfft64.argtypes = [
     _c_int,
 ]
 _lib.gn_rfft_size.argtypes = [_c_size_t_p, _c_size_t, _c_size_t, _c_size_t]
+_lib.gn_fft_msq.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+]
+_lib.gn_fft_msq16.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fft_msq32.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fft_msq64.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_msq.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_msq16.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_msq32.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_msq64.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fft_batch.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+]
+_lib.gn_fft_batch16.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fft_batch32.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fft_batch64.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fft_batch_size.argtypes = [_c_size_t_p, _c_size_t, _c_size_t]
+_lib.gn_rfft_batch.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_batch16.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_batch32.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_batch64.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_int,
+]
+_lib.gn_rfft_batch_size.argtypes = [_c_size_t_p, _c_size_t, _c_size_t]
+_lib.gn_fft_get_planner.argtypes = [_c_int_p]
+_lib.gn_fft_set_planner.argtypes = [_c_int]
+_lib.gn_fft_wisdom_export.argtypes = [_c_char_p]
+_lib.gn_fft_wisdom_import.argtypes = [_c_char_p]
+_lib.gn_fft_window_cache_size.argtypes = [_c_size_t_p]
+_lib.gn_fft_window_cache_warm.argtypes = [_c_int, _c_size_t, _c_int]
+
+
+def fft(a, *args):
+    """
+    Compute FFT
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``complex128``, ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``args`` (``list``) : Additional arguments
+            1. If ``a`` is of type ``complex128`` or ``float64``, then compute the FFT of interleaved normalized samples with the following interpretation.
+
+                ``navg`` (``int``) : FFT averaging number
+
+                ``nfft`` (``int``) : FFT size
+
+                ``window`` (``Window``): Window
+
+                In this case, if ``a`` is not complex, then a is interpreted to contain interleaved I/Q samples with the following interpretation.
+
+            2. If ``a`` is of type ``float64``, then compute the FFT of split normalized samples.
+
+                ``q`` (``float64``) : Quadrature component
+
+                ``navg`` (``int``) : FFT averaging number
 
-
-def fft(a, *args):
-    """
-    Compute FFT
-
-    Args:
-        ``a`` (``ndarray``) : Input array of type ``complex128``, ``float64``, ``int16``, ``int32``, or ``int64``
-
-        ``args`` (``list``) : Additional arguments
-            1. If ``a`` is of type ``complex128`` or ``float64``, then compute the FFT of interleaved normalized samples with the following interpretation.
-
-                ``navg`` (``int``) : FFT averaging number
-
-                ``nfft`` (``int``) : FFT size
-
-                ``window`` (``Window``): Window
-
-                In this case, if ``a`` is not complex, then a is interpreted to contain interleaved I/Q samples with the following interpretation.
-
-            2. If ``a`` is of type ``float64``, then compute the FFT of split normalized samples.
-
-                ``q`` (``float64``) : Quadrature component
-
-                ``navg`` (``int``) : FFT averaging number
-
                 ``nfft`` (``int``) : FFT size
 
                 ``window`` (``Window``): Window
@@ -1841,50 +2467,10 @@ def fft(a, *args):
         ``out`` (``ndarray``) : FFT result of type ``float64`` with interleaved Re/Im components
 
     """
-    dtype = _check_ndarray(a, ["complex128", "float64", "int16", "int32", "int64"])
-    nargs = len(args)
-    q_data = _np.empty(0, dtype=dtype)
-    q_size = 0
-    base_index = 0
-    if dtype in ["complex128", "float64"]:  # normalized samples
-        if "complex128" == dtype:
-            i_data = a.view("float64")
-            q_data.dtype = "float64"
-        else:
-            i_data = a
-            if 0 < nargs and isinstance(args[0], _np.ndarray):  # arg[0] is Q data
-                _check_ndarray(args[0], dtype)
-                q_data = args[0]
-                q_size = q_data.size
-                base_index = 1
-        i_size = i_data.size
-        navg = 1 if nargs <= base_index else args[base_index]
-        nfft = 0 if nargs <= base_index + 1 else args[base_index + 1]
-        window = Window.NO_WINDOW if nargs <= base_index + 2 else args[base_index + 2]
-        n = None
-        fmt = None
-    else:  # quantized samples
-        i_data = a
-        i_size = i_data.size
-        if 0 < nargs and isinstance(args[0], _np.ndarray):  # arg[0] is Q data
-            _check_ndarray(args[0], dtype)
-            q_data = args[0]
-            q_size = q_data.size
-            base_index = 1
-        if nargs <= base_index:
-            raise Exception("Missing required parameter, n, code width")
-        n = args[base_index]
-        navg = 1 if nargs <= base_index + 1 else args[base_index + 1]
-        nfft = 0 if nargs <= base_index + 2 else args[base_index + 2]
-        window = Window.NO_WINDOW if nargs <= base_index + 3 else args[base_index + 3]
-        fmt = (
-            CodeFormat.TWOS_COMPLEMENT
-            if nargs <= base_index + 4
-            else args[base_index + 4]
-        )
+    dtype, i_data, i_size, q_data, q_size, n, navg, nfft, window, fmt = _fft_args(
+        a, args
+    )
     out_size = _c_size_t(0)
-    navg = max(0, navg)
-    nfft = max(0, nfft)
     result = _lib.gn_fft_size(_ctypes.byref(out_size), i_size, q_size, navg, nfft)
     _raise_exception_on_failure(result)
     out = _np.empty(out_size.value // 2, dtype="complex128")
@@ -1939,84 +2525,1620 @@ def fft(a, *args):
     return out
 
 
-def rfft(a, *args):
+def fft16f(a, *args):
+    """
+    Compute FFT of 16-bit quantized data in single precision
+
+    Requires genalyzer to be built with the FFTW float library.
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``int16``
+
+        ``args`` (``list``) : Additional arguments, as for ``fft`` with quantized samples
+
+    Returns:
+        ``out`` (``ndarray``) : FFT result of type ``complex64``
+
+    """
+    _check_ndarray(a, "int16")
+    dtype, i_data, i_size, q_data, q_size, n, navg, nfft, window, fmt = _fft_args(
+        a, args
+    )
+    out_size = _c_size_t(0)
+    result = _lib.gn_fft_size(_ctypes.byref(out_size), i_size, q_size, navg, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty(out_size.value // 2, dtype="complex64")
+    outf32 = out.view("float32")
+    result = _lib.gn_fft16f(
+        outf32, outf32.size, i_data, i_size, q_data, q_size, n, navg, nfft, window, fmt
+    )
+    _raise_exception_on_failure(result)
+    return out
+
+
+def fft_msq(a, *args):
+    """
+    Compute the averaged mean-square spectrum of complex data
+
+    Same as ``fft``, but returns the mean-square magnitude of each bin.  The averaged phase is not computed, which makes averaging much faster.  The result equals ``norm(fft(a, *args))`` and can be passed directly to ``fft_analysis`` (phase results are then unavailable).
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``complex128``, ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``args`` (``list``) : Additional arguments, as for ``fft``
+
+    Returns:
+        ``out`` (``ndarray``) : Mean-square spectrum of type ``float64``
+    """
+    dtype, i_data, i_size, q_data, q_size, n, navg, nfft, window, fmt = _fft_args(
+        a, args
+    )
+    out_size = _c_size_t(0)
+    result = _lib.gn_fft_size(_ctypes.byref(out_size), i_size, q_size, navg, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty(out_size.value // 2, dtype="float64")
+    if "complex128" == dtype or "float64" == dtype:
+        result = _lib.gn_fft_msq(
+            out, out.size, i_data, i_size, q_data, q_size, navg, nfft, window
+        )
+    else:
+        func = {
+            "int16": _lib.gn_fft_msq16,
+            "int32": _lib.gn_fft_msq32,
+            "int64": _lib.gn_fft_msq64,
+        }[str(dtype)]
+        result = func(
+            out, out.size, i_data, i_size, q_data, q_size, n, navg, nfft, window, fmt
+        )
+    _raise_exception_on_failure(result)
+    return out
+
+
+def _fft_args(a, args):
+    dtype = _check_ndarray(a, ["complex128", "float64", "int16", "int32", "int64"])
+    nargs = len(args)
+    q_data = _np.empty(0, dtype=dtype)
+    q_size = 0
+    base_index = 0
+    if dtype in ["complex128", "float64"]:  # normalized samples
+        if "complex128" == dtype:
+            i_data = a.view("float64")
+            q_data.dtype = "float64"
+        else:
+            i_data = a
+            if 0 < nargs and isinstance(args[0], _np.ndarray):  # arg[0] is Q data
+                _check_ndarray(args[0], dtype)
+                q_data = args[0]
+                q_size = q_data.size
+                base_index = 1
+        i_size = i_data.size
+        navg = 1 if nargs <= base_index else args[base_index]
+        nfft = 0 if nargs <= base_index + 1 else args[base_index + 1]
+        window = Window.NO_WINDOW if nargs <= base_index + 2 else args[base_index + 2]
+        n = None
+        fmt = None
+    else:  # quantized samples
+        i_data = a
+        i_size = i_data.size
+        if 0 < nargs and isinstance(args[0], _np.ndarray):  # arg[0] is Q data
+            _check_ndarray(args[0], dtype)
+            q_data = args[0]
+            q_size = q_data.size
+            base_index = 1
+        if nargs <= base_index:
+            raise Exception("Missing required parameter, n, code width")
+        n = args[base_index]
+        navg = 1 if nargs <= base_index + 1 else args[base_index + 1]
+        nfft = 0 if nargs <= base_index + 2 else args[base_index + 2]
+        window = Window.NO_WINDOW if nargs <= base_index + 3 else args[base_index + 3]
+        fmt = (
+            CodeFormat.TWOS_COMPLEMENT
+            if nargs <= base_index + 4
+            else args[base_index + 4]
+        )
+    navg = max(0, navg)
+    nfft = max(0, nfft)
+    return dtype, i_data, i_size, q_data, q_size, n, navg, nfft, window, fmt
+
+
+def rfft(a, *args):
+    """
+    Compute Real-FFT
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``args`` (``list``) : Additional arguments
+            1. If ``a`` is of type ``float64``, then compute the real-FFT of normalized samples with the following interpretation.
+
+                ``navg`` (``int``) : FFT averaging number
+
+                ``nfft`` (``int``) : FFT size
+
+                ``window`` (``Window``): Window
+
+                ``scale`` (``RfftScale``): Scaling mode
+
+            2. If ``a`` is of type ``int16``, ``int32``, or ``int64``, then compute the FFT of interleaved quantized samples with the following interpretation.
+
+                ``n`` (``int``) : Resolution (Bitwidth of a)
+
+                ``navg`` (``int``) : FFT averaging number
+
+                ``nfft`` (``int``) : FFT size
+
+                ``window`` (``Window``): Window
+
+                ``fmt`` (``CodeFormat``): Code format
+
+                ``scale`` (``RfftScale``): Scaling mode
+
+    Returns:
+        ``out`` (``ndarray``) : FFT result of type ``float64`` with interleaved Re/Im components
+    """
+    dtype, n, navg, nfft, window, fmt, scale = _rfft_args(a, args)
+    out_size = _c_size_t(0)
+    result = _lib.gn_rfft_size(_ctypes.byref(out_size), a.size, navg, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty(out_size.value // 2, dtype="complex128")
+    outf64 = out.view("float64")
+    if "int16" == dtype:
+        result = _lib.gn_rfft16(
+            outf64, outf64.size, a, a.size, n, navg, nfft, window, fmt, scale
+        )
+    elif "int32" == dtype:
+        result = _lib.gn_rfft32(
+            outf64, outf64.size, a, a.size, n, navg, nfft, window, fmt, scale
+        )
+    elif "int64" == dtype:
+        result = _lib.gn_rfft64(
+            outf64, outf64.size, a, a.size, n, navg, nfft, window, fmt, scale
+        )
+    else:
+        result = _lib.gn_rfft(outf64, outf64.size, a, a.size, navg, nfft, window, scale)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def rfft16f(a, *args):
+    """
+    Compute Real-FFT of 16-bit quantized data in single precision
+
+    Requires genalyzer to be built with the FFTW float library.
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``int16``
+
+        ``args`` (``list``) : Additional arguments, as for ``rfft`` with quantized samples
+
+    Returns:
+        ``out`` (``ndarray``) : FFT result of type ``complex64``
+    """
+    _check_ndarray(a, "int16")
+    dtype, n, navg, nfft, window, fmt, scale = _rfft_args(a, args)
+    out_size = _c_size_t(0)
+    result = _lib.gn_rfft_size(_ctypes.byref(out_size), a.size, navg, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty(out_size.value // 2, dtype="complex64")
+    outf32 = out.view("float32")
+    result = _lib.gn_rfft16f(
+        outf32, outf32.size, a, a.size, n, navg, nfft, window, fmt, scale
+    )
+    _raise_exception_on_failure(result)
+    return out
+
+
+def rfft_msq(a, *args):
+    """
+    Compute the averaged mean-square one-sided spectrum of real data
+
+    Same as ``rfft``, but returns the mean-square magnitude of each bin; see ``fft_msq``.
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``args`` (``list``) : Additional arguments, as for ``rfft``
+
+    Returns:
+        ``out`` (``ndarray``) : Mean-square spectrum of type ``float64``
+    """
+    dtype, n, navg, nfft, window, fmt, scale = _rfft_args(a, args)
+    out_size = _c_size_t(0)
+    result = _lib.gn_rfft_size(_ctypes.byref(out_size), a.size, navg, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty(out_size.value // 2, dtype="float64")
+    if "float64" == dtype:
+        result = _lib.gn_rfft_msq(out, out.size, a, a.size, navg, nfft, window, scale)
+    else:
+        func = {
+            "int16": _lib.gn_rfft_msq16,
+            "int32": _lib.gn_rfft_msq32,
+            "int64": _lib.gn_rfft_msq64,
+        }[str(dtype)]
+        result = func(out, out.size, a, a.size, n, navg, nfft, window, fmt, scale)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def _rfft_args(a, args):
+    dtype = _check_ndarray(a, ["float64", "int16", "int32", "int64"])
+    nargs = len(args)
+    if "float64" == dtype:
+        # normalized samples
+        navg = 1 if nargs == 0 else args[0]
+        nfft = 0 if nargs <= 1 else args[1]
+        window = Window.NO_WINDOW if nargs <= 2 else args[2]
+        scale = RfftScale.DBFS_SIN if nargs <= 3 else args[3]
+        n = None
+        fmt = None
+    else:
+        # quantized samples
+        if 0 == len(args):
+            raise Exception("Missing required parameter, n, code width")
+        n = args[0]
+        navg = 1 if nargs <= 1 else args[1]
+        nfft = 0 if nargs <= 2 else args[2]
+        window = Window.NO_WINDOW if nargs <= 3 else args[3]
+        fmt = CodeFormat.TWOS_COMPLEMENT if nargs <= 4 else args[4]
+        scale = RfftScale.DBFS_SIN if nargs <= 5 else args[5]
+    navg = max(0, navg)
+    nfft = max(0, nfft)
+    return dtype, n, navg, nfft, window, fmt, scale
+
+
+def _batch_rows(a, dtype):
+    if 2 != a.ndim:
+        raise ValueError(f"Expected 2-D array (channels x samples), got {a.ndim}-D")
+    rows = _np.ascontiguousarray(a)
+    if "complex128" == dtype:
+        rows = rows.view("float64")
+    return rows.reshape(-1), rows.shape[0], rows.shape[1]
+
+
+def fft_batch(a, navg=1, nfft=0, window=Window.NO_WINDOW, q=None, n=None, fmt=CodeFormat.TWOS_COMPLEMENT):
+    """
+    Compute the averaged complex FFTs of several channels in one call
+
+    The records of all channels are transformed with one FFTW plan.
+
+    Args:
+        ``a`` (``ndarray``) : 2-D input array (channels x samples) of type ``complex128``, ``float64``, ``int16``, ``int32``, or ``int64``.  Real rows hold interleaved I/Q samples unless ``q`` is given.
+
+        ``navg`` (``int``) : FFT averaging number
+
+        ``nfft`` (``int``) : FFT size (0 to use all samples of a record)
+
+        ``window`` (``Window``) : Window
+
+        ``q`` (``ndarray``) : Quadrature component, same shape and type as ``a`` (``a`` is then the In-phase component)
+
+        ``n`` (``int``) : Resolution (required for quantized samples)
+
+        ``fmt`` (``CodeFormat``) : Code format
+
+    Returns:
+        ``out`` (``ndarray``) : FFT results of type ``complex128``, one row per channel
+    """
+    dtype = _check_ndarray(a, ["complex128", "float64", "int16", "int32", "int64"])
+    i_data, nch, ch_size = _batch_rows(a, dtype)
+    if q is None:
+        q_data = _np.empty(0, dtype=i_data.dtype)
+        ch_size //= 2
+    else:
+        _check_ndarray(q, dtype)
+        if q.shape != a.shape:
+            raise ValueError("Expected I and Q arrays of the same shape")
+        q_data = _batch_rows(q, dtype)[0]
+    navg = max(1, navg)
+    nfft = ch_size // navg if nfft <= 0 else nfft
+    out_size = _c_size_t(0)
+    result = _lib.gn_fft_batch_size(_ctypes.byref(out_size), nch, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty((nch, out_size.value // (2 * nch)), dtype="complex128")
+    outf64 = out.view("float64").reshape(-1)
+    if "complex128" == dtype or "float64" == dtype:
+        result = _lib.gn_fft_batch(
+            outf64,
+            outf64.size,
+            i_data,
+            i_data.size,
+            q_data,
+            q_data.size,
+            nch,
+            0,
+            navg,
+            nfft,
+            window,
+        )
+    else:
+        if n is None:
+            raise Exception("Missing required parameter, n, code width")
+        func = {
+            "int16": _lib.gn_fft_batch16,
+            "int32": _lib.gn_fft_batch32,
+            "int64": _lib.gn_fft_batch64,
+        }[str(dtype)]
+        result = func(
+            outf64,
+            outf64.size,
+            i_data,
+            i_data.size,
+            q_data,
+            q_data.size,
+            nch,
+            0,
+            n,
+            navg,
+            nfft,
+            window,
+            fmt,
+        )
+    _raise_exception_on_failure(result)
+    return out
+
+
+def rfft_batch(a, navg=1, nfft=0, window=Window.NO_WINDOW, scale=RfftScale.DBFS_SIN, n=None, fmt=CodeFormat.TWOS_COMPLEMENT):
+    """
+    Compute the averaged real FFTs of several channels in one call
+
+    The records of all channels are transformed with one FFTW plan.
+
+    Args:
+        ``a`` (``ndarray``) : 2-D input array (channels x samples) of type ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``navg`` (``int``) : FFT averaging number
+
+        ``nfft`` (``int``) : FFT size (0 to use all samples of a record)
+
+        ``window`` (``Window``) : Window
+
+        ``scale`` (``RfftScale``) : Scaling mode
+
+        ``n`` (``int``) : Resolution (required for quantized samples)
+
+        ``fmt`` (``CodeFormat``) : Code format
+
+    Returns:
+        ``out`` (``ndarray``) : FFT results of type ``complex128``, one row per channel
+    """
+    dtype = _check_ndarray(a, ["float64", "int16", "int32", "int64"])
+    in_data, nch, ch_size = _batch_rows(a, dtype)
+    navg = max(1, navg)
+    nfft = ch_size // navg if nfft <= 0 else nfft
+    out_size = _c_size_t(0)
+    result = _lib.gn_rfft_batch_size(_ctypes.byref(out_size), nch, nfft)
+    _raise_exception_on_failure(result)
+    out = _np.empty((nch, out_size.value // (2 * nch)), dtype="complex128")
+    outf64 = out.view("float64").reshape(-1)
+    if "float64" == dtype:
+        result = _lib.gn_rfft_batch(
+            outf64, outf64.size, in_data, in_data.size, nch, 0, navg, nfft, window, scale
+        )
+    else:
+        if n is None:
+            raise Exception("Missing required parameter, n, code width")
+        func = {
+            "int16": _lib.gn_rfft_batch16,
+            "int32": _lib.gn_rfft_batch32,
+            "int64": _lib.gn_rfft_batch64,
+        }[str(dtype)]
+        result = func(
+            outf64,
+            outf64.size,
+            in_data,
+            in_data.size,
+            nch,
+            0,
+            n,
+            navg,
+            nfft,
+            window,
+            fmt,
+            scale,
+        )
+    _raise_exception_on_failure(result)
+    return out
+
+
+def fft_get_planner():
+    """
+    Get the FFTW planner effort used for new FFT plans
+
+    Returns:
+        ``planner`` (``FftPlanner``) : Planner effort
+    """
+    planner = _c_int(0)
+    result = _lib.gn_fft_get_planner(_ctypes.byref(planner))
+    _raise_exception_on_failure(result)
+    return FftPlanner(planner.value)
+
+
+def fft_set_planner(planner):
+    """
+    Set the FFTW planner effort used for new FFT plans
+
+    Args:
+        ``planner`` (``FftPlanner``) : Planner effort
+    """
+    result = _lib.gn_fft_set_planner(planner)
+    _raise_exception_on_failure(result)
+
+
+def fft_wisdom_export(filename):
+    """
+    Save accumulated FFTW wisdom to a file
+
+    When single-precision FFTs are available, their wisdom is saved to a second
+    file, ``filename`` with ".float" appended.
+
+    Args:
+        ``filename`` (``str``) : File name
+    """
+    filename = bytes(filename, "utf-8")
+    result = _lib.gn_fft_wisdom_export(filename)
+    _raise_exception_on_failure(result)
+
+
+def fft_wisdom_import(filename):
+    """
+    Load FFTW wisdom from a file
+
+    When single-precision FFTs are available, their wisdom is also loaded from
+    ``filename`` with ".float" appended, if that file exists.
+
+    Args:
+        ``filename`` (``str``) : File name
+    """
+    filename = bytes(filename, "utf-8")
+    result = _lib.gn_fft_wisdom_import(filename)
+    _raise_exception_on_failure(result)
+
+
+def fft_wisdom_forget():
+    """
+    Discard all accumulated FFTW wisdom
+
+    Cached plans are kept; only plans created afterwards are affected.
+    Single-precision wisdom, when available, is discarded too.
+    """
+    result = _lib.gn_fft_wisdom_forget()
+    _raise_exception_on_failure(result)
+
+
+def fft_window_cache_clear():
+    """Remove all cached window coefficient tables."""
+    _lib.gn_fft_window_cache_clear()
+
+
+def fft_window_cache_size():
+    """
+    Get the number of cached window coefficient tables
+
+    Returns:
+        ``size`` (``int``) : Number of tables
+    """
+    size = _c_size_t(0)
+    result = _lib.gn_fft_window_cache_size(_ctypes.byref(size))
+    _raise_exception_on_failure(result)
+    return size.value
+
+
+def fft_window_cache_warm(window, nfft, scale=RfftScale.DBFS_SIN):
+    """
+    Precompute and cache the window coefficient table for an FFT size
+
+    Args:
+        ``window`` (``Window``) : Window
+
+        ``nfft`` (``int``) : FFT size
+
+        ``scale`` (``RfftScale``) : Scaling mode; complex FFTs use ``RfftScale.NATIVE``
+    """
+    result = _lib.gn_fft_window_cache_warm(window, nfft, scale)
+    _raise_exception_on_failure(result)
+
+
+"""
+Spectrum Averager
+"""
+
+_lib.gn_sa_create.argtypes = [_c_char_p, _c_size_t, _c_int]
+_lib.gn_sa_rcreate.argtypes = [_c_char_p, _c_size_t, _c_int, _c_int]
+_lib.gn_sa_add.argtypes = [
+    _c_char_p,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+]
+_lib.gn_sa_add16.argtypes = [
+    _c_char_p,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_sa_add32.argtypes = [
+    _c_char_p,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_sa_add64.argtypes = [
+    _c_char_p,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_sa_radd.argtypes = [_c_char_p, _ndptr_f64_1d, _c_size_t]
+_lib.gn_sa_radd16.argtypes = [_c_char_p, _ndptr_i16_1d, _c_size_t, _c_int, _c_int]
+_lib.gn_sa_radd32.argtypes = [_c_char_p, _ndptr_i32_1d, _c_size_t, _c_int, _c_int]
+_lib.gn_sa_radd64.argtypes = [_c_char_p, _ndptr_i64_1d, _c_size_t, _c_int, _c_int]
+_lib.gn_sa_get.argtypes = [_ndptr_f64_1d, _c_size_t, _c_char_p]
+_lib.gn_sa_reset.argtypes = [_c_char_p]
+_lib.gn_sa_count.argtypes = [_c_size_t_p, _c_char_p]
+_lib.gn_sa_size.argtypes = [_c_size_t_p, _c_char_p]
+
+
+def sa_create(test_key, nfft, window=Window.NO_WINDOW):
+    """
+    Create a complex spectrum averager object
+
+    A spectrum averager accepts records one at a time, or in chunks of whole
+    records, and keeps only running per-bin sums.  The averaged spectrum
+    matches ``fft`` with ``navg`` equal to the number of records added.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``nfft`` (``int``) : FFT size
+
+        ``window`` (``Window``) : Window
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_sa_create(test_key, nfft, window)
+    _raise_exception_on_failure(result)
+
+
+def sa_rcreate(test_key, nfft, window=Window.NO_WINDOW, scale=RfftScale.DBFS_SIN):
+    """
+    Create a real spectrum averager object
+
+    The averaged spectrum matches ``rfft`` with ``navg`` equal to the number
+    of records added.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``nfft`` (``int``) : FFT size
+
+        ``window`` (``Window``) : Window
+
+        ``scale`` (``RfftScale``) : Scaling mode
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_sa_rcreate(test_key, nfft, window, scale)
+    _raise_exception_on_failure(result)
+
+
+def sa_add(test_key, a, *args):
+    """
+    Add records to a complex spectrum averager
+
+    Args:
+        ``test_key`` (``str``) : Key of a complex spectrum averager object
+
+        ``a`` (``ndarray``) : Input array of type ``complex128``, ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``args`` (``list``) : Optional Q data array of the same type as ``a``, followed, for quantized samples, by ``n`` (``int``, resolution) and ``fmt`` (``CodeFormat``)
+
+    The input size must be a multiple of the FFT size.  Real-valued arrays
+    without Q data are interpreted as interleaved I/Q.
+    """
+    test_key = bytes(test_key, "utf-8")
+    dtype = _check_ndarray(a, ["complex128", "float64", "int16", "int32", "int64"])
+    nargs = len(args)
+    i_data = a.view("float64") if "complex128" == dtype else a
+    q_data = _np.empty(0, dtype=i_data.dtype)
+    base_index = 0
+    if 0 < nargs and isinstance(args[0], _np.ndarray):  # arg[0] is Q data
+        _check_ndarray(args[0], dtype)
+        q_data = args[0]
+        base_index = 1
+    if "complex128" == dtype or "float64" == dtype:
+        result = _lib.gn_sa_add(test_key, i_data, i_data.size, q_data, q_data.size)
+    else:
+        if nargs <= base_index:
+            raise Exception("Missing required parameter, n, code width")
+        n = args[base_index]
+        fmt = (
+            CodeFormat.TWOS_COMPLEMENT
+            if nargs <= base_index + 1
+            else args[base_index + 1]
+        )
+        func = {
+            "int16": _lib.gn_sa_add16,
+            "int32": _lib.gn_sa_add32,
+            "int64": _lib.gn_sa_add64,
+        }[str(dtype)]
+        result = func(test_key, i_data, i_data.size, q_data, q_data.size, n, fmt)
+    _raise_exception_on_failure(result)
+
+
+def sa_radd(test_key, a, n=None, fmt=CodeFormat.TWOS_COMPLEMENT):
+    """
+    Add records to a real spectrum averager
+
+    Args:
+        ``test_key`` (``str``) : Key of a real spectrum averager object
+
+        ``a`` (``ndarray``) : Input array of type ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``n`` (``int``) : Resolution (required for quantized samples)
+
+        ``fmt`` (``CodeFormat``) : Code format
+
+    The input size must be a multiple of the FFT size.
+    """
+    test_key = bytes(test_key, "utf-8")
+    dtype = _check_ndarray(a, ["float64", "int16", "int32", "int64"])
+    if "float64" == dtype:
+        result = _lib.gn_sa_radd(test_key, a, a.size)
+    else:
+        if n is None:
+            raise Exception("Missing required parameter, n, code width")
+        func = {
+            "int16": _lib.gn_sa_radd16,
+            "int32": _lib.gn_sa_radd32,
+            "int64": _lib.gn_sa_radd64,
+        }[str(dtype)]
+        result = func(test_key, a, a.size, n, fmt)
+    _raise_exception_on_failure(result)
+
+
+def sa_get(test_key):
+    """
+    Get the averaged spectrum of all records added so far
+
+    Args:
+        ``test_key`` (``str``) : Key of a spectrum averager object
+
+    Returns:
+        ``out`` (``ndarray``) : Averaged spectrum of type ``complex128``
+    """
+    test_key = bytes(test_key, "utf-8")
+    out_size = _c_size_t(0)
+    result = _lib.gn_sa_size(_ctypes.byref(out_size), test_key)
+    _raise_exception_on_failure(result)
+    out = _np.empty(out_size.value // 2, dtype="complex128")
+    outf64 = out.view("float64")
+    result = _lib.gn_sa_get(outf64, outf64.size, test_key)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def sa_reset(test_key):
+    """
+    Discard all records added to a spectrum averager
+
+    Args:
+        ``test_key`` (``str``) : Key of a spectrum averager object
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_sa_reset(test_key)
+    _raise_exception_on_failure(result)
+
+
+def sa_count(test_key):
+    """
+    Get the number of records added to a spectrum averager
+
+    Args:
+        ``test_key`` (``str``) : Key of a spectrum averager object
+
+    Returns:
+        ``count`` (``int``) : Number of records
+    """
+    test_key = bytes(test_key, "utf-8")
+    count = _c_size_t(0)
+    result = _lib.gn_sa_count(_ctypes.byref(count), test_key)
+    _raise_exception_on_failure(result)
+    return count.value
+
+
+"""
+Sparse Histograms
+"""
+
+_lib.gn_sh_create.argtypes = [_c_char_p, _c_int, _c_int]
+_lib.gn_sh_createx.argtypes = [_c_char_p, _c_int64, _c_int64]
+_lib.gn_sh_add16.argtypes = [_c_char_p, _ndptr_i16_1d, _c_size_t]
+_lib.gn_sh_add32.argtypes = [_c_char_p, _ndptr_i32_1d, _c_size_t]
+_lib.gn_sh_add64.argtypes = [_c_char_p, _ndptr_i64_1d, _c_size_t]
+_lib.gn_sh_get.argtypes = [_ndptr_u64_1d, _c_size_t, _c_size_t, _c_char_p]
+_lib.gn_sh_reset.argtypes = [_c_char_p]
+_lib.gn_sh_dnl.argtypes = [_ndptr_f64_1d, _c_size_t, _c_char_p, _c_int]
+_lib.gn_sh_analysis.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _c_char_p,
+]
+_lib.gn_sh_nz_range.argtypes = [_c_size_t_p, _c_size_t_p, _c_char_p]
+_lib.gn_sh_size.argtypes = [_c_size_t_p, _c_char_p]
+
+
+def sh_create(test_key, n, fmt=CodeFormat.TWOS_COMPLEMENT):
+    """
+    Create a sparse histogram object for a given resolution and code format
+
+    A sparse histogram stores counts only for the code range that is hit, so
+    histograms of 20- to 30-bit codes fit in memory.  Bins are indexed like
+    the array returned by ``hist``.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``n`` (``int``) : Resolution
+
+        ``fmt`` (``CodeFormat``) : Code format
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_sh_create(test_key, n, fmt)
+    _raise_exception_on_failure(result)
+
+
+def sh_createx(test_key, min_code, max_code):
+    """
+    Create a sparse histogram object for an explicit code range
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``min_code`` (``int``) : Minimum code
+
+        ``max_code`` (``int``) : Maximum code
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_sh_createx(test_key, min_code, max_code)
+    _raise_exception_on_failure(result)
+
+
+def sh_add(test_key, a):
+    """
+    Add quantized waveform data to a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+
+        ``a`` (``ndarray``) : Input array of type ``int16``, ``int32``, or ``int64``
+
+    Codes outside the histogram range are ignored.
+    """
+    test_key = bytes(test_key, "utf-8")
+    dtype = _check_ndarray(a, ["int16", "int32", "int64"])
+    func = {
+        "int16": _lib.gn_sh_add16,
+        "int32": _lib.gn_sh_add32,
+        "int64": _lib.gn_sh_add64,
+    }[str(dtype)]
+    result = func(test_key, a, a.size)
+    _raise_exception_on_failure(result)
+
+
+def sh_get(test_key, first, size):
+    """
+    Get the counts of a range of bins of a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+
+        ``first`` (``int``) : Index of the first bin
+
+        ``size`` (``int``) : Number of bins
+
+    Returns:
+        ``out`` (``ndarray``) : Bin counts of type ``uint64``
+    """
+    test_key = bytes(test_key, "utf-8")
+    out = _np.empty(size, dtype="uint64")
+    result = _lib.gn_sh_get(out, out.size, first, test_key)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def sh_reset(test_key):
+    """
+    Clear all counts of a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_sh_reset(test_key)
+    _raise_exception_on_failure(result)
+
+
+def sh_dnl(test_key, signal_type=DnlSignal.TONE):
+    """
+    Compute DNL from a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+
+        ``signal_type`` (``DnlSignal``) : Signal type
+
+    Returns:
+        ``out`` (``ndarray``) : DNL of bins ``first`` to ``last`` (see
+        ``sh_nz_range``), of type ``float64``
+
+    The result equals those bins of ``dnl`` of the equivalent dense histogram;
+    all other bins are -1.
+    """
+    first, last = sh_nz_range(test_key)
+    test_key = bytes(test_key, "utf-8")
+    out = _np.empty(last - first + 1, dtype="float64")
+    result = _lib.gn_sh_dnl(out, out.size, test_key, signal_type)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def sh_analysis(test_key):
+    """
+    Compute summary statistics of a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+
+    Returns:
+        ``results`` (``dict``) : The sum, the first and last non-zero bins
+        (see ``sh_nz_range``), and the non-zero range, 1 + last - first
+    """
+    test_key = bytes(test_key, "utf-8")
+    keys, values = _get_analysis_containers(_AnalysisType.HISTOGRAM)
+    result = _lib.gn_sh_analysis(keys, len(keys), values, len(values), test_key)
+    _raise_exception_on_failure(result)
+    return _make_results_dict(keys, values)
+
+
+def sh_nz_range(test_key):
+    """
+    Get the first and last non-zero bins of a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+
+    Returns:
+        ``first``, ``last`` (``int``) : First and last non-zero bins; both
+        are the number of bins if all bins are zero
+    """
+    test_key = bytes(test_key, "utf-8")
+    first = _c_size_t(0)
+    last = _c_size_t(0)
+    result = _lib.gn_sh_nz_range(
+        _ctypes.byref(first), _ctypes.byref(last), test_key
+    )
+    _raise_exception_on_failure(result)
+    return first.value, last.value
+
+
+def sh_size(test_key):
+    """
+    Get the number of bins of a sparse histogram
+
+    Args:
+        ``test_key`` (``str``) : Key of a sparse histogram object
+
+    Returns:
+        ``size`` (``int``) : Number of bins
+    """
+    test_key = bytes(test_key, "utf-8")
+    size = _c_size_t(0)
+    result = _lib.gn_sh_size(_ctypes.byref(size), test_key)
+    _raise_exception_on_failure(result)
+    return size.value
+
+
+"""
+Code Density Accumulators
+"""
+
+_lib.gn_cda_create.argtypes = [_c_char_p, _c_int, _c_int]
+_lib.gn_cda_createx.argtypes = [_c_char_p, _c_int64, _c_int64]
+_lib.gn_cda_push16.argtypes = [_c_char_p, _ndptr_i16_1d, _c_size_t]
+_lib.gn_cda_push32.argtypes = [_c_char_p, _ndptr_i32_1d, _c_size_t]
+_lib.gn_cda_push64.argtypes = [_c_char_p, _ndptr_i64_1d, _c_size_t]
+_lib.gn_cda_merge.argtypes = [_c_char_p, _c_char_p]
+_lib.gn_cda_reset.argtypes = [_c_char_p]
+_lib.gn_cda_snapshot.argtypes = [_ndptr_u64_1d, _c_size_t, _c_char_p]
+_lib.gn_cda_analysis.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _c_char_p,
+]
+_lib.gn_cda_counts.argtypes = [_c_uint64_p, _c_uint64_p, _c_uint64_p, _c_char_p]
+_lib.gn_cda_code_range.argtypes = [_c_int64_p, _c_int64_p, _c_char_p]
+_lib.gn_cda_size.argtypes = [_c_size_t_p, _c_char_p]
+
+
+def cda_create(test_key, n, fmt=CodeFormat.TWOS_COMPLEMENT):
+    """
+    Create a code density accumulator object for a given resolution and code
+    format
+
+    An accumulator owns a histogram, indexed like the array returned by
+    ``hist``, to which waveforms are pushed in any number of chunks.
+    Accumulators filled by separate workers are combined with ``cda_merge``.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``n`` (``int``) : Resolution
+
+        ``fmt`` (``CodeFormat``) : Code format
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_cda_create(test_key, n, fmt)
+    _raise_exception_on_failure(result)
+
+
+def cda_createx(test_key, min_code, max_code):
+    """
+    Create a code density accumulator object for an explicit code range
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``min_code`` (``int``) : Minimum code
+
+        ``max_code`` (``int``) : Maximum code
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_cda_createx(test_key, min_code, max_code)
+    _raise_exception_on_failure(result)
+
+
+def cda_push(test_key, a):
+    """
+    Push quantized waveform data to a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+
+        ``a`` (``ndarray``) : Input array of type ``int16``, ``int32``, or ``int64``
+    """
+    test_key = bytes(test_key, "utf-8")
+    dtype = _check_ndarray(a, ["int16", "int32", "int64"])
+    func = {
+        "int16": _lib.gn_cda_push16,
+        "int32": _lib.gn_cda_push32,
+        "int64": _lib.gn_cda_push64,
+    }[str(dtype)]
+    result = func(test_key, a, a.size)
+    _raise_exception_on_failure(result)
+
+
+def cda_merge(test_key, other_key):
+    """
+    Add the histogram and counts of one code density accumulator to another
+
+    Args:
+        ``test_key`` (``str``) : Key of the accumulator to add to
+
+        ``other_key`` (``str``) : Key of an accumulator with the same code range
+    """
+    test_key = bytes(test_key, "utf-8")
+    other_key = bytes(other_key, "utf-8")
+    result = _lib.gn_cda_merge(test_key, other_key)
+    _raise_exception_on_failure(result)
+
+
+def cda_reset(test_key):
+    """
+    Discard all samples pushed to a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_cda_reset(test_key)
+    _raise_exception_on_failure(result)
+
+
+def cda_snapshot(test_key):
+    """
+    Get the histogram of a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+
+    Returns:
+        ``out`` (``ndarray``) : Histogram of type ``uint64``
+    """
+    size = cda_size(test_key)
+    test_key = bytes(test_key, "utf-8")
+    out = _np.empty(size, dtype="uint64")
+    result = _lib.gn_cda_snapshot(out, out.size, test_key)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def cda_analysis(test_key):
+    """
+    Compute summary statistics of a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+
+    Returns:
+        ``results`` (``dict``) : The results of ``hist_analysis`` on its
+        histogram, computed in constant time
+    """
+    test_key = bytes(test_key, "utf-8")
+    keys, values = _get_analysis_containers(_AnalysisType.HISTOGRAM)
+    result = _lib.gn_cda_analysis(keys, len(keys), values, len(values), test_key)
+    _raise_exception_on_failure(result)
+    return _make_results_dict(keys, values)
+
+
+def cda_counts(test_key):
+    """
+    Get the sample counts of a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+
+    Returns:
+        ``count``, ``below``, ``above`` (``int``) : Total samples pushed, and
+        samples below the min and above the max code
+    """
+    test_key = bytes(test_key, "utf-8")
+    count = _c_uint64(0)
+    below = _c_uint64(0)
+    above = _c_uint64(0)
+    result = _lib.gn_cda_counts(
+        _ctypes.byref(count), _ctypes.byref(below), _ctypes.byref(above), test_key
+    )
+    _raise_exception_on_failure(result)
+    return count.value, below.value, above.value
+
+
+def cda_code_range(test_key):
+    """
+    Get the smallest and largest codes pushed to a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+
+    Returns:
+        ``min_code``, ``max_code`` (``int``) : Smallest and largest codes;
+        ``min_code`` is greater than ``max_code`` if no samples were pushed
+    """
+    test_key = bytes(test_key, "utf-8")
+    min_code = _c_int64(0)
+    max_code = _c_int64(0)
+    result = _lib.gn_cda_code_range(
+        _ctypes.byref(min_code), _ctypes.byref(max_code), test_key
+    )
+    _raise_exception_on_failure(result)
+    return min_code.value, max_code.value
+
+
+def cda_size(test_key):
+    """
+    Get the number of bins of a code density accumulator
+
+    Args:
+        ``test_key`` (``str``) : Key of a code density accumulator object
+
+    Returns:
+        ``size`` (``int``) : Number of bins
+    """
+    test_key = bytes(test_key, "utf-8")
+    size = _c_size_t(0)
+    result = _lib.gn_cda_size(_ctypes.byref(size), test_key)
+    _raise_exception_on_failure(result)
+    return size.value
+
+
+"""
+FFT Contexts
+"""
+
+_lib.gn_fc_create.argtypes = [_c_char_p, _c_size_t, _c_size_t, _c_int]
+_lib.gn_fc_rcreate.argtypes = [_c_char_p, _c_size_t, _c_size_t, _c_int, _c_int]
+_lib.gn_fc_fft.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+]
+_lib.gn_fc_fft16.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fc_fft32.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fc_fft64.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fc_rfft.argtypes = [_ndptr_f64_1d, _c_size_t, _c_char_p, _ndptr_f64_1d, _c_size_t]
+_lib.gn_fc_rfft16.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fc_rfft32.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fc_rfft64.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_fc_size.argtypes = [_c_size_t_p, _c_char_p]
+_lib.gn_ac_create.argtypes = [_c_char_p, _c_size_t]
+_lib.gn_fft_analysis_ctx.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _c_char_p,
+    _c_char_p,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+]
+_lib.gn_fa_prepare.argtypes = [_c_char_p, _c_char_p, _c_size_t, _c_int, _c_bool]
+_lib.gn_fft_analysis_plan.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_f64_1d,
+    _c_size_t,
+]
+_lib.gn_fft_analysis_batch.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+]
+_lib.gn_fft_analysis_sparse.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _c_char_p,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_size_t,
+    _c_int,
+    _c_int,
+]
+_lib.gn_ap_results_key_sizes.argtypes = [_c_size_t_p, _c_size_t, _c_char_p]
+_lib.gn_ap_results_keys.argtypes = [_c_char_p_p, _c_size_t, _c_char_p]
+_lib.gn_ap_results_size.argtypes = [_c_size_t_p, _c_char_p]
+
+
+def fc_create(test_key, navg, nfft, window=Window.NO_WINDOW):
+    """
+    Create a complex FFT context object
+
+    An FFT context owns the work array that ``fft`` allocates on every
+    averaged call, sized for a fixed ``navg``, ``nfft``, and ``window``.
+    Results of ``fc_fft`` match ``fft``.  Free the context with
+    ``mgr_remove``.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``navg`` (``int``) : FFT averaging number
+
+        ``nfft`` (``int``) : FFT size
+
+        ``window`` (``Window``) : Window
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_fc_create(test_key, navg, nfft, window)
+    _raise_exception_on_failure(result)
+
+
+def fc_rcreate(test_key, navg, nfft, window=Window.NO_WINDOW, scale=RfftScale.DBFS_SIN):
+    """
+    Create a real FFT context object
+
+    Results of ``fc_rfft`` match ``rfft``.  Free the context with
+    ``mgr_remove``.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``navg`` (``int``) : FFT averaging number
+
+        ``nfft`` (``int``) : FFT size
+
+        ``window`` (``Window``) : Window
+
+        ``scale`` (``RfftScale``) : Scaling mode
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_fc_rcreate(test_key, navg, nfft, window, scale)
+    _raise_exception_on_failure(result)
+
+
+def _fc_out(test_key):
+    out_size = _c_size_t(0)
+    result = _lib.gn_fc_size(_ctypes.byref(out_size), test_key)
+    _raise_exception_on_failure(result)
+    return _np.empty(out_size.value // 2, dtype="complex128")
+
+
+def fc_fft(test_key, a, *args):
+    """
+    Compute the complex FFT using an FFT context
+
+    Args:
+        ``test_key`` (``str``) : Key of a complex FFT context object
+
+        ``a`` (``ndarray``) : Input array of type ``complex128``, ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``args`` (``list``) : Optional Q data array of the same type as ``a``, followed, for quantized samples, by ``n`` (``int``, resolution) and ``fmt`` (``CodeFormat``)
+
+    Returns:
+        ``out`` (``ndarray``) : FFT result of type ``complex128``
+    """
+    test_key = bytes(test_key, "utf-8")
+    dtype = _check_ndarray(a, ["complex128", "float64", "int16", "int32", "int64"])
+    nargs = len(args)
+    i_data = a.view("float64") if "complex128" == dtype else a
+    q_data = _np.empty(0, dtype=i_data.dtype)
+    base_index = 0
+    if 0 < nargs and isinstance(args[0], _np.ndarray):  # arg[0] is Q data
+        _check_ndarray(args[0], dtype)
+        q_data = args[0]
+        base_index = 1
+    out = _fc_out(test_key)
+    outf64 = out.view("float64")
+    if "complex128" == dtype or "float64" == dtype:
+        result = _lib.gn_fc_fft(
+            outf64, outf64.size, test_key, i_data, i_data.size, q_data, q_data.size
+        )
+    else:
+        if nargs <= base_index:
+            raise Exception("Missing required parameter, n, code width")
+        n = args[base_index]
+        fmt = (
+            CodeFormat.TWOS_COMPLEMENT
+            if nargs <= base_index + 1
+            else args[base_index + 1]
+        )
+        func = {
+            "int16": _lib.gn_fc_fft16,
+            "int32": _lib.gn_fc_fft32,
+            "int64": _lib.gn_fc_fft64,
+        }[str(dtype)]
+        result = func(
+            outf64,
+            outf64.size,
+            test_key,
+            i_data,
+            i_data.size,
+            q_data,
+            q_data.size,
+            n,
+            fmt,
+        )
+    _raise_exception_on_failure(result)
+    return out
+
+
+def fc_rfft(test_key, a, n=None, fmt=CodeFormat.TWOS_COMPLEMENT):
+    """
+    Compute the real FFT using an FFT context
+
+    Args:
+        ``test_key`` (``str``) : Key of a real FFT context object
+
+        ``a`` (``ndarray``) : Input array of type ``float64``, ``int16``, ``int32``, or ``int64``
+
+        ``n`` (``int``) : Resolution (required for quantized samples)
+
+        ``fmt`` (``CodeFormat``) : Code format
+
+    Returns:
+        ``out`` (``ndarray``) : FFT result of type ``complex128``
+    """
+    test_key = bytes(test_key, "utf-8")
+    dtype = _check_ndarray(a, ["float64", "int16", "int32", "int64"])
+    out = _fc_out(test_key)
+    outf64 = out.view("float64")
+    if "float64" == dtype:
+        result = _lib.gn_fc_rfft(outf64, outf64.size, test_key, a, a.size)
+    else:
+        if n is None:
+            raise Exception("Missing required parameter, n, code width")
+        func = {
+            "int16": _lib.gn_fc_rfft16,
+            "int32": _lib.gn_fc_rfft32,
+            "int64": _lib.gn_fc_rfft64,
+        }[str(dtype)]
+        result = func(outf64, outf64.size, test_key, a, a.size, n, fmt)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def ac_create(test_key, nfft):
+    """
+    Create a Fourier analysis context object
+
+    An analysis context keeps the scratch storage built by each analysis so
+    that repeated ``fft_analysis_ctx`` calls reuse it.  Free the context with
+    ``mgr_remove``.
+
+    Args:
+        ``test_key`` (``str``) : Key under which to register the object
+
+        ``nfft`` (``int``) : FFT size
+    """
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_ac_create(test_key, nfft)
+    _raise_exception_on_failure(result)
+
+
+def fft_analysis_ctx(test_key, ctx_key, a, nfft, axis_type=FreqAxisType.DC_LEFT):
+    """Returns all Fourier analysis results, using an analysis context
+
+    Args:
+        ``test_key`` (``string``) : Key value to the Fourier Analysis object created (through gn_fa_create)
+
+        ``ctx_key`` (``string``) : Key value to the analysis context object created (through ac_create)
+
+        ``a`` (``ndarray``) : FFT data of type 'complex128' or 'float64'
+
+        ``nfft`` (``int``) : FFT size
+
+        axis_type (``FreqAxisType``) : Frequency axis type
+
+    Returns:
+        ``results`` (``dict``) : Same as ``fft_analysis``
+    """
+    test_key = bytes(test_key, "utf-8")
+    ctx_key = bytes(ctx_key, "utf-8")
+    dtype = _check_ndarray(a, ["complex128", "float64"])
+    af64 = a.view("float64") if "complex128" == dtype else a
+    size = _c_size_t(0)
+    result = _lib.gn_fft_analysis_results_size(
+        _ctypes.byref(size), test_key, af64.size, nfft
+    )
+    _raise_exception_on_failure(result)
+    size = size.value
+    key_sizes = (_c_size_t * size)()
+    result = _lib.gn_fft_analysis_results_key_sizes(
+        key_sizes, size, test_key, af64.size, nfft
+    )
+    _raise_exception_on_failure(result)
+    keys = (_c_char_p * size)()
+    values = (_c_double * size)()
+    for i in range(size):
+        keys[i] = _ctypes.cast(
+            _ctypes.create_string_buffer(int(key_sizes[i])), _c_char_p
+        )
+    result = _lib.gn_fft_analysis_ctx(
+        keys, size, values, size, test_key, ctx_key, af64, af64.size, nfft, axis_type
+    )
+    _raise_exception_on_failure(result)
+    results = _make_results_dict(keys, values)
+    return results
+
+
+def fa_prepare(plan_key, test_key, nfft, axis_type=FreqAxisType.DC_LEFT, cplx=True):
+    """
+    Compile a Fourier analysis configuration into an analysis plan object
+
+    A plan resolves, once, everything in an analysis that does not depend on
+    the spectrum, so repeated ``fft_analysis_plan`` calls do only the
+    data-dependent work.  The plan is a snapshot of the configuration.  Free
+    the plan with ``mgr_remove``.
+
+    Args:
+        ``plan_key`` (``str``) : Key under which to register the plan
+
+        ``test_key`` (``str``) : Key value to the Fourier Analysis object created (through gn_fa_create)
+
+        ``nfft`` (``int``) : FFT size
+
+        ``axis_type`` (``FreqAxisType``) : Frequency axis type
+
+        ``cplx`` (``bool``) : True for complex analysis, False for real analysis
     """
-    Compute Real-FFT
+    plan_key = bytes(plan_key, "utf-8")
+    test_key = bytes(test_key, "utf-8")
+    result = _lib.gn_fa_prepare(plan_key, test_key, nfft, axis_type, cplx)
+    _raise_exception_on_failure(result)
+
+
+def fft_analysis_plan(plan_key, a):
+    """Returns all Fourier analysis results, using an analysis plan
 
     Args:
-        ``a`` (``ndarray``) : Input array of type ``float64``, ``int16``, ``int32``, or ``int64``
+        ``plan_key`` (``string``) : Key value to the analysis plan object created (through fa_prepare)
 
-        ``args`` (``list``) : Additional arguments
-            1. If ``a`` is of type ``float64``, then compute the real-FFT of normalized samples with the following interpretation.
+        ``a`` (``ndarray``) : FFT data of type 'complex128' or 'float64'
 
-                ``navg`` (``int``) : FFT averaging number
+    Returns:
+        ``results`` (``dict``) : Same as ``fft_analysis``
+    """
+    plan_key = bytes(plan_key, "utf-8")
+    dtype = _check_ndarray(a, ["complex128", "float64"])
+    af64 = a.view("float64") if "complex128" == dtype else a
+    size = _c_size_t(0)
+    result = _lib.gn_ap_results_size(_ctypes.byref(size), plan_key)
+    _raise_exception_on_failure(result)
+    size = size.value
+    key_sizes = (_c_size_t * size)()
+    result = _lib.gn_ap_results_key_sizes(key_sizes, size, plan_key)
+    _raise_exception_on_failure(result)
+    keys = (_c_char_p * size)()
+    values = (_c_double * size)()
+    for i in range(size):
+        keys[i] = _ctypes.cast(
+            _ctypes.create_string_buffer(int(key_sizes[i])), _c_char_p
+        )
+    result = _lib.gn_fft_analysis_plan(
+        keys, size, values, size, plan_key, af64, af64.size
+    )
+    _raise_exception_on_failure(result)
+    results = _make_results_dict(keys, values)
+    return results
 
-                ``nfft`` (``int``) : FFT size
 
-                ``window`` (``Window``): Window
+def fft_analysis_batch(plan_key, a):
+    """Returns Fourier analysis results for a batch of spectra, using an analysis plan
 
-                ``scale`` (``RfftScale``): Scaling mode
+    The spectra are analyzed on ``get_num_threads()`` threads, and the result
+    keys are generated once for the whole batch.
 
-            2. If ``a`` is of type ``int16``, ``int32``, or ``int64``, then compute the FFT of interleaved quantized samples with the following interpretation.
+    Args:
+        ``plan_key`` (``string``) : Key value to the analysis plan object created (through fa_prepare)
 
-                ``n`` (``int``) : Resolution (Bitwidth of a)
+        ``a`` (``ndarray``) : 2-D FFT data (spectra x bins) of type 'complex128' or 'float64'
 
-                ``navg`` (``int``) : FFT averaging number
+    Returns:
+        ``keys`` (``list``) : Result keys, one per column of ``values``
 
-                ``nfft`` (``int``) : FFT size
+        ``values`` (``ndarray``) : Result values of type 'float64', one row per spectrum; row i holds the values that ``fft_analysis_plan`` returns for spectrum i
+    """
+    plan_key = bytes(plan_key, "utf-8")
+    dtype = _check_ndarray(a, ["complex128", "float64"])
+    af64, count, _ = _batch_rows(a, dtype)
+    size = _c_size_t(0)
+    result = _lib.gn_ap_results_size(_ctypes.byref(size), plan_key)
+    _raise_exception_on_failure(result)
+    size = size.value
+    key_sizes = (_c_size_t * size)()
+    result = _lib.gn_ap_results_key_sizes(key_sizes, size, plan_key)
+    _raise_exception_on_failure(result)
+    keys = (_c_char_p * size)()
+    for i in range(size):
+        keys[i] = _ctypes.cast(
+            _ctypes.create_string_buffer(int(key_sizes[i])), _c_char_p
+        )
+    result = _lib.gn_ap_results_keys(keys, size, plan_key)
+    _raise_exception_on_failure(result)
+    values = _np.empty((count, size), dtype="float64")
+    vf64 = values.reshape(-1)
+    result = _lib.gn_fft_analysis_batch(
+        vf64, vf64.size, plan_key, af64, af64.size, count
+    )
+    _raise_exception_on_failure(result)
+    return [key.decode("utf-8") for key in keys], values
 
-                ``window`` (``Window``): Window
 
-                ``fmt`` (``CodeFormat``): Code format
+def fft_analysis_sparse(
+    plan_key, a, navg=1, window=Window.NO_WINDOW, scale=RfftScale.DBFS_SIN
+):
+    """Returns Fourier analysis results for real time-domain data, using an analysis plan
 
-                ``scale`` (``RfftScale``): Scaling mode
+    Only the spectrum bins of the plan's DC and FixedTone components are
+    computed; the noise comes from the total power of the windowed data.  The
+    plan must be for a real analysis (``cplx=False``) of the whole spectrum,
+    with no MaxTone or WO components (``fa_wo(key, 0)``).  Results match
+    ``rfft_msq`` followed by ``fft_analysis_plan``, up to floating-point
+    rounding; noise much more than 120 dB below the total power is not
+    resolved.
+
+    Args:
+        ``plan_key`` (``string``) : Key value to the analysis plan object created (through fa_prepare)
+
+        ``a`` (``ndarray``) : Time-domain data of type 'float64', ``navg`` records of nfft samples
+
+        ``navg`` (``int``) : FFT averaging number
+
+        ``window`` (``Window``) : Window
+
+        ``scale`` (``RfftScale``) : Scaling mode
 
     Returns:
-        ``out`` (``ndarray``) : FFT result of type ``float64`` with interleaved Re/Im components
+        ``results`` (``dict``) : Same as ``fft_analysis_plan``
     """
-    dtype = _check_ndarray(a, ["float64", "int16", "int32", "int64"])
-    nargs = len(args)
-    if "float64" == dtype:
-        # normalized samples
-        navg = 1 if nargs == 0 else args[0]
-        nfft = 0 if nargs <= 1 else args[1]
-        window = Window.NO_WINDOW if nargs <= 2 else args[2]
-        scale = RfftScale.DBFS_SIN if nargs <= 3 else args[3]
-        n = None
-        fmt = None
-    else:
-        # quantized samples
-        if 0 == len(args):
-            raise Exception("Missing required parameter, n, code width")
-        n = args[0]
-        navg = 1 if nargs <= 1 else args[1]
-        nfft = 0 if nargs <= 2 else args[2]
-        window = Window.NO_WINDOW if nargs <= 3 else args[3]
-        fmt = CodeFormat.TWOS_COMPLEMENT if nargs <= 4 else args[4]
-        scale = RfftScale.DBFS_SIN if nargs <= 5 else args[5]
-    out_size = _c_size_t(0)
-    navg = max(0, navg)
-    nfft = max(0, nfft)
-    result = _lib.gn_rfft_size(_ctypes.byref(out_size), a.size, navg, nfft)
+    plan_key = bytes(plan_key, "utf-8")
+    _check_ndarray(a, ["float64"])
+    size = _c_size_t(0)
+    result = _lib.gn_ap_results_size(_ctypes.byref(size), plan_key)
     _raise_exception_on_failure(result)
-    out = _np.empty(out_size.value // 2, dtype="complex128")
-    outf64 = out.view("float64")
-    if "int16" == dtype:
-        result = _lib.gn_rfft16(
-            outf64, outf64.size, a, a.size, n, navg, nfft, window, fmt, scale
-        )
-    elif "int32" == dtype:
-        result = _lib.gn_rfft32(
-            outf64, outf64.size, a, a.size, n, navg, nfft, window, fmt, scale
-        )
-    elif "int64" == dtype:
-        result = _lib.gn_rfft64(
-            outf64, outf64.size, a, a.size, n, navg, nfft, window, fmt, scale
+    size = size.value
+    key_sizes = (_c_size_t * size)()
+    result = _lib.gn_ap_results_key_sizes(key_sizes, size, plan_key)
+    _raise_exception_on_failure(result)
+    keys = (_c_char_p * size)()
+    values = (_c_double * size)()
+    for i in range(size):
+        keys[i] = _ctypes.cast(
+            _ctypes.create_string_buffer(int(key_sizes[i])), _c_char_p
         )
-    else:
-        result = _lib.gn_rfft(outf64, outf64.size, a, a.size, navg, nfft, window, scale)
+    result = _lib.gn_fft_analysis_sparse(
+        keys, size, values, size, plan_key, a, a.size, navg, window, scale
+    )
     _raise_exception_on_failure(result)
-    return out
+    results = _make_results_dict(keys, values)
+    return results
 
 
 """
@@ -2411,6 +4533,30 @@ _lib.gn_normalize64.argtypes = [
     _c_int,
     _c_int,
 ]
+_lib.gn_normalize_raw.argtypes = [
+    _ndptr_f64_1d,
+    _c_size_t,
+    _ndptr_u8_1d,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_bool,
+    _c_bool,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+]
+_lib.gn_raw_sample_count.argtypes = [
+    _c_size_t_p,
+    _c_size_t,
+    _c_int,
+    _c_int,
+    _c_bool,
+    _c_bool,
+    _c_int,
+    _c_size_t,
+    _c_size_t,
+]
 _lib.gn_polyval.argtypes = [
     _ndptr_f64_1d,
     _c_size_t,
@@ -2660,6 +4806,112 @@ def normalize(a, n, fmt=CodeFormat.TWOS_COMPLEMENT):
     return out
 
 
+def normalize_raw(
+    buf,
+    n,
+    fmt=CodeFormat.TWOS_COMPLEMENT,
+    container_bits=None,
+    left_justified=False,
+    big_endian=False,
+    stride=1,
+    offset=0,
+    count=None,
+):
+    """Convert raw ADC samples to normalized floating-point values in [-1, 1).
+
+    See ``hist_raw`` for the raw sample format.  Samples are decoded a block
+    at a time, without an intermediate array.
+
+    Args:
+        ``buf`` (``ndarray``) : Raw sample buffer of type ``uint8``
+
+        ``n`` (``int``) : ADC resolution in bits
+
+        ``fmt`` (``CodeFormat``) : Binary code format (default: TWOS_COMPLEMENT)
+
+        ``container_bits`` (``int``) : Bits per container (default: ``n``, i.e. packed)
+
+        ``left_justified`` (``bool``) : Codes are in the most significant container bits
+
+        ``big_endian`` (``bool``) : Byte order of words, or bit order of packed containers
+
+        ``stride`` (``int``) : Containers per sample, e.g. the number of channels
+
+        ``offset`` (``int``) : Index of the first container, e.g. the channel
+
+        ``count`` (``int``) : Number of samples (default: ``raw_sample_count``); pass it if pad bits after the last sample fill a whole container
+
+    Returns:
+        ``out`` (``ndarray``) : ``float64`` array, identical to ``normalize`` of the decoded codes
+    """
+    _check_ndarray(buf, "uint8")
+    container_bits = n if container_bits is None else container_bits
+    args = (n, container_bits, left_justified, big_endian, fmt, stride, offset)
+    if count is None:
+        count = raw_sample_count(
+            buf.size, n, fmt, container_bits, left_justified, big_endian, stride, offset
+        )
+    out = _np.empty(count, dtype="float64")
+    result = _lib.gn_normalize_raw(out, out.size, buf, buf.size, *args)
+    _raise_exception_on_failure(result)
+    return out
+
+
+def raw_sample_count(
+    buf_size,
+    n,
+    fmt=CodeFormat.TWOS_COMPLEMENT,
+    container_bits=None,
+    left_justified=False,
+    big_endian=False,
+    stride=1,
+    offset=0,
+):
+    """Get the number of samples in a raw buffer.
+
+    See ``hist_raw`` for the raw sample format.  The count is inferred from
+    the buffer size, so pad bits after the last sample count as one more
+    sample if they fill a whole container, e.g. three 4-bit samples in two
+    bytes count as four.  This happens only for containers narrower than 8
+    bits; pass the true count to ``hist_raw`` or ``normalize_raw``.
+
+    Args:
+        ``buf_size`` (``int``) : Raw buffer size in bytes
+
+        ``n`` (``int``) : ADC resolution in bits
+
+        ``fmt`` (``CodeFormat``) : Binary code format (default: TWOS_COMPLEMENT)
+
+        ``container_bits`` (``int``) : Bits per container (default: ``n``, i.e. packed)
+
+        ``left_justified`` (``bool``) : Codes are in the most significant container bits
+
+        ``big_endian`` (``bool``) : Byte order of words, or bit order of packed containers
+
+        ``stride`` (``int``) : Containers per sample, e.g. the number of channels
+
+        ``offset`` (``int``) : Index of the first container, e.g. the channel
+
+    Returns:
+        ``count`` (``int``) : Number of samples
+    """
+    container_bits = n if container_bits is None else container_bits
+    count = _c_size_t(0)
+    result = _lib.gn_raw_sample_count(
+        _ctypes.byref(count),
+        buf_size,
+        n,
+        container_bits,
+        left_justified,
+        big_endian,
+        fmt,
+        stride,
+        offset,
+    )
+    _raise_exception_on_failure(result)
+    return count.value
+
+
 def polyval(a, c):
     """Evaluate a polynomial at each element of the input array using Horner's method.
 
@@ -2851,6 +5103,50 @@ _lib.gn_wf_analysis64.argtypes = [
     _ndptr_i64_1d,
     _c_size_t,
 ]
+_lib.gn_sine_fit_analysis.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_f64_1d,
+    _c_size_t,
+    _c_double,
+    _c_double,
+    _c_bool,
+]
+_lib.gn_sine_fit_analysis16.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_i16_1d,
+    _c_size_t,
+    _c_double,
+    _c_double,
+    _c_bool,
+]
+_lib.gn_sine_fit_analysis32.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_i32_1d,
+    _c_size_t,
+    _c_double,
+    _c_double,
+    _c_bool,
+]
+_lib.gn_sine_fit_analysis64.argtypes = [
+    _c_char_p_p,
+    _c_size_t,
+    _c_double_p,
+    _c_size_t,
+    _ndptr_i64_1d,
+    _c_size_t,
+    _c_double,
+    _c_double,
+    _c_bool,
+]
 
 
 def cos(nsamples, fs, ampl, freq, phase=0.0, td=0.0, tj=0.0):
@@ -3008,3 +5304,60 @@ def wf_analysis(a):
     _raise_exception_on_failure(result)
     results = _make_results_dict(keys, values)
     return results
+
+
+def sine_fit_analysis(a, fs, freq, fit_freq=True):
+    """Fit a sinewave to a waveform by least squares (IEEE Std 1057 / 1241).
+
+    Fits ampl * cos(2*pi*freq*n/fs + phase) + offset to the waveform.  With
+    ``fit_freq`` False, ``freq`` is taken as exact (three-parameter fit).  With
+    ``fit_freq`` True, ``freq`` is an initial estimate, refined by iteration
+    (four-parameter fit); it should be within about fs / a.size of the true
+    frequency.  No window is applied, and the capture need not be coherent.
+
+    Args:
+        ``a`` (``ndarray``) : Input array of type ``float``, ``int16``, ``int32``, or ``int64``
+
+        ``fs`` (``float``) : Sample rate (S/s)
+
+        ``freq`` (``float``) : Tone frequency, or initial estimate (Hz)
+
+        ``fit_freq`` (``bool``) : If True, also fit the frequency
+
+    Returns:
+        ``results`` (``dict``) : Dictionary containing all sine-fit analysis results
+
+    Notes:
+        Every Key:Value pair in the dictionary is ``str``:``float``.
+
+        The dictionary contains the following keys:
+            ``ampl`` : Amplitude of the fitted tone
+
+            ``freq`` : Frequency of the fitted tone (Hz)
+
+            ``phase`` : Phase of the fitted tone at sample 0 (rad)
+
+            ``offset`` : DC offset
+
+            ``resid_rms`` : RMS of the fit residual
+
+            ``sinad`` : SINAD: fitted tone RMS / residual RMS (dB)
+
+            ``enob`` : ENOB computed from SINAD (bits)
+
+            ``iterations`` : Number of four-parameter iterations
+    """
+    dtype = _check_ndarray(a, ["float", "int16", "int32", "int64"])
+    keys, values = _get_analysis_containers(_AnalysisType.SINE_FIT)
+    args = (keys, len(keys), values, len(values), a, a.size, fs, freq, fit_freq)
+    if "int16" == dtype:
+        result = _lib.gn_sine_fit_analysis16(*args)
+    elif "int32" == dtype:
+        result = _lib.gn_sine_fit_analysis32(*args)
+    elif "int64" == dtype:
+        result = _lib.gn_sine_fit_analysis64(*args)
+    else:
+        result = _lib.gn_sine_fit_analysis(*args)
+    _raise_exception_on_failure(result)
+    results = _make_results_dict(keys, values)
+    return results
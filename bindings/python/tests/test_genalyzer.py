@@ -1,4 +1,5 @@
 import os, glob, json, pytest, genalyzer
+import numpy as np
 
 try:
     import genalyzer.helpers.WaveformGen
@@ -232,3 +233,105 @@ def test_gen_wf_data(filename):
         assert len(wf_tri) != 0, "the list is empty"
         assert len(wf_square) != 0, "the list is empty"
         assert len(wf_pwm) != 0, "the list is empty"
+
+
+def _assert_single_close(single, dbl, navg, nfft):
+    # within float rounding of the largest output; averaged spectra hold the
+    # mean phase of the records, which jumps when one record wraps at +/-pi,
+    # so only their magnitudes are compared
+    assert single.dtype == np.complex64
+    assert single.shape == dbl.shape
+    tol = 4.0 * np.log2(nfft) * 1.2e-7 * np.max(np.abs(dbl.view("float64")))
+    if 1 == navg:
+        assert np.max(np.abs(single.view("float32") - dbl.view("float64"))) <= tol
+    else:
+        assert np.max(np.abs(np.abs(single) - np.abs(dbl))) <= tol
+
+
+@pytest.mark.parametrize("navg", [1, 4])
+def test_fft16f(navg):
+    nfft = 1024
+    k = np.arange(navg * nfft)
+    rng = np.random.default_rng(5)
+    u = rng.uniform(-0.5, 0.5, k.size)
+    i = np.round(1800.0 * np.sin(0.0913 * k) + u).astype("int16")
+    q = np.round(1800.0 * np.cos(0.0913 * k) + u).astype("int16")
+    win = genalyzer.Window.BLACKMAN_HARRIS
+    fmt = genalyzer.CodeFormat.TWOS_COMPLEMENT
+    try:
+        out = genalyzer.fft16f(i, q, 12, navg, nfft, win, fmt)
+    except Exception as e:
+        if "single-precision FFTs are not available" not in str(e):
+            raise
+        pytest.skip("genalyzer was built without the FFTW float library")
+    _assert_single_close(out, genalyzer.fft(i, q, 12, navg, nfft, win, fmt), navg, nfft)
+    scale = genalyzer.RfftScale.DBFS_SIN
+    _assert_single_close(
+        genalyzer.rfft16f(i, 12, navg, nfft, win, fmt, scale),
+        genalyzer.rfft(i, 12, navg, nfft, win, fmt, scale),
+        navg,
+        nfft,
+    )
+
+
+@pytest.mark.parametrize("dtype", ["float64", "int16", "int32", "int64"])
+def test_spectrum_averager(dtype):
+    # records added one at a time match rfft / fft of all records, to
+    # rounding: the averager scales each record, rfft / fft the averaged sums
+    nfft, navg, n = 256, 4, 12
+    k = np.arange(2 * navg * nfft)
+    rng = np.random.default_rng(7)
+    codes = 1800.0 * np.sin(0.0913 * k) + rng.uniform(-0.5, 0.5, k.size)
+    if "float64" == dtype:
+        x = codes / 2048.0
+        rargs, cargs = (), ()
+    else:
+        x = np.round(codes).astype(dtype)
+        rargs, cargs = (n,), (n,)
+    i, q = x[: navg * nfft], x[navg * nfft :]
+    win = genalyzer.Window.BLACKMAN_HARRIS
+    fmt = genalyzer.CodeFormat.TWOS_COMPLEMENT
+    scale = genalyzer.RfftScale.DBFS_SIN
+
+    genalyzer.sa_rcreate("sa_r", nfft, win, scale)
+    for r in range(navg):
+        genalyzer.sa_radd("sa_r", i[r * nfft : (r + 1) * nfft], *rargs)
+    assert navg == genalyzer.sa_count("sa_r")
+    if "float64" == dtype:
+        expected = genalyzer.rfft(i, navg, nfft, win, scale)
+    else:
+        expected = genalyzer.rfft(i, n, navg, nfft, win, fmt, scale)
+    np.testing.assert_allclose(
+        genalyzer.sa_get("sa_r"), expected, rtol=0, atol=1e-12 * np.max(np.abs(expected))
+    )
+
+    genalyzer.sa_create("sa_c", nfft, win)
+    for r in range(navg):
+        rec = slice(r * nfft, (r + 1) * nfft)
+        genalyzer.sa_add("sa_c", i[rec], q[rec], *cargs)
+    if "float64" == dtype:
+        expected = genalyzer.fft(i, q, navg, nfft, win)
+    else:
+        expected = genalyzer.fft(i, q, n, navg, nfft, win, fmt)
+    np.testing.assert_allclose(
+        genalyzer.sa_get("sa_c"), expected, rtol=0, atol=1e-12 * np.max(np.abs(expected))
+    )
+    genalyzer.mgr_remove("sa_r")
+    genalyzer.mgr_remove("sa_c")
+
+
+def test_fft_wisdom(tmp_path):
+    saved = genalyzer.fft_get_planner()
+    genalyzer.fft_set_planner(genalyzer.FftPlanner.MEASURE)
+    assert genalyzer.fft_get_planner() == genalyzer.FftPlanner.MEASURE
+    x = np.round(1800.0 * np.sin(0.0913 * np.arange(512))).astype("int16")
+    before = genalyzer.rfft(x, 12, 1, 512)
+    filename = str(tmp_path / "wisdom.txt")
+    genalyzer.fft_wisdom_export(filename)
+    genalyzer.fft_wisdom_forget()
+    genalyzer.fft_wisdom_import(filename)
+    np.testing.assert_array_equal(genalyzer.rfft(x, 12, 1, 512), before)
+    with pytest.raises(Exception):
+        genalyzer.fft_wisdom_import(str(tmp_path / "missing.txt"))
+    genalyzer.fft_set_planner(saved)
+    assert genalyzer.fft_get_planner() == saved
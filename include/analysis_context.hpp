@@ -0,0 +1,90 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_ANALYSIS_CONTEXT_HPP
+#define GENALYZER_IMPL_ANALYSIS_CONTEXT_HPP
+
+#include "enums.hpp"
+#include "fourier_analysis_comp_mask.hpp"
+#include "object.hpp"
+#include "spectrum_index.hpp"
+#include "type_aliases.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Reusable scratch storage for fourier_analysis::analyze().
+ *
+ * Each analysis computes a mean-square spectrum from complex FFT data, indexes
+ * it for range sums, and builds a set of bin masks, one per component tag and
+ * analysis category.  An analysis_context keeps that storage between calls for
+ * a fixed nfft, so repeated analyses reuse it rather than reallocating it.
+ * With analysis_plan::analyze(), the results can also be written into a
+ * caller-owned object that is reused from call to call.  Results are identical
+ * to analyze() without a context.
+ */
+class analysis_context final : public object {
+public:
+	using mask_map = std::map<int, fourier_analysis_comp_mask>;
+
+	/**
+	 * @brief Factory method to create a new analysis_context object.
+	 *
+	 * @param nfft FFT size of the spectra to be analyzed.
+	 * @return Shared pointer to a new analysis_context instance.
+	 */
+	static std::shared_ptr<analysis_context> create(size_t nfft) {
+		return std::make_shared<analysis_context>(nfft);
+	}
+
+public: // Constructors, Destructor, and Assignment
+	analysis_context(size_t nfft);
+
+public: // Accessors
+	size_t nfft() const {
+		return m_nfft;
+	}
+
+private: // Virtual Function Overrides
+	bool equals_impl(const object &that) const override;
+
+	ObjectType object_type_impl() const override {
+		return ObjectType::AnalysisContext;
+	}
+
+	void save_impl(const str_t &filename) const override;
+
+	str_t to_string_impl() const override;
+
+private: // Used by fourier_analysis and analysis_plan
+	friend class analysis_plan;
+	friend class fourier_analysis;
+
+	void check_nfft(size_t nfft) const;
+
+	// Returns a buffer of at least size elements for mean-square data
+	real_t *msq(size_t size);
+
+	// Copies init into m_masks, reusing the existing mask storage when m_masks
+	// has the same keys, and returns m_masks
+	mask_map &masks(const mask_map &init);
+
+	// Rebuilds m_index from data and returns it
+	const spectrum_index &index(const real_t *data, size_t size,
+			bool max_queries);
+
+private:
+	size_t m_nfft;
+	std::vector<real_t> m_msq;
+	mask_map m_masks;
+	spectrum_index m_index;
+
+}; // class analysis_context
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_ANALYSIS_CONTEXT_HPP
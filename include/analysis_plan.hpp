@@ -0,0 +1,271 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_ANALYSIS_PLAN_HPP
+#define GENALYZER_IMPL_ANALYSIS_PLAN_HPP
+
+#include "enums.hpp"
+#include "expression.hpp"
+#include "fourier_analysis.hpp"
+#include "fourier_analysis_comp_mask.hpp"
+#include "fourier_analysis_results.hpp"
+#include "object.hpp"
+#include "type_aliases.hpp"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace genalyzer_impl {
+
+class analysis_context;
+
+/**
+ * @brief Bins of a DC or FixedTone component, resolved by an analysis_plan.
+ */
+struct fa_tone_bins {
+	real_t freq; // "actual" frequency
+	real_t ffinal; // frequency after translation and aliasing
+	fourier_analysis_comp_mask mask;
+	size_t i1;
+	size_t i2;
+	size_t nbins;
+	bool inband;
+};
+
+/**
+ * @brief An IMD product of two Signals, freq = c1 * f1 + c2 * f2, where f1 and
+ * f2 are the frequencies of the components with key indexes k1 and k2.  Only
+ * used without IMD tones (see fourier_analysis::en_imd_tones).
+ */
+struct fa_imd_product {
+	size_t k1;
+	size_t k2;
+	int c1;
+	int c2;
+};
+
+/**
+ * @brief Bins [i1, i2] of one or more IMD products; the range wraps if i2 < i1.
+ */
+struct fa_imd_range {
+	size_t i1;
+	size_t i2;
+	bool dc; // true if every product of the range is exactly at DC
+};
+
+/**
+ * @brief The IMD products of a Signal with each earlier Signal.  They are
+ * found where the IMD tones of that Signal would be: after its HD and ILGT
+ * components, before the component with key index key_index.  Only used
+ * without IMD tones.
+ */
+struct fa_imd_step {
+	size_t key_index;
+	std::vector<fa_imd_range> ranges; // resolved when compiled; merged
+	fourier_analysis_comp_mask mask; // the union of ranges
+	std::vector<fa_imd_product> products; // depend on a MaxTone
+};
+
+/**
+ * @brief Compiled, immutable form of a fourier_analysis configuration.
+ *
+ * Created by fourier_analysis::prepare() for a fixed nfft, axis type, and
+ * signal type.  The plan holds everything that does not depend on the
+ * spectrum: the generated components and their order, the evaluated
+ * variables, the analysis band, and the bins of every DC and FixedTone
+ * component whose frequency does not depend on a MaxTone.  analyze() then
+ * does only the data-dependent work.  Results are identical to
+ * fourier_analysis::analyze().
+ *
+ * A plan keeps a copy of the configuration; later changes to the
+ * fourier_analysis object do not affect it.  All member functions are const,
+ * so one plan may be used by several threads at once.
+ */
+class analysis_plan final : public object {
+public:
+	using mask_map = fourier_analysis::mask_map;
+	using var_map = fourier_analysis::var_map;
+
+public: // Constructors, Destructor, and Assignment
+	analysis_plan(std::shared_ptr<const fourier_analysis> config, size_t nfft,
+			FreqAxisType axis_type, bool cplx);
+
+	analysis_plan(const analysis_plan &) = delete;
+
+	analysis_plan &operator=(const analysis_plan &) = delete;
+
+public: // Analysis
+	/**
+	 * @brief Run Fourier analysis using this plan.
+	 *
+	 * @param in_data Pointer to FFT data: mean-square (data_size() elements)
+	 *                or interleaved Re/Im (2 * data_size() elements).
+	 * @param in_size Number of elements in @p in_data.
+	 * @return A fourier_analysis_results object containing all computed metrics.
+	 */
+	fourier_analysis_results analyze(const real_t *in_data,
+			size_t in_size) const;
+
+	/**
+	 * @brief Run Fourier analysis using this plan and reusable scratch storage.
+	 *
+	 * @param in_data Pointer to FFT data.
+	 * @param in_size Number of elements in @p in_data.
+	 * @param ctx     Analysis context; its nfft must equal the plan nfft.
+	 * @return A fourier_analysis_results object containing all computed metrics.
+	 */
+	fourier_analysis_results analyze(const real_t *in_data, size_t in_size,
+			analysis_context &ctx) const;
+
+	/**
+	 * @brief Run Fourier analysis using this plan and reusable scratch
+	 * storage, writing into caller-owned results.
+	 *
+	 * Same as analyze(in_data, in_size, ctx), but the results replace the
+	 * contents of @p results.  Passing the same object to repeated calls
+	 * reuses its storage: every analysis with one plan adds the same tones,
+	 * which are overwritten in place.
+	 *
+	 * @param in_data Pointer to FFT data.
+	 * @param in_size Number of elements in @p in_data.
+	 * @param ctx     Analysis context; its nfft must equal the plan nfft.
+	 * @param results Results of the analysis.
+	 */
+	void analyze(const real_t *in_data, size_t in_size, analysis_context &ctx,
+			fourier_analysis_results &results) const;
+
+	/**
+	 * @brief Run Fourier analysis on a batch of spectra using this plan.
+	 *
+	 * The spectra are stored back to back, each in the format accepted by
+	 * analyze(), and are analyzed on get_num_threads() threads, each with its
+	 * own analysis_context and results object.  Row i of the result is
+	 * identical to the flattened results of analyze() on spectrum i.
+	 *
+	 * @param in_data Pointer to @p count spectra of FFT data.
+	 * @param in_size Number of elements in @p in_data; a multiple of @p count.
+	 * @param count   Number of spectra.
+	 * @return The result keys and a count x keys matrix of result values.
+	 */
+	fourier_analysis_batch_results analyze_batch(const real_t *in_data,
+			size_t in_size, size_t count) const;
+
+	/**
+	 * @brief Run Fourier analysis on real time-domain data, computing only
+	 * the spectrum bins of the plan's components.
+	 *
+	 * The bins of every DC and FixedTone component are computed with
+	 * rfft_msq_bins(), and the power in all other bins, which are noise, from
+	 * the total power of the windowed data.  Results are those of analyze()
+	 * on the rfft_msq() spectrum of the data, up to floating-point rounding;
+	 * noise that is much more than 120 dB below the total power is not
+	 * resolved.  Plans with more than about log2(nfft) component bins, for
+	 * which the full transform is faster, are analyzed with rfft_msq() and
+	 * analyze().  Requires sparse().
+	 *
+	 * @param in_data Pointer to real input data: navg records of nfft samples.
+	 * @param in_size Number of elements in @p in_data.
+	 * @param navg    Number of records to average (0 for auto-detect).
+	 * @param window  Window function to apply before the DFT.
+	 * @param scale   dBFS scaling convention.
+	 * @return A fourier_analysis_results object containing all computed metrics.
+	 */
+	fourier_analysis_results analyze_sparse(const real_t *in_data,
+			size_t in_size, size_t navg, Window window,
+			RfftScale scale) const;
+
+public: // Accessors
+	FreqAxisType axis_type() const {
+		return m_axis_type;
+	}
+
+	bool cplx() const {
+		return m_cplx;
+	}
+
+	/** @brief Number of mean-square spectrum bins: nfft or nfft/2+1. */
+	size_t data_size() const {
+		return m_size;
+	}
+
+	/** @brief Component keys, in analysis order. */
+	const str_vector &keys() const {
+		return m_keys;
+	}
+
+	size_t nfft() const {
+		return m_nfft;
+	}
+
+	/**
+	 * @brief True if analyze_sparse() may be used: the analysis is real, the
+	 * analysis band is the whole spectrum, and there are no MaxTone or WO
+	 * components, so every component bin is known in advance.
+	 */
+	bool sparse() const {
+		return m_sparse;
+	}
+
+	/** @brief Bins of all components, in order; empty unless sparse(). */
+	const std::vector<size_t> &sparse_bins() const {
+		return m_sparse_bins;
+	}
+
+	std::vector<size_t> result_key_lengths() const {
+		return m_config->result_key_lengths(m_size, m_nfft);
+	}
+
+	/** @brief Flattened result keys, in the order of analyze_batch() columns. */
+	str_vector result_keys() const;
+
+	size_t results_size() const {
+		return m_config->results_size(m_size, m_nfft);
+	}
+
+private: // Virtual Function Overrides
+	bool equals_impl(const object &that) const override;
+
+	ObjectType object_type_impl() const override {
+		return ObjectType::AnalysisPlan;
+	}
+
+	void save_impl(const str_t &filename) const override;
+
+	str_t to_string_impl() const override;
+
+private: // Built and used by fourier_analysis
+	friend class fourier_analysis;
+
+	using comp_map = fourier_analysis::comp_map;
+
+	std::shared_ptr<const fourier_analysis> m_config;
+	size_t m_nfft;
+	FreqAxisType m_axis_type;
+	bool m_cplx;
+	size_t m_size;
+	var_map m_vars; // includes the frequencies of resolved FixedTones
+	str_vector m_keys;
+	comp_map m_comps;
+	std::set<str_t> m_ilos_clk_keys;
+	mask_map m_masks; // initial masks; only the analysis band is set
+	std::vector<std::optional<fa_tone_bins>> m_bins; // indexed like m_keys
+	bool m_dynamic; // true if any component depends on a MaxTone
+	bool m_search; // true if any component is a MaxTone or WOTone
+	bool m_sparse;
+	std::vector<size_t> m_sparse_bins; // only set if m_sparse
+	// Without IMD tones: one step per Signal after the first, in key order
+	std::vector<fa_imd_step> m_imd_steps;
+	// The members below are only set if m_dynamic
+	str_vector m_slot_names; // variables, then MaxTones and unresolved FixedTones
+	std::vector<real_t> m_slot_values; // initial values; NaN if unresolved
+	std::vector<size_t> m_key_slots; // indexed like m_keys
+	std::vector<compiled_expression> m_freq_code; // indexed like m_keys
+
+}; // class analysis_plan
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_ANALYSIS_PLAN_HPP
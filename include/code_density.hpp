@@ -11,6 +11,10 @@
 
 namespace genalyzer_impl {
 
+class code_density_accumulator;
+class sparse_histogram;
+struct sample_format;
+
 /**
  * @brief Return the number of histogram bins for a given ADC resolution and code format.
  *
@@ -70,6 +74,23 @@ void code_axisx(real_t *data, size_t size, int64_t min, int64_t max);
 void dnl(real_t *dnl_data, size_t dnl_size, const uint64_t *hist_data,
 		size_t hist_size, DnlSignal type);
 
+/**
+ * @brief Compute DNL from a sparse histogram.
+ *
+ * DNL is computed for bins [first, last], the first and last non-zero bins
+ * of @p hist (see sparse_histogram::nz_range()), and is identical to those
+ * bins of dnl() on the equivalent dense histogram; all other bins are -1, so
+ * they are not written.  inl() of this DNL equals those bins of inl() of the
+ * dense DNL, up to floating-point rounding.
+ *
+ * @param dnl_data Pointer to output DNL array.
+ * @param dnl_size Number of elements in @p dnl_data (last - first + 1).
+ * @param hist     Input histogram; must have a non-zero bin.
+ * @param type     Signal type used to acquire the histogram (Ramp or Tone).
+ */
+void dnl(real_t *dnl_data, size_t dnl_size, const sparse_histogram &hist,
+		DnlSignal type);
+
 /**
  * @brief Compute summary statistics from DNL data.
  *
@@ -128,10 +149,75 @@ template <typename T>
 void histx(uint64_t *hist_data, size_t hist_size, const T *wf_data,
 		size_t wf_size, int64_t min, int64_t max, bool preserve);
 
+/**
+ * @brief Compute a histogram of a quantized waveform on multiple threads.
+ *
+ * The waveform is split into get_num_threads() slices, each of which is
+ * counted into a private sub-histogram; the sub-histograms are then summed
+ * into @p hist_data.  Results, including @p preserve, are identical to hist().
+ * Small waveforms, relative to the number of bins, are counted on the calling
+ * thread.
+ *
+ * @tparam T        Integer sample type.
+ * @param hist_data Pointer to histogram output array.
+ * @param hist_size Number of elements in @p hist_data (use code_density_size()).
+ * @param wf_data   Pointer to input waveform samples.
+ * @param wf_size   Number of elements in @p wf_data.
+ * @param n         ADC resolution in bits.
+ * @param format    Code format.
+ * @param preserve  If true, add counts to existing histogram data; if false,
+ *                  initialize the histogram to zero first.
+ */
+template <typename T>
+void hist_parallel(uint64_t *hist_data, size_t hist_size, const T *wf_data,
+		size_t wf_size, int n, CodeFormat format, bool preserve);
+
+/**
+ * @brief Compute a histogram using explicit code bounds on multiple threads.
+ *
+ * See hist_parallel().  Results are identical to histx().
+ *
+ * @tparam T        Integer sample type.
+ * @param hist_data Pointer to histogram output array.
+ * @param hist_size Number of elements in @p hist_data (use code_densityx_size()).
+ * @param wf_data   Pointer to input waveform samples.
+ * @param wf_size   Number of elements in @p wf_data.
+ * @param min       Minimum code value (inclusive).
+ * @param max       Maximum code value (inclusive).
+ * @param preserve  If true, add counts to existing histogram data; if false,
+ *                  initialize the histogram to zero first.
+ */
+template <typename T>
+void histx_parallel(uint64_t *hist_data, size_t hist_size, const T *wf_data,
+		size_t wf_size, int64_t min, int64_t max, bool preserve);
+
+/**
+ * @brief Compute a code density histogram directly from raw ADC samples.
+ *
+ * Samples are decoded as described by @p fmt (see sample_format) a block at a
+ * time, without unpacking the whole buffer into an integer array.  Results are
+ * identical to hist() of the unpacked codes, with n = fmt.bits.
+ *
+ * @param hist_data Pointer to histogram output array.
+ * @param hist_size Number of elements in @p hist_data (use code_density_size()).
+ * @param buf       Pointer to raw sample buffer.
+ * @param buf_size  Number of bytes in @p buf.
+ * @param fmt       Raw sample format.
+ * @param count     Number of samples to decode, from the first; at most
+ *                  raw_sample_count(buf_size, fmt).
+ * @param preserve  If true, add counts to existing histogram data; if false,
+ *                  initialize the histogram to zero first.
+ */
+void hist_raw(uint64_t *hist_data, size_t hist_size, const uint8_t *buf,
+		size_t buf_size, const sample_format &fmt, size_t count,
+		bool preserve);
+
 /**
  * @brief Compute summary statistics from histogram data.
  *
- * Results include sum, first/last non-zero bin indices, and non-zero range.
+ * Results include sum, first/last non-zero bin indices, and non-zero range
+ * (1 + last - first).  If every bin is zero, both indices are @p size and the
+ * range is 0.
  *
  * @param data Pointer to histogram data array.
  * @param size Number of elements in @p data.
@@ -139,6 +225,28 @@ void histx(uint64_t *hist_data, size_t hist_size, const T *wf_data,
  */
 std::map<str_t, real_t> hist_analysis(const uint64_t *data, size_t size);
 
+/**
+ * @brief Compute summary statistics from a sparse histogram.
+ *
+ * Results include sum, the first and last non-zero bins, and non-zero range
+ * (1 + last - first).
+ *
+ * @param hist Input histogram.
+ * @return Map of metric names to values.
+ */
+std::map<str_t, real_t> hist_analysis(const sparse_histogram &hist);
+
+/**
+ * @brief Compute summary statistics from a code density accumulator.
+ *
+ * Results are identical to hist_analysis() of its snapshot, but take O(1)
+ * time.
+ *
+ * @param acc Input accumulator.
+ * @return Map of metric names to values.
+ */
+std::map<str_t, real_t> hist_analysis(const code_density_accumulator &acc);
+
 /**
  * @brief Return the ordered list of result keys for hist_analysis().
  *
@@ -180,6 +288,103 @@ std::map<str_t, real_t> inl_analysis(const real_t *data, size_t size);
  */
 const std::vector<str_t> &inl_analysis_ordered_keys();
 
+/**
+ * @brief Results of linearity_analysis(): the results of hist_analysis(),
+ * dnl_analysis(), and inl_analysis(), in the order of
+ * linearity_analysis_ordered_keys().
+ */
+struct linearity_results {
+	uint64_t hist_sum; // total histogram hits
+	size_t hist_first_nz_index; // index of first non-zero bin
+	size_t hist_last_nz_index; // index of last non-zero bin
+	size_t hist_nz_range; // non-zero bin range
+	real_t dnl_min; // min DNL value
+	real_t dnl_max; // max DNL value
+	real_t dnl_avg; // average DNL value
+	real_t dnl_rms; // RMS DNL value
+	size_t dnl_min_index; // index of min DNL value
+	size_t dnl_max_index; // index of max DNL value
+	size_t dnl_first_nm_index; // index of first non-missing code
+	size_t dnl_last_nm_index; // index of last non-missing code
+	size_t dnl_nm_range; // non-missing code range
+	real_t inl_min; // min INL value
+	real_t inl_max; // max INL value
+	size_t inl_min_index; // index of min INL value
+	size_t inl_max_index; // index of max INL value
+};
+
+/**
+ * @brief Compute DNL, INL, and their summary statistics from a histogram.
+ *
+ * Equivalent to hist_analysis(), dnl(), dnl_analysis(), inl(), and
+ * inl_analysis(), with identical results, but with fewer passes over the
+ * bins: one to sum the histogram, one to compute DNL, its statistics, and the
+ * INL before the line fit, and one to remove the line and compute the INL
+ * statistics.  A tone takes two more passes over the non-zero bins, to find
+ * the code widths.  The separate calls take eight passes for a ramp, and ten
+ * for a tone.
+ *
+ * @param dnl_data  Pointer to output DNL array.
+ * @param dnl_size  Number of elements in @p dnl_data.
+ * @param inl_data  Pointer to output INL array.
+ * @param inl_size  Number of elements in @p inl_data.
+ * @param hist_data Pointer to input histogram data.
+ * @param hist_size Number of elements in @p hist_data.
+ * @param type      Signal type used to acquire the histogram (Ramp or Tone).
+ * @param fit       Line-fit method (BestFit, EndFit, or NoFit).
+ * @return Summary statistics.
+ */
+linearity_results linearity_analysis(real_t *dnl_data, size_t dnl_size,
+		real_t *inl_data, size_t inl_size, const uint64_t *hist_data,
+		size_t hist_size, DnlSignal type, InlLineFit fit);
+
+/**
+ * @brief Compute the histogram, DNL, INL, and their summary statistics from
+ * a quantized waveform.
+ *
+ * Equivalent to hist() followed by the histogram overload, with identical
+ * results; the histogram sum is counted while the histogram is computed, so
+ * it is not summed again.
+ *
+ * @tparam T        Integer sample type.
+ * @param hist_data Pointer to output histogram array.
+ * @param hist_size Number of elements in @p hist_data.
+ * @param dnl_data  Pointer to output DNL array.
+ * @param dnl_size  Number of elements in @p dnl_data.
+ * @param inl_data  Pointer to output INL array.
+ * @param inl_size  Number of elements in @p inl_data.
+ * @param wf_data   Pointer to input waveform samples.
+ * @param wf_size   Number of elements in @p wf_data.
+ * @param n         ADC resolution in bits.
+ * @param format    Code format.
+ * @param type      Signal type used to acquire the waveform (Ramp or Tone).
+ * @param fit       Line-fit method (BestFit, EndFit, or NoFit).
+ * @return Summary statistics.
+ */
+template <typename T>
+linearity_results linearity_analysis(uint64_t *hist_data, size_t hist_size,
+		real_t *dnl_data, size_t dnl_size, real_t *inl_data, size_t inl_size,
+		const T *wf_data, size_t wf_size, int n, CodeFormat format,
+		DnlSignal type, InlLineFit fit);
+
+/**
+ * @brief Return the ordered list of result keys for linearity_analysis().
+ *
+ * @return Reference to a vector of key strings in canonical order.
+ */
+const std::vector<str_t> &linearity_analysis_ordered_keys();
+
+/**
+ * @brief Write linearity results in the order of
+ * linearity_analysis_ordered_keys().
+ *
+ * @param values  Pointer to output values array.
+ * @param size    Number of elements in @p values.
+ * @param results Results of linearity_analysis().
+ */
+void linearity_results_values(real_t *values, size_t size,
+		const linearity_results &results);
+
 } // namespace genalyzer_impl
 
 #endif // GENALYZER_IMPL_CODE_DENSITY_HPP
\ No newline at end of file
@@ -0,0 +1,168 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_CODE_DENSITY_ACCUMULATOR_HPP
+#define GENALYZER_IMPL_CODE_DENSITY_ACCUMULATOR_HPP
+
+#include "enums.hpp"
+#include "object.hpp"
+#include "type_aliases.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Streaming code density histogram.
+ *
+ * Samples are pushed in any number of chunks, and accumulators over the same
+ * code range, e.g. filled by separate capture threads, may be merged.  The
+ * histogram is identical to histx() of all samples pushed; in addition, the
+ * total, below-range, and above-range sample counts, the smallest and largest
+ * code pushed, and the first and last non-zero bins are updated as samples
+ * are pushed, so that hist_analysis() of an accumulator does not scan the
+ * histogram.
+ *
+ * An accumulator is not synchronized: each thread should push to its own.
+ */
+class code_density_accumulator final : public object {
+public:
+	/**
+	 * @brief Factory method to create a new code_density_accumulator object.
+	 *
+	 * @param min Minimum code value (inclusive).
+	 * @param max Maximum code value (inclusive).
+	 * @return Shared pointer to a new code_density_accumulator instance.
+	 */
+	static std::shared_ptr<code_density_accumulator> create(int64_t min,
+			int64_t max) {
+		return std::make_shared<code_density_accumulator>(min, max);
+	}
+
+	/**
+	 * @brief Factory method to create a new code_density_accumulator object.
+	 *
+	 * @param n      ADC resolution in bits.
+	 * @param format Code format.
+	 * @return Shared pointer to a new code_density_accumulator instance.
+	 */
+	static std::shared_ptr<code_density_accumulator> create(int n,
+			CodeFormat format);
+
+public: // Constructors, Destructor, and Assignment
+	code_density_accumulator(int64_t min, int64_t max);
+
+public: // Accumulation
+	/**
+	 * @brief Add the codes of a quantized waveform.
+	 *
+	 * @tparam T      Integer sample type.
+	 * @param wf_data Pointer to input waveform samples.
+	 * @param wf_size Number of elements in @p wf_data.
+	 */
+	template <typename T>
+	void push(const T *wf_data, size_t wf_size);
+
+	/**
+	 * @brief Add the histogram and statistics of another accumulator.
+	 *
+	 * @param that Accumulator with the same code range.
+	 */
+	void merge(const code_density_accumulator &that);
+
+	/**
+	 * @brief Discard all samples pushed so far.
+	 */
+	void reset();
+
+public: // Results
+	/**
+	 * @brief Return the first and last non-zero bins, or (size(), size()) if
+	 * all bins are zero.
+	 */
+	size_p nz_range() const {
+		return size_p(m_nz_first, m_nz_last);
+	}
+
+	/**
+	 * @brief Write the histogram of all samples pushed so far.
+	 *
+	 * @param hist_data Pointer to histogram output array.
+	 * @param hist_size Number of elements in @p hist_data (use size()).
+	 */
+	void snapshot(uint64_t *hist_data, size_t hist_size) const;
+
+public: // Accessors
+	/** @brief Number of samples pushed above max. */
+	uint64_t above() const {
+		return m_above;
+	}
+
+	/** @brief Number of samples pushed below min. */
+	uint64_t below() const {
+		return m_below;
+	}
+
+	/** @brief Total number of samples pushed, including out-of-range ones. */
+	uint64_t count() const {
+		return m_count;
+	}
+
+	/** @brief Largest code pushed; less than min_code() if count() is 0. */
+	int64_t max_code() const {
+		return m_max_code;
+	}
+
+	/** @brief Smallest code pushed; greater than max_code() if count() is 0. */
+	int64_t min_code() const {
+		return m_min_code;
+	}
+
+	int64_t max() const {
+		return m_max;
+	}
+
+	int64_t min() const {
+		return m_min;
+	}
+
+	/** @brief Number of histogram bins, max - min + 1. */
+	size_t size() const {
+		return m_hist.size();
+	}
+
+	/** @brief Sum of all bins: the number of samples pushed in range. */
+	uint64_t sum() const {
+		return m_count - m_below - m_above;
+	}
+
+private: // Virtual Function Overrides
+	bool equals_impl(const object &that) const override;
+
+	ObjectType object_type_impl() const override {
+		return ObjectType::CodeDensityAccumulator;
+	}
+
+	void save_impl(const str_t &filename) const override;
+
+	str_t to_string_impl() const override;
+
+private:
+	int64_t m_min;
+	int64_t m_max;
+	std::vector<uint64_t> m_hist;
+	uint64_t m_count;
+	uint64_t m_below;
+	uint64_t m_above;
+	int64_t m_min_code;
+	int64_t m_max_code;
+	size_t m_nz_first; // first non-zero bin; size() if there are none
+	size_t m_nz_last; // last non-zero bin; size() if there are none
+
+}; // class code_density_accumulator
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_CODE_DENSITY_ACCUMULATOR_HPP
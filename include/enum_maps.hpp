@@ -21,7 +21,9 @@ const enum_map
 						{ to_int(AnalysisType::Fourier), "Fourier" },
 						{ to_int(AnalysisType::Histogram), "Histogram" },
 						{ to_int(AnalysisType::INL), "INL" },
-						{ to_int(AnalysisType::Waveform), "Waveform" } });
+						{ to_int(AnalysisType::Waveform), "Waveform" },
+						{ to_int(AnalysisType::SineFit), "SineFit" },
+						{ to_int(AnalysisType::Linearity), "Linearity" } });
 
 const enum_map code_format_map(
 		"CodeFormat",
@@ -45,6 +47,10 @@ const enum_map fa_comp_tag_map("FACompTag",
 
 const enum_map fa_ssb_map("FASsb", { { to_int(FASsb::Default), "Default" }, { to_int(FASsb::DC), "DC" }, { to_int(FASsb::Signal), "Signal" }, { to_int(FASsb::WO), "WO" } });
 
+const enum_map fft_planner_map("FftPlanner",
+		{ { to_int(FftPlanner::Estimate), "Estimate" },
+				{ to_int(FftPlanner::Measure), "Measure" },
+				{ to_int(FftPlanner::Patient), "Patient" } });
 const enum_map
 		freq_axis_format_map("FreqAxisFormat",
 				{ { to_int(FreqAxisFormat::Bins), "Bins" },
@@ -146,8 +152,17 @@ const enum_map
 						{ to_int(FAToneResult::Phase_c), "phase_c" } });
 
 const enum_map object_type_map("ObjectType",
-		{ { to_int(ObjectType::FourierAnalysis),
-				"FourierAnalysis" } });
+		{ { to_int(ObjectType::FourierAnalysis), "FourierAnalysis" },
+				{ to_int(ObjectType::SpectrumAverager),
+						"SpectrumAverager" },
+				{ to_int(ObjectType::FftContext), "FftContext" },
+				{ to_int(ObjectType::AnalysisContext),
+						"AnalysisContext" },
+				{ to_int(ObjectType::AnalysisPlan), "AnalysisPlan" },
+				{ to_int(ObjectType::SparseHistogram),
+						"SparseHistogram" },
+				{ to_int(ObjectType::CodeDensityAccumulator),
+						"CodeDensityAccumulator" } });
 
 } // namespace genalyzer_impl
 
@@ -15,7 +15,9 @@ enum class AnalysisType : int {
 	Fourier, /**< Fourier (spectral) analysis. */
 	Histogram, /**< Histogram (code density) analysis. */
 	INL, /**< Integral nonlinearity analysis. */
-	Waveform /**< Time-domain waveform analysis. */
+	Waveform, /**< Time-domain waveform analysis. */
+	SineFit, /**< Time-domain sine-fit analysis. */
+	Linearity /**< Histogram, DNL, and INL analysis. */
 };
 
 /** @brief ADC code format. */
@@ -62,6 +64,18 @@ enum class FASsb : int {
 	WO /**< SSB for worst-other components. */
 };
 
+/**
+ * @brief FFTW planner effort used when creating FFT plans.
+ *
+ * Higher effort takes longer to plan, but may produce faster transforms.
+ * Plans are cached, so the planning cost is paid once per FFT size.
+ */
+enum class FftPlanner : int {
+	Estimate, /**< Heuristic plan; no measurement (FFTW_ESTIMATE). */
+	Measure, /**< Time several candidate plans (FFTW_MEASURE). */
+	Patient /**< Time a wider range of candidate plans (FFTW_PATIENT). */
+};
+
 /** @brief Output format for frequency axis values. */
 enum class FreqAxisFormat : int {
 	Bins, /**< Frequency expressed as FFT bin indices. */
@@ -197,7 +211,15 @@ enum class FPFormat { // Floating-point format
 	Sci
 };
 
-enum class ObjectType { FourierAnalysis };
+enum class ObjectType {
+	FourierAnalysis,
+	SpectrumAverager,
+	FftContext,
+	AnalysisContext,
+	AnalysisPlan,
+	SparseHistogram,
+	CodeDensityAccumulator
+};
 
 } // namespace genalyzer_impl
 
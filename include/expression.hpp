@@ -15,6 +15,8 @@ namespace genalyzer_impl {
 
 struct expression_token;
 
+class compiled_expression;
+
 class expression {
 public:
 	using token_ptr = std::unique_ptr<expression_token>;
@@ -28,6 +30,10 @@ public:
 	~expression();
 
 public:
+	// Returns a flat postfix form of expression in which each variable is an
+	// index into slots; throws if a variable is not in slots
+	compiled_expression compile(const str_vector &slots) const;
+
 	// Returns true if expression depends on one or more variables in vars
 	bool depends_on(const var_set &vars) const;
 
@@ -49,6 +55,50 @@ private:
 
 }; // class expression
 
+// Postfix bytecode for an expression.  Variables are resolved to slots, i.e.,
+// indexes into a dense array of values, so evaluation needs no string lookups
+// and no allocation.
+class compiled_expression {
+public:
+	// Maximum number of operands on the evaluation stack
+	static constexpr size_t max_depth = 64;
+
+public:
+	compiled_expression() = default;
+
+public:
+	// Returns the value of the expression; values[i] is the value of slot i
+	real_t evaluate(const real_t *values) const;
+
+	// Returns the slots the expression depends on, in ascending order
+	const std::vector<size_t> &slots() const {
+		return m_slots;
+	}
+
+private:
+	friend class expression;
+
+	enum class OpCode : unsigned char { Num,
+		Var,
+		Add,
+		Sub,
+		Mul,
+		Div,
+		Mod,
+		Neg,
+		Exp };
+
+	struct instruction {
+		OpCode op;
+		size_t arg; // index into m_nums (Num) or slot (Var)
+	};
+
+	std::vector<instruction> m_code;
+	std::vector<real_t> m_nums;
+	std::vector<size_t> m_slots;
+
+}; // class compiled_expression
+
 } // namespace genalyzer_impl
 
 #endif // GENALYZER_IMPL_EXPRESSION_HPP
\ No newline at end of file
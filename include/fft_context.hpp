@@ -0,0 +1,168 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_FFT_CONTEXT_HPP
+#define GENALYZER_IMPL_FFT_CONTEXT_HPP
+
+#include "enums.hpp"
+#include "fourier_transforms.hpp"
+#include "object.hpp"
+#include "type_aliases.hpp"
+
+#include <memory>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Reusable workspace for repeated fft() / rfft() calls of one shape.
+ *
+ * fft() and rfft() allocate a navg-record work array on every averaged call.
+ * An fft_context owns that array, 64-byte aligned, for a fixed (navg, nfft,
+ * window).  It holds the window coefficient table for its lifetime, so calls
+ * skip the window table cache, and warms the FFTW plan when it is created, so
+ * later calls perform no heap allocation when FFTs run on a single thread (see
+ * set_num_threads()).  Without averaging, the FFT runs in the output array, so
+ * an output array with a different SIMD alignment than a std::vector builds
+ * one more plan on its first call.  Results are identical to fft() / rfft()
+ * with the same arguments.
+ */
+class fft_context final : public object {
+public:
+	/**
+	 * @brief Factory method to create a new fft_context object.
+	 *
+	 * @param cplx   If true, the context computes complex FFTs; otherwise
+	 *               real FFTs.
+	 * @param navg   Number of FFT averages.
+	 * @param nfft   FFT size.
+	 * @param window Window function to apply.
+	 * @param scale  dBFS scaling convention (real FFTs only).
+	 * @return Shared pointer to a new fft_context instance.
+	 */
+	static std::shared_ptr<fft_context> create(bool cplx, size_t navg,
+			size_t nfft, Window window, RfftScale scale) {
+		return std::make_shared<fft_context>(cplx, navg, nfft, window, scale);
+	}
+
+public: // Constructors, Destructor, and Assignment
+	fft_context(bool cplx, size_t navg, size_t nfft, Window window,
+			RfftScale scale);
+
+public: // Complex FFT
+	/**
+	 * @brief Compute the FFT of normalized I/Q data.
+	 *
+	 * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+	 * @param i_size   Number of elements in @p i_data.
+	 * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+	 * @param q_size   Number of elements in @p q_data.
+	 * @param out_data Pointer to output array for interleaved Re/Im result.
+	 * @param out_size Number of elements in @p out_data (use size()).
+	 */
+	void fft(const real_t *i_data, size_t i_size, const real_t *q_data,
+			size_t q_size, real_t *out_data, size_t out_size);
+
+	/**
+	 * @brief Compute the FFT of quantized (integer) I/Q data.
+	 *
+	 * @tparam T       Integer sample type (int16_t, int32_t, or int64_t).
+	 * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+	 * @param i_size   Number of elements in @p i_data.
+	 * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+	 * @param q_size   Number of elements in @p q_data.
+	 * @param out_data Pointer to output array for interleaved Re/Im result.
+	 * @param out_size Number of elements in @p out_data (use size()).
+	 * @param n        ADC resolution in bits.
+	 * @param format   Code format of the input samples.
+	 */
+	template <typename T>
+	void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+			real_t *out_data, size_t out_size, int n, CodeFormat format);
+
+public: // Real FFT
+	/**
+	 * @brief Compute the real FFT of normalized data.
+	 *
+	 * @param in_data  Pointer to real input data.
+	 * @param in_size  Number of elements in @p in_data.
+	 * @param out_data Pointer to output array for interleaved Re/Im result.
+	 * @param out_size Number of elements in @p out_data (use size()).
+	 */
+	void rfft(const real_t *in_data, size_t in_size, real_t *out_data,
+			size_t out_size);
+
+	/**
+	 * @brief Compute the real FFT of quantized (integer) data.
+	 *
+	 * @tparam T       Integer sample type (int16_t, int32_t, or int64_t).
+	 * @param in_data  Pointer to quantized input data.
+	 * @param in_size  Number of elements in @p in_data.
+	 * @param out_data Pointer to output array for interleaved Re/Im result.
+	 * @param out_size Number of elements in @p out_data (use size()).
+	 * @param n        ADC resolution in bits.
+	 * @param format   Code format of the input samples.
+	 */
+	template <typename T>
+	void rfft(const T *in_data, size_t in_size, real_t *out_data,
+			size_t out_size, int n, CodeFormat format);
+
+public: // Accessors
+	/**
+	 * @brief Return the required output array size.
+	 */
+	size_t size() const {
+		return (m_cplx ? m_nfft : m_nfft / 2 + 1) * 2;
+	}
+
+	bool is_complex() const {
+		return m_cplx;
+	}
+
+	size_t navg() const {
+		return m_navg;
+	}
+
+	size_t nfft() const {
+		return m_nfft;
+	}
+
+	RfftScale scale() const {
+		return m_scale;
+	}
+
+	Window window() const {
+		return m_window;
+	}
+
+private: // Virtual Function Overrides
+	bool equals_impl(const object &that) const override;
+
+	ObjectType object_type_impl() const override {
+		return ObjectType::FftContext;
+	}
+
+	void save_impl(const str_t &filename) const override;
+
+	str_t to_string_impl() const override;
+
+private:
+	struct aligned_delete {
+		void operator()(real_t *p) const;
+	};
+
+	void check_type(bool cplx) const;
+
+	bool m_cplx;
+	size_t m_navg;
+	size_t m_nfft;
+	Window m_window;
+	RfftScale m_scale;
+	window_coefficients m_win;
+	size_t m_work_size;
+	std::unique_ptr<real_t[], aligned_delete> m_work;
+
+}; // class fft_context
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_FFT_CONTEXT_HPP
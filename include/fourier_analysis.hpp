@@ -19,6 +19,9 @@
 
 namespace genalyzer_impl {
 
+class analysis_context;
+class analysis_plan;
+
 /**
  * @brief Central class for Fourier-analysis-based RF performance metrics.
  *
@@ -76,17 +79,126 @@ public: // Analysis
 	 * Identifies configured signal, distortion, and noise components in the
 	 * spectrum and computes performance metrics (SNR, SINAD, SFDR, THD, etc.).
 	 *
-	 * @param in_data   Pointer to magnitude-squared FFT data.
+	 * @p in_data may be the interleaved Re/Im output of fft() / rfft(), or the
+	 * mean-square output of fft_msq() / rfft_msq(), which is analyzed without
+	 * another norm() pass but carries no phase.
+	 *
+	 * @param in_data   Pointer to FFT data (magnitude-squared or interleaved
+	 *                  Re/Im).
+	 * @param in_size   Number of elements in @p in_data.
+	 * @param nfft      FFT size used to produce @p in_data.
+	 * @param axis_type Frequency axis type of the input data.
+	 * @return A fourier_analysis_results object containing all computed metrics.
+	 */
+	fourier_analysis_results analyze(const real_t *in_data,
+			const size_t in_size,
+			const size_t nfft,
+			FreqAxisType axis_type) const;
+
+	/**
+	 * @brief Run Fourier analysis on single-precision FFT data.
+	 *
+	 * Accepts the float spectra produced by the single-precision fft() and
+	 * rfft() overloads.  The data is widened to double precision and
+	 * analyzed exactly as by the double-precision overload.
+	 *
+	 * @param in_data   Pointer to FFT data (magnitude-squared or interleaved
+	 *                  Re/Im).
 	 * @param in_size   Number of elements in @p in_data.
 	 * @param nfft      FFT size used to produce @p in_data.
 	 * @param axis_type Frequency axis type of the input data.
 	 * @return A fourier_analysis_results object containing all computed metrics.
 	 */
+	fourier_analysis_results analyze(const float *in_data,
+			const size_t in_size,
+			const size_t nfft,
+			FreqAxisType axis_type) const;
+
+	/**
+	 * @brief Run Fourier analysis using reusable scratch storage.
+	 *
+	 * Same as the context-free overload, but the mean-square spectrum and the
+	 * bin masks are kept in @p ctx and reused by later calls.
+	 *
+	 * @param in_data   Pointer to FFT data (magnitude-squared or interleaved
+	 *                  Re/Im).
+	 * @param in_size   Number of elements in @p in_data.
+	 * @param nfft      FFT size used to produce @p in_data; must equal the
+	 *                  context nfft.
+	 * @param axis_type Frequency axis type of the input data.
+	 * @param ctx       Analysis context.
+	 * @return A fourier_analysis_results object containing all computed metrics.
+	 */
 	fourier_analysis_results analyze(const real_t *in_data,
 			const size_t in_size,
 			const size_t nfft,
+			FreqAxisType axis_type,
+			analysis_context &ctx) const;
+
+	/**
+	 * @brief Run Fourier analysis on a batch of spectra of the same nfft.
+	 *
+	 * The configuration is compiled once, as by prepare(), and the spectra
+	 * are analyzed as by analysis_plan::analyze_batch().
+	 *
+	 * @param in_data   Pointer to @p count spectra of FFT data, stored back
+	 *                  to back, each in the format accepted by analyze().
+	 * @param in_size   Number of elements in @p in_data; a multiple of
+	 *                  @p count.
+	 * @param count     Number of spectra.
+	 * @param nfft      FFT size used to produce each spectrum.
+	 * @param axis_type Frequency axis type of the input data.
+	 * @return The result keys and a count x keys matrix of result values.
+	 */
+	fourier_analysis_batch_results analyze_batch(const real_t *in_data,
+			const size_t in_size,
+			const size_t count,
+			const size_t nfft,
+			FreqAxisType axis_type) const;
+
+	/**
+	 * @brief Run Fourier analysis on real time-domain data, computing only
+	 * the spectrum bins of the components.
+	 *
+	 * The configuration is compiled once, as by prepare() for a real
+	 * analysis, and the data are analyzed as by
+	 * analysis_plan::analyze_sparse().  Results are those of analyze() on
+	 * the rfft_msq() spectrum of the data.
+	 *
+	 * @param in_data   Pointer to real input data.
+	 * @param in_size   Number of elements in @p in_data.
+	 * @param navg      Number of records to average (0 for auto-detect).
+	 * @param nfft      FFT size.
+	 * @param window    Window function to apply before the DFT.
+	 * @param scale     dBFS scaling convention.
+	 * @param axis_type Frequency axis type.
+	 * @return A fourier_analysis_results object containing all computed metrics.
+	 */
+	fourier_analysis_results analyze_sparse(const real_t *in_data,
+			const size_t in_size,
+			const size_t navg,
+			const size_t nfft,
+			Window window,
+			RfftScale scale,
 			FreqAxisType axis_type) const;
 
+	/**
+	 * @brief Compile this configuration into a reusable analysis plan.
+	 *
+	 * Everything that does not depend on the spectrum is resolved once: the
+	 * component list and order, the variables, the analysis band, and the bins
+	 * of fixed components.  The plan is a snapshot; later changes to this
+	 * object do not affect it.
+	 *
+	 * @param nfft      FFT size of the spectra to be analyzed.
+	 * @param axis_type Frequency axis type of the spectra.
+	 * @param cplx      True for complex (nfft-bin) spectra, false for real
+	 *                  (nfft/2+1-bin) spectra.
+	 * @return Shared pointer to a new analysis_plan instance.
+	 */
+	std::shared_ptr<analysis_plan> prepare(size_t nfft,
+			FreqAxisType axis_type, bool cplx) const;
+
 public: // Component Definition
 	/**
 	 * @brief Add a tone component at a fixed frequency.
@@ -380,6 +492,8 @@ private: // Virtual Function Overrides
 	str_t to_string_impl() const override;
 
 private:
+	friend class analysis_plan;
+
 	using comp_ptr = std::unique_ptr<fourier_analysis_component>;
 	using comp_map = std::map<str_t, comp_ptr>;
 	using comp_data_t = std::tuple<str_vector, comp_map, std::set<str_t>>;
@@ -396,17 +510,23 @@ private:
 private: // Analysis and related subroutines
 	static mask_map initialize_masks(bool cplx, size_t size);
 
-	fourier_analysis_results analyze_impl(
+	void analyze_impl(
+			fourier_analysis_results &results, // output; cleared first
+			const analysis_plan &plan, // compiled form of this configuration
 			const real_t *msq_data, // mean-square FFT magnitude data
 			const size_t msq_size, // size of ms_data
-			const size_t nfft, // FFT size
-			FreqAxisType axis_type, //
-			const cplx_t *fft_data =
-					nullptr, // complex FFT data; if provided, results include phase
-			const size_t fft_size =
-					0 // size of fft_data; if fft_data is not Null,
+			const cplx_t *fft_data, // complex FFT data; if provided, results include phase
+			const size_t fft_size, // size of fft_data; if fft_data is not Null,
+			analysis_context *ctx // reusable scratch storage, or nullptr
 	) const; // fft_size should equal msq_size
 
+	void analyze_data(fourier_analysis_results &results,
+			const real_t *in_data, const size_t in_size, const size_t nfft,
+			FreqAxisType axis_type, analysis_context *ctx,
+			const analysis_plan *plan = nullptr) const;
+
+	void compile(analysis_plan &plan) const;
+
 	void finalize_masks(mask_map &masks) const;
 
 	var_map initialize_vars(size_t nfft) const;
@@ -423,6 +543,18 @@ public: // Public configuration parameters
 	bool en_conv_offset;
 	/** @brief If true, enable fundamental image components (for complex FFT analysis). */
 	bool en_fund_images;
+	/**
+	 * @brief If true, report each IMD product as a tone.  If false, IMD
+	 * products are enumerated numerically when a plan is compiled: products
+	 * outside the analysis band are dropped, and products that land on the
+	 * same bins are merged.  They contribute to the IMD, THD, and distortion
+	 * results and to SFDR, but have no tone results; MaxSpurIndex is -1 if
+	 * the largest spur is such a product.  The products of each Signal with
+	 * the Signals before it are found where its IMD tones would be, after its
+	 * HD and ILGT components, so every other result is the same as with IMD
+	 * tones.
+	 */
+	bool en_imd_tones;
 	/** @brief If true, enable quadrature error tone components (image, gain/phase imbalance). */
 	bool en_quad_errors;
 	/** @brief If true, classify interleaving components as noise rather than distortion. */
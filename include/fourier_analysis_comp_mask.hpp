@@ -9,6 +9,8 @@
 
 namespace genalyzer_impl {
 
+class spectrum_index;
+
 // Ranges are set as [first, last], i.e., inclusive-inclusive,
 // but are stored [first, last+1) like STL, i.e., inclusive-exclusive
 class fourier_analysis_comp_mask {
@@ -38,8 +40,15 @@ public:
 	fourier_analysis_comp_mask &
 	operator=(const fourier_analysis_comp_mask &m) {
 		if (&m != this) {
-			fourier_analysis_comp_mask the_copy(m);
-			std::swap(the_copy, *this);
+			// Member-wise, so that m_data keeps its storage
+			m_mode = m.m_mode;
+			m_ufirst = m.m_ufirst;
+			m_ulast = m.m_ulast;
+			m_usize = m.m_usize;
+			m_first = m.m_first;
+			m_last = m.m_last;
+			m_size = m.m_size;
+			m_data = m.m_data;
 		}
 		return *this;
 	}
@@ -88,6 +97,10 @@ public:
 	std::tuple<diff_t, diff_t, diff_t> find_max_index(const real_t *data,
 			size_t size) const;
 
+	// Same as above, using an index built with max queries enabled
+	std::tuple<diff_t, diff_t, diff_t> find_max_index(
+			const spectrum_index &index) const;
+
 	// Returns Index1, Index2, Number of Bins
 	std::tuple<size_t, size_t, size_t> get_indexes() const;
 
@@ -124,12 +137,23 @@ public:
 		return std::sqrt(sum(data, size));
 	}
 
+	real_t root_sum(const spectrum_index &index) const {
+		return std::sqrt(sum(index));
+	}
+
 	// Returns the sum of the data in the ranges
 	real_t sum(const real_t *data, size_t size) const;
 
+	// Returns the sum of the indexed data in the ranges; O(number of ranges)
+	real_t sum(const spectrum_index &index) const;
+
 	void unset_ranges(const fourier_analysis_comp_mask &m);
 
 private:
+	// Masks with at least this many ranges are merged by operator|= in one
+	// pass, rather than one range at a time
+	static constexpr size_t merge_min_ranges = 16;
+
 	// Returns the index of the first element greater than 'value'
 	size_t get_index(size_t value) const;
 
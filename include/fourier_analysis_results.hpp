@@ -8,21 +8,32 @@
 #include "exceptions.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bitset>
 #include <map>
+#include <unordered_map>
 
 namespace genalyzer_impl {
 
 struct fa_tone_results {
+	static constexpr size_t size = static_cast<size_t>(FAToneResult::__SIZE__);
+
+	bool contains(FAToneResult key) const {
+		return defined.test(static_cast<size_t>(key));
+	}
+
 	real_t get(FAToneResult key) const {
-		if (results.find(key) == results.end()) {
+		if (!contains(key)) {
 			throw runtime_error(
 					"fa_tone_results::get : key not found");
 		}
-		return results.at(key);
+		return results[static_cast<size_t>(key)];
 	}
 
 	void set(FAToneResult key, real_t value) {
-		results[key] = value;
+		results[static_cast<size_t>(key)] = value;
+		defined.set(static_cast<size_t>(key));
 		if (FAToneResult::I1 == key) {
 			i1 = static_cast<size_t>(value);
 		} else if (FAToneResult::I2 == key) {
@@ -35,53 +46,210 @@ struct fa_tone_results {
 	}
 
 	void set_mag(real_t ms_value) {
-		results[FAToneResult::Mag] = std::sqrt(ms_value);
-		results[FAToneResult::Mag_dBFS] = bounded_db10(ms_value);
+		set(FAToneResult::Mag, std::sqrt(ms_value));
+		set(FAToneResult::Mag_dBFS, bounded_db10(ms_value));
+	}
+
+	// Map view of the defined results
+	std::map<FAToneResult, real_t> to_map() const {
+		std::map<FAToneResult, real_t> m;
+		for (size_t j = 0; j < size; ++j) {
+			if (defined.test(j)) {
+				m.emplace(static_cast<FAToneResult>(j), results[j]);
+			}
+		}
+		return m;
 	}
 
-	std::map<FAToneResult, real_t> results;
-	size_t i1;
-	size_t i2;
-	size_t nbins;
-	bool inband;
+	std::array<real_t, size> results{};
+	std::bitset<size> defined{};
+	size_t i1 = 0;
+	size_t i2 = 0;
+	size_t nbins = 0;
+	bool inband = false;
 };
 
+/*
+ * Global results are a fixed array indexed by FAResult.  Tone results are a
+ * table stored as a struct-of-arrays: tone_values[j][t] is result j of tone t,
+ * whose key is tone_keys[t].  Tones are kept in the order they were added, and
+ * tone_lookup maps each key to its index.
+ *
+ * An object can be reused by repeated analyses.  clear() keeps the tone
+ * storage; tones that are added again with the same keys in the same order, as
+ * by every analysis with one plan, are overwritten in place without
+ * allocating.  end_tones() then drops any stored tones that were not added.
+ */
 struct fourier_analysis_results {
+	static constexpr size_t size = static_cast<size_t>(FAResult::__SIZE__);
+
 	real_t get(FAResult key) const {
-		if (results.find(key) == results.end()) {
+		if (!defined.test(static_cast<size_t>(key))) {
 			throw runtime_error(
 					"fourier_analysis_results::get : key not found");
 		}
-		return results.at(key);
+		return results[static_cast<size_t>(key)];
 	}
 
 	void set(FAResult key, real_t value) {
-		results[key] = value;
+		results[static_cast<size_t>(key)] = value;
+		defined.set(static_cast<size_t>(key));
+	}
+
+	// Clears every result for reuse; see end_tones()
+	void clear() {
+		results.fill(0.0);
+		defined.reset();
+		tones_added = 0;
 	}
 
 	bool contains_tone(const str_t &key) const {
-		return tone_results.find(key) != tone_results.end();
+		return tone_lookup.end() != tone_lookup.find(key);
 	}
 
-	void add_tone(const str_t &key, fa_tone_results tr) {
-		if (!contains_tone(key)) {
-			tone_keys.push_back(key);
-			tone_results.emplace(key, std::move(tr));
+	// Returns the index of tone key, or tone_count() if not found
+	size_t tone_index(const str_t &key) const {
+		auto it = tone_lookup.find(key);
+		return (tone_lookup.end() == it) ? tone_keys.size() : it->second;
+	}
+
+	size_t tone_count() const {
+		return tone_keys.size();
+	}
+
+	void reserve_tones(size_t n) {
+		tone_keys.reserve(n);
+		tone_lookup.reserve(n);
+		tone_defined.reserve(n);
+		for (std::vector<real_t> &column : tone_values) {
+			column.reserve(n);
 		}
 	}
 
-	const fa_tone_results &get_tone(const str_t &key) const {
-		if (contains_tone(key)) {
-			return tone_results.at(key);
+	// Adds tone key after the tones added since clear() and returns its index;
+	// keys must be unique.  A stored tone at that index with the same key is
+	// overwritten; one with a different key is dropped, with those after it.
+	size_t add_tone(const str_t &key, const fa_tone_results &tr) {
+		const size_t t = tones_added;
+		if (t < tone_keys.size() && tone_keys[t] != key) {
+			truncate_tones(t);
+		}
+		if (t == tone_keys.size()) {
+			if (!tone_lookup.emplace(key, t).second) {
+				throw runtime_error("fourier_analysis_results::add_tone : "
+						"duplicate key '" + key + "'");
+			}
+			tone_keys.push_back(key);
+			tone_defined.push_back(tr.defined);
+			for (size_t j = 0; j < fa_tone_results::size; ++j) {
+				tone_values[j].push_back(tr.results[j]);
+			}
 		} else {
+			tone_defined[t] = tr.defined;
+			for (size_t j = 0; j < fa_tone_results::size; ++j) {
+				tone_values[j][t] = tr.results[j];
+			}
+		}
+		++tones_added;
+		return t;
+	}
+
+	// Drops the stored tones that were not added since clear()
+	void end_tones() {
+		truncate_tones(tones_added);
+	}
+
+	void truncate_tones(size_t n) {
+		for (size_t t = n; t < tone_keys.size(); ++t) {
+			tone_lookup.erase(tone_keys[t]);
+		}
+		tone_keys.resize(std::min(n, tone_keys.size()));
+		tone_defined.resize(tone_keys.size());
+		for (std::vector<real_t> &column : tone_values) {
+			column.resize(tone_keys.size());
+		}
+		tones_added = std::min(tones_added, tone_keys.size());
+	}
+
+	fa_tone_results get_tone(size_t t) const {
+		fa_tone_results tr;
+		for (size_t j = 0; j < fa_tone_results::size; ++j) {
+			if (tone_defined[t].test(j)) {
+				tr.set(static_cast<FAToneResult>(j), tone_values[j][t]);
+			}
+		}
+		return tr;
+	}
+
+	fa_tone_results get_tone(const str_t &key) const {
+		size_t t = tone_index(key);
+		if (tone_keys.size() == t) {
+			throw runtime_error(
+					"fourier_analysis_results::get_tone : key not found");
+		}
+		return get_tone(t);
+	}
+
+	real_t get_tone(size_t t, FAToneResult key) const {
+		if (!tone_defined[t].test(static_cast<size_t>(key))) {
 			throw runtime_error(
 					"fourier_analysis_results::get_tone : key not found");
 		}
+		return tone_values[static_cast<size_t>(key)][t];
 	}
 
-	std::map<FAResult, real_t> results;
+	void set_tone(size_t t, FAToneResult key, real_t value) {
+		tone_values[static_cast<size_t>(key)][t] = value;
+		tone_defined[t].set(static_cast<size_t>(key));
+	}
+
+	// Map view of the defined global results
+	std::map<FAResult, real_t> to_map() const {
+		std::map<FAResult, real_t> m;
+		for (size_t i = 0; i < size; ++i) {
+			if (defined.test(i)) {
+				m.emplace(static_cast<FAResult>(i), results[i]);
+			}
+		}
+		return m;
+	}
+
+	// Map view of the tone results
+	std::map<str_t, fa_tone_results> tone_map() const {
+		std::map<str_t, fa_tone_results> m;
+		for (size_t t = 0; t < tone_keys.size(); ++t) {
+			m.emplace(tone_keys[t], get_tone(t));
+		}
+		return m;
+	}
+
+	std::array<real_t, size> results{};
+	std::bitset<size> defined{};
 	str_vector tone_keys;
-	std::map<str_t, fa_tone_results> tone_results;
+	std::unordered_map<str_t, size_t> tone_lookup;
+	std::array<std::vector<real_t>, fa_tone_results::size> tone_values;
+	std::vector<std::bitset<fa_tone_results::size>> tone_defined;
+	size_t tones_added = 0; // tones added since clear()
+};
+
+/*
+ * Results of a batch of analyses that share one plan.  Every analysis has the
+ * same result keys, so they are stored once; values is a rows x keys.size()
+ * matrix in row-major order, with one row per spectrum.  The columns are in
+ * the order of the flattened results of a single analysis.
+ */
+struct fourier_analysis_batch_results {
+	size_t cols() const {
+		return keys.size();
+	}
+
+	real_t get(size_t row, size_t col) const {
+		return values[row * keys.size() + col];
+	}
+
+	str_vector keys;
+	size_t rows = 0;
+	std::vector<real_t> values;
 };
 
 } // namespace genalyzer_impl
@@ -7,6 +7,8 @@
 #include "enums.hpp"
 #include "type_aliases.hpp"
 
+#include <memory>
+
 namespace genalyzer_impl {
 
 /**
@@ -55,6 +57,31 @@ void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
 		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
 		Window window, CodeFormat format);
 
+/**
+ * @brief Compute the complex FFT of 16-bit quantized I/Q data in single
+ * precision.
+ *
+ * Same as the integer fft() template, but normalization, windowing, the FFT,
+ * and averaging are carried out in single precision and the spectrum is
+ * written as float.  Requires genalyzer to be built with the FFTW float
+ * library; otherwise a runtime_error is thrown.
+ *
+ * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+ * @param i_size   Number of elements in @p i_data.
+ * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+ * @param q_size   Number of elements in @p q_data (0 for interleaved input).
+ * @param out_data Pointer to output array for interleaved complex FFT result.
+ * @param out_size Number of elements in @p out_data (use fft_size() to compute).
+ * @param n        ADC resolution in bits.
+ * @param navg     Number of records to average (0 for auto-detect).
+ * @param nfft     FFT size (0 for auto-detect).
+ * @param window   Window function to apply before the FFT.
+ * @param format   Code format of the input samples.
+ */
+void fft(const int16_t *i_data, size_t i_size, const int16_t *q_data,
+		size_t q_size, float *out_data, size_t out_size, int n, size_t navg,
+		size_t nfft, Window window, CodeFormat format);
+
 /**
  * @brief Compute the required output array size for fft().
  *
@@ -110,6 +137,29 @@ void rfft(const T *in_data, size_t in_size, real_t *out_data, size_t out_size,
 		int n, size_t navg, size_t nfft, Window window, CodeFormat format,
 		RfftScale scale);
 
+/**
+ * @brief Compute the real FFT of 16-bit quantized data in single precision.
+ *
+ * Same as the integer rfft() template, but normalization, windowing, the FFT,
+ * and averaging are carried out in single precision and the spectrum is
+ * written as float.  Requires genalyzer to be built with the FFTW float
+ * library; otherwise a runtime_error is thrown.
+ *
+ * @param in_data  Pointer to quantized input data.
+ * @param in_size  Number of elements in @p in_data.
+ * @param out_data Pointer to output array for interleaved complex FFT result.
+ * @param out_size Number of elements in @p out_data (use rfft_size() to compute).
+ * @param n        ADC resolution in bits.
+ * @param navg     Number of records to average (0 for auto-detect).
+ * @param nfft     FFT size (0 for auto-detect).
+ * @param window   Window function to apply before the FFT.
+ * @param format   Code format of the input samples.
+ * @param scale    dBFS scaling convention.
+ */
+void rfft(const int16_t *in_data, size_t in_size, float *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format, RfftScale scale);
+
 /**
  * @brief Compute the required output array size for rfft().
  *
@@ -122,6 +172,366 @@ void rfft(const T *in_data, size_t in_size, real_t *out_data, size_t out_size,
  */
 size_t rfft_size(size_t in_size, size_t &navg, size_t &nfft);
 
+/**
+ * @brief Compute the averaged mean-square spectrum of normalized I/Q data.
+ *
+ * Same as fft(), but writes the mean-square magnitude of each bin instead of
+ * the interleaved Re/Im spectrum.  The averaged phase is not computed, which
+ * removes most of the averaging cost.  The result equals norm() of the fft()
+ * output, up to floating-point rounding, and can be passed directly to
+ * fourier_analysis::analyze() (phase results are then unavailable).
+ *
+ * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+ * @param i_size   Number of elements in @p i_data.
+ * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+ * @param q_size   Number of elements in @p q_data (0 for interleaved input).
+ * @param out_data Pointer to output array for the mean-square spectrum.
+ * @param out_size Number of elements in @p out_data (half of fft_size()).
+ * @param navg     Number of records to average (0 for auto-detect).
+ * @param nfft     FFT size (0 for auto-detect).
+ * @param window   Window function to apply before the FFT.
+ */
+void fft_msq(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, Window window);
+
+/**
+ * @brief Compute the averaged mean-square spectrum of quantized (integer) I/Q
+ * data.
+ *
+ * See the normalized fft_msq().
+ *
+ * @tparam T       Integer sample type (int16_t, int32_t, or int64_t).
+ * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+ * @param i_size   Number of elements in @p i_data.
+ * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+ * @param q_size   Number of elements in @p q_data (0 for interleaved input).
+ * @param out_data Pointer to output array for the mean-square spectrum.
+ * @param out_size Number of elements in @p out_data (half of fft_size()).
+ * @param n        ADC resolution in bits.
+ * @param navg     Number of records to average (0 for auto-detect).
+ * @param nfft     FFT size (0 for auto-detect).
+ * @param window   Window function to apply before the FFT.
+ * @param format   Code format of the input samples.
+ */
+template <typename T>
+void fft_msq(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		Window window, CodeFormat format);
+
+/**
+ * @brief Compute the averaged mean-square one-sided spectrum of normalized
+ * data.
+ *
+ * Same as rfft(), but writes the mean-square magnitude of each of the nfft/2+1
+ * bins; see fft_msq().
+ *
+ * @param in_data  Pointer to real input data.
+ * @param in_size  Number of elements in @p in_data.
+ * @param out_data Pointer to output array for the mean-square spectrum.
+ * @param out_size Number of elements in @p out_data (half of rfft_size()).
+ * @param navg     Number of records to average (0 for auto-detect).
+ * @param nfft     FFT size (0 for auto-detect).
+ * @param window   Window function to apply before the FFT.
+ * @param scale    dBFS scaling convention.
+ */
+void rfft_msq(const real_t *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window,
+		RfftScale scale);
+
+/**
+ * @brief Compute the averaged mean-square one-sided spectrum of quantized
+ * (integer) data.
+ *
+ * See the normalized rfft_msq().
+ *
+ * @tparam T       Integer sample type (int16_t, int32_t, or int64_t).
+ * @param in_data  Pointer to quantized input data.
+ * @param in_size  Number of elements in @p in_data.
+ * @param out_data Pointer to output array for the mean-square spectrum.
+ * @param out_size Number of elements in @p out_data (half of rfft_size()).
+ * @param n        ADC resolution in bits.
+ * @param navg     Number of records to average (0 for auto-detect).
+ * @param nfft     FFT size (0 for auto-detect).
+ * @param window   Window function to apply before the FFT.
+ * @param format   Code format of the input samples.
+ * @param scale    dBFS scaling convention.
+ */
+template <typename T>
+void rfft_msq(const T *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format, RfftScale scale);
+
+/**
+ * @brief Compute selected bins of the averaged mean-square one-sided spectrum
+ * of normalized data, and the sum of all of its bins.
+ *
+ * out_data[i] is bin bins[i] of the rfft_msq() output, up to floating-point
+ * rounding.  Each bin is a direct DFT sum, so the cost is O(in_size *
+ * bins_size) rather than that of a full FFT; for a few bins of a long record,
+ * this is much faster.  The sum of all nfft/2+1 bins is computed from the
+ * windowed time-domain data (Parseval's theorem).
+ *
+ * @param in_data   Pointer to real input data.
+ * @param in_size   Number of elements in @p in_data.
+ * @param bins      Pointer to the bin indexes to compute, each < nfft/2+1.
+ * @param bins_size Number of elements in @p bins.
+ * @param out_data  Pointer to output array for the selected bins.
+ * @param out_size  Number of elements in @p out_data; equal to @p bins_size.
+ * @param navg      Number of records to average (0 for auto-detect).
+ * @param nfft      FFT size (0 for auto-detect); less than 2^32.
+ * @param window    Window function to apply before the DFT.
+ * @param scale     dBFS scaling convention.
+ * @return Sum of all bins of the mean-square spectrum.
+ */
+real_t rfft_msq_bins(const real_t *in_data, size_t in_size,
+		const size_t *bins, size_t bins_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window,
+		RfftScale scale);
+
+/**
+ * @brief Compute the averaged complex FFTs of several channels in one call.
+ *
+ * The input holds nch channels in channel-major order, each navg * nfft
+ * samples (2 * navg * nfft for interleaved I/Q), with the first sample of each
+ * channel @p stride elements after that of the previous one.  The records of
+ * all channels share one FFTW plan and are split across threads as in fft()
+ * (see set_num_threads()).  Row c of the output is the same spectrum that fft()
+ * returns for channel c alone.
+ *
+ * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+ * @param i_size   Number of elements in @p i_data.
+ * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+ * @param q_size   Number of elements in @p q_data (0 for interleaved input).
+ * @param nch      Number of channels.
+ * @param stride   Channel stride in elements (0 if channels are contiguous).
+ * @param out_data Pointer to output array of nch interleaved Re/Im rows.
+ * @param out_size Number of elements in @p out_data (use fft_batch_size()).
+ * @param navg     Number of records to average per channel.
+ * @param nfft     FFT size.
+ * @param window   Window function to apply before the FFT.
+ */
+void fft_batch(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, size_t nch, size_t stride, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window);
+
+/**
+ * @brief Compute the averaged complex FFTs of several channels of quantized
+ * (integer) I/Q data in one call.
+ *
+ * See the normalized fft_batch() for the input and output layouts.
+ *
+ * @tparam T       Integer sample type (int16_t, int32_t, or int64_t).
+ * @param i_data   Pointer to I data (or interleaved I/Q if @p q_size is 0).
+ * @param i_size   Number of elements in @p i_data.
+ * @param q_data   Pointer to Q data (may be nullptr if @p q_size is 0).
+ * @param q_size   Number of elements in @p q_data (0 for interleaved input).
+ * @param nch      Number of channels.
+ * @param stride   Channel stride in elements (0 if channels are contiguous).
+ * @param out_data Pointer to output array of nch interleaved Re/Im rows.
+ * @param out_size Number of elements in @p out_data (use fft_batch_size()).
+ * @param n        ADC resolution in bits.
+ * @param navg     Number of records to average per channel.
+ * @param nfft     FFT size.
+ * @param window   Window function to apply before the FFT.
+ * @param format   Code format of the input samples.
+ */
+template <typename T>
+void fft_batch(const T *i_data, size_t i_size, const T *q_data,
+		size_t q_size, size_t nch, size_t stride, real_t *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format);
+
+/**
+ * @brief Compute the required output array size for fft_batch().
+ *
+ * @param nch  Number of channels.
+ * @param nfft FFT size.
+ * @return Required output array size (nch * 2 * nfft).
+ */
+size_t fft_batch_size(size_t nch, size_t nfft);
+
+/**
+ * @brief Compute the averaged real FFTs of several channels in one call.
+ *
+ * The input holds nch channels in channel-major order, each navg * nfft
+ * samples, with the first sample of each channel @p stride elements after that
+ * of the previous one.  Row c of the output is the same spectrum that rfft()
+ * returns for channel c alone.
+ *
+ * @param in_data  Pointer to real input data.
+ * @param in_size  Number of elements in @p in_data.
+ * @param nch      Number of channels.
+ * @param stride   Channel stride in elements (0 if channels are contiguous).
+ * @param out_data Pointer to output array of nch interleaved Re/Im rows.
+ * @param out_size Number of elements in @p out_data (use rfft_batch_size()).
+ * @param navg     Number of records to average per channel.
+ * @param nfft     FFT size.
+ * @param window   Window function to apply before the FFT.
+ * @param scale    dBFS scaling convention.
+ */
+void rfft_batch(const real_t *in_data, size_t in_size, size_t nch,
+		size_t stride, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, Window window, RfftScale scale);
+
+/**
+ * @brief Compute the averaged real FFTs of several channels of quantized
+ * (integer) data in one call.
+ *
+ * See the normalized rfft_batch() for the input and output layouts.
+ *
+ * @tparam T       Integer sample type (int16_t, int32_t, or int64_t).
+ * @param in_data  Pointer to quantized input data.
+ * @param in_size  Number of elements in @p in_data.
+ * @param nch      Number of channels.
+ * @param stride   Channel stride in elements (0 if channels are contiguous).
+ * @param out_data Pointer to output array of nch interleaved Re/Im rows.
+ * @param out_size Number of elements in @p out_data (use rfft_batch_size()).
+ * @param n        ADC resolution in bits.
+ * @param navg     Number of records to average per channel.
+ * @param nfft     FFT size.
+ * @param window   Window function to apply before the FFT.
+ * @param format   Code format of the input samples.
+ * @param scale    dBFS scaling convention.
+ */
+template <typename T>
+void rfft_batch(const T *in_data, size_t in_size, size_t nch, size_t stride,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		Window window, CodeFormat format, RfftScale scale);
+
+/**
+ * @brief Compute the required output array size for rfft_batch().
+ *
+ * @param nch  Number of channels.
+ * @param nfft FFT size.
+ * @return Required output array size (nch * (nfft / 2 + 1) * 2).
+ */
+size_t rfft_batch_size(size_t nch, size_t nfft);
+
+/**
+ * @brief Get the FFTW planner effort used for new FFT plans.
+ *
+ * @return Current planner effort.
+ */
+FftPlanner get_fft_planner();
+
+/**
+ * @brief Set the FFTW planner effort used for new FFT plans.
+ *
+ * The planner effort is part of the plan cache key, so plans created with a
+ * different effort remain cached and are not replaced.
+ *
+ * @param planner Planner effort.
+ */
+void set_fft_planner(FftPlanner planner);
+
+/**
+ * @brief Save accumulated FFTW wisdom to a file.
+ *
+ * Wisdom for single-precision FFTs, when they are available, is saved to a
+ * second file, @p filename with ".float" appended.
+ *
+ * @param filename Path of the wisdom file to write.
+ */
+void fft_wisdom_export(const str_t &filename);
+
+/**
+ * @brief Load FFTW wisdom from a file.
+ *
+ * Imported wisdom lets measuring planners (FftPlanner::Measure and
+ * FftPlanner::Patient) skip the planning cost for sizes already seen.  When
+ * single-precision FFTs are available, their wisdom is also loaded from
+ * @p filename with ".float" appended, if that file exists.
+ *
+ * @param filename Path of the wisdom file to read.
+ */
+void fft_wisdom_import(const str_t &filename);
+
+/**
+ * @brief Discard all accumulated FFTW wisdom.
+ *
+ * Cached plans are kept; only plans created afterwards are affected.  Wisdom
+ * for single-precision FFTs, when they are available, is discarded too.
+ */
+void fft_wisdom_forget();
+
+/**
+ * @brief Remove all cached window coefficient tables.
+ *
+ * Threads also hold the tables they have used in a private cache; each thread
+ * releases them on its next windowed transform.
+ */
+void window_cache_clear();
+
+/**
+ * @brief Get the number of cached window coefficient tables.
+ *
+ * @return Number of tables currently held in the cache.
+ */
+size_t window_cache_size();
+
+/**
+ * @brief Precompute and cache the window coefficient table for an FFT size.
+ *
+ * fft() and rfft() build each table on first use and reuse it afterwards.
+ * Tables are keyed by (window, nfft, scale); complex FFTs use the
+ * RfftScale::Native table.  Window::NoWindow requires no table.  If genalyzer
+ * is built with the FFTW float library, the single-precision table is warmed
+ * too.
+ *
+ * @param window Window function.
+ * @param nfft   FFT size.
+ * @param scale  dBFS scaling convention.
+ */
+void window_cache_warm(Window window, size_t nfft, RfftScale scale);
+
+} // namespace genalyzer_impl
+
+/*
+ * Internal use only
+ *
+ * Variants of fft() and rfft() that use a caller-provided work array when
+ * averaging (1 < navg), instead of allocating one per call.  work_size must be
+ * at least fft_work_size() / rfft_work_size() for the resolved navg and nfft;
+ * work may be nullptr when that size is 0.
+ *
+ * Instead of a Window, they take the window coefficients returned by
+ * fft_window_coefficients(), so a caller that holds them skips the window
+ * table cache.  win is nullptr for Window::NoWindow, and otherwise its size
+ * must equal the resolved nfft.  Complex FFTs use the RfftScale::Native table.
+ */
+namespace genalyzer_impl {
+
+using window_coefficients = std::shared_ptr<const std::vector<real_t>>;
+
+size_t fft_work_size(size_t navg, size_t nfft);
+
+size_t rfft_work_size(size_t navg, size_t nfft);
+
+window_coefficients fft_window_coefficients(Window window, size_t nfft,
+		RfftScale scale);
+
+void fft(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, const window_coefficients &win, real_t *work,
+		size_t work_size);
+
+template <typename T>
+void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		const window_coefficients &win, CodeFormat format, real_t *work,
+		size_t work_size);
+
+void rfft(const real_t *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft,
+		const window_coefficients &win, RfftScale scale, real_t *work,
+		size_t work_size);
+
+template <typename T>
+void rfft(const T *in_data, size_t in_size, real_t *out_data, size_t out_size,
+		int n, size_t navg, size_t nfft, const window_coefficients &win,
+		CodeFormat format, RfftScale scale, real_t *work, size_t work_size);
+
 } // namespace genalyzer_impl
 
 #endif // GENALYZER_IMPL_FOURIER_TRANSFORMS_HPP
\ No newline at end of file
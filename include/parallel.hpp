@@ -0,0 +1,62 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_PARALLEL_HPP
+#define GENALYZER_IMPL_PARALLEL_HPP
+
+#include "type_aliases.hpp"
+
+#include <functional>
+#include <utility>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Get the number of threads used by parallel algorithms.
+ *
+ * @return Thread count (1 means all work runs on the calling thread).
+ */
+size_t get_num_threads();
+
+/**
+ * @brief Set the number of threads used by parallel algorithms.
+ *
+ * The default is 1, which keeps every computation on the calling thread.
+ * Worker threads are created on demand and shared by all parallel algorithms.
+ *
+ * @param num_threads Thread count; 0 selects the hardware concurrency.
+ */
+void set_num_threads(size_t num_threads);
+
+/**
+ * @brief Run @p f(i) for every i in [0, @p ntasks) on the shared thread pool.
+ *
+ * The calling thread participates and the call blocks until all tasks have
+ * completed.  If any task throws, the first exception is rethrown to the
+ * caller after the remaining tasks finish.  Nested calls are safe.
+ *
+ * @param ntasks Number of tasks.
+ * @param f      Task function, called once per task index.
+ */
+void parallel_for(size_t ntasks, const std::function<void(size_t)> &f);
+
+/**
+ * @brief Split [0, @p size) into @p nparts contiguous, near-equal ranges.
+ *
+ * @param size   Number of elements.
+ * @param nparts Number of ranges.
+ * @param part   Range index in [0, @p nparts).
+ * @return Half-open range [first, last) for @p part.
+ */
+inline std::pair<size_t, size_t> partition_range(size_t size, size_t nparts,
+		size_t part) {
+	const size_t q = size / nparts;
+	const size_t r = size % nparts;
+	const size_t first = part * q + (part < r ? part : r);
+	const size_t last = first + q + (part < r ? 1 : 0);
+	return std::make_pair(first, last);
+}
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_PARALLEL_HPP
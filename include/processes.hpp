@@ -9,6 +9,8 @@
 
 namespace genalyzer_impl {
 
+struct sample_format;
+
 /**
  * @brief Decimate a waveform by keeping every Nth sample.
  *
@@ -108,6 +110,24 @@ template <typename T>
 void normalize(const T *in_data, size_t in_size, real_t *out_data,
 		size_t out_size, int n, CodeFormat format);
 
+/**
+ * @brief Convert raw ADC samples to normalized floating-point values.
+ *
+ * Samples are decoded as described by @p fmt (see sample_format) a block at a
+ * time, without unpacking the whole buffer into an integer array.  Results are
+ * identical to normalize() of the unpacked codes, with n = fmt.bits.
+ *
+ * @param buf      Pointer to raw sample buffer.
+ * @param buf_size Number of bytes in @p buf.
+ * @param out_data Pointer to output normalized data.
+ * @param out_size Number of elements in @p out_data, i.e. the number of
+ *                 samples to decode, from the first; at most
+ *                 raw_sample_count(buf_size, fmt).
+ * @param fmt      Raw sample format.
+ */
+void normalize_raw(const uint8_t *buf, size_t buf_size, real_t *out_data,
+		size_t out_size, const sample_format &fmt);
+
 /**
  * @brief Evaluate a polynomial at each point in the input array.
  *
@@ -0,0 +1,83 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_SAMPLE_FORMAT_HPP
+#define GENALYZER_IMPL_SAMPLE_FORMAT_HPP
+
+#include "enums.hpp"
+#include "type_aliases.hpp"
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Layout of raw ADC samples in a byte buffer.
+ *
+ * The buffer is a stream of containers of @p container_bits bits each; sample
+ * j is container @p offset + j * @p stride.  With 8, 16, 24, or 32 container
+ * bits, each container is a word of that many bytes; otherwise containers are
+ * packed back to back, e.g. two 12-bit samples in three bytes.  For words,
+ * @p big_endian selects the byte order; for packed containers, it selects
+ * whether each byte is filled from its most (true) or least (false)
+ * significant bit, which for byte-sized containers gives the same word byte
+ * order.  A code narrower than its container is in the least significant
+ * bits, unless @p left_justified; the other bits are ignored.
+ */
+struct sample_format {
+	int bits; // code width, i.e. ADC resolution
+	int container_bits; // bits per container, from bits to 32
+	bool left_justified; // code is in the most significant container bits
+	bool big_endian; // byte (word) or bit (packed) order
+	CodeFormat format; // code format
+	size_t stride; // containers per sample, e.g. the number of channels
+	size_t offset; // index of the first container, e.g. the channel
+};
+
+/**
+ * @brief Number of samples that hist_raw() and normalize_raw() decode at a
+ * time; the decoded codes stay in L1 cache.
+ */
+const size_t k_raw_block_size = 1024;
+
+/**
+ * @brief Check a raw sample format, and throw runtime_error if it is invalid.
+ *
+ * @param trace Prefix for error messages.
+ * @param fmt   Raw sample format.
+ */
+void check_sample_format(const char *trace, const sample_format &fmt);
+
+/**
+ * @brief Return the number of samples in a raw buffer.
+ *
+ * @param buf_size Number of bytes in the buffer.
+ * @param fmt      Raw sample format.
+ * @return Number of samples, i.e. containers offset, offset + stride, ...
+ *         that lie entirely in the buffer.
+ *
+ * The count is inferred from the buffer size, so pad bits after the last
+ * sample count as one more sample if they fill a whole container, e.g. three
+ * 4-bit samples in two bytes count as four.  This happens only for containers
+ * narrower than 8 bits; callers whose buffers are padded pass the true count
+ * to hist_raw() or normalize_raw().
+ */
+size_t raw_sample_count(size_t buf_size, const sample_format &fmt);
+
+/**
+ * @brief Decode raw samples into codes.
+ *
+ * Two's complement codes are sign-extended; offset binary codes are in
+ * [0, 2^bits).
+ *
+ * @param out_data Pointer to output codes.
+ * @param out_size Number of samples to decode.
+ * @param buf      Pointer to raw buffer.
+ * @param buf_size Number of bytes in @p buf.
+ * @param fmt      Raw sample format.
+ * @param first    Index of the first sample to decode.
+ */
+void unpack_raw(int32_t *out_data, size_t out_size, const uint8_t *buf,
+		size_t buf_size, const sample_format &fmt, size_t first = 0);
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_SAMPLE_FORMAT_HPP
@@ -0,0 +1,109 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_SIMD_KERNELS_HPP
+#define GENALYZER_IMPL_SIMD_KERNELS_HPP
+
+// This header is included by the instruction-set-specific translation units,
+// which are compiled with extra target flags.  It must not include headers
+// that define inline functions, so that no code built for those targets is
+// shared with the rest of the library.
+#include <cstddef>
+#include <cstdint>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Instruction sets used by the normalize-window kernels.
+ */
+enum class SimdLevel { Scalar, Avx2, Avx512, Neon };
+
+/**
+ * @brief Get the instruction set used by the normalize-window kernels.
+ *
+ * The default is detected at run time: AVX2 or NEON if the library was built
+ * with it and the host CPU supports it, otherwise Scalar.  AVX-512 must be
+ * selected explicitly with set_simd_level().
+ *
+ * @return Current instruction set.
+ */
+SimdLevel get_simd_level();
+
+/**
+ * @brief Set the instruction set used by the normalize-window kernels.
+ *
+ * Throws runtime_error if @p level is not available on this host.  All levels
+ * produce identical results; this is intended for testing and benchmarking.
+ *
+ * @param level Instruction set.
+ */
+void set_simd_level(SimdLevel level);
+
+/**
+ * @brief Get the name of an instruction set.
+ */
+const char *simd_level_name(SimdLevel level);
+
+/**
+ * @brief Normalize, and optionally window, quantized real samples.
+ *
+ * out_data[i] = win[i] * fma(scalar, in_data[i], offset) for i in [0, size).
+ * If @p win is nullptr, the window product is omitted.
+ */
+template <typename T, typename R>
+void norm_window(const T *in_data, const R *win, R *out_data, size_t size,
+		R scalar, R offset);
+
+/**
+ * @brief Normalize, and optionally window, quantized I/Q samples into an
+ * interleaved Re/Im array.
+ *
+ * For j in [0, nfft), out_data[2j] and out_data[2j+1] are the normalized and
+ * windowed samples i_data[j * in_stride] and q_data[j * in_stride].  If @p win
+ * is nullptr, the window product is omitted.
+ */
+template <typename T, typename R>
+void norm_window_cplx(const T *i_data, const T *q_data, size_t in_stride,
+		const R *win, R *out_data, size_t nfft, R scalar, R offset);
+
+} // namespace genalyzer_impl
+
+/*
+ * Internal use only
+ *
+ * Each instruction-set-specific translation unit defines a kernel table.  A
+ * kernel processes a whole number of vector blocks from the start of its
+ * arrays and returns the number of samples (complex samples for the split and
+ * interleaved kernels) that it processed; the caller handles the remainder.
+ * Results are bit-identical to the scalar kernels.
+ */
+namespace genalyzer_impl {
+
+template <typename R>
+struct norm_window_kernels {
+	size_t (*real16)(const int16_t *in, const R *win, R *out, size_t size,
+			R scalar, R offset);
+	size_t (*real32)(const int32_t *in, const R *win, R *out, size_t size,
+			R scalar, R offset);
+	size_t (*split16)(const int16_t *i, const int16_t *q, const R *win,
+			R *out, size_t nfft, R scalar, R offset);
+	size_t (*split32)(const int32_t *i, const int32_t *q, const R *win,
+			R *out, size_t nfft, R scalar, R offset);
+	size_t (*inter16)(const int16_t *iq, const R *win, R *out, size_t nfft,
+			R scalar, R offset);
+	size_t (*inter32)(const int32_t *iq, const R *win, R *out, size_t nfft,
+			R scalar, R offset);
+};
+
+struct simd_kernel_table {
+	norm_window_kernels<double> f64;
+	norm_window_kernels<float> f32;
+};
+
+extern const simd_kernel_table avx2_kernel_table;
+extern const simd_kernel_table avx512_kernel_table;
+extern const simd_kernel_table neon_kernel_table;
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_SIMD_KERNELS_HPP
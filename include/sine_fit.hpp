@@ -0,0 +1,57 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_SINE_FIT_HPP
+#define GENALYZER_IMPL_SINE_FIT_HPP
+
+#include "type_aliases.hpp"
+
+#include <map>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Fit a sinewave to time-domain data by least squares.
+ *
+ * Fits y[n] = ampl * cos(2 * pi * freq * n / fs + phase) + offset, as in
+ * IEEE Std 1057 / 1241.  The three-parameter fit uses @p freq as the known
+ * frequency and solves for amplitude, phase, and offset.  The four-parameter
+ * fit also solves for the frequency, by Gauss-Newton iteration starting at
+ * @p freq, which should be within about fs / size of the true frequency.  It
+ * stops when a step is negligible, or, with noise, when it is below 1% of the
+ * standard error of the frequency, so low SNR needs few more iterations.
+ * The phase follows the convention of cos(); it is the phase of sample 0.
+ *
+ * Results are amplitude, frequency, phase, offset, the RMS of the fit
+ * residual, SINAD (dB) of the fitted tone relative to the residual, ENOB
+ * computed from SINAD, and the number of four-parameter iterations.  Unlike
+ * Fourier analysis, no window is applied, and the capture need not be
+ * coherent.
+ *
+ * Throws runtime_error if the fit is singular (e.g., @p freq is 0 or fs/2),
+ * or if the four-parameter fit does not converge.
+ *
+ * @tparam T       Sample type (integer or floating-point).
+ * @param wf_data  Pointer to waveform data.
+ * @param wf_size  Number of elements in @p wf_data; at least 4.
+ * @param fs       Sample rate (S/s).
+ * @param freq     Tone frequency (Hz): exact for the three-parameter fit,
+ *                 the initial estimate for the four-parameter fit.
+ * @param fit_freq False for the three-parameter fit, true for the
+ *                 four-parameter fit.
+ * @return Map of metric names to values.
+ */
+template <typename T>
+std::map<str_t, real_t> sine_fit_analysis(const T *wf_data, size_t wf_size,
+		real_t fs, real_t freq, bool fit_freq);
+
+/**
+ * @brief Return the ordered list of result keys for sine_fit_analysis().
+ *
+ * @return Reference to a vector of key strings in canonical order.
+ */
+const std::vector<str_t> &sine_fit_analysis_ordered_keys();
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_SINE_FIT_HPP
@@ -0,0 +1,146 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_SPARSE_HISTOGRAM_HPP
+#define GENALYZER_IMPL_SPARSE_HISTOGRAM_HPP
+
+#include "enums.hpp"
+#include "object.hpp"
+#include "type_aliases.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Code density histogram that only stores the codes that are hit.
+ *
+ * Bins are indexed like a histx() histogram: bin i counts code min + i.
+ * Counts are kept in pages of 4096 32-bit counters, which are allocated when
+ * one of their codes is first hit; the rare counts that exceed 32 bits spill
+ * their high part into a map.  Memory is therefore proportional to the code
+ * range actually hit, instead of 8 bytes per code, and a histogram of 20- to
+ * 30-bit codes fits in memory.  dnl() and hist_analysis() accept a
+ * sparse_histogram directly.
+ */
+class sparse_histogram final : public object {
+public:
+	/**
+	 * @brief Factory method to create a new sparse_histogram object.
+	 *
+	 * @param min Minimum code value (inclusive).
+	 * @param max Maximum code value (inclusive).
+	 * @return Shared pointer to a new sparse_histogram instance.
+	 */
+	static std::shared_ptr<sparse_histogram> create(int64_t min, int64_t max) {
+		return std::make_shared<sparse_histogram>(min, max);
+	}
+
+	/**
+	 * @brief Factory method to create a new sparse_histogram object.
+	 *
+	 * @param n      ADC resolution in bits.
+	 * @param format Code format.
+	 * @return Shared pointer to a new sparse_histogram instance.
+	 */
+	static std::shared_ptr<sparse_histogram> create(int n, CodeFormat format);
+
+public: // Constructors, Destructor, and Assignment
+	sparse_histogram(int64_t min, int64_t max);
+
+public: // Counting
+	/**
+	 * @brief Add the codes of a quantized waveform to the histogram.
+	 *
+	 * Codes outside [min, max] are ignored, as by histx().
+	 *
+	 * @tparam T      Integer sample type.
+	 * @param wf_data Pointer to input waveform samples.
+	 * @param wf_size Number of elements in @p wf_data.
+	 */
+	template <typename T>
+	void add(const T *wf_data, size_t wf_size);
+
+	/**
+	 * @brief Clear all counts and release their storage.
+	 */
+	void reset();
+
+public: // Results
+	/**
+	 * @brief Return the count of bin @p index (code min + @p index).
+	 */
+	uint64_t count(size_t index) const;
+
+	/**
+	 * @brief Write the counts of bins [@p first, @p first + @p hist_size).
+	 *
+	 * @param hist_data Pointer to histogram output array.
+	 * @param hist_size Number of elements in @p hist_data.
+	 * @param first     Index of the first bin to write.
+	 */
+	void get(uint64_t *hist_data, size_t hist_size, size_t first) const;
+
+	/**
+	 * @brief Return the first and last non-zero bins, or (size(), size()) if
+	 * all bins are zero.
+	 */
+	size_p nz_range() const;
+
+	/**
+	 * @brief Return the number of bytes used for counts.
+	 */
+	size_t memory_size() const;
+
+public: // Accessors
+	int64_t max() const {
+		return m_max;
+	}
+
+	int64_t min() const {
+		return m_min;
+	}
+
+	/**
+	 * @brief Return the number of bins, max - min + 1.
+	 */
+	size_t size() const {
+		return m_size;
+	}
+
+	/**
+	 * @brief Return the sum of all bins.
+	 */
+	uint64_t sum() const {
+		return m_sum;
+	}
+
+private: // Virtual Function Overrides
+	bool equals_impl(const object &that) const override;
+
+	ObjectType object_type_impl() const override {
+		return ObjectType::SparseHistogram;
+	}
+
+	void save_impl(const str_t &filename) const override;
+
+	str_t to_string_impl() const override;
+
+private:
+	static const int page_bits = 12;
+	static const size_t page_size = static_cast<size_t>(1) << page_bits;
+
+	int64_t m_min;
+	int64_t m_max;
+	size_t m_size;
+	uint64_t m_sum;
+	std::vector<std::vector<uint32_t>> m_pages; // empty until a code is hit
+	std::map<size_t, uint64_t> m_spill; // high 32 bits of large counts
+
+}; // class sparse_histogram
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_SPARSE_HISTOGRAM_HPP
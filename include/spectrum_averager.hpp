@@ -0,0 +1,169 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_SPECTRUM_AVERAGER_HPP
+#define GENALYZER_IMPL_SPECTRUM_AVERAGER_HPP
+
+#include "enums.hpp"
+#include "object.hpp"
+#include "type_aliases.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace genalyzer_impl {
+
+/**
+ * @brief Streaming equivalent of the averaging performed by fft() and rfft().
+ *
+ * Records are added one at a time, or in chunks of whole records, and are
+ * transformed individually.  Only a running power and phase sum per bin is
+ * kept, so memory use is O(nfft) regardless of the number of records.  The
+ * averaged spectrum matches fft() / rfft() with navg equal to count(), up to
+ * floating-point rounding, and has the same interleaved Re/Im layout.
+ */
+class spectrum_averager final : public object {
+public:
+	/**
+	 * @brief Factory method to create a new spectrum_averager object.
+	 *
+	 * @param cplx   If true, average complex FFTs; otherwise real FFTs.
+	 * @param nfft   FFT size (samples per record).
+	 * @param window Window function to apply to each record.
+	 * @param scale  dBFS scaling convention (real FFTs only).
+	 * @return Shared pointer to a new spectrum_averager instance.
+	 */
+	static std::shared_ptr<spectrum_averager> create(bool cplx, size_t nfft,
+			Window window, RfftScale scale) {
+		return std::make_shared<spectrum_averager>(cplx, nfft, window,
+				scale);
+	}
+
+public: // Constructors, Destructor, and Assignment
+	spectrum_averager(bool cplx, size_t nfft, Window window, RfftScale scale);
+
+public: // Complex FFT Records
+	/**
+	 * @brief Add records of normalized I/Q data.
+	 *
+	 * @param i_data Pointer to I data (or interleaved I/Q if @p q_size is 0).
+	 * @param i_size Number of elements in @p i_data.
+	 * @param q_data Pointer to Q data (may be nullptr if @p q_size is 0).
+	 * @param q_size Number of elements in @p q_data (0 for interleaved input).
+	 */
+	void add(const real_t *i_data, size_t i_size, const real_t *q_data,
+			size_t q_size);
+
+	/**
+	 * @brief Add records of quantized (integer) I/Q data.
+	 *
+	 * @tparam T     Integer sample type (int16_t, int32_t, or int64_t).
+	 * @param i_data Pointer to I data (or interleaved I/Q if @p q_size is 0).
+	 * @param i_size Number of elements in @p i_data.
+	 * @param q_data Pointer to Q data (may be nullptr if @p q_size is 0).
+	 * @param q_size Number of elements in @p q_data (0 for interleaved input).
+	 * @param n      ADC resolution in bits.
+	 * @param format Code format of the input samples.
+	 */
+	template <typename T>
+	void add(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+			int n, CodeFormat format);
+
+public: // Real FFT Records
+	/**
+	 * @brief Add records of normalized real data.
+	 *
+	 * @param in_data Pointer to real input data.
+	 * @param in_size Number of elements in @p in_data.
+	 */
+	void radd(const real_t *in_data, size_t in_size);
+
+	/**
+	 * @brief Add records of quantized (integer) real data.
+	 *
+	 * @tparam T      Integer sample type (int16_t, int32_t, or int64_t).
+	 * @param in_data Pointer to quantized input data.
+	 * @param in_size Number of elements in @p in_data.
+	 * @param n       ADC resolution in bits.
+	 * @param format  Code format of the input samples.
+	 */
+	template <typename T>
+	void radd(const T *in_data, size_t in_size, int n, CodeFormat format);
+
+public: // Results and State
+	/**
+	 * @brief Write the averaged spectrum of all records added so far.
+	 *
+	 * @param out_data Pointer to output array for interleaved Re/Im result.
+	 * @param out_size Number of elements in @p out_data (use size()).
+	 */
+	void get(real_t *out_data, size_t out_size) const;
+
+	/**
+	 * @brief Discard all records added so far.
+	 */
+	void reset();
+
+	/**
+	 * @brief Return the number of records added since creation or reset().
+	 */
+	size_t count() const {
+		return m_count;
+	}
+
+	/**
+	 * @brief Return the required output array size for get().
+	 */
+	size_t size() const {
+		return m_work.size();
+	}
+
+	bool is_complex() const {
+		return m_cplx;
+	}
+
+	size_t nfft() const {
+		return m_nfft;
+	}
+
+	RfftScale scale() const {
+		return m_scale;
+	}
+
+	Window window() const {
+		return m_window;
+	}
+
+private: // Virtual Function Overrides
+	bool equals_impl(const object &that) const override;
+
+	ObjectType object_type_impl() const override {
+		return ObjectType::SpectrumAverager;
+	}
+
+	void save_impl(const str_t &filename) const override;
+
+	str_t to_string_impl() const override;
+
+private:
+	void check_type(bool cplx) const;
+
+	size_t record_count(size_t size) const;
+
+	// Adds the spectrum of one record, held in m_work, to the running sums
+	void accumulate();
+
+	bool m_cplx;
+	size_t m_nfft;
+	Window m_window;
+	RfftScale m_scale;
+	size_t m_count;
+	std::vector<real_t> m_work; // spectrum of the current record
+	std::vector<real_t> m_power; // sum of |X|^2 per bin
+	std::vector<real_t> m_phase; // sum of arg(X) per bin
+
+}; // class spectrum_averager
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_SPECTRUM_AVERAGER_HPP
@@ -0,0 +1,83 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#ifndef GENALYZER_IMPL_SPECTRUM_INDEX_HPP
+#define GENALYZER_IMPL_SPECTRUM_INDEX_HPP
+
+#include "type_aliases.hpp"
+
+#include <vector>
+
+namespace genalyzer_impl {
+
+// Block prefix sums of a mean-square spectrum, built once per analysis so that
+// the sum over a range of bins costs two lookups plus at most two partial
+// blocks, instead of one addition per bin.
+//
+// The spectrum is divided into blocks of block_size bins.  The prefix sums of
+// the block sums are stored as compensated (hi, lo) pairs, renormalized after
+// every block, so differencing two prefixes loses nothing to cancellation.
+// A range that does not span a whole block is summed bin by bin, exactly as
+// fourier_analysis_comp_mask::sum(data, size) does.  A longer range is the sum
+// of its partial edge blocks, summed bin by bin, and one prefix difference; its
+// rounding error is bounded by that of block_size + 1 additions, rather than
+// by one addition per bin.
+//
+// For component searches, the index can also hold a segment tree over the
+// blocks that gives the first maximum of each node.  The maximum of a range is
+// then found in O(log n) plus at most two partial blocks, with the same result
+// as fourier_analysis_comp_mask::find_max_index(data, size).
+//
+// The index refers to, but does not copy, the spectrum, which must outlive it.
+class spectrum_index {
+public:
+	static constexpr size_t block_size = 32;
+
+public:
+	spectrum_index() :
+			m_data{ nullptr },
+			m_size{ 0 },
+			m_prefix{},
+			m_block_max{},
+			m_leaves{ 0 },
+			m_tree{} {
+	}
+
+	spectrum_index(const real_t *data, size_t size, bool max_queries = false) :
+			spectrum_index() {
+		build(data, size, max_queries);
+	}
+
+public:
+	// Rebuilds the index for data, reusing the existing storage; max_queries
+	// enables max_index()
+	void build(const real_t *data, size_t size, bool max_queries = false);
+
+	bool has_max_queries() const {
+		return 0 < m_leaves;
+	}
+
+	// Returns the index and value of the first maximum of data[i1] through
+	// data[i2 - 1]; the index is -1 if no element is greater than 0
+	std::pair<diff_t, real_t> max_index(size_t i1, size_t i2) const;
+
+	size_t size() const {
+		return m_size;
+	}
+
+	// Returns the sum of data[i1] through data[i2 - 1]
+	real_t sum(size_t i1, size_t i2) const;
+
+private:
+	const real_t *m_data;
+	size_t m_size;
+	std::vector<real_t> m_prefix; // (hi, lo) pairs, one per block boundary
+	std::vector<real_t> m_block_max; // maximum of each block, or 0; -1 pads
+	size_t m_leaves; // number of tree leaves: a power of 2, or 0
+	std::vector<size_t> m_tree; // block of the first maximum of each node
+
+}; // class spectrum_index
+
+} // namespace genalyzer_impl
+
+#endif // GENALYZER_IMPL_SPECTRUM_INDEX_HPP
@@ -78,8 +78,9 @@ template <typename T>
 void check_array(const char *trace, const char *name, const T *p, size_t size,
 		bool interleaved = false) {
 	assert_ptr_not_null(trace, name, p);
-	str_t n = str_t(name) + " size";
-	assert_gt0(trace, n.c_str(), size);
+	if (0 == size) { // the message is built only on failure
+		throw runtime_error(str_t(trace) + name + " size <= 0");
+	}
 	if (interleaved && is_odd(size)) {
 		throw runtime_error(str_t(trace) +
 				" must be even if interleaved");
@@ -92,9 +93,10 @@ void check_array_pair(const char *trace, const char *name1, const T1 *p1,
 		size_t size2, bool interleaved = false) {
 	check_array(trace, name1, p1, size1);
 	check_array(trace, name2, p2, size2);
-	str_t n1 = str_t(name1) + " size";
-	str_t n2 = str_t(name2) + " size";
-	assert_eq(trace, n1.c_str(), size1, n2.c_str(), size2);
+	if (size1 != size2) {
+		throw runtime_error(str_t(trace) + name1 + " size != " + name2 +
+				" size");
+	}
 	if (interleaved && is_odd(size1)) {
 		throw runtime_error(str_t(trace) +
 				" must be even if interleaved");
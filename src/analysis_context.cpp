@@ -0,0 +1,84 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "analysis_context.hpp"
+
+#include "exceptions.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+
+namespace genalyzer_impl {
+
+analysis_context::analysis_context(size_t nfft) :
+		m_nfft{ nfft },
+		m_msq{},
+		m_masks{},
+		m_index{} {
+	assert_gt0("analysis_context : ", "nfft", nfft);
+	m_msq.reserve(nfft);
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Virtual Function Overrides
+
+bool analysis_context::equals_impl(const object &that_obj) const {
+	if (ObjectType::AnalysisContext != that_obj.object_type()) {
+		return false;
+	}
+	auto &that = static_cast<const analysis_context &>(that_obj);
+	return this->m_nfft == that.m_nfft;
+}
+
+void analysis_context::save_impl(const str_t &) const {
+	throw runtime_error("analysis_context::save : not supported");
+}
+
+str_t analysis_context::to_string_impl() const {
+	str_t s = "AnalysisContext\n";
+	s += "  nfft : " + std::to_string(m_nfft) + "\n";
+	return s;
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Non-Public
+
+void analysis_context::check_nfft(size_t nfft) const {
+	if (nfft != m_nfft) {
+		throw runtime_error("analysis_context : nfft (" +
+				std::to_string(nfft) + ") does not match context nfft (" +
+				std::to_string(m_nfft) + ")");
+	}
+}
+
+const spectrum_index &analysis_context::index(const real_t *data,
+		size_t size, bool max_queries) {
+	m_index.build(data, size, max_queries);
+	return m_index;
+}
+
+real_t *analysis_context::msq(size_t size) {
+	m_msq.resize(size);
+	return m_msq.data();
+}
+
+analysis_context::mask_map &analysis_context::masks(const mask_map &init) {
+	bool same_keys = m_masks.size() == init.size() &&
+			std::equal(m_masks.begin(), m_masks.end(), init.begin(),
+					[](const auto &a, const auto &b) {
+						return a.first == b.first;
+					});
+	if (same_keys) {
+		auto iter = m_masks.begin();
+		for (const auto &kv : init) {
+			(iter++)->second = kv.second;
+		}
+	} else {
+		m_masks = init;
+	}
+	return m_masks;
+}
+
+} // namespace genalyzer_impl
@@ -0,0 +1,213 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "analysis_plan.hpp"
+
+#include "analysis_context.hpp"
+#include "enum_maps.hpp"
+#include "exceptions.hpp"
+#include "fourier_transforms.hpp"
+#include "parallel.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+
+namespace genalyzer_impl {
+
+analysis_plan::analysis_plan(std::shared_ptr<const fourier_analysis> config,
+		size_t nfft, FreqAxisType axis_type, bool cplx) :
+		m_config{ std::move(config) },
+		m_nfft{ nfft },
+		m_axis_type{ axis_type },
+		m_cplx{ cplx },
+		m_size{ cplx ? nfft : nfft / 2 + 1 },
+		m_vars{},
+		m_keys{},
+		m_comps{},
+		m_ilos_clk_keys{},
+		m_masks{},
+		m_bins{},
+		m_dynamic{ false },
+		m_search{ false },
+		m_sparse{ false },
+		m_sparse_bins{},
+		m_imd_steps{},
+		m_slot_names{},
+		m_slot_values{},
+		m_key_slots{},
+		m_freq_code{} {
+	assert_gt0("analysis_plan : ", "nfft", nfft);
+	m_config->compile(*this);
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Analysis
+
+fourier_analysis_results analysis_plan::analyze(const real_t *in_data,
+		size_t in_size) const {
+	fourier_analysis_results results;
+	m_config->analyze_data(results, in_data, in_size, m_nfft, m_axis_type,
+			nullptr, this);
+	return results;
+}
+
+fourier_analysis_results analysis_plan::analyze(const real_t *in_data,
+		size_t in_size, analysis_context &ctx) const {
+	fourier_analysis_results results;
+	analyze(in_data, in_size, ctx, results);
+	return results;
+}
+
+void analysis_plan::analyze(const real_t *in_data, size_t in_size,
+		analysis_context &ctx, fourier_analysis_results &results) const {
+	ctx.check_nfft(m_nfft);
+	m_config->analyze_data(results, in_data, in_size, m_nfft, m_axis_type,
+			&ctx, this);
+}
+
+namespace {
+
+// Writes the values of results in flattened order: global results, then the
+// results of each tone
+void flatten_values(const fourier_analysis_results &results, real_t *values,
+		size_t size) {
+	const size_t tone_size = fa_tone_results::size;
+	if (fourier_analysis_results::size + tone_size * results.tone_count() !=
+			size) {
+		throw runtime_error(
+				"analysis_plan::analyze_batch : results size error");
+	}
+	for (size_t j = 0; j < fourier_analysis_results::size; ++j) {
+		*values++ = results.get(static_cast<FAResult>(j));
+	}
+	for (size_t t = 0; t < results.tone_count(); ++t) {
+		for (size_t j = 0; j < tone_size; ++j) {
+			*values++ = results.get_tone(t, static_cast<FAToneResult>(j));
+		}
+	}
+}
+
+} // namespace
+
+fourier_analysis_batch_results analysis_plan::analyze_batch(
+		const real_t *in_data, size_t in_size, size_t count) const {
+	const char *trace = "analysis_plan::analyze_batch : ";
+	assert_gt0(trace, "count", count);
+	check_array(trace, "input array", in_data, in_size);
+	if (0 != in_size % count) {
+		throw runtime_error(str_t(trace) +
+				"input size is not a multiple of count");
+	}
+	const size_t size = in_size / count;
+	fourier_analysis_batch_results batch;
+	batch.keys = result_keys();
+	batch.rows = count;
+	batch.values.resize(count * batch.keys.size());
+	const size_t cols = batch.keys.size();
+	real_t *values = batch.values.data();
+	// Contiguous rows per worker, so that each context is reused
+	const size_t nparts = std::min(get_num_threads(), count);
+	parallel_for(nparts, [&](size_t part) {
+		const std::pair<size_t, size_t> rows =
+				partition_range(count, nparts, part);
+		analysis_context ctx(m_nfft);
+		fourier_analysis_results results;
+		for (size_t row = rows.first; row < rows.second; ++row) {
+			analyze(in_data + row * size, size, ctx, results);
+			flatten_values(results, values + row * cols, cols);
+		}
+	});
+	return batch;
+}
+
+fourier_analysis_results analysis_plan::analyze_sparse(const real_t *in_data,
+		size_t in_size, size_t navg, Window window, RfftScale scale) const {
+	if (!m_sparse) {
+		throw runtime_error("analysis_plan::analyze_sparse : plan requires "
+				"the full spectrum (complex analysis, partial analysis band, "
+				"MaxTone components, or WO components; see set_wo(0))");
+	}
+	// Each bin costs about one pass over the data, so past about log2(nfft)
+	// bins the full transform is faster.
+	size_t log2_nfft = 0;
+	while ((static_cast<size_t>(1) << (log2_nfft + 1)) <= m_nfft) {
+		++log2_nfft;
+	}
+	if (log2_nfft < m_sparse_bins.size()) {
+		std::vector<real_t> msq(m_size);
+		rfft_msq(in_data, in_size, msq.data(), msq.size(), navg, m_nfft,
+				window, scale);
+		return analyze(msq.data(), msq.size());
+	}
+	std::vector<real_t> bin_values(m_sparse_bins.size());
+	const real_t total = rfft_msq_bins(in_data, in_size, m_sparse_bins.data(),
+			m_sparse_bins.size(), bin_values.data(), bin_values.size(), navg,
+			m_nfft, window, scale);
+	// Every mask that the analysis sums is either a union of component bins
+	// or contains all other bins, so the other bins can share the rest of the
+	// total equally without changing any result.
+	real_t known = 0.0;
+	for (real_t x : bin_values) {
+		known += x;
+	}
+	const size_t others = m_size - m_sparse_bins.size();
+	const real_t fill = (0 < others)
+			? std::max(0.0, total - known) / static_cast<real_t>(others)
+			: 0.0;
+	std::vector<real_t> msq(m_size, fill);
+	for (size_t i = 0; i < m_sparse_bins.size(); ++i) {
+		msq[m_sparse_bins[i]] = bin_values[i];
+	}
+	return analyze(msq.data(), msq.size());
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Accessors
+
+str_vector analysis_plan::result_keys() const {
+	str_vector keys;
+	keys.reserve(fourier_analysis_results::size +
+			fa_tone_results::size * m_keys.size());
+	for (int j = 0; j < static_cast<int>(FAResult::__SIZE__); ++j) {
+		keys.push_back(fa_result_map.at(j));
+	}
+	for (const str_t &key : m_keys) {
+		for (int j = 0; j < static_cast<int>(FAToneResult::__SIZE__); ++j) {
+			keys.push_back(fourier_analysis::flat_tone_key(key, j));
+		}
+	}
+	return keys;
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Virtual Function Overrides
+
+bool analysis_plan::equals_impl(const object &that_obj) const {
+	if (ObjectType::AnalysisPlan != that_obj.object_type()) {
+		return false;
+	}
+	auto &that = static_cast<const analysis_plan &>(that_obj);
+	return (this->m_nfft == that.m_nfft) &&
+			(this->m_axis_type == that.m_axis_type) &&
+			(this->m_cplx == that.m_cplx) &&
+			this->m_config->equals(*that.m_config);
+}
+
+void analysis_plan::save_impl(const str_t &) const {
+	throw runtime_error("analysis_plan::save : not supported");
+}
+
+str_t analysis_plan::to_string_impl() const {
+	str_t s = "AnalysisPlan\n";
+	s += "  nfft      : " + std::to_string(m_nfft) + "\n";
+	s += "  axis_type : " +
+			freq_axis_type_map.at(static_cast<int>(m_axis_type)) + "\n";
+	s += "  cplx      : " + str_t(m_cplx ? "true" : "false") + "\n";
+	s += "  keys      : " + std::to_string(m_keys.size()) + "\n";
+	return s;
+}
+
+} // namespace genalyzer_impl
@@ -3,9 +3,13 @@
 // SPDX short identifier: ADIBSD OR GPL-2.0-or-later
 #include "code_density.hpp"
 
+#include "code_density_accumulator.hpp"
 #include "constants.hpp"
 #include "exceptions.hpp"
+#include "parallel.hpp"
 #include "reductions.hpp"
+#include "sample_format.hpp"
+#include "sparse_histogram.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -139,6 +143,388 @@ void dnl_tone(const uint64_t *hist_data, real_t *dnl_data, size_t size) {
 	}
 }
 
+// nz: first and last non-zero bins, or (size, size) if there are none
+std::map<str_t, real_t> hist_analysis_results(real_t sum, size_p nz,
+		size_t size) {
+	const real_t num_bins = (nz.first < size)
+			? 1.0 + static_cast<real_t>(nz.second - nz.first)
+			: 0.0;
+	const std::vector<str_t> &keys = hist_analysis_ordered_keys();
+	return std::map<str_t, real_t>{
+		{ keys[0], sum },
+		{ keys[1], static_cast<real_t>(nz.first) },
+		{ keys[2], static_cast<real_t>(nz.second) },
+		{ keys[3], num_bins }
+	};
+}
+
+// Fewest samples per slice for which histx_parallel uses another thread
+const size_t min_parallel_hist_samples = 1 << 16;
+
+// Most samples per slice, so that counts fit in 32-bit sub-histograms, which
+// take half the cache of 64-bit ones
+const size_t max_hist_slice_samples = UINT32_MAX;
+
+template <typename T>
+void histx_slice(uint32_t *sub_data, const T *wf_data, size_t wf_size,
+		int64_t min, uint64_t span) {
+	// Codes outside [min, max] wrap around to more than span
+	const uint64_t umin = static_cast<uint64_t>(min);
+	for (size_t i = 0; i < wf_size; ++i) {
+		const int64_t x = static_cast<int64_t>(wf_data[i]);
+		const uint64_t k = static_cast<uint64_t>(x) - umin;
+		if (k <= span) {
+			++sub_data[k];
+		}
+	}
+}
+
+// DNL of a ramp histogram is value(i) in [lo, hi], and -1 elsewhere
+struct ramp_dnl {
+	const uint64_t *hist_data;
+	real_t avg_count;
+	real_t operator()(size_t i) const {
+		return hist_data[i] / avg_count - 1.0;
+	}
+};
+
+// DNL of a tone histogram is value(i) in [lo, hi], and -1 elsewhere; the
+// code widths are in the DNL array, which value(i) overwrites
+struct tone_dnl {
+	const real_t *width_data;
+	real_t k2;
+	real_t operator()(size_t i) const {
+		return std::fma(k2, width_data[i], -1.0);
+	}
+};
+
+// Steps 1 to 3 of dnl_tone(), with the cumulative histogram, histogram peaks,
+// transition points, and code widths in a single pass over the non-zero
+// bins.  Writes the widths to dnl_data[lo, hi], and returns (lo, hi).
+size_p tone_code_widths(real_t *dnl_data, const uint64_t *hist_data,
+		uint64_t sum, size_p nz) {
+	// Bins before nz.first add nothing to the cumulative histogram, whose
+	// total is sum
+	const real_t total_count = static_cast<real_t>(sum);
+	const real_t median_count = total_count * 0.5;
+	const real_t k1 = k_pi / total_count;
+	real_t count = 0.0;
+	real_t prev = 0.0;
+	size_t median_index = nz.second + 1;
+	size_t left_peak_index = nz.first;
+	uint64_t left_peak = hist_data[nz.first];
+	size_t right_peak_index = 0;
+	uint64_t right_peak = 0;
+	for (size_t i = nz.first; i <= nz.second; ++i) {
+		count += static_cast<real_t>(hist_data[i]);
+		const real_t t = -std::cos(k1 * count);
+		dnl_data[i] = t - prev;
+		prev = t;
+		if (nz.second < median_index) {
+			if (left_peak < hist_data[i]) { // leftmost peak
+				left_peak = hist_data[i];
+				left_peak_index = i;
+			}
+			if (median_count <= count) {
+				median_index = i;
+				right_peak = hist_data[i];
+				right_peak_index = i;
+			}
+		} else if (right_peak <= hist_data[i]) { // rightmost peak
+			right_peak = hist_data[i];
+			right_peak_index = i;
+		}
+	}
+	if (!(left_peak_index < median_index &&
+				median_index < right_peak_index)) {
+		throw runtime_error(
+				"linearity_analysis : unable to locate histogram peaks");
+	}
+	// Exclude the first and last NZ bins
+	const size_t lo = left_peak_index + (nz.first == left_peak_index);
+	const size_t hi = right_peak_index - (nz.second == right_peak_index);
+	return size_p(lo, hi);
+}
+
+// Steps 3 and 4 of dnl_tone(): returns the DNL of code widths in [lo, hi]
+tone_dnl tone_dnl_value(const real_t *dnl_data, size_p r) {
+	real_t code_width_sum = 0.0;
+	for (size_t i = r.second; r.first <= i; --i) { // same order as dnl_tone()
+		code_width_sum += dnl_data[i];
+	}
+	const real_t avg_code_width = code_width_sum /
+			static_cast<real_t>((r.second - r.first) + 1);
+	if (avg_code_width <= 0.0) {
+		throw runtime_error("linearity_analysis : avg_code_width <= 0.0");
+	}
+	return tone_dnl{ dnl_data, 1 / avg_code_width };
+}
+
+// Running min and max, with the first index of each, as in std_reduce()
+void update_extrema(std_reduce_t &r, real_t x, size_t i) {
+	if (x < r.min) {
+		r.min = x;
+		r.min_index = i;
+	}
+	if (r.max < x) {
+		r.max = x;
+		r.max_index = i;
+	}
+}
+
+void init_extrema(std_reduce_t &r, real_t x, size_t i) {
+	r.min = x;
+	r.max = x;
+	r.min_index = i;
+	r.max_index = i;
+}
+
+// Writes the DNL in [lo, hi] and the INL before the line fit in [f, l], the
+// first and last non-missing codes; -1 and 0 are written elsewhere.  Returns
+// the DNL reduction of dnl_analysis() over [fq, lq], which is in [f, l]
+// unless l == f, and accumulates the sums of the best-fit line.
+template <bool BestFit, typename Value>
+std_reduce_t dnl_inl_pass(real_t *dnl_data, real_t *inl_data, size_t size,
+		Value value, size_p lohi, size_p fl, size_p fqlq, real_t *sums) {
+	const size_t f = fl.first;
+	const size_t l = fl.second;
+	std::fill(dnl_data, dnl_data + lohi.first, -1.0);
+	for (size_t i = lohi.first; i < f; ++i) {
+		dnl_data[i] = value(i);
+	}
+	std::fill(inl_data, inl_data + f, 0.0);
+	real_t sx = 0.0;
+	real_t sy = 0.0;
+	real_t sxx = 0.0;
+	real_t sxy = 0.0;
+	real_t y = 0.0;
+	auto step = [&](size_t i, real_t d) {
+		dnl_data[i] = d;
+		y = (f == i) ? d : y + d;
+		inl_data[i] = y;
+		if (BestFit) {
+			const real_t x = static_cast<real_t>(i);
+			sx += x;
+			sy += y;
+			sxx += x * x;
+			sxy += x * y;
+		}
+	};
+	std_reduce_t r(size);
+	size_t i = f;
+	for (; i < fqlq.first && i <= l; ++i) {
+		step(i, value(i));
+	}
+	if (i <= l && i == fqlq.first) {
+		const real_t d = value(i);
+		step(i, d);
+		init_extrema(r, d, i);
+		for (++i; i <= fqlq.second; ++i) {
+			const real_t d = value(i);
+			step(i, d);
+			update_extrema(r, d, i);
+			r.sum += d;
+			r.sumsq += d * d;
+		}
+	}
+	for (; i <= l; ++i) {
+		step(i, value(i));
+	}
+	for (i = l + 1; i <= lohi.second; ++i) {
+		dnl_data[i] = value(i);
+	}
+	std::fill(dnl_data + std::max(l, lohi.second) + 1, dnl_data + size, -1.0);
+	std::fill(inl_data + l + 1, inl_data + size, 0.0);
+	sums[0] = sx;
+	sums[1] = sy;
+	sums[2] = sxx;
+	sums[3] = sxy;
+	return r;
+}
+
+template <typename Value>
+std_reduce_t dnl_inl_pass(real_t *dnl_data, real_t *inl_data, size_t size,
+		Value value, size_p lohi, size_p fl, size_p fqlq, real_t *sums,
+		bool best_fit) {
+	if (best_fit) {
+		return dnl_inl_pass<true>(dnl_data, inl_data, size, value, lohi, fl,
+				fqlq, sums);
+	}
+	return dnl_inl_pass<false>(dnl_data, inl_data, size, value, lohi, fl,
+			fqlq, sums);
+}
+
+// First and last i in [lo, hi] for which -1 < value(i), or (size, size)
+template <typename Value>
+size_p first_and_last_nm(Value value, size_p lohi, size_t size) {
+	size_t first = lohi.first;
+	while (first <= lohi.second && !(-1.0 < value(first))) {
+		++first;
+	}
+	if (lohi.second < first) {
+		return size_p(size, size);
+	}
+	size_t last = lohi.second;
+	while (first < last && !(-1.0 < value(last))) {
+		--last;
+	}
+	return size_p(first, last);
+}
+
+// hist_analysis(), dnl(), dnl_analysis(), inl(), and inl_analysis(), given
+// the histogram sum and first and last non-zero bins
+linearity_results linearity(real_t *dnl_data, real_t *inl_data,
+		const uint64_t *hist_data, size_t size, uint64_t sum, size_p nz,
+		DnlSignal type, InlLineFit fit) {
+	linearity_results res{};
+	res.hist_sum = sum;
+	res.hist_first_nz_index = nz.first;
+	res.hist_last_nz_index = nz.second;
+	res.hist_nz_range = (nz.first < size) ? 1 + (nz.second - nz.first) : 0;
+	// 1. DNL is value(i) in [lo, hi], and -1 elsewhere; lo > hi if all codes
+	// are missing
+	size_p lohi(1, 0);
+	ramp_dnl ramp{ hist_data, 0.0 };
+	tone_dnl tone{ dnl_data, 0.0 };
+	switch (type) {
+		case DnlSignal::Ramp: {
+			// Sum of all but the first and last NZ bins
+			const bool inner = nz.first < size && nz.first + 1 < nz.second;
+			const uint64_t inner_sum = inner
+					? sum - hist_data[nz.first] - hist_data[nz.second]
+					: 0;
+			if (0 < inner_sum) {
+				ramp.avg_count = static_cast<real_t>(inner_sum) /
+						(static_cast<real_t>(nz.second - nz.first) - 1.0);
+				lohi = size_p(nz.first + 1, nz.second - 1);
+			}
+			break;
+		}
+		case DnlSignal::Tone:
+			if (nz.first + 1 < nz.second) {
+				try {
+					lohi = tone_code_widths(dnl_data, hist_data, sum, nz);
+					tone = tone_dnl_value(dnl_data, lohi);
+				} catch (const runtime_error &) {
+					std::fill(dnl_data, dnl_data + size, -1.0);
+					throw;
+				}
+			}
+			break;
+		default:
+			throw runtime_error(
+					"linearity_analysis : DNL not implemented for signal type");
+	}
+	// 2. First and last non-missing codes, f and l, and the range [fq, lq]
+	// reduced by dnl_analysis()
+	const bool ramp_type = DnlSignal::Ramp == type;
+	const size_p fl = ramp_type ? first_and_last_nm(ramp, lohi, size)
+								: first_and_last_nm(tone, lohi, size);
+	const size_t f = fl.first;
+	const size_t l = fl.second;
+	if (size == f) {
+		std::fill(dnl_data, dnl_data + size, -1.0);
+		for (size_t i = lohi.first; i <= lohi.second; ++i) {
+			dnl_data[i] = ramp_type ? ramp(i) : tone(i);
+		}
+		std::fill(inl_data, inl_data + size, 0.0);
+		res.dnl_min = -1.0;
+		res.dnl_max = -1.0;
+		res.dnl_avg = -1.0;
+		res.dnl_rms = 1.0;
+		res.dnl_min_index = size;
+		res.dnl_max_index = size;
+		res.dnl_first_nm_index = size;
+		res.dnl_last_nm_index = size;
+		res.dnl_nm_range = 0;
+		res.inl_min = 0.0;
+		res.inl_max = 0.0;
+		res.inl_min_index = 0;
+		res.inl_max_index = 0;
+		return res;
+	}
+	const size_t fq = f + 1;
+	const size_t lq = (f + 2 <= l) ? l - 1 : fq;
+	// 3. DNL, its reduction, INL before the line fit, and best-fit sums
+	const bool best_fit = InlLineFit::BestFit == fit;
+	real_t sums[4];
+	std_reduce_t r = ramp_type
+			? dnl_inl_pass(dnl_data, inl_data, size, ramp, lohi, fl,
+					  size_p(fq, lq), sums, best_fit)
+			: dnl_inl_pass(dnl_data, inl_data, size, tone, lohi, fl,
+					  size_p(fq, lq), sums, best_fit);
+	if (l < fq && fq < size) {
+		r = std_reduce(dnl_data, size, fq, fq + 1);
+	}
+	if (fq < size) {
+		const real_t num_codes = 1.0 + static_cast<real_t>(lq - fq);
+		res.dnl_min = r.min;
+		res.dnl_max = r.max;
+		res.dnl_avg = r.sum / num_codes;
+		res.dnl_rms = std::sqrt(r.sumsq / num_codes);
+		res.dnl_min_index = r.min_index;
+		res.dnl_max_index = r.max_index;
+		res.dnl_first_nm_index = fq;
+		res.dnl_last_nm_index = lq;
+		res.dnl_nm_range = 1 + (lq - fq);
+	} else {
+		res.dnl_min = -1.0;
+		res.dnl_max = -1.0;
+		res.dnl_avg = -1.0;
+		res.dnl_rms = 1.0;
+		res.dnl_min_index = size;
+		res.dnl_max_index = size;
+		res.dnl_first_nm_index = size;
+		res.dnl_last_nm_index = size;
+		res.dnl_nm_range = 0;
+	}
+	// 4. Line fit, and INL reduction over the whole array, of which all but
+	// [f, l] is 0
+	real_t m = 0.0;
+	real_t b = 0.0;
+	switch (fit) {
+		case InlLineFit::NoFit:
+			break;
+		case InlLineFit::BestFit: {
+			real_t n = static_cast<real_t>(l - f) + 1.0;
+			m = (n * sums[3] - sums[0] * sums[1]) /
+					(n * sums[2] - sums[0] * sums[0]);
+			b = (sums[1] - m * sums[0]) / n;
+			break;
+		}
+		case InlLineFit::EndFit:
+			m = (inl_data[l] - inl_data[f]) / static_cast<real_t>(l - f);
+			b = inl_data[f] - m * static_cast<real_t>(f);
+			break;
+		default:
+			throw runtime_error("linearity_analysis : line fit not implemented");
+	}
+	// With NoFit, m and b are 0, which leaves the INL unchanged
+	auto remove_line = [&](size_t i) {
+		inl_data[i] -= m * static_cast<real_t>(i) + b;
+		return inl_data[i];
+	};
+	std_reduce_t q(size);
+	size_t i = f;
+	if (0 < f) {
+		init_extrema(q, 0.0, 0);
+	} else {
+		init_extrema(q, remove_line(0), 0);
+		++i;
+	}
+	for (; i <= l; ++i) {
+		update_extrema(q, remove_line(i), i);
+	}
+	if (l + 1 < size) {
+		update_extrema(q, 0.0, l + 1);
+	}
+	res.inl_min = q.min;
+	res.inl_max = q.max;
+	res.inl_min_index = q.min_index;
+	res.inl_max_index = q.max_index;
+	return res;
+}
+
 } // namespace
 
 size_t code_density_size(int n, CodeFormat format) {
@@ -205,6 +591,22 @@ void dnl(real_t *dnl_data, size_t dnl_size, const uint64_t *hist_data,
 	}
 }
 
+void dnl(real_t *dnl_data, size_t dnl_size, const sparse_histogram &hist,
+		DnlSignal type) {
+	const size_p nz = hist.nz_range();
+	if (hist.size() == nz.first) {
+		throw runtime_error("dnl : histogram is empty");
+	}
+	// Bins outside [nz.first, nz.second] do not affect the DNL of the bins
+	// inside
+	const size_t size = nz.second - nz.first + 1;
+	check_array("dnl : ", "dnl array", dnl_data, dnl_size);
+	assert_eq("dnl : ", "dnl array size", dnl_size, "expected", size);
+	std::vector<uint64_t> hist_data(size);
+	hist.get(hist_data.data(), size, nz.first);
+	dnl(dnl_data, dnl_size, hist_data.data(), size, type);
+}
+
 std::map<str_t, real_t> dnl_analysis(const real_t *data, size_t size) {
 	check_array("", "dnl array", data, size);
 	// First and last non-missing codes
@@ -312,42 +714,111 @@ template void histx(uint64_t *, size_t, const int32_t *, size_t, int64_t,
 template void histx(uint64_t *, size_t, const int64_t *, size_t, int64_t,
 		int64_t, bool);
 
-std::map<str_t, real_t> hist_analysis(const uint64_t *data, size_t size) {
-	check_array("", "hist array", data, size);
-	// Cummulative Histogram
-	std::vector<real_t> chist(size);
-	chist[0] = static_cast<real_t>(data[0]);
-	for (size_t i = 1; i < size; ++i) {
-		chist[i] = chist[i - 1] + static_cast<real_t>(data[i]);
+template <typename T>
+void hist_parallel(uint64_t *hist_data, size_t hist_size, const T *wf_data,
+		size_t wf_size, int n, CodeFormat format, bool preserve) {
+	std::pair<int64_t, int64_t> mm =
+			resolution_to_minmax<int64_t>(n, format);
+	histx_parallel(hist_data, hist_size, wf_data, wf_size, mm.first,
+			mm.second, preserve);
+}
+
+template void hist_parallel(uint64_t *, size_t, const int16_t *, size_t, int,
+		CodeFormat, bool);
+template void hist_parallel(uint64_t *, size_t, const int32_t *, size_t, int,
+		CodeFormat, bool);
+template void hist_parallel(uint64_t *, size_t, const int64_t *, size_t, int,
+		CodeFormat, bool);
+
+template <typename T>
+void histx_parallel(uint64_t *hist_data, size_t hist_size, const T *wf_data,
+		size_t wf_size, int64_t min, int64_t max, bool preserve) {
+	check_array("histx_parallel : ", "hist array", hist_data, hist_size);
+	check_array("histx_parallel : ", "waveform array", wf_data, wf_size);
+	size_t size_expected = code_densityx_size(min, max);
+	assert_eq("histx_parallel : ", "hist array size", hist_size, "expected",
+			size_expected);
+	// Each slice should have enough samples to pay for its sub-histogram
+	const size_t min_samples = std::max(min_parallel_hist_samples, hist_size);
+	size_t nparts = std::min(get_num_threads(), wf_size / min_samples);
+	if (nparts < 2 && wf_size <= max_hist_slice_samples) {
+		histx(hist_data, hist_size, wf_data, wf_size, min, max, preserve);
+		return;
 	}
-	// First and last non-zero indexes
-	size_t first_nz_index = 0;
-	while (first_nz_index < size) {
-		if (0 < data[first_nz_index++]) {
-			break;
+	nparts = std::max(nparts, (wf_size - 1) / max_hist_slice_samples + 1);
+	const uint64_t span = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+	std::vector<std::vector<uint32_t>> subs(nparts);
+	parallel_for(nparts, [&](size_t part) {
+		const size_p r = partition_range(wf_size, nparts, part);
+		subs[part].assign(hist_size, 0);
+		histx_slice(subs[part].data(), wf_data + r.first, r.second - r.first,
+				min, span);
+	});
+	// Merge contiguous bin ranges in parallel
+	parallel_for(nparts, [&](size_t part) {
+		const size_p r = partition_range(hist_size, nparts, part);
+		for (size_t i = r.first; i < r.second; ++i) {
+			uint64_t count = preserve ? hist_data[i] : 0;
+			for (const std::vector<uint32_t> &sub : subs) {
+				count += sub[i];
+			}
+			hist_data[i] = count;
 		}
+	});
+}
+
+template void histx_parallel(uint64_t *, size_t, const int16_t *, size_t,
+		int64_t, int64_t, bool);
+template void histx_parallel(uint64_t *, size_t, const int32_t *, size_t,
+		int64_t, int64_t, bool);
+template void histx_parallel(uint64_t *, size_t, const int64_t *, size_t,
+		int64_t, int64_t, bool);
+
+void hist_raw(uint64_t *hist_data, size_t hist_size, const uint8_t *buf,
+		size_t buf_size, const sample_format &fmt, size_t count,
+		bool preserve) {
+	const char *trace = "hist_raw : ";
+	check_array(trace, "hist array", hist_data, hist_size);
+	check_array(trace, "raw buffer", buf, buf_size);
+	check_sample_format(trace, fmt);
+	size_t size_expected = code_density_size(fmt.bits, fmt.format);
+	assert_eq(trace, "hist array size", hist_size, "expected",
+			size_expected);
+	if (raw_sample_count(buf_size, fmt) < count) {
+		throw runtime_error(str_t(trace) + "count exceeds sample count");
 	}
-	size_t last_nz_index = size - 1;
-	real_t num_bins = 0.0;
-	if (first_nz_index < size) { // if there are any non-zero bins
-		while (first_nz_index < last_nz_index) {
-			if (0 < data[last_nz_index--]) {
-				break;
-			}
+	if (!preserve) {
+		std::fill(hist_data, hist_data + hist_size, 0);
+	}
+	// Decoded codes are always in [min, max], so bins need no range check
+	const int32_t min = (CodeFormat::TwosComplement == fmt.format)
+			? -static_cast<int32_t>(hist_size >> 1)
+			: 0;
+	int32_t codes[k_raw_block_size];
+	for (size_t first = 0; first < count; first += k_raw_block_size) {
+		const size_t size = std::min(k_raw_block_size, count - first);
+		unpack_raw(codes, size, buf, buf_size, fmt, first);
+		for (size_t i = 0; i < size; ++i) {
+			++hist_data[codes[i] - min];
 		}
-		num_bins = 1.0 +
-				static_cast<real_t>(last_nz_index - first_nz_index);
-	} else {
-		last_nz_index = first_nz_index;
 	}
-	// Results
-	std::vector<str_t> keys = hist_analysis_ordered_keys();
-	return std::map<str_t, real_t>{
-		{ keys[0], chist.back() },
-		{ keys[1], static_cast<real_t>(first_nz_index) },
-		{ keys[2], static_cast<real_t>(last_nz_index) },
-		{ keys[3], num_bins }
-	};
+}
+
+std::map<str_t, real_t> hist_analysis(const uint64_t *data, size_t size) {
+	check_array("", "hist array", data, size);
+	const uint64_t sum = std::accumulate(data, data + size, uint64_t{ 0 });
+	return hist_analysis_results(static_cast<real_t>(sum),
+			first_and_last_nz(data, size), size);
+}
+
+std::map<str_t, real_t> hist_analysis(const sparse_histogram &hist) {
+	return hist_analysis_results(static_cast<real_t>(hist.sum()),
+			hist.nz_range(), hist.size());
+}
+
+std::map<str_t, real_t> hist_analysis(const code_density_accumulator &acc) {
+	return hist_analysis_results(static_cast<real_t>(acc.sum()),
+			acc.nz_range(), acc.size());
 }
 
 const std::vector<str_t> &hist_analysis_ordered_keys() {
@@ -436,4 +907,104 @@ const std::vector<str_t> &inl_analysis_ordered_keys() {
 	return keys;
 }
 
+linearity_results linearity_analysis(real_t *dnl_data, size_t dnl_size,
+		real_t *inl_data, size_t inl_size, const uint64_t *hist_data,
+		size_t hist_size, DnlSignal type, InlLineFit fit) {
+	const char *trace = "linearity_analysis : ";
+	check_array_pair(trace, "hist array", hist_data, hist_size, "dnl array",
+			dnl_data, dnl_size);
+	check_array_pair(trace, "hist array", hist_data, hist_size, "inl array",
+			inl_data, inl_size);
+	const uint64_t sum =
+			std::accumulate(hist_data, hist_data + hist_size, uint64_t{ 0 });
+	return linearity(dnl_data, inl_data, hist_data, hist_size, sum,
+			first_and_last_nz(hist_data, hist_size), type, fit);
+}
+
+template <typename T>
+linearity_results linearity_analysis(uint64_t *hist_data, size_t hist_size,
+		real_t *dnl_data, size_t dnl_size, real_t *inl_data, size_t inl_size,
+		const T *wf_data, size_t wf_size, int n, CodeFormat format,
+		DnlSignal type, InlLineFit fit) {
+	const char *trace = "linearity_analysis : ";
+	check_array_pair(trace, "hist array", hist_data, hist_size, "dnl array",
+			dnl_data, dnl_size);
+	check_array_pair(trace, "hist array", hist_data, hist_size, "inl array",
+			inl_data, inl_size);
+	check_array(trace, "waveform array", wf_data, wf_size);
+	const size_t size_expected = code_density_size(n, format);
+	assert_eq(trace, "hist array size", hist_size, "expected",
+			size_expected);
+	std::fill(hist_data, hist_data + hist_size, 0);
+	// The sum is the number of codes in range, so the histogram is not summed
+	// again; its first and last non-zero bins are found from its ends
+	const std::pair<int64_t, int64_t> mm =
+			resolution_to_minmax<int64_t>(n, format);
+	uint64_t outside = 0;
+	for (size_t i = 0; i < wf_size; ++i) {
+		if (mm.first <= wf_data[i] && wf_data[i] <= mm.second) {
+			++hist_data[wf_data[i] - mm.first];
+		} else {
+			++outside;
+		}
+	}
+	return linearity(dnl_data, inl_data, hist_data, hist_size,
+			wf_size - outside, first_and_last_nz(hist_data, hist_size), type,
+			fit);
+}
+
+template linearity_results linearity_analysis(uint64_t *, size_t, real_t *,
+		size_t, real_t *, size_t, const int16_t *, size_t, int, CodeFormat,
+		DnlSignal, InlLineFit);
+template linearity_results linearity_analysis(uint64_t *, size_t, real_t *,
+		size_t, real_t *, size_t, const int32_t *, size_t, int, CodeFormat,
+		DnlSignal, InlLineFit);
+template linearity_results linearity_analysis(uint64_t *, size_t, real_t *,
+		size_t, real_t *, size_t, const int64_t *, size_t, int, CodeFormat,
+		DnlSignal, InlLineFit);
+
+const std::vector<str_t> &linearity_analysis_ordered_keys() {
+	static const std::vector<str_t> keys{
+		"hist_sum", // total histogram hits
+		"hist_first_nz_index", // index of first non-zero bin
+		"hist_last_nz_index", // index of last non-zero bin
+		"hist_nz_range", // non-zero bin range
+		"dnl_min", // min DNL value
+		"dnl_max", // max DNL value
+		"dnl_avg", // average DNL value
+		"dnl_rms", // RMS DNL value
+		"dnl_min_index", // index of min DNL value
+		"dnl_max_index", // index of max DNL value
+		"dnl_first_nm_index", // index of first non-missing code
+		"dnl_last_nm_index", // index of last non-missing code
+		"dnl_nm_range", // non-missing code range
+		"inl_min", // min INL value
+		"inl_max", // max INL value
+		"inl_min_index", // index of min INL value
+		"inl_max_index" // index of max INL value
+	};
+	return keys;
+}
+
+void linearity_results_values(real_t *values, size_t size,
+		const linearity_results &results) {
+	const char *trace = "linearity_results_values : ";
+	check_array(trace, "values array", values, size);
+	assert_eq(trace, "values array size", size, "expected",
+			linearity_analysis_ordered_keys().size());
+	const linearity_results &r = results;
+	const real_t v[] = { static_cast<real_t>(r.hist_sum),
+		static_cast<real_t>(r.hist_first_nz_index),
+		static_cast<real_t>(r.hist_last_nz_index),
+		static_cast<real_t>(r.hist_nz_range), r.dnl_min, r.dnl_max,
+		r.dnl_avg, r.dnl_rms, static_cast<real_t>(r.dnl_min_index),
+		static_cast<real_t>(r.dnl_max_index),
+		static_cast<real_t>(r.dnl_first_nm_index),
+		static_cast<real_t>(r.dnl_last_nm_index),
+		static_cast<real_t>(r.dnl_nm_range), r.inl_min, r.inl_max,
+		static_cast<real_t>(r.inl_min_index),
+		static_cast<real_t>(r.inl_max_index) };
+	std::copy(v, v + size, values);
+}
+
 } // namespace genalyzer_impl
\ No newline at end of file
@@ -0,0 +1,167 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "code_density_accumulator.hpp"
+
+#include "code_density.hpp"
+#include "exceptions.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace genalyzer_impl {
+
+std::shared_ptr<code_density_accumulator> code_density_accumulator::create(
+		int n, CodeFormat format) {
+	std::pair<int64_t, int64_t> mm =
+			resolution_to_minmax<int64_t>(n, format);
+	return create(mm.first, mm.second);
+}
+
+code_density_accumulator::code_density_accumulator(int64_t min, int64_t max) :
+		m_min{ min },
+		m_max{ max },
+		m_hist(code_densityx_size(min, max), 0) {
+	reset();
+}
+
+template <typename T>
+void code_density_accumulator::push(const T *wf_data, size_t wf_size) {
+	check_array("code_density_accumulator::push : ", "waveform array",
+			wf_data, wf_size);
+	// Codes outside [min, max] wrap around to more than span
+	const uint64_t umin = static_cast<uint64_t>(m_min);
+	const uint64_t span = static_cast<uint64_t>(m_hist.size() - 1);
+	uint64_t *hist_data = m_hist.data();
+	int64_t lo = std::numeric_limits<int64_t>::max();
+	int64_t hi = std::numeric_limits<int64_t>::min();
+	uint64_t outside = 0;
+	for (size_t i = 0; i < wf_size; ++i) {
+		const int64_t x = static_cast<int64_t>(wf_data[i]);
+		lo = std::min(lo, x);
+		hi = std::max(hi, x);
+		const uint64_t k = static_cast<uint64_t>(x) - umin;
+		if (k <= span) {
+			++hist_data[k];
+		} else {
+			++outside;
+		}
+	}
+	m_count += wf_size;
+	m_min_code = std::min(m_min_code, lo);
+	m_max_code = std::max(m_max_code, hi);
+	// Without out-of-range codes, the smallest and largest codes are the first
+	// and last non-zero bins; otherwise, rescan for them
+	uint64_t kfirst = static_cast<uint64_t>(lo) - umin;
+	uint64_t klast = static_cast<uint64_t>(hi) - umin;
+	if (0 < outside) {
+		kfirst = std::numeric_limits<uint64_t>::max();
+		klast = 0;
+		uint64_t below = 0;
+		for (size_t i = 0; i < wf_size; ++i) {
+			const int64_t x = static_cast<int64_t>(wf_data[i]);
+			const uint64_t k = static_cast<uint64_t>(x) - umin;
+			if (k <= span) {
+				kfirst = std::min(kfirst, k);
+				klast = std::max(klast, k);
+			} else if (x < m_min) {
+				++below;
+			}
+		}
+		m_below += below;
+		m_above += outside - below;
+		if (klast < kfirst) {
+			return;
+		}
+	}
+	const size_t first = static_cast<size_t>(kfirst);
+	const size_t last = static_cast<size_t>(klast);
+	const bool empty = m_hist.size() == m_nz_first;
+	m_nz_first = empty ? first : std::min(m_nz_first, first);
+	m_nz_last = empty ? last : std::max(m_nz_last, last);
+}
+
+template void code_density_accumulator::push(const int16_t *, size_t);
+template void code_density_accumulator::push(const int32_t *, size_t);
+template void code_density_accumulator::push(const int64_t *, size_t);
+
+void code_density_accumulator::merge(const code_density_accumulator &that) {
+	if (this->m_min != that.m_min || this->m_max != that.m_max) {
+		throw runtime_error("code_density_accumulator::merge : "
+				"code ranges differ");
+	}
+	const size_t size = m_hist.size();
+	for (size_t i = 0; i < size; ++i) {
+		m_hist[i] += that.m_hist[i];
+	}
+	m_count += that.m_count;
+	m_below += that.m_below;
+	m_above += that.m_above;
+	m_min_code = std::min(m_min_code, that.m_min_code);
+	m_max_code = std::max(m_max_code, that.m_max_code);
+	if (size != that.m_nz_first) {
+		const bool empty = size == m_nz_first;
+		m_nz_first = empty ? that.m_nz_first
+				: std::min(m_nz_first, that.m_nz_first);
+		m_nz_last = empty ? that.m_nz_last
+				: std::max(m_nz_last, that.m_nz_last);
+	}
+}
+
+void code_density_accumulator::reset() {
+	std::fill(m_hist.begin(), m_hist.end(), 0);
+	m_count = 0;
+	m_below = 0;
+	m_above = 0;
+	m_min_code = std::numeric_limits<int64_t>::max();
+	m_max_code = std::numeric_limits<int64_t>::min();
+	m_nz_first = m_hist.size();
+	m_nz_last = m_hist.size();
+}
+
+void code_density_accumulator::snapshot(uint64_t *hist_data,
+		size_t hist_size) const {
+	const char *trace = "code_density_accumulator::snapshot : ";
+	check_array(trace, "hist array", hist_data, hist_size);
+	assert_eq(trace, "hist array size", hist_size, "expected", m_hist.size());
+	std::copy(m_hist.begin(), m_hist.end(), hist_data);
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Virtual Function Overrides
+
+bool code_density_accumulator::equals_impl(const object &that_obj) const {
+	if (ObjectType::CodeDensityAccumulator != that_obj.object_type()) {
+		return false;
+	}
+	auto &that = static_cast<const code_density_accumulator &>(that_obj);
+	return (this->m_min == that.m_min) && (this->m_max == that.m_max) &&
+			(this->m_count == that.m_count) &&
+			(this->m_below == that.m_below) &&
+			(this->m_above == that.m_above) &&
+			(this->m_min_code == that.m_min_code) &&
+			(this->m_max_code == that.m_max_code) &&
+			(this->m_hist == that.m_hist);
+}
+
+void code_density_accumulator::save_impl(const str_t &) const {
+	throw runtime_error("code_density_accumulator::save : not supported");
+}
+
+str_t code_density_accumulator::to_string_impl() const {
+	str_t s = "CodeDensityAccumulator\n";
+	s += "  min   : " + std::to_string(m_min) + "\n";
+	s += "  max   : " + std::to_string(m_max) + "\n";
+	s += "  count : " + std::to_string(m_count) + "\n";
+	s += "  below : " + std::to_string(m_below) + "\n";
+	s += "  above : " + std::to_string(m_above) + "\n";
+	if (0 < m_count) {
+		s += "  codes : " + std::to_string(m_min_code) + " to " +
+				std::to_string(m_max_code) + "\n";
+	}
+	return s;
+}
+
+} // namespace genalyzer_impl
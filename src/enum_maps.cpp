@@ -13,6 +13,7 @@ const std::map<str_t, std::reference_wrapper<const enum_map>> enumeration_map =
 	{ dnl_signal_map.name(), std::cref(dnl_signal_map) },
 	{ fa_comp_tag_map.name(), std::cref(fa_comp_tag_map) },
 	{ fa_ssb_map.name(), std::cref(fa_ssb_map) },
+	{ fft_planner_map.name(), std::cref(fft_planner_map) },
 	{ freq_axis_format_map.name(), std::cref(freq_axis_format_map) },
 	{ freq_axis_type_map.name(), std::cref(freq_axis_type_map) },
 	{ inl_line_fit_map.name(), std::cref(inl_line_fit_map) },
@@ -60,6 +61,12 @@ FASsb get_enum<FASsb>(int i) {
 	return static_cast<FASsb>(i);
 }
 
+template <>
+FftPlanner get_enum<FftPlanner>(int i) {
+	fft_planner_map.contains(i, true);
+	return static_cast<FftPlanner>(i);
+}
+
 template <>
 FreqAxisFormat get_enum<FreqAxisFormat>(int i) {
 	freq_axis_format_map.contains(i, true);
@@ -6,8 +6,9 @@
 #include "exceptions.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
 #include <cctype>
-#include <regex>
+#include <cmath>
 #include <sstream>
 #include <stack>
 #include <tuple>
@@ -182,8 +183,12 @@ bool is_operator(char c) {
 }
 
 bool is_variable(const str_t &s) {
-	static const std::regex re("[[:alpha:]][[:alnum:]_]*");
-	return std::regex_match(s, re);
+	if (s.empty() || !std::isalpha(static_cast<unsigned char>(s[0]))) {
+		return false;
+	}
+	return std::all_of(s.begin() + 1, s.end(), [](char c) {
+		return std::isalnum(static_cast<unsigned char>(c)) || '_' == c;
+	});
 }
 
 void operator<<(expression::token_vector &tokens, real_t n) {
@@ -605,6 +610,86 @@ expression::expression(const str_t &infix_string) :
 
 expression::~expression() = default;
 
+compiled_expression expression::compile(const str_vector &slots) const {
+	str_t msg = "expression::compile : ";
+	token_vector postfix_tokens = infix_to_postfix(m_infix_tokens);
+	if (postfix_tokens.empty()) {
+		throw runtime_error(msg + "empty expression");
+	}
+	using OpCode = compiled_expression::OpCode;
+	compiled_expression ce;
+	ce.m_code.reserve(postfix_tokens.size());
+	size_t depth = 0;
+	for (const token_ptr &token : postfix_tokens) {
+		switch (token->type()) {
+			case TokenType::Number: {
+				auto &t = static_cast<const num_token &>(*token);
+				ce.m_code.push_back({ OpCode::Num, ce.m_nums.size() });
+				ce.m_nums.push_back(t.num);
+				depth += 1;
+				break;
+			}
+			case TokenType::Variable: {
+				auto &t = static_cast<const var_token &>(*token);
+				auto it = std::find(slots.begin(), slots.end(), t.var);
+				if (slots.end() == it) {
+					throw runtime_error(msg +
+							"expression depends on undefined variable, '" +
+							t.var + "'");
+				}
+				size_t slot = static_cast<size_t>(it - slots.begin());
+				ce.m_code.push_back({ OpCode::Var, slot });
+				ce.m_slots.push_back(slot);
+				depth += 1;
+				break;
+			}
+			case TokenType::Operator: {
+				auto &t = static_cast<const op_token &>(*token);
+				OpCode op = OpCode::Add;
+				switch (t.op) {
+					case OpType::UPlus:
+						continue; // no-op
+					case OpType::UMinus:
+						op = OpCode::Neg;
+						break;
+					case OpType::Add:
+						op = OpCode::Add;
+						break;
+					case OpType::Sub:
+						op = OpCode::Sub;
+						break;
+					case OpType::Mul:
+						op = OpCode::Mul;
+						break;
+					case OpType::Div:
+						op = OpCode::Div;
+						break;
+					case OpType::Mod:
+						op = OpCode::Mod;
+						break;
+					case OpType::Exp:
+						op = OpCode::Exp;
+						break;
+				}
+				ce.m_code.push_back({ op, 0 });
+				if (OpArity::Binary == t.arity) {
+					depth -= 1; // validate_postfix guarantees depth > 1
+				}
+				break;
+			}
+			default:
+				break;
+		}
+		if (compiled_expression::max_depth < depth) {
+			throw runtime_error(msg + "expression is too deeply nested");
+		}
+	}
+	std::sort(ce.m_slots.begin(), ce.m_slots.end());
+	ce.m_slots.erase(std::unique(ce.m_slots.begin(), ce.m_slots.end()),
+			ce.m_slots.end());
+	return ce;
+}
+
 bool expression::depends_on(const var_set &vars) const {
 	var_set expr_vars = get_vars(m_infix_tokens);
 	for (const str_t &v : vars) {
@@ -728,4 +813,62 @@ str_t expression::vars_defined(const var_map &vars) const {
 	return "";
 }
 
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // compiled_expression class
+
+real_t compiled_expression::evaluate(const real_t *values) const {
+	if (m_code.empty()) {
+		throw runtime_error("compiled_expression::evaluate : empty expression");
+	}
+	real_t stack[max_depth];
+	real_t *top = stack - 1;
+	for (const instruction &ins : m_code) {
+		switch (ins.op) {
+			case OpCode::Num:
+				*++top = m_nums[ins.arg];
+				break;
+			case OpCode::Var:
+				*++top = values[ins.arg];
+				break;
+			case OpCode::Add:
+				top[-1] += top[0];
+				--top;
+				break;
+			case OpCode::Sub:
+				top[-1] -= top[0];
+				--top;
+				break;
+			case OpCode::Mul:
+				top[-1] *= top[0];
+				--top;
+				break;
+			case OpCode::Div:
+				if (0.0 == top[0]) {
+					throw runtime_error(
+							"compiled_expression::evaluate : divide by 0");
+				}
+				top[-1] /= top[0];
+				--top;
+				break;
+			case OpCode::Mod:
+				if (0.0 == top[0]) {
+					throw runtime_error(
+							"compiled_expression::evaluate : divide by 0");
+				}
+				top[-1] = std::fmod(top[-1], top[0]);
+				--top;
+				break;
+			case OpCode::Neg:
+				top[0] = -top[0];
+				break;
+			case OpCode::Exp:
+				top[-1] = std::pow(top[-1], top[0]);
+				--top;
+				break;
+		}
+	}
+	return *top;
+}
+
 } // namespace genalyzer_impl
\ No newline at end of file
@@ -0,0 +1,146 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "fft_context.hpp"
+
+#include "enum_maps.hpp"
+#include "exceptions.hpp"
+#include "fourier_transforms.hpp"
+#include "utils.hpp"
+
+#include <new>
+#include <vector>
+
+namespace genalyzer_impl {
+
+namespace {
+
+constexpr std::align_val_t work_alignment{ 64 };
+
+} // namespace
+
+fft_context::fft_context(bool cplx, size_t navg, size_t nfft, Window window,
+		RfftScale scale) :
+		m_cplx{ cplx },
+		m_navg{ navg },
+		m_nfft{ nfft },
+		m_window{ window },
+		m_scale{ scale },
+		m_win{},
+		m_work_size{ 0 },
+		m_work{} {
+	assert_gt0("fft_context : ", "navg", navg);
+	assert_gt0("fft_context : ", "nfft", nfft);
+	m_win = fft_window_coefficients(window, nfft,
+			cplx ? RfftScale::Native : scale);
+	m_work_size = cplx ? fft_work_size(navg, nfft) : rfft_work_size(navg, nfft);
+	if (0 < m_work_size) {
+		m_work.reset(static_cast<real_t *>(::operator new[](
+				m_work_size * sizeof(real_t), work_alignment)));
+	}
+	// One transform of zeros validates navg and nfft, and builds the FFTW
+	// plan that later calls reuse.
+	std::vector<real_t> in_data(navg * nfft * (cplx ? 2 : 1), 0.0);
+	std::vector<real_t> out_data(size());
+	if (cplx) {
+		fft(in_data.data(), in_data.size(), nullptr, 0, out_data.data(),
+				out_data.size());
+	} else {
+		rfft(in_data.data(), in_data.size(), out_data.data(),
+				out_data.size());
+	}
+}
+
+void fft_context::fft(const real_t *i_data, size_t i_size,
+		const real_t *q_data, size_t q_size, real_t *out_data,
+		size_t out_size) {
+	check_type(true);
+	genalyzer_impl::fft(i_data, i_size, q_data, q_size, out_data, out_size,
+			m_navg, m_nfft, m_win, m_work.get(), m_work_size);
+}
+
+template <typename T>
+void fft_context::fft(const T *i_data, size_t i_size, const T *q_data,
+		size_t q_size, real_t *out_data, size_t out_size, int n,
+		CodeFormat format) {
+	check_type(true);
+	genalyzer_impl::fft(i_data, i_size, q_data, q_size, out_data, out_size,
+			n, m_navg, m_nfft, m_win, format, m_work.get(), m_work_size);
+}
+
+template void fft_context::fft(const int16_t *, size_t, const int16_t *,
+		size_t, real_t *, size_t, int, CodeFormat);
+template void fft_context::fft(const int32_t *, size_t, const int32_t *,
+		size_t, real_t *, size_t, int, CodeFormat);
+template void fft_context::fft(const int64_t *, size_t, const int64_t *,
+		size_t, real_t *, size_t, int, CodeFormat);
+
+void fft_context::rfft(const real_t *in_data, size_t in_size,
+		real_t *out_data, size_t out_size) {
+	check_type(false);
+	genalyzer_impl::rfft(in_data, in_size, out_data, out_size, m_navg,
+			m_nfft, m_win, m_scale, m_work.get(), m_work_size);
+}
+
+template <typename T>
+void fft_context::rfft(const T *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, int n, CodeFormat format) {
+	check_type(false);
+	genalyzer_impl::rfft(in_data, in_size, out_data, out_size, n, m_navg,
+			m_nfft, m_win, format, m_scale, m_work.get(), m_work_size);
+}
+
+template void fft_context::rfft(const int16_t *, size_t, real_t *, size_t,
+		int, CodeFormat);
+template void fft_context::rfft(const int32_t *, size_t, real_t *, size_t,
+		int, CodeFormat);
+template void fft_context::rfft(const int64_t *, size_t, real_t *, size_t,
+		int, CodeFormat);
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Virtual Function Overrides
+
+bool fft_context::equals_impl(const object &that_obj) const {
+	if (ObjectType::FftContext != that_obj.object_type()) {
+		return false;
+	}
+	auto &that = static_cast<const fft_context &>(that_obj);
+	return (this->m_cplx == that.m_cplx) && (this->m_navg == that.m_navg) &&
+			(this->m_nfft == that.m_nfft) &&
+			(this->m_window == that.m_window) &&
+			(this->m_scale == that.m_scale);
+}
+
+void fft_context::save_impl(const str_t &) const {
+	throw runtime_error("fft_context::save : not supported");
+}
+
+str_t fft_context::to_string_impl() const {
+	str_t s = "FftContext\n";
+	s += "  type   : " + str_t(m_cplx ? "complex" : "real") + "\n";
+	s += "  navg   : " + std::to_string(m_navg) + "\n";
+	s += "  nfft   : " + std::to_string(m_nfft) + "\n";
+	s += "  window : " + window_map.at(to_int(m_window)) + "\n";
+	if (!m_cplx) {
+		s += "  scale  : " + rfft_scale_map.at(to_int(m_scale)) + "\n";
+	}
+	return s;
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Non-Public
+
+void fft_context::aligned_delete::operator()(real_t *p) const {
+	::operator delete[](p, work_alignment);
+}
+
+void fft_context::check_type(bool cplx) const {
+	if (cplx != m_cplx) {
+		throw runtime_error(str_t("fft_context : object computes ") +
+				(m_cplx ? "complex" : "real") + " FFTs");
+	}
+}
+
+} // namespace genalyzer_impl
@@ -3,15 +3,21 @@
 // SPDX short identifier: ADIBSD OR GPL-2.0-or-later
 #include "fourier_analysis.hpp"
 
+#include "analysis_context.hpp"
+#include "analysis_plan.hpp"
 #include "array_ops.hpp"
 #include "enum_maps.hpp"
 #include "exceptions.hpp"
 #include "expression.hpp"
 #include "formatted_data.hpp"
+#include "spectrum_index.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <sstream>
 
@@ -57,6 +63,104 @@ str_t negate(const str_t &expr, bool neg) {
 	return neg ? ("-(" + expr + ')') : expr;
 }
 
+// An IMD product of the signals a and b: sign * (p * x op q * y), where x and
+// y are a and b, in either order.  a is the earlier of the two signals.
+struct imd_term {
+	bool x_is_a;
+	int p;
+	bool plus; // op is '+'; otherwise, '-'
+	int q;
+	bool neg; // sign is -1
+
+	// The key of the product, which is also its frequency expression
+	str_t key(const str_t &ka, const str_t &kb) const {
+		const str_t sp = (1 == p) ? "" : std::to_string(p);
+		const str_t sq = (1 == q) ? "" : std::to_string(q);
+		const str_t &kx = x_is_a ? ka : kb;
+		const str_t &ky = x_is_a ? kb : ka;
+		return negate(sp + kx + (plus ? '+' : '-') + sq + ky, neg);
+	}
+
+	// The coefficients of the frequencies of a and b
+	std::pair<int, int> coefs() const {
+		const int sign = neg ? -1 : 1;
+		const int cx = sign * p;
+		const int cy = sign * (plus ? q : -q);
+		return x_is_a ? std::make_pair(cx, cy) : std::make_pair(cy, cx);
+	}
+};
+
+// The IMD products of two signals, of orders 2 through max_order.  Real data
+// has one product per distinct frequency magnitude; complex data also has the
+// negative frequencies, except for odd-order sums, which only have them with
+// quadrature errors.
+std::vector<imd_term> imd_terms(int max_order, bool cplx, bool find_qe) {
+	std::vector<imd_term> terms;
+	for (int order = 2; order <= max_order; ++order) {
+		for (int group = is_even(order) ? 0 : 1; group <= order; group += 2) {
+			if (group < order) {
+				// form: p * x MINUS q * y
+				const int p = (order + group) / 2;
+				const int q = order - p;
+				if (0 == group) {
+					terms.push_back({ false, p, false, q, false });
+					if (cplx) {
+						terms.push_back({ false, p, false, q, true });
+					}
+				} else if (is_even(order)) {
+					terms.push_back({ true, p, false, q, false });
+					terms.push_back({ false, p, false, q, false });
+					if (cplx) {
+						terms.push_back({ true, p, false, q, true });
+						terms.push_back({ false, p, false, q, true });
+					}
+				} else {
+					const bool neg = cplx && is_odd(group / 2);
+					terms.push_back({ true, p, false, q, neg });
+					terms.push_back({ false, p, false, q, neg });
+					if (cplx) {
+						terms.push_back({ true, p, false, q, !neg });
+						terms.push_back({ false, p, false, q, !neg });
+					}
+				}
+			} else if (is_even(order)) {
+				// form: p * a PLUS q * b
+				for (int q = 1; q < order; ++q) {
+					terms.push_back({ true, order - q, true, q, false });
+				}
+				if (cplx) {
+					for (int p = 1; p < order; ++p) {
+						terms.push_back({ true, p, true, order - p, true });
+					}
+				}
+			} else {
+				const bool neg = cplx && is_odd(order / 2);
+				for (int q = 1; q < order; ++q) {
+					terms.push_back({ true, order - q, true, q, neg });
+				}
+				if (find_qe) {
+					for (int p = 1; p < order; ++p) {
+						terms.push_back({ true, p, true, order - p, !neg });
+					}
+				}
+			}
+		}
+	}
+	return terms;
+}
+
+bool is_cplx_analysis(size_t in_size, size_t nfft) {
+	bool cplx = false;
+	if (in_size == nfft || in_size == nfft * 2) {
+		cplx = true;
+	} else if (!(in_size == nfft / 2 + 1 ||
+					   in_size == (nfft / 2 + 1) * 2)) {
+		throw runtime_error(
+				"Invalid combination of data size and NFFT");
+	}
+	return cplx;
+}
+
 } // namespace
 
 const fourier_analysis::min_max_def_t fourier_analysis::mmd_hd = { 1, 99, 6 };
@@ -76,6 +180,7 @@ fourier_analysis::fourier_analysis() :
 		dc_as_dist(false),
 		en_conv_offset(false),
 		en_fund_images(true),
+		en_imd_tones(true),
 		en_quad_errors(false),
 		ilv_as_noise(false),
 		m_hd(std::get<2>(mmd_hd)),
@@ -106,6 +211,7 @@ fourier_analysis::fourier_analysis(const fourier_analysis &obj) :
 		dc_as_dist(obj.dc_as_dist),
 		en_conv_offset(obj.en_conv_offset),
 		en_fund_images(obj.en_fund_images),
+		en_imd_tones(obj.en_imd_tones),
 		en_quad_errors(obj.en_quad_errors),
 		ilv_as_noise(obj.ilv_as_noise),
 		m_hd(obj.m_hd),
@@ -139,6 +245,7 @@ fourier_analysis::fourier_analysis(fourier_analysis &&obj) :
 		dc_as_dist(obj.dc_as_dist),
 		en_conv_offset(obj.en_conv_offset),
 		en_fund_images(obj.en_fund_images),
+		en_imd_tones(obj.en_imd_tones),
 		en_quad_errors(obj.en_quad_errors),
 		ilv_as_noise(obj.ilv_as_noise),
 		m_hd(obj.m_hd),
@@ -176,6 +283,7 @@ fourier_analysis &fourier_analysis::operator=(fourier_analysis &&obj) {
 	std::swap(dc_as_dist, obj.dc_as_dist);
 	std::swap(en_conv_offset, obj.en_conv_offset);
 	std::swap(en_fund_images, obj.en_fund_images);
+	std::swap(en_imd_tones, obj.en_imd_tones);
 	std::swap(en_quad_errors, obj.en_quad_errors);
 	std::swap(ilv_as_noise, obj.ilv_as_noise);
 	std::swap(m_hd, obj.m_hd);
@@ -208,6 +316,25 @@ fourier_analysis_results fourier_analysis::analyze(const real_t *in_data,
 		const size_t in_size,
 		const size_t nfft,
 		FreqAxisType axis_type) const {
+	fourier_analysis_results results;
+	analyze_data(results, in_data, in_size, nfft, axis_type, nullptr);
+	return results;
+}
+
+fourier_analysis_results fourier_analysis::analyze(const real_t *in_data,
+		const size_t in_size,
+		const size_t nfft,
+		FreqAxisType axis_type,
+		analysis_context &ctx) const {
+	ctx.check_nfft(nfft);
+	fourier_analysis_results results;
+	analyze_data(results, in_data, in_size, nfft, axis_type, &ctx);
+	return results;
+}
+void fourier_analysis::analyze_data(fourier_analysis_results &results,
+		const real_t *in_data, const size_t in_size, const size_t nfft,
+		FreqAxisType axis_type, analysis_context *ctx,
+		const analysis_plan *plan) const {
 	check_array("", "input array", in_data, in_size);
 	std::vector<real_t> msq; // used only if in_data is complex
 	const real_t *msq_data = nullptr;
@@ -224,17 +351,70 @@ fourier_analysis_results fourier_analysis::analyze(const real_t *in_data,
 					(nfft / 2 + 1) * 2) { // Complex data, real analysis
 		// input array is interleaved Re/Im FFT data
 		msq_size = in_size / 2;
-		msq = std::vector<real_t>(msq_size);
-		norm(in_data, in_size, msq.data(), msq.size());
-		msq_data = msq.data();
+		real_t *msq_out = nullptr;
+		if (nullptr == ctx) {
+			msq = std::vector<real_t>(msq_size);
+			msq_out = msq.data();
+		} else {
+			msq_out = ctx->msq(msq_size);
+		}
+		norm(in_data, in_size, msq_out, msq_size);
+		msq_data = msq_out;
 		fft_data = reinterpret_cast<const cplx_t *>(in_data);
 		fft_size = in_size / 2;
 	} else {
 		throw runtime_error("Mismatch between data size and NFFT");
 	}
-	fourier_analysis_results results = analyze_impl(
-			msq_data, msq_size, nfft, axis_type, fft_data, fft_size);
-	return results;
+	if (plan) {
+		analyze_impl(results, *plan, msq_data, msq_size, fft_data, fft_size,
+				ctx);
+		return;
+	}
+	// The plan refers to, but does not own, this object
+	const std::shared_ptr<const fourier_analysis> config(
+			std::shared_ptr<const fourier_analysis>(), this);
+	const analysis_plan local_plan(config, nfft, axis_type, msq_size == nfft);
+	analyze_impl(results, local_plan, msq_data, msq_size, fft_data,
+			fft_size, ctx);
+}
+
+fourier_analysis_batch_results fourier_analysis::analyze_batch(
+		const real_t *in_data, const size_t in_size, const size_t count,
+		const size_t nfft, FreqAxisType axis_type) const {
+	assert_gt0("fourier_analysis::analyze_batch : ", "count", count);
+	// The plan refers to, but does not own, this object
+	const std::shared_ptr<const fourier_analysis> config(
+			std::shared_ptr<const fourier_analysis>(), this);
+	const analysis_plan plan(config, nfft, axis_type,
+			is_cplx_analysis(in_size / count, nfft));
+	return plan.analyze_batch(in_data, in_size, count);
+}
+
+fourier_analysis_results fourier_analysis::analyze_sparse(
+		const real_t *in_data, const size_t in_size, const size_t navg,
+		const size_t nfft, Window window, RfftScale scale,
+		FreqAxisType axis_type) const {
+	// The plan refers to, but does not own, this object
+	const std::shared_ptr<const fourier_analysis> config(
+			std::shared_ptr<const fourier_analysis>(), this);
+	const analysis_plan plan(config, nfft, axis_type, false);
+	return plan.analyze_sparse(in_data, in_size, navg, window, scale);
+}
+
+std::shared_ptr<analysis_plan> fourier_analysis::prepare(size_t nfft,
+		FreqAxisType axis_type, bool cplx) const {
+	return std::make_shared<analysis_plan>(
+			std::make_shared<const fourier_analysis>(*this), nfft, axis_type,
+			cplx);
+}
+
+fourier_analysis_results fourier_analysis::analyze(const float *in_data,
+		const size_t in_size,
+		const size_t nfft,
+		FreqAxisType axis_type) const {
+	check_array("", "input array", in_data, in_size);
+	std::vector<real_t> wide(in_data, in_data + in_size);
+	return analyze(wide.data(), wide.size(), nfft, axis_type);
 }
 
 } // namespace genalyzer_impl
@@ -464,22 +644,6 @@ void fourier_analysis::reset() {
 	std::swap(new_obj, *this);
 }
 
-namespace {
-
-bool is_cplx_analysis(size_t in_size, size_t nfft) {
-	bool cplx = false;
-	if (in_size == nfft || in_size == nfft * 2) {
-		cplx = true;
-	} else if (!(in_size == nfft / 2 + 1 ||
-					   in_size == (nfft / 2 + 1) * 2)) {
-		throw runtime_error(
-				"Invalid combination of data size and NFFT");
-	}
-	return cplx;
-}
-
-} // namespace
-
 std::vector<size_t> fourier_analysis::result_key_lengths(size_t in_size,
 		size_t nfft) const {
 	bool cplx = is_cplx_analysis(in_size, nfft);
@@ -534,6 +698,7 @@ bool fourier_analysis::equals_impl(const object &that_obj) const {
 			(this->dc_as_dist != that.dc_as_dist) ||
 			(this->en_conv_offset != that.en_conv_offset) ||
 			(this->en_fund_images != that.en_fund_images) ||
+			(this->en_imd_tones != that.en_imd_tones) ||
 			(this->en_quad_errors != that.en_quad_errors) ||
 			(this->ilv_as_noise != that.ilv_as_noise)) {
 		return false;
@@ -614,6 +779,7 @@ int fourier_analysis::limit_ssb(int ssb, int lower_limit) {
 fourier_analysis::comp_data_t fourier_analysis::generate_comps(bool cplx) const {
 	bool find_fi = en_fund_images && cplx;
 	bool find_qe = en_quad_errors && cplx;
+	const std::vector<imd_term> imd = imd_terms(m_imd, cplx, find_qe);
 	comp_data_t comp_data;
 	str_vector &keys = std::get<0>(comp_data);
 	comp_map &comps = std::get<1>(comp_data);
@@ -770,285 +936,19 @@ fourier_analysis::comp_data_t fourier_analysis::generate_comps(bool cplx) const
 				}
 			}
 		}
-		// Intermodulation Distorion Components
+		// Intermodulation Distortion Components; without IMD tones, see
+		// compile()
+		if (!en_imd_tones) {
+			continue;
+		}
 		for (const str_t &ka : fund_keys) {
 			if (ka == ukey) {
 				continue;
 			}
-			const str_t &kb = ukey;
-			for (int order = 2; order <= m_imd; ++order) {
-				int group = is_even(order) ? 0 : 1;
-				int pp = 0;
-				int qq = 0;
-				str_t p = "";
-				str_t q = "";
-				for (; group <= order; group += 2) {
-					if (group < order) {
-						// form: p * kx MINUS q * ky
-						pp = (order + group) / 2;
-						qq = order - pp;
-						p = (1 == pp) ? "" : std::to_string(pp);
-						q = (1 == qq) ? "" : std::to_string(qq);
-						if (0 == group) {
-							key = p + kb + '-' + q +
-									ka;
-							add_comp(
-									keys, comps,
-									key,
-									fa_fixed_tone::create(
-											FACompTag::
-													IMD,
-											key,
-											ssb));
-							if (cplx) {
-								key = negate(
-										key,
-										true);
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-							}
-						} else if (is_even(order)) {
-							// even order
-							key = p + ka + '-' + q +
-									kb;
-							add_comp(
-									keys, comps,
-									key,
-									fa_fixed_tone::create(
-											FACompTag::
-													IMD,
-											key,
-											ssb));
-							key = p + kb + '-' + q +
-									ka;
-							add_comp(
-									keys, comps,
-									key,
-									fa_fixed_tone::create(
-											FACompTag::
-													IMD,
-											key,
-											ssb));
-							if (cplx) {
-								key = negate(
-										p + ka +
-												'-' +
-												q +
-												kb,
-										true);
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-								key = negate(
-										p + kb +
-												'-' +
-												q +
-												ka,
-										true);
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-							}
-						} else {
-							// odd order
-							bool neg =
-									cplx &&
-									is_odd(group /
-											2);
-							key = negate(
-									p + ka + '-' +
-											q + kb,
-									neg);
-							add_comp(
-									keys, comps,
-									key,
-									fa_fixed_tone::create(
-											FACompTag::
-													IMD,
-											key,
-											ssb));
-							key = negate(
-									p + kb + '-' +
-											q + ka,
-									neg);
-							add_comp(
-									keys, comps,
-									key,
-									fa_fixed_tone::create(
-											FACompTag::
-													IMD,
-											key,
-											ssb));
-							if (cplx) {
-								key = negate(
-										p + ka +
-												'-' +
-												q +
-												kb,
-										!neg);
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-								key = negate(
-										p + kb +
-												'-' +
-												q +
-												ka,
-										!neg);
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-							}
-						}
-					} else { // group == order
-						// form: p * kx PLUS q * ky
-						if (is_even(order)) {
-							// even order
-							for (qq = 1; qq < group;
-									++qq) {
-								pp = order - qq;
-								p = (1 == pp) ? "" : std::to_string(pp);
-								q = (1 == qq) ? "" : std::to_string(qq);
-								key = p + ka +
-										'+' + q +
-										kb;
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-							}
-							if (cplx) {
-								for (pp = 1;
-										pp < group;
-										++pp) {
-									qq = order -
-											pp;
-									p = (1 ==
-												pp)
-											? ""
-											: std::to_string(
-													  pp);
-									q = (1 ==
-												qq)
-											? ""
-											: std::to_string(
-													  qq);
-									key = negate(
-											p + ka +
-													'+' +
-													q +
-													kb,
-											true);
-									add_comp(
-											keys,
-											comps,
-											key,
-											fa_fixed_tone::create(
-													FACompTag::
-															IMD,
-													key,
-													ssb));
-								}
-							}
-						} else {
-							// odd order
-							bool neg =
-									cplx &&
-									is_odd(group /
-											2);
-							for (qq = 1; qq < group;
-									++qq) {
-								pp = order - qq;
-								p = (1 == pp) ? "" : std::to_string(pp);
-								q = (1 == qq) ? "" : std::to_string(qq);
-								key = negate(
-										p + ka +
-												'+' +
-												q +
-												kb,
-										neg);
-								add_comp(
-										keys,
-										comps,
-										key,
-										fa_fixed_tone::create(
-												FACompTag::
-														IMD,
-												key,
-												ssb));
-							}
-							if (find_qe) {
-								for (pp = 1;
-										pp < group;
-										++pp) {
-									qq = order -
-											pp;
-									p = (1 ==
-												pp)
-											? ""
-											: std::to_string(
-													  pp);
-									q = (1 ==
-												qq)
-											? ""
-											: std::to_string(
-													  qq);
-									key = negate(
-											p + ka +
-													'+' +
-													q +
-													kb,
-											!neg);
-									add_comp(
-											keys,
-											comps,
-											key,
-											fa_fixed_tone::create(
-													FACompTag::
-															IMD,
-													key,
-													ssb));
-								}
-							}
-						}
-					}
-				}
+			for (const imd_term &t : imd) {
+				key = t.key(ka, ukey);
+				add_comp(keys, comps, key,
+						fa_fixed_tone::create(FACompTag::IMD, key, ssb));
 			}
 		}
 	}
@@ -1206,89 +1106,147 @@ bool has_tone_results(const fourier_analysis_component &c) {
 			(FACompType::WOTone == c.type);
 }
 
-fa_tone_results meas_dc(const fa_dc &comp, const real_t *msq_data,
-		const size_t msq_size, const size_t nfft,
-		fourier_analysis::mask_map &masks) {
-	const bool cplx = msq_size == nfft;
+fa_tone_bins dc_bins(const fa_dc &comp, bool cplx, size_t msq_size,
+		size_t nfft, const fourier_analysis_comp_mask &ab_mask) {
 	const diff_p lrbins = get_lrbins(nfft, cplx, 0.0, comp.ssb);
 	fourier_analysis_comp_mask m(cplx, msq_size);
 	m.set_range(lrbins.first, lrbins.second);
-	masks.at(to_int(FACompTag::DC)) = m;
-	masks.at(to_int(FAMask::Comp)) |= m;
 	size_t i1, i2, nbins;
 	std::tie(i1, i2, nbins) = m.get_indexes();
-	real_t fwavg = 0.0; // FIXME: Real: 0.0 by definition; Cplx: calc
-	bool inband = masks.at(to_int(FAMask::AB)).overlaps(i1, i2);
-	real_t mag2 = m.sum(msq_data, msq_size);
-	fa_tone_results results;
-	results.set(FAToneResult::Tag, static_cast<real_t>(FACompTag::DC));
-	results.set(FAToneResult::Freq, 0.0);
-	results.set(FAToneResult::FFinal, 0.0);
-	results.set(FAToneResult::FWAvg, fwavg);
-	results.set(FAToneResult::I1, static_cast<real_t>(i1));
-	results.set(FAToneResult::I2, static_cast<real_t>(i2));
-	results.set(FAToneResult::NBins, static_cast<real_t>(nbins));
-	results.set(FAToneResult::InBand, inband ? 1.0 : 0.0);
-	results.set_mag(mag2);
-	return results;
+	bool inband = ab_mask.overlaps(i1, i2);
+	return { 0.0, 0.0, std::move(m), i1, i2, nbins, inband };
 }
 
-fa_tone_results meas_fixed_tone(const str_t &key, const fa_fixed_tone &comp,
-		const real_t *msq_data, const size_t msq_size,
-		const size_t nfft,
-		fourier_analysis::mask_map &masks,
-		fourier_analysis::var_map &vars) {
-	const bool cplx = msq_size == nfft;
+// freq is the "actual" frequency of the tone
+fa_tone_bins fixed_tone_bins(const fa_fixed_tone &comp, real_t freq,
+		bool cplx, size_t msq_size, size_t nfft,
+		const fourier_analysis::var_map &vars,
+		const fourier_analysis_comp_mask &ab_mask) {
 	const real_t fbin = vars.at("fbin");
 	const real_t fdata = vars.at("fdata");
 	const real_t fshift = vars.at("fshift");
-	const real_t freq =
-			expression(comp.freq).evaluate(vars); // "actual" frequency
 	const real_t ffinal =
 			alias(freq + fshift, fdata,
 					!cplx); // freq after translation and aliasing
 	const diff_p lrbins = get_lrbins(nfft, cplx, (ffinal / fbin), comp.ssb);
-	vars[key] = freq;
 	fourier_analysis_comp_mask m(cplx, msq_size);
 	m.set_range(lrbins.first, lrbins.second);
-	masks.at(to_int(comp.tag)) |= m;
-	masks.at(to_int(FAMask::Comp)) |= m;
 	size_t i1, i2, nbins;
 	std::tie(i1, i2, nbins) = m.get_indexes();
+	bool inband = ab_mask.overlaps(i1, i2);
+	return { freq, ffinal, std::move(m), i1, i2, nbins, inband };
+}
+
+// Bins of an IMD product at freq, as fixed_tone_bins() finds them for a
+// FixedTone; scratch is any mask of the right size
+fa_imd_range imd_range(real_t freq, int ssb, bool cplx, size_t nfft,
+		real_t fbin, real_t fdata, real_t fshift,
+		fourier_analysis_comp_mask &scratch) {
+	const real_t ffinal = alias(freq + fshift, fdata, !cplx);
+	const diff_p lrbins = get_lrbins(nfft, cplx, (ffinal / fbin), ssb);
+	scratch.clear();
+	scratch.set_range(lrbins.first, lrbins.second);
+	size_t i1, i2, nbins;
+	std::tie(i1, i2, nbins) = scratch.get_indexes();
+	return { i1, i2, 0.0 == ffinal };
+}
+
+// Sorts ranges and merges those with the same bins
+void merge_imd_ranges(std::vector<fa_imd_range> &ranges) {
+	std::sort(ranges.begin(), ranges.end(),
+			[](const fa_imd_range &a, const fa_imd_range &b) {
+				return (a.i1 < b.i1) || (a.i1 == b.i1 && a.i2 < b.i2);
+			});
+	size_t n = 0;
+	for (const fa_imd_range &r : ranges) {
+		if (0 < n && r.i1 == ranges[n - 1].i1 && r.i2 == ranges[n - 1].i2) {
+			ranges[n - 1].dc = ranges[n - 1].dc && r.dc;
+		} else {
+			ranges[n++] = r;
+		}
+	}
+	ranges.resize(n);
+}
+
+// Adds sorted ranges to mask, mostly at its end
+void set_imd_ranges(fourier_analysis_comp_mask &mask,
+		const std::vector<fa_imd_range> &ranges) {
+	for (const fa_imd_range &r : ranges) {
+		diff_t i2 = static_cast<diff_t>(r.i2);
+		if (r.i2 < r.i1) {
+			i2 += static_cast<diff_t>(mask.size()); // wraps
+		}
+		mask.set_range(static_cast<diff_t>(r.i1), i2);
+	}
+}
+
+// The mean-square of range r, squared magnitude as tone results report it:
+// summed in mask order, then through the square root
+real_t imd_range_mag2(const spectrum_index &index, const fa_imd_range &r) {
+	real_t mag2 = 0.0;
+	if (r.i1 <= r.i2) {
+		mag2 += index.sum(r.i1, r.i2 + 1);
+	} else {
+		mag2 += index.sum(0, r.i2 + 1);
+		mag2 += index.sum(r.i1, index.size());
+	}
+	const real_t mag = std::sqrt(mag2);
+	return mag * mag;
+}
+
+fa_tone_results meas_dc(const fa_tone_bins &bins, const spectrum_index &index,
+		fourier_analysis::mask_map &masks) {
+	masks.at(to_int(FACompTag::DC)) = bins.mask;
+	masks.at(to_int(FAMask::Comp)) |= bins.mask;
+	real_t fwavg = 0.0; // FIXME: Real: 0.0 by definition; Cplx: calc
+	real_t mag2 = bins.mask.sum(index);
+	fa_tone_results results;
+	results.set(FAToneResult::Tag, static_cast<real_t>(FACompTag::DC));
+	results.set(FAToneResult::Freq, 0.0);
+	results.set(FAToneResult::FFinal, 0.0);
+	results.set(FAToneResult::FWAvg, fwavg);
+	results.set(FAToneResult::I1, static_cast<real_t>(bins.i1));
+	results.set(FAToneResult::I2, static_cast<real_t>(bins.i2));
+	results.set(FAToneResult::NBins, static_cast<real_t>(bins.nbins));
+	results.set(FAToneResult::InBand, bins.inband ? 1.0 : 0.0);
+	results.set_mag(mag2);
+	return results;
+}
+
+fa_tone_results meas_fixed_tone(FACompTag tag, const fa_tone_bins &bins,
+		const spectrum_index &index, fourier_analysis::mask_map &masks) {
+	masks.at(to_int(tag)) |= bins.mask;
+	masks.at(to_int(FAMask::Comp)) |= bins.mask;
 	real_t fwavg = 0.0; // FIXME
-	bool inband = masks.at(to_int(FAMask::AB)).overlaps(i1, i2);
-	real_t mag2 = m.sum(msq_data, msq_size);
+	real_t mag2 = bins.mask.sum(index);
 	fa_tone_results results;
-	results.set(FAToneResult::Tag, static_cast<real_t>(comp.tag));
-	results.set(FAToneResult::Freq, freq);
-	results.set(FAToneResult::FFinal, ffinal);
+	results.set(FAToneResult::Tag, static_cast<real_t>(tag));
+	results.set(FAToneResult::Freq, bins.freq);
+	results.set(FAToneResult::FFinal, bins.ffinal);
 	results.set(FAToneResult::FWAvg, fwavg);
-	results.set(FAToneResult::InBand, inband ? 1.0 : 0.0);
-	results.set(FAToneResult::I1, static_cast<real_t>(i1));
-	results.set(FAToneResult::I2, static_cast<real_t>(i2));
-	results.set(FAToneResult::NBins, static_cast<real_t>(nbins));
+	results.set(FAToneResult::InBand, bins.inband ? 1.0 : 0.0);
+	results.set(FAToneResult::I1, static_cast<real_t>(bins.i1));
+	results.set(FAToneResult::I2, static_cast<real_t>(bins.i2));
+	results.set(FAToneResult::NBins, static_cast<real_t>(bins.nbins));
 	results.set_mag(mag2);
 	return results;
 }
 
 // May implement search band in future.  Note: search band != analysis band.
-fa_tone_results meas_max_tone(const str_t &key, const fa_max_tone &comp,
-		const real_t *msq_data, const size_t msq_size,
-		const size_t nfft,
-		fourier_analysis::mask_map &masks,
-		fourier_analysis::var_map &vars) {
+fa_tone_results meas_max_tone(const fa_max_tone &comp, const size_t msq_size,
+		const spectrum_index &index, const size_t nfft, const real_t fbin,
+		const real_t fshift, fourier_analysis::mask_map &masks,
+		real_t *freq_slot) {
 	fourier_analysis_comp_mask search_mask = masks.at(to_int(FAMask::AB));
 	fourier_analysis_comp_mask &comp_mask = masks.at(to_int(FAMask::Comp));
 	search_mask.unset_ranges(comp_mask);
 	diff_t max_index, lower, upper;
 	std::tie(max_index, lower, upper) =
-			search_mask.find_max_index(msq_data, msq_size);
+			search_mask.find_max_index(index);
 	if (max_index < 0) {
 		return null_tone_results(comp.tag);
 	}
 	const bool cplx = msq_size == nfft;
-	const real_t fbin = vars.at("fbin");
-	const real_t fshift = vars.at("fshift");
 	const real_t ffinal = max_index * fbin;
 	const real_t freq = ffinal - fshift; // this is a best guess
 	diff_p lrbins = get_lrbins(nfft, cplx, static_cast<real_t>(max_index),
@@ -1306,8 +1264,10 @@ fa_tone_results meas_max_tone(const str_t &key, const fa_max_tone &comp,
 	std::tie(i1, i2, nbins) = m.get_indexes();
 	real_t fwavg = 0.0; // FIXME
 	bool inband = masks.at(to_int(FAMask::AB)).overlaps(i1, i2);
-	real_t mag2 = m.sum(msq_data, msq_size);
-	vars[key] = freq; // should probably use fwavg (once implemented)
+	real_t mag2 = m.sum(index);
+	if (freq_slot) {
+		*freq_slot = freq; // should probably use fwavg (once implemented)
+	}
 	fa_tone_results results;
 	results.set(FAToneResult::Tag, static_cast<real_t>(comp.tag));
 	results.set(FAToneResult::Freq, freq);
@@ -1321,47 +1281,92 @@ fa_tone_results meas_max_tone(const str_t &key, const fa_max_tone &comp,
 	return results;
 }
 
-fa_tone_results meas_wo_tone(const fa_wo_tone &comp, const real_t *msq_data,
-		const size_t msq_size, const size_t nfft,
-		const real_t fbin, const real_t fshift,
-		fourier_analysis::mask_map &masks) {
+// Finds the worst others, in the order of comps, from one search of the WO
+// mask.  Each free range of the mask goes into a max-heap keyed by its first
+// maximum.  Each WO found is the top of the heap; its exclusion zone is
+// removed from its range, and what is left on either side goes back into the
+// heap.  The result is the same as searching the whole WO mask once per WO and
+// removing each zone from the mask before the next search.
+std::vector<fa_tone_results> meas_wo_tones(
+		const std::vector<const fa_wo_tone *> &comps, const size_t msq_size,
+		const spectrum_index &index, const size_t nfft, const real_t fbin,
+		const real_t fshift, fourier_analysis::mask_map &masks) {
+	struct wo_range { // [i1, i2) and the index and value of its first maximum
+		diff_t max_index;
+		real_t max_value;
+		size_t i1;
+		size_t i2;
+	};
+	// Larger values first; on ties, the lower index first, as in a search
+	auto lower_priority = [](const wo_range &a, const wo_range &b) {
+		return (a.max_value < b.max_value) ||
+				(a.max_value == b.max_value && b.max_index < a.max_index);
+	};
+	std::vector<wo_range> heap;
+	auto add_range = [&](size_t i1, size_t i2) {
+		if (i1 < i2) {
+			std::pair<diff_t, real_t> im = index.max_index(i1, i2);
+			if (0 <= im.first) {
+				heap.push_back({ im.first, im.second, i1, i2 });
+			}
+		}
+	};
 	fourier_analysis_comp_mask &wo_mask = masks.at(to_int(FAMask::WO));
 	fourier_analysis_comp_mask &comp_mask = masks.at(to_int(FAMask::Comp));
-	diff_t max_index, lower, upper;
-	std::tie(max_index, lower, upper) =
-			wo_mask.find_max_index(msq_data, msq_size);
-	if (max_index < 0) {
-		return null_tone_results(comp.tag);
+	const std::vector<size_t> &wo_ranges = wo_mask.data();
+	heap.reserve(wo_mask.num_ranges() + comps.size() * 2);
+	for (size_t range = 0; range < wo_mask.num_ranges(); ++range) {
+		add_range(wo_ranges[range * 2], wo_ranges[range * 2 + 1]);
 	}
+	std::make_heap(heap.begin(), heap.end(), lower_priority);
 	const bool cplx = msq_size == nfft;
-	const real_t ffinal = max_index * fbin;
-	const real_t freq = ffinal - fshift; // best guess
-	diff_p lrbins = get_lrbins(nfft, cplx, static_cast<real_t>(max_index),
-			comp.ssb);
-	// Unlike FixedTone, MaxTone stops when it runs into another tone.  Since DC
-	// is always found and is always at bin 0, we never have to worry about
-	// MaxTone wrapping.
-	lrbins.first = std::max<diff_t>(lower, lrbins.first);
-	lrbins.second = std::min<diff_t>(lrbins.second, upper);
-	fourier_analysis_comp_mask m(cplx, msq_size);
-	m.set_range(lrbins.first, lrbins.second);
-	comp_mask |= m; // add this range to component mask
-	wo_mask.unset_ranges(m); // remove this range from WO search mask
-	size_t i1, i2, nbins;
-	std::tie(i1, i2, nbins) = m.get_indexes();
-	real_t fwavg = 0.0; // FIXME
-	real_t mag2 = m.sum(msq_data, msq_size);
-	fa_tone_results results;
-	results.set(FAToneResult::Tag, static_cast<real_t>(comp.tag));
-	results.set(FAToneResult::Freq, freq);
-	results.set(FAToneResult::FFinal, ffinal);
-	results.set(FAToneResult::FWAvg, fwavg);
-	results.set(FAToneResult::InBand, 1.0); // by definition
-	results.set(FAToneResult::I1, static_cast<real_t>(i1));
-	results.set(FAToneResult::I2, static_cast<real_t>(i2));
-	results.set(FAToneResult::NBins, static_cast<real_t>(nbins));
-	results.set_mag(mag2);
-	return results;
+	fourier_analysis_comp_mask zones(cplx, msq_size);
+	std::vector<fa_tone_results> wo_res;
+	wo_res.reserve(comps.size());
+	for (const fa_wo_tone *comp : comps) {
+		if (heap.empty()) {
+			wo_res.push_back(null_tone_results(comp->tag));
+			continue;
+		}
+		std::pop_heap(heap.begin(), heap.end(), lower_priority);
+		const wo_range r = heap.back();
+		heap.pop_back();
+		const real_t ffinal = r.max_index * fbin;
+		const real_t freq = ffinal - fshift; // best guess
+		diff_p lrbins = get_lrbins(nfft, cplx,
+				static_cast<real_t>(r.max_index), comp->ssb);
+		// Unlike FixedTone, WO stops when it runs into another tone.  Since DC
+		// is always found and is always at bin 0, we never have to worry about
+		// WO wrapping.
+		lrbins.first = std::max<diff_t>(r.i1, lrbins.first);
+		lrbins.second = std::min<diff_t>(lrbins.second, r.i2 - 1);
+		zones.set_range(lrbins.first, lrbins.second);
+		const size_t i1 = static_cast<size_t>(lrbins.first);
+		const size_t i2 = static_cast<size_t>(lrbins.second);
+		const size_t n = heap.size();
+		add_range(r.i1, i1); // what is left of r goes back into the heap
+		add_range(i2 + 1, r.i2);
+		for (size_t k = n; k < heap.size(); ++k) {
+			std::push_heap(heap.begin(), heap.begin() + k + 1,
+					lower_priority);
+		}
+		real_t fwavg = 0.0; // FIXME
+		real_t mag2 = index.sum(i1, i2 + 1);
+		fa_tone_results results;
+		results.set(FAToneResult::Tag, static_cast<real_t>(comp->tag));
+		results.set(FAToneResult::Freq, freq);
+		results.set(FAToneResult::FFinal, ffinal);
+		results.set(FAToneResult::FWAvg, fwavg);
+		results.set(FAToneResult::InBand, 1.0); // by definition
+		results.set(FAToneResult::I1, static_cast<real_t>(i1));
+		results.set(FAToneResult::I2, static_cast<real_t>(i2));
+		results.set(FAToneResult::NBins, static_cast<real_t>(i2 - i1 + 1));
+		results.set_mag(mag2);
+		wo_res.push_back(results);
+	}
+	comp_mask |= zones; // add the WO ranges to component mask
+	wo_mask.unset_ranges(zones); // and remove them from WO search mask
+	return wo_res;
 }
 
 void update_maxspur(size_t key_index, const fa_tone_results &results,
@@ -1435,75 +1440,179 @@ fourier_analysis::mask_map fourier_analysis::initialize_masks(bool cplx,
 	return masks;
 }
 
-fourier_analysis_results
-fourier_analysis::analyze_impl(const real_t *msq_data, const size_t msq_size,
-		const size_t nfft, FreqAxisType axis_type,
-		const cplx_t *fft_data,
-		const size_t fft_size) const {
+void fourier_analysis::analyze_impl(fourier_analysis_results &results,
+		const analysis_plan &plan, const real_t *msq_data,
+		const size_t msq_size, const cplx_t *fft_data, const size_t fft_size,
+		analysis_context *ctx) const {
 	//
 	// Setup
+	//      The plan holds the analysis band, the generated components, and the
+	//      bins of each component that does not depend on a MaxTone.
 	//
+	const size_t nfft = plan.m_nfft;
 	const bool cplx =
 			check_args(msq_data, msq_size, nfft, fft_data, fft_size);
-	mask_map masks = initialize_masks(cplx, msq_size);
-	var_map vars = initialize_vars(nfft);
-	const real_t fbin = vars.at("fbin");
-	const real_t fdata = vars.at("fdata");
-	const real_t fsample = vars.at("fs");
-	const real_t fshift = vars.at("fshift");
-	fourier_analysis_results results;
-	//
-	// Analysis Band
-	//
-	setup_analysis_band(cplx, masks.at(to_int(FAMask::AB)), vars);
+	if (cplx != plan.m_cplx) {
+		throw runtime_error("analysis_plan : data size does not match plan");
+	}
+	mask_map local_masks;
+	if (nullptr == ctx) {
+		local_masks = plan.m_masks;
+	}
+	mask_map &masks = (nullptr == ctx) ? local_masks : ctx->masks(plan.m_masks);
+	// Every mask sum and component search below goes through this index
+	spectrum_index local_index;
+	if (nullptr == ctx) {
+		local_index.build(msq_data, msq_size, plan.m_search);
+	}
+	const spectrum_index &index = (nullptr == ctx)
+			? local_index
+			: ctx->index(msq_data, msq_size, plan.m_search);
+	std::vector<real_t> values; // only needed for components that depend on MaxTones
+	if (plan.m_dynamic) {
+		values = plan.m_slot_values;
+	}
+	const real_t fbin = plan.m_vars.at("fbin");
+	const real_t fdata = plan.m_vars.at("fdata");
+	const real_t fsample = plan.m_vars.at("fs");
+	const real_t fshift = plan.m_vars.at("fshift");
+	const FreqAxisType axis_type = plan.m_axis_type;
+	const str_vector &keys = plan.m_keys;
+	const comp_map &comps = plan.m_comps;
+	const std::set<str_t> &ilos_clk_keys = plan.m_ilos_clk_keys;
+	results.clear();
+	results.reserve_tones(keys.size());
+	std::vector<size_t> tone_of_key(keys.size()); // maps key index to tone index
+	comp_index_mag_t carrier_im{ -1, 0.0 };
+	comp_index_mag_t maxspur_im{ -1, 0.0 };
 	//
-	// Component Generation
-	//      CLK and ILOS components may overlap.  Since the ILOS tag has higher
-	//      priority, generate_comps() creates a dedicated list of CLK keys.
+	// IMD Products
+	//      Without IMD tones, each step of the plan holds the ranges of the
+	//      products that were resolved when compiled.  Products that depend on
+	//      a MaxTone are resolved when the step is applied.  A step is applied
+	//      where the IMD tones would be measured, so that later searches see
+	//      the same masks.  Each range is a candidate for MaxSpur.
 	//
-	comp_data_t comp_data = generate_comps(cplx);
-	const str_vector &keys = std::get<0>(comp_data);
-	const comp_map &comps = std::get<1>(comp_data);
-	const std::set<str_t> &ilos_clk_keys = std::get<2>(comp_data);
+	const diff_t imd_index = static_cast<diff_t>(keys.size()); // no tone
+	auto update_imd_maxspur = [&](const std::vector<fa_imd_range> &ranges) {
+		const fourier_analysis_comp_mask &sig_mask =
+				masks.at(to_int(FACompTag::Signal));
+		for (const fa_imd_range &r : ranges) {
+			if ((!r.dc || dc_as_dist) && !sig_mask.overlaps(r.i1, r.i2)) {
+				const real_t mag2 = imd_range_mag2(index, r);
+				if (maxspur_im.first < 0 || maxspur_im.second < mag2) {
+					maxspur_im.first = imd_index;
+					maxspur_im.second = mag2;
+				}
+			}
+		}
+	};
+	auto freq_of = [&](size_t k) {
+		if (plan.m_bins[k]) {
+			return plan.m_bins[k]->freq;
+		}
+		const real_t freq = values[plan.m_key_slots[k]];
+		if (std::isnan(freq)) {
+			throw runtime_error(
+					"expression::evaluate : expression depends on undefined variable, '" +
+					keys[k] + "'");
+		}
+		return freq;
+	};
+	size_t imd_step = 0;
+	auto apply_imd_steps = [&](size_t before) {
+		for (; imd_step < plan.m_imd_steps.size() &&
+				plan.m_imd_steps[imd_step].key_index <= before;
+				++imd_step) {
+			const fa_imd_step &step = plan.m_imd_steps[imd_step];
+			masks.at(to_int(FACompTag::IMD)) |= step.mask;
+			masks.at(to_int(FAMask::Comp)) |= step.mask;
+			update_imd_maxspur(step.ranges);
+			if (step.products.empty()) {
+				continue;
+			}
+			const fourier_analysis_comp_mask &ab_mask =
+					masks.at(to_int(FAMask::AB));
+			fourier_analysis_comp_mask scratch(cplx, msq_size);
+			std::vector<fa_imd_range> ranges;
+			for (const fa_imd_product &p : step.products) {
+				const real_t freq =
+						p.c1 * freq_of(p.k1) + p.c2 * freq_of(p.k2);
+				const fa_imd_range r = imd_range(freq, m_ssb_def, cplx, nfft,
+						fbin, fdata, fshift, scratch);
+				if (ab_mask.overlaps(r.i1, r.i2)) {
+					ranges.push_back(r);
+				}
+			}
+			merge_imd_ranges(ranges);
+			scratch.clear();
+			set_imd_ranges(scratch, ranges);
+			masks.at(to_int(FACompTag::IMD)) |= scratch;
+			masks.at(to_int(FAMask::Comp)) |= scratch;
+			update_imd_maxspur(ranges);
+		}
+	};
 	//
 	// Main Component Loop
 	//
-	comp_index_mag_t carrier_im{ -1, 0.0 };
-	comp_index_mag_t maxspur_im{ -1, 0.0 };
 	size_t key_index = 0;
 	for (; key_index < keys.size(); ++key_index) {
+		apply_imd_steps(key_index);
 		const str_t &key = keys[key_index];
 		const fourier_analysis_component &comp = *comps.at(key);
 		switch (comp.type) {
 			case FACompType::DC: {
-				auto &c = static_cast<const fa_dc &>(comp);
-				fa_tone_results r =
-						meas_dc(c, msq_data, msq_size, nfft, masks);
+				fa_tone_results r = meas_dc(*plan.m_bins[key_index],
+						index, masks);
 				if (r.inband && dc_as_dist) {
 					update_maxspur(key_index, r, dc_as_dist, masks,
 							maxspur_im);
 				}
-				results.add_tone(key, std::move(r));
+				tone_of_key[key_index] = results.add_tone(key, r);
 				break;
 			}
 			case FACompType::FixedTone: {
 				auto &c = static_cast<const fa_fixed_tone &>(comp);
-				fa_tone_results r = meas_fixed_tone(
-						key, c, msq_data, msq_size, nfft, masks, vars);
+				const std::optional<fa_tone_bins> &bins =
+						plan.m_bins[key_index];
+				fa_tone_results r;
+				if (bins) {
+					r = meas_fixed_tone(c.tag, *bins, index, masks);
+				} else {
+					const compiled_expression &fe =
+							plan.m_freq_code[key_index];
+					for (size_t slot : fe.slots()) {
+						if (std::isnan(values[slot])) {
+							throw runtime_error(
+									"expression::evaluate : expression depends on undefined variable, '" +
+									plan.m_slot_names[slot] + "'");
+						}
+					}
+					const real_t freq = fe.evaluate(values.data());
+					r = meas_fixed_tone(c.tag,
+							fixed_tone_bins(c, freq, cplx, msq_size, nfft,
+									plan.m_vars,
+									masks.at(to_int(FAMask::AB))),
+							index, masks);
+					values[plan.m_key_slots[key_index]] = freq;
+				}
 				tone_updates(key, key_index, comp.tag, r, dc_as_dist,
 						masks, ilos_clk_keys, carrier_im,
 						maxspur_im);
-				results.add_tone(key, std::move(r));
+				tone_of_key[key_index] = results.add_tone(key, r);
 				break;
 			}
 			case FACompType::MaxTone: {
 				auto &c = static_cast<const fa_max_tone &>(comp);
-				fa_tone_results r = meas_max_tone(
-						key, c, msq_data, msq_size, nfft, masks, vars);
+				real_t *freq_slot = plan.m_dynamic
+						? &values[plan.m_key_slots[key_index]]
+						: nullptr;
+				fa_tone_results r = meas_max_tone(c, msq_size, index,
+						nfft, fbin, fshift, masks, freq_slot);
 				tone_updates(key, key_index, comp.tag, r, dc_as_dist,
 						masks, ilos_clk_keys, carrier_im,
 						maxspur_im);
-				results.add_tone(key, std::move(r));
+				tone_of_key[key_index] = results.add_tone(key, r);
 				break;
 			}
 			default:
@@ -1513,76 +1622,82 @@ fourier_analysis::analyze_impl(const real_t *msq_data, const size_t msq_size,
 			break;
 		}
 	}
+	apply_imd_steps(keys.size());
 	//
 	// Worst Others
 	//      WOs are handled separately in order to guarantee max to min order
 	//
-	std::multimap<real_t, str_t> wo_mag_map; // maps WO magnitude to WO key
-	std::map<str_t, fa_tone_results> wo_res_map; // maps WO key to WO results
 	fourier_analysis_comp_mask &wo_mask = masks.at(to_int(FAMask::WO));
 	wo_mask =
 			masks.at(to_int(FAMask::AB)); // Initialize WO mask with AB mask
 	wo_mask.unset_ranges(masks.at(to_int(
 			FAMask::Comp))); // Then remove all components already found
 	const size_t first_wo_index = key_index;
+	std::vector<const fa_wo_tone *> wo_comps;
+	wo_comps.reserve(keys.size() - first_wo_index);
 	for (; key_index < keys.size(); ++key_index) {
-		const str_t &key = keys[key_index];
-		auto &c = static_cast<const fa_wo_tone &>(*comps.at(key));
-		fa_tone_results r = meas_wo_tone(c, msq_data, msq_size, nfft,
-				fbin, fshift, masks);
-		wo_mag_map.insert({ r.get(FAToneResult::Mag), key });
-		wo_res_map[key] = std::move(r);
-	}
-	// WOs are found.  Now add to results in order from max to min.  Update
-	// MaxSpur.
+		wo_comps.push_back(
+				&static_cast<const fa_wo_tone &>(*comps.at(keys[key_index])));
+	}
+	const std::vector<fa_tone_results> wo_res = meas_wo_tones(wo_comps,
+			msq_size, index, nfft, fbin, fshift, masks); // in key order
+	// WOs are found.  Now add to results in order from max to min; equal
+	// magnitudes go last found first.  Update MaxSpur.
+	std::vector<size_t> wo_order(wo_res.size());
+	std::iota(wo_order.rbegin(), wo_order.rend(), 0);
+	std::stable_sort(wo_order.begin(), wo_order.end(),
+			[&wo_res](size_t a, size_t b) {
+				return wo_res[b].get(FAToneResult::Mag) <
+						wo_res[a].get(FAToneResult::Mag);
+			});
 	int wo_num = 0;
-	for (auto iter = wo_mag_map.crbegin(); iter != wo_mag_map.crend();
-			++iter) {
-		const str_t &key = iter->second;
+	for (size_t w : wo_order) {
+		const fa_tone_results &r = wo_res[w];
 		str_t new_key = "wo";
 		if (1 < m_wo) {
 			new_key += std::to_string(++wo_num);
 		}
 		if (1 == m_wo || 1 == wo_num) {
-			update_maxspur(first_wo_index, wo_res_map.at(key),
-					dc_as_dist, masks, maxspur_im);
+			update_maxspur(first_wo_index, r, dc_as_dist, masks,
+					maxspur_im);
 		}
-		results.add_tone(new_key, std::move(wo_res_map.at(key)));
+		tone_of_key[first_wo_index + std::max(wo_num, 1) - 1] =
+				results.add_tone(new_key, r);
 	}
+	results.end_tones();
 	//
 	// Second pass for dBc, phase, and phase_c.
 	//      If there are no in-band Signal components, there is no Carrier.
 	//
 	real_t carrier_phase = 0.0;
 	if (0 < carrier_im.first) {
-		str_t carrier_key = keys[carrier_im.first];
-		fa_tone_results &carrier_results =
-				results.tone_results.at(carrier_key);
+		const fa_tone_results carrier_results =
+				results.get_tone(tone_of_key[carrier_im.first]);
 		carrier_phase = fa_phase(carrier_results, fft_data, cplx, fdata,
 				fshift);
 	}
 	for (size_t i = 0; i < keys.size(); ++i) {
 		const str_t &key = keys[i];
 		if (has_tone_results(*comps.at(key))) {
-			fa_tone_results &r = results.tone_results.at(key);
-			real_t mag = r.get(FAToneResult::Mag);
-			real_t phase =
-					fa_phase(r, fft_data, cplx, fdata, fshift);
-			r.set(FAToneResult::OrderIndex, static_cast<real_t>(i));
-			r.set(FAToneResult::Mag_dBc,
+			const size_t t = tone_of_key[i];
+			real_t mag = results.get_tone(t, FAToneResult::Mag);
+			real_t phase = fa_phase(results.get_tone(t), fft_data, cplx,
+					fdata, fshift);
+			results.set_tone(t, FAToneResult::OrderIndex,
+					static_cast<real_t>(i));
+			results.set_tone(t, FAToneResult::Mag_dBc,
 					fa_db10(mag * mag, carrier_im.second));
-			r.set(FAToneResult::Phase, phase);
-			r.set(FAToneResult::Phase_c, phase - carrier_phase);
+			results.set_tone(t, FAToneResult::Phase, phase);
+			results.set_tone(t, FAToneResult::Phase_c,
+					phase - carrier_phase);
 		}
 	}
 	//
 	// ffinal adjustment (only for complex analysis)
 	//
 	if (cplx && FreqAxisType::DcCenter == axis_type) {
-		for (std::pair<const str_t, fa_tone_results> &kv :
-				results.tone_results) {
-			double &ffinal =
-					kv.second.results[FAToneResult::FFinal];
+		for (real_t &ffinal : results.tone_values[to_int(
+					FAToneResult::FFinal)]) {
 			if (fdata <= 2 * ffinal) {
 				ffinal -= fdata;
 			}
@@ -1596,12 +1711,12 @@ fourier_analysis::analyze_impl(const real_t *msq_data, const size_t msq_size,
 			masks.at(to_int(FAMask::AB)).get_indexes();
 	real_t ab_nbins = static_cast<real_t>(std::get<2>(ab_info));
 	real_t ab_width = cplx ? ab_nbins * fbin : std::fmin(fdata / 2, ab_nbins * fbin);
-	real_t nad_ss = masks.at(to_int(FAMask::NAD)).sum(msq_data, msq_size);
+	real_t nad_ss = masks.at(to_int(FAMask::NAD)).sum(index);
 	real_t noise_ss =
-			masks.at(to_int(FAMask::Noise)).sum(msq_data, msq_size);
+			masks.at(to_int(FAMask::Noise)).sum(index);
 	real_t noise_nbins = masks.at(to_int(FAMask::Noise)).count_r();
 	real_t signal_ss =
-			masks.at(to_int(FACompTag::Signal)).sum(msq_data, msq_size);
+			masks.at(to_int(FACompTag::Signal)).sum(index);
 	results.set(FAResult::AnalysisType,
 			static_cast<real_t>(AnalysisType::Fourier));
 	results.set(FAResult::SignalType, cplx ? 1.0 : 0.0);
@@ -1623,13 +1738,15 @@ fourier_analysis::analyze_impl(const real_t *msq_data, const size_t msq_size,
 	results.set(FAResult::CarrierIndex,
 			static_cast<real_t>(carrier_im.first));
 	results.set(FAResult::MaxSpurIndex,
-			static_cast<real_t>(maxspur_im.first));
+			(imd_index == maxspur_im.first)
+					? -1.0
+					: static_cast<real_t>(maxspur_im.first));
 	results.set(FAResult::AB_Width, ab_width);
 	results.set(FAResult::AB_I1, static_cast<real_t>(std::get<0>(ab_info)));
 	results.set(FAResult::AB_I2, static_cast<real_t>(std::get<1>(ab_info)));
 	results.set(FAResult::AB_NBins, ab_nbins);
 	results.set(FAResult::AB_RSS,
-			masks.at(to_int(FAMask::AB)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FAMask::AB)).root_sum(index));
 	results.set(FAResult::Signal_NBins,
 			masks.at(to_int(FACompTag::Signal)).count_r());
 	results.set(FAResult::Signal_RSS, std::sqrt(signal_ss));
@@ -1637,52 +1754,219 @@ fourier_analysis::analyze_impl(const real_t *msq_data, const size_t msq_size,
 			masks.at(to_int(FACompTag::CLK)).count_r());
 	results.set(
 			FAResult::CLK_RSS,
-			masks.at(to_int(FACompTag::CLK)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FACompTag::CLK)).root_sum(index));
 	results.set(FAResult::HD_NBins,
 			masks.at(to_int(FACompTag::HD)).count_r());
 	results.set(
 			FAResult::HD_RSS,
-			masks.at(to_int(FACompTag::HD)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FACompTag::HD)).root_sum(index));
 	results.set(FAResult::ILOS_NBins,
 			masks.at(to_int(FACompTag::ILOS)).count_r());
 	results.set(
 			FAResult::ILOS_RSS,
-			masks.at(to_int(FACompTag::ILOS)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FACompTag::ILOS)).root_sum(index));
 	results.set(FAResult::ILGT_NBins,
 			masks.at(to_int(FACompTag::ILGT)).count_r());
 	results.set(
 			FAResult::ILGT_RSS,
-			masks.at(to_int(FACompTag::ILGT)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FACompTag::ILGT)).root_sum(index));
 	results.set(FAResult::IMD_NBins,
 			masks.at(to_int(FACompTag::IMD)).count_r());
 	results.set(
 			FAResult::IMD_RSS,
-			masks.at(to_int(FACompTag::IMD)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FACompTag::IMD)).root_sum(index));
 	results.set(FAResult::UserDist_NBins,
 			masks.at(to_int(FACompTag::UserDist)).count_r());
 	results.set(FAResult::UserDist_RSS,
 			masks.at(to_int(FACompTag::UserDist))
-					.root_sum(msq_data, msq_size));
+					.root_sum(index));
 	results.set(FAResult::THD_NBins,
 			masks.at(to_int(FAMask::THD)).count_r());
 	results.set(FAResult::THD_RSS,
-			masks.at(to_int(FAMask::THD)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FAMask::THD)).root_sum(index));
 	results.set(FAResult::ILV_NBins,
 			masks.at(to_int(FAMask::ILV)).count_r());
 	results.set(FAResult::ILV_RSS,
-			masks.at(to_int(FAMask::ILV)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FAMask::ILV)).root_sum(index));
 	results.set(FAResult::Dist_NBins,
 			masks.at(to_int(FAMask::Dist)).count_r());
 	results.set(
 			FAResult::Dist_RSS,
-			masks.at(to_int(FAMask::Dist)).root_sum(msq_data, msq_size));
+			masks.at(to_int(FAMask::Dist)).root_sum(index));
 	results.set(FAResult::Noise_NBins,
 			masks.at(to_int(FAMask::Noise)).count_r());
 	results.set(FAResult::Noise_RSS, std::sqrt(noise_ss));
 	results.set(FAResult::NAD_NBins,
 			masks.at(to_int(FAMask::NAD)).count_r());
 	results.set(FAResult::NAD_RSS, std::sqrt(nad_ss));
-	return results;
+}
+
+void fourier_analysis::compile(analysis_plan &plan) const {
+	const bool cplx = plan.m_cplx;
+	const size_t nfft = plan.m_nfft;
+	const size_t size = plan.m_size;
+	plan.m_masks = initialize_masks(cplx, size);
+	plan.m_vars = initialize_vars(nfft);
+	fourier_analysis_comp_mask &ab_mask = plan.m_masks.at(to_int(FAMask::AB));
+	setup_analysis_band(cplx, ab_mask, plan.m_vars);
+	//
+	// Component Generation
+	//      CLK and ILOS components may overlap.  Since the ILOS tag has higher
+	//      priority, generate_comps() creates a dedicated list of CLK keys.
+	//
+	comp_data_t comp_data = generate_comps(cplx);
+	plan.m_keys = std::move(std::get<0>(comp_data));
+	plan.m_comps = std::move(std::get<1>(comp_data));
+	plan.m_ilos_clk_keys = std::move(std::get<2>(comp_data));
+	//
+	// Component Bins
+	//      A FixedTone frequency may refer to a MaxTone, directly or through
+	//      another FixedTone.  Those frequencies are only known once the
+	//      spectrum has been searched, so they are left unresolved.
+	//
+	plan.m_bins.resize(plan.m_keys.size());
+	expression::var_set dynamic_keys;
+	for (size_t i = 0; i < plan.m_keys.size(); ++i) {
+		const str_t &key = plan.m_keys[i];
+		const fourier_analysis_component &comp = *plan.m_comps.at(key);
+		if (FACompType::DC == comp.type) {
+			plan.m_bins[i] = dc_bins(static_cast<const fa_dc &>(comp), cplx,
+					size, nfft, ab_mask);
+		} else if (FACompType::FixedTone == comp.type) {
+			auto &c = static_cast<const fa_fixed_tone &>(comp);
+			expression fe(c.freq);
+			if (fe.depends_on(dynamic_keys)) {
+				dynamic_keys.insert(key);
+				plan.m_dynamic = true;
+			} else {
+				plan.m_bins[i] = fixed_tone_bins(c,
+						fe.evaluate(plan.m_vars), cplx, size, nfft,
+						plan.m_vars, ab_mask);
+				plan.m_vars[key] = plan.m_bins[i]->freq;
+			}
+		} else if (FACompType::MaxTone == comp.type) {
+			dynamic_keys.insert(key);
+			plan.m_search = true;
+		} else if (FACompType::WOTone == comp.type) {
+			plan.m_search = true;
+		}
+	}
+	//
+	// IMD Products
+	//      Without IMD tones, the products of each pair of Signals are
+	//      enumerated numerically.  The products of a Signal with each earlier
+	//      Signal form one step, which the analysis applies where the IMD tones
+	//      of that Signal would be: before the next user component, WO, or the
+	//      end.  Products of resolved Signals are resolved here: those outside
+	//      the analysis band are dropped, and the rest are merged by bins.  The
+	//      analysis resolves the products that depend on a MaxTone.
+	//
+	if (!en_imd_tones) {
+		std::vector<size_t> sig_indexes; // key indexes of Signals, in order
+		for (size_t i = 0; i < plan.m_keys.size(); ++i) {
+			if (FACompTag::Signal == plan.m_comps.at(plan.m_keys[i])->tag) {
+				sig_indexes.push_back(i);
+			}
+		}
+		const std::vector<imd_term> imd =
+				imd_terms(m_imd, cplx, en_quad_errors && cplx);
+		const real_t fbin = plan.m_vars.at("fbin");
+		const real_t fdata = plan.m_vars.at("fdata");
+		const real_t fshift = plan.m_vars.at("fshift");
+		fourier_analysis_comp_mask scratch(cplx, size);
+		for (size_t j = 1; j < sig_indexes.size(); ++j) {
+			const size_t kb = sig_indexes[j];
+			size_t next = kb + 1;
+			while (next < plan.m_keys.size()) {
+				const str_t &key = plan.m_keys[next];
+				if (m_user_comps.count(key) ||
+						FACompType::WOTone == plan.m_comps.at(key)->type) {
+					break;
+				}
+				++next;
+			}
+			fa_imd_step step{ next, {}, fourier_analysis_comp_mask(cplx, size),
+				{} };
+			for (size_t i = 0; i < j; ++i) {
+				const size_t ka = sig_indexes[i];
+				const bool resolved = plan.m_bins[ka] && plan.m_bins[kb];
+				for (const imd_term &t : imd) {
+					const std::pair<int, int> c = t.coefs();
+					if (!resolved) {
+						step.products.push_back({ ka, kb, c.first, c.second });
+						continue;
+					}
+					const real_t freq = c.first * plan.m_bins[ka]->freq +
+							c.second * plan.m_bins[kb]->freq;
+					const fa_imd_range r = imd_range(freq, m_ssb_def, cplx,
+							nfft, fbin, fdata, fshift, scratch);
+					if (ab_mask.overlaps(r.i1, r.i2)) {
+						step.ranges.push_back(r);
+					}
+				}
+			}
+			merge_imd_ranges(step.ranges);
+			set_imd_ranges(step.mask, step.ranges);
+			if (!step.products.empty()) {
+				plan.m_dynamic = true; // the analysis needs the MaxTone slots
+			}
+			plan.m_imd_steps.push_back(std::move(step));
+		}
+	}
+	//
+	// Sparse Bins
+	//      For a real analysis of the whole spectrum without searches, every
+	//      component bin is known here, and all other bins are noise.
+	//
+	plan.m_sparse = !cplx && !plan.m_search && ab_mask.count() == size;
+	if (plan.m_sparse) {
+		fourier_analysis_comp_mask all(cplx, size);
+		for (const std::optional<fa_tone_bins> &bins : plan.m_bins) {
+			if (bins) {
+				all |= bins->mask;
+			}
+		}
+		for (const fa_imd_step &step : plan.m_imd_steps) {
+			all |= step.mask;
+		}
+		const std::vector<size_t> &ranges = all.data();
+		for (size_t i = 0; i < ranges.size(); i += 2) {
+			for (size_t k = ranges[i]; k < ranges[i + 1]; ++k) {
+				plan.m_sparse_bins.push_back(k);
+			}
+		}
+	}
+	if (!plan.m_dynamic) {
+		return;
+	}
+	//
+	// Dynamic Frequencies
+	//      The remaining FixedTone frequencies are compiled against a dense
+	//      array of values: first the variables resolved above, then one slot
+	//      per MaxTone and unresolved FixedTone.  Unresolved slots hold NaN
+	//      until the analysis finds the tone.
+	//
+	for (const std::pair<const str_t, real_t> &kv : plan.m_vars) {
+		plan.m_slot_names.push_back(kv.first);
+		plan.m_slot_values.push_back(kv.second);
+	}
+	plan.m_key_slots.resize(plan.m_keys.size(), 0);
+	for (size_t i = 0; i < plan.m_keys.size(); ++i) {
+		if (dynamic_keys.count(plan.m_keys[i])) {
+			plan.m_key_slots[i] = plan.m_slot_names.size();
+			plan.m_slot_names.push_back(plan.m_keys[i]);
+			plan.m_slot_values.push_back(
+					std::numeric_limits<real_t>::quiet_NaN());
+		}
+	}
+	plan.m_freq_code.resize(plan.m_keys.size());
+	for (size_t i = 0; i < plan.m_keys.size(); ++i) {
+		const fourier_analysis_component &comp = *plan.m_comps.at(plan.m_keys[i]);
+		if (FACompType::FixedTone == comp.type && !plan.m_bins[i]) {
+			auto &c = static_cast<const fa_fixed_tone &>(comp);
+			plan.m_freq_code[i] = expression(c.freq).compile(plan.m_slot_names);
+		}
+	}
 }
 
 // This function needs a detailed explanation.  Don't edit this function unless
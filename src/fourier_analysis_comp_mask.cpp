@@ -4,6 +4,7 @@
 #include "fourier_analysis_comp_mask.hpp"
 
 #include "exceptions.hpp"
+#include "spectrum_index.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -40,6 +41,34 @@ fourier_analysis_comp_mask::operator&=(fourier_analysis_comp_mask m) {
 fourier_analysis_comp_mask &
 fourier_analysis_comp_mask::operator|=(const fourier_analysis_comp_mask &m) {
 	if_not_compat_then_throw(m);
+	if (merge_min_ranges <= m.num_ranges()) {
+		// Merge the two sorted lists of ranges, joining ranges that overlap
+		// or touch, in O(this->num_ranges() + m.num_ranges())
+		std::vector<size_t> merged;
+		merged.reserve(m_data.size() + m.m_data.size());
+		size_t i = 0;
+		size_t j = 0;
+		while (i < m_data.size() || j < m.m_data.size()) {
+			const std::vector<size_t> *src = &m.m_data;
+			size_t *k = &j;
+			if (j == m.m_data.size() ||
+					(i < m_data.size() && m_data[i] < m.m_data[j])) {
+				src = &m_data;
+				k = &i;
+			}
+			const size_t i1 = (*src)[*k];
+			const size_t i2 = (*src)[*k + 1];
+			*k += 2;
+			if (!merged.empty() && i1 <= merged.back()) {
+				merged.back() = std::max(merged.back(), i2);
+			} else {
+				merged.push_back(i1);
+				merged.push_back(i2);
+			}
+		}
+		m_data.swap(merged);
+		return *this;
+	}
 	for (size_t range = 0; range < m.num_ranges(); ++range) {
 		size_t i1 = m.m_data[range * 2];
 		size_t i2 = m.m_data[range * 2 + 1];
@@ -52,11 +81,7 @@ fourier_analysis_comp_mask::operator|=(const fourier_analysis_comp_mask &m) {
 size_t fourier_analysis_comp_mask::count() const {
 	size_t count = 0;
 	for (size_t range = 0; range < num_ranges(); ++range) {
-		const size_t i1 = m_data[range * 2];
-		const size_t i2 = m_data[range * 2 + 1];
-		for (size_t i = i1; i < i2; ++i) {
-			++count;
-		}
+		count += m_data[range * 2 + 1] - m_data[range * 2];
 	}
 	return count;
 }
@@ -92,6 +117,34 @@ fourier_analysis_comp_mask::find_max_index(const real_t *data,
 	}
 }
 
+std::tuple<diff_t, diff_t, diff_t>
+fourier_analysis_comp_mask::find_max_index(const spectrum_index &index) const {
+	if (m_usize != index.size()) {
+		throw runtime_error(
+				"fourier_analysis_comp_mask::find_max_index : size error");
+	}
+	real_t max_value = 0.0;
+	diff_t max_index = -1;
+	size_t max_range = 0;
+	for (size_t range = 0; range < num_ranges(); ++range) {
+		std::pair<diff_t, real_t> im =
+				index.max_index(m_data[range * 2], m_data[range * 2 + 1]);
+		if (0 <= im.first && max_value < im.second) {
+			max_value = im.second;
+			max_index = im.first;
+			max_range = range;
+		}
+	}
+	if (max_index < 0) {
+		return std::make_tuple(-1, -1, -1);
+	} else {
+		diff_t lower = static_cast<diff_t>(m_data[max_range * 2]);
+		diff_t upper =
+				static_cast<diff_t>(m_data[max_range * 2 + 1]) - 1;
+		return std::make_tuple(max_index, lower, upper);
+	}
+}
+
 std::tuple<size_t, size_t, size_t>
 fourier_analysis_comp_mask::get_indexes() const {
 	if (1 == num_ranges()) {
@@ -191,6 +244,18 @@ real_t fourier_analysis_comp_mask::sum(const real_t *data, size_t size) const {
 	return mag;
 }
 
+real_t fourier_analysis_comp_mask::sum(const spectrum_index &index) const {
+	if (m_usize != index.size()) {
+		throw runtime_error(
+				"fourier_analysis_comp_mask::sum : size error");
+	}
+	real_t mag = 0.0;
+	for (size_t range = 0; range < num_ranges(); ++range) {
+		mag += index.sum(m_data[range * 2], m_data[range * 2 + 1]);
+	}
+	return mag;
+}
+
 void fourier_analysis_comp_mask::unset_ranges(
 		const fourier_analysis_comp_mask &m) {
 	if (&m == this) {
@@ -204,14 +269,9 @@ void fourier_analysis_comp_mask::unset_ranges(
 }
 
 size_t fourier_analysis_comp_mask::get_index(size_t value) const {
-	size_t index = 0;
-	while (index < m_data.size()) {
-		if (value < m_data[index]) {
-			break;
-		}
-		++index;
-	}
-	return index;
+	return static_cast<size_t>(
+			std::upper_bound(m_data.begin(), m_data.end(), value) -
+			m_data.begin());
 }
 
 void fourier_analysis_comp_mask::if_not_compat_then_throw(
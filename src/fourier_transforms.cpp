@@ -5,12 +5,18 @@
 
 #include "constants.hpp"
 #include "exceptions.hpp"
+#include "parallel.hpp"
+#include "simd_kernels.hpp"
 #include "utils.hpp"
 
 #include <fftw3.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <complex>
+#include <fstream>
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <tuple>
@@ -32,202 +38,183 @@ const real_t hann_k1 = -0.5;
 
 } // namespace
 
-namespace { // Window-Only Functions
+namespace { // Window Coefficient Tables
 
-// For Complex FFT
-void blackman_harris(const real_t *i_data, const real_t *q_data,
-		real_t *out_data, size_t in_stride, size_t navg,
-		size_t nfft) {
-	const real_t scalar = blackman_harris_kx;
+template <typename R>
+using window_table = std::shared_ptr<const std::vector<R>>;
+
+// Window table cache key: (window, nfft, scale)
+struct WindowKey {
+	Window window;
+	size_t nfft;
+	RfftScale scale;
+	bool operator==(const WindowKey &o) const {
+		return window == o.window && nfft == o.nfft && scale == o.scale;
+	}
+};
+
+struct WindowKeyHash {
+	size_t operator()(const WindowKey &k) const {
+		size_t h = std::hash<size_t>{}(k.nfft);
+		h ^= std::hash<int>{}(static_cast<int>(k.window)) + 0x9e3779b9 +
+				(h << 6) + (h >> 2);
+		h ^= std::hash<int>{}(static_cast<int>(k.scale)) + 0x9e3779b9 +
+				(h << 6) + (h >> 2);
+		return h;
+	}
+};
+
+std::mutex &window_cache_mutex() {
+	static std::mutex mtx;
+	return mtx;
+}
+
+// One cache per table precision, all guarded by window_cache_mutex()
+template <typename R>
+std::unordered_map<WindowKey, window_table<R>, WindowKeyHash> &window_cache() {
+	static std::unordered_map<WindowKey, window_table<R>, WindowKeyHash> cache;
+	return cache;
+}
+
+// Incremented by window_cache_clear(), which tells every thread to drop the
+// tables held in its front cache
+std::atomic<size_t> &window_cache_generation() {
+	static std::atomic<size_t> generation{ 0 };
+	return generation;
+}
+
+// Only RfftScale::DbfsSin changes the coefficients (by sqrt(2)), so DbfsDc and
+// Native share a table.  Complex FFTs use the Native table.
+RfftScale window_table_scale(RfftScale scale) {
+	return (RfftScale::DbfsSin == scale) ? RfftScale::DbfsSin :
+											RfftScale::Native;
+}
+
+// Coefficients include the window gain correction (kx) and the real FFT scale
+// factor, so applying the window is a single multiply per sample.  They are
+// always computed in double precision and then rounded to R.
+template <typename R>
+std::vector<R> make_window_table(Window window, size_t nfft, RfftScale scale) {
+	const real_t s = (RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0;
 	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
 	const real_t k2 = k1 * 2;
 	const real_t k3 = k1 * 3;
-	const size_t in_row_stride = nfft * in_stride;
-	const size_t out_row_stride = nfft * 2;
-	size_t i = 0;
+	std::vector<R> table(nfft);
 	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[j] = w * scalar * i_data[i];
-			out_data[j + 1] = w * scalar * q_data[i];
-			i += in_stride;
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const real_t *i2_data = i_data + in_row_stride;
-		const real_t *q2_data = q_data + in_row_stride;
-		real_t *out2_data = out_data + out_row_stride;
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[j] = w * scalar * i_data[i];
-			out_data[j + 1] = w * scalar * q_data[i];
-			out2_data[j] = w * scalar * i2_data[i];
-			out2_data[j + 1] = w * scalar * q2_data[i];
-			i += in_stride;
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			const real_t *pi = i_data;
-			const real_t *pq = q_data;
-			real_t *po = out_data;
-			for (size_t k = 0; k < navg; ++k) {
-				po[j] = w * scalar * pi[i];
-				po[j + 1] = w * scalar * pq[i];
-				pi += in_row_stride;
-				pq += in_row_stride;
-				po += out_row_stride;
+	switch (window) {
+		case Window::BlackmanHarris: {
+			const real_t scalar = blackman_harris_kx * s;
+			for (size_t i = 0; i < nfft; ++i) {
+				const real_t w = blackman_harris_k0 +
+						blackman_harris_k1 * std::cos(k1 * x) +
+						blackman_harris_k2 * std::cos(k2 * x) +
+						blackman_harris_k3 * std::cos(k3 * x);
+				table[i] = static_cast<R>(w * scalar);
+				x += 1.0;
 			}
-			i += in_stride;
-			x += 1.0;
+			break;
+		}
+		case Window::Hann: {
+			const real_t scalar = hann_kx * s;
+			for (size_t i = 0; i < nfft; ++i) {
+				const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
+				table[i] = static_cast<R>(w * scalar);
+				x += 1.0;
+			}
+			break;
 		}
+		default:
+			throw runtime_error("unsupported window");
 	}
+	return table;
 }
 
-// For Real FFT
-void blackman_harris(const real_t *in_data, real_t *out_data, size_t navg,
-		size_t nfft, RfftScale scale) {
-	const real_t scalar = blackman_harris_kx *
-			((RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0);
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
-	const real_t k2 = k1 * 2;
-	const real_t k3 = k1 * 3;
-	const size_t out_stride = (nfft / 2 + 1) * 2;
-	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[i] = w * scalar * in_data[i];
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const real_t *in2_data = in_data + nfft;
-		real_t *out2_data = out_data + out_stride;
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[i] = w * scalar * in_data[i];
-			out2_data[i] = w * scalar * in2_data[i];
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			const real_t *pi = in_data;
-			real_t *po = out_data;
-			for (size_t j = 0; j < navg; ++j) {
-				po[i] = w * scalar * pi[i];
-				pi += nfft;
-				po += out_stride;
-			}
-			x += 1.0;
+// Like get_plan(), each thread keeps a private front cache of the tables it
+// has used, so hits are served without locking.  Only a miss takes the mutex,
+// either to build the table or to fetch one built by another thread.
+template <typename R>
+window_table<R> get_window_table(Window window, size_t nfft, RfftScale scale) {
+	using table_map =
+			std::unordered_map<WindowKey, window_table<R>, WindowKeyHash>;
+	thread_local table_map front;
+	thread_local size_t front_generation = 0;
+	const size_t generation = window_cache_generation().load();
+	if (generation != front_generation) {
+		front.clear();
+		front_generation = generation;
+	}
+	WindowKey key{ window, nfft, window_table_scale(scale) };
+	auto fit = front.find(key);
+	if (fit != front.end()) {
+		return fit->second;
+	}
+	window_table<R> table;
+	{
+		std::lock_guard<std::mutex> lock(window_cache_mutex());
+		auto &cache = window_cache<R>();
+		auto it = cache.find(key);
+		if (it != cache.end()) {
+			table = it->second;
+		} else {
+			table = std::make_shared<const std::vector<R>>(
+					make_window_table<R>(window, nfft, key.scale));
+			cache[key] = table;
 		}
 	}
+	front.emplace(key, table);
+	return table;
+}
+
+// Returns the window coefficients for a transform of resolved size nfft: table
+// if the caller provides one, otherwise the cached table for window, which is
+// held in cached.  Returns nullptr for Window::NoWindow.
+template <typename R>
+const std::vector<R> *select_window(const std::vector<R> *table,
+		window_table<R> &cached, Window window, size_t nfft,
+		RfftScale scale) {
+	if (nullptr != table) {
+		assert_eq("", "window size", table->size(), "FFT size", nfft);
+		return table;
+	}
+	if (Window::NoWindow != window) {
+		cached = get_window_table<R>(window, nfft, scale);
+	}
+	return cached.get();
 }
 
+} // namespace
+
+namespace { // Window-Only Functions
+
 // For Complex FFT
-void hann(const real_t *i_data, const real_t *q_data, real_t *out_data,
-		size_t in_stride, size_t navg, size_t nfft) {
-	const real_t scalar = hann_kx;
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
+void apply_window(const real_t *win, const real_t *i_data,
+		const real_t *q_data, real_t *out_data, size_t in_stride,
+		size_t navg, size_t nfft) {
 	const size_t in_row_stride = nfft * in_stride;
 	const size_t out_row_stride = nfft * 2;
-	size_t i = 0;
-	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[j] = w * scalar * i_data[i];
-			out_data[j + 1] = w * scalar * q_data[i];
-			i += in_stride;
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const real_t *i2_data = i_data + nfft * in_stride;
-		const real_t *q2_data = q_data + nfft * in_stride;
-		real_t *out2_data = out_data + out_row_stride;
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[j] = w * scalar * i_data[i];
-			out_data[j + 1] = w * scalar * q_data[i];
-			out2_data[j] = w * scalar * i2_data[i];
-			out2_data[j + 1] = w * scalar * q2_data[i];
-			i += in_stride;
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			const real_t *pi = i_data;
-			const real_t *pq = q_data;
-			real_t *po = out_data;
-			for (size_t k = 0; k < navg; ++k) {
-				po[j] = w * scalar * pi[i];
-				po[j + 1] = w * scalar * pq[i];
-				pi += in_row_stride;
-				pq += in_row_stride;
-				po += out_row_stride;
-			}
+	for (size_t k = 0; k < navg; ++k) {
+		size_t i = 0;
+		for (size_t j = 0; j < nfft; ++j) {
+			out_data[2 * j] = win[j] * i_data[i];
+			out_data[2 * j + 1] = win[j] * q_data[i];
 			i += in_stride;
-			x += 1.0;
 		}
+		i_data += in_row_stride;
+		q_data += in_row_stride;
+		out_data += out_row_stride;
 	}
 }
 
 // For Real FFT
-void hann(const real_t *in_data, real_t *out_data, size_t navg, size_t nfft,
-		RfftScale scale) {
-	const real_t scalar =
-			hann_kx * ((RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0);
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
+void apply_window(const real_t *win, const real_t *in_data, real_t *out_data,
+		size_t navg, size_t nfft) {
 	const size_t out_stride = (nfft / 2 + 1) * 2;
-	real_t x = 0.0;
-	if (1 == navg) {
+	for (size_t k = 0; k < navg; ++k) {
 		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[i] = w * scalar * in_data[i];
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const real_t *in2_data = in_data + nfft;
-		real_t *out2_data = out_data + out_stride;
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[i] = w * scalar * in_data[i];
-			out2_data[i] = w * scalar * in2_data[i];
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			const real_t *pi = in_data;
-			real_t *po = out_data;
-			for (size_t j = 0; j < navg; ++j) {
-				po[i] = w * scalar * pi[i];
-				pi += nfft;
-				po += out_stride;
-			}
-			x += 1.0;
+			out_data[i] = win[i] * in_data[i];
 		}
+		in_data += nfft;
+		out_data += out_stride;
 	}
 }
 
@@ -261,266 +248,64 @@ void no_window(const real_t *in_data, real_t *out_data, size_t navg,
 
 namespace { // Normalize-Window Functions
 
-// For Complex FFT
-template <typename T>
-void norm_blackman_harris(const T *i_data, const T *q_data, real_t *out_data,
-		size_t in_stride, int n, size_t navg, size_t nfft,
-		CodeFormat format) {
-	const real_t scalar = blackman_harris_kx * 2.0 / (1 << n);
-	const real_t offset = (CodeFormat::OffsetBinary == format) ? -blackman_harris_kx : 0.0;
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
-	const real_t k2 = k1 * 2;
-	const real_t k3 = k1 * 3;
-	const size_t in_row_stride = nfft * in_stride;
-	const size_t out_row_stride = nfft * 2;
-	size_t i = 0;
-	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[j] =
-					w * std::fma(scalar, static_cast<real_t>(i_data[i]), offset);
-			out_data[j + 1] =
-					w * std::fma(scalar, static_cast<real_t>(q_data[i]), offset);
-			i += in_stride;
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const T *i2_data = i_data + in_row_stride;
-		const T *q2_data = q_data + in_row_stride;
-		real_t *out2_data = out_data + out_row_stride;
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[j] =
-					w * std::fma(scalar, static_cast<real_t>(i_data[i]), offset);
-			out_data[j + 1] =
-					w * std::fma(scalar, static_cast<real_t>(q_data[i]), offset);
-			out2_data[j] =
-					w * std::fma(scalar, static_cast<real_t>(i2_data[i]), offset);
-			out2_data[j + 1] =
-					w * std::fma(scalar, static_cast<real_t>(q2_data[i]), offset);
-			i += in_stride;
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			const T *pi = i_data;
-			const T *pq = q_data;
-			real_t *po = out_data;
-			for (size_t k = 0; k < navg; ++k) {
-				po[j] = w * std::fma(scalar, static_cast<real_t>(pi[i]), offset);
-				po[j + 1] =
-						w * std::fma(scalar, static_cast<real_t>(pq[i]), offset);
-				pi += in_row_stride;
-				pq += in_row_stride;
-				po += out_row_stride;
-			}
-			i += in_stride;
-			x += 1.0;
-		}
-	}
-}
-
-// For Real FFT
-template <typename T>
-void norm_blackman_harris(const T *in_data, real_t *out_data, int n,
-		size_t navg, size_t nfft, CodeFormat format,
-		RfftScale scale) {
-	real_t s = blackman_harris_kx *
-			((RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0);
-	const real_t scalar = s * 2.0 / (1 << n);
-	const real_t offset = (CodeFormat::OffsetBinary == format) ? -s : 0.0;
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
-	const real_t k2 = k1 * 2;
-	const real_t k3 = k1 * 3;
-	const size_t out_stride = (nfft / 2 + 1) * 2;
-	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[i] =
-					w * std::fma(scalar, static_cast<real_t>(in_data[i]), offset);
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const T *in2_data = in_data + nfft;
-		real_t *out2_data = out_data + out_stride;
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			out_data[i] =
-					w * std::fma(scalar, static_cast<real_t>(in_data[i]), offset);
-			out2_data[i] =
-					w * std::fma(scalar, static_cast<real_t>(in2_data[i]), offset);
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = blackman_harris_k0 +
-					blackman_harris_k1 * std::cos(k1 * x) +
-					blackman_harris_k2 * std::cos(k2 * x) +
-					blackman_harris_k3 * std::cos(k3 * x);
-			const T *pi = in_data;
-			real_t *po = out_data;
-			for (size_t j = 0; j < navg; ++j) {
-				po[i] = w * std::fma(scalar, static_cast<real_t>(pi[i]), offset);
-				pi += nfft;
-				po += out_stride;
-			}
-			x += 1.0;
-		}
-	}
-}
+// These are templated on the output precision R; normalization is carried out
+// in R, which is exact for codes that fit in R's significand.
 
 // For Complex FFT
-template <typename T>
-void norm_hann(const T *i_data, const T *q_data, real_t *out_data,
-		size_t in_stride, int n, size_t navg, size_t nfft,
+template <typename T, typename R>
+void norm_apply_window(const R *win, const T *i_data, const T *q_data,
+		R *out_data, size_t in_stride, int n, size_t navg, size_t nfft,
 		CodeFormat format) {
-	const real_t scalar = hann_kx * 2.0 / (1 << n);
-	const real_t offset = (CodeFormat::OffsetBinary == format) ? -hann_kx : 0.0;
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
+	const R scalar = static_cast<R>(2.0 / (1 << n));
+	const R offset = (CodeFormat::OffsetBinary == format) ? -1 : 0;
 	const size_t in_row_stride = nfft * in_stride;
 	const size_t out_row_stride = nfft * 2;
-	size_t i = 0;
-	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[j] =
-					w * std::fma(scalar, static_cast<real_t>(i_data[i]), offset);
-			out_data[j + 1] =
-					w * std::fma(scalar, static_cast<real_t>(q_data[i]), offset);
-			i += in_stride;
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const T *i2_data = i_data + nfft * in_stride;
-		const T *q2_data = q_data + nfft * in_stride;
-		real_t *out2_data = out_data + out_row_stride;
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[j] =
-					w * std::fma(scalar, static_cast<real_t>(i_data[i]), offset);
-			out_data[j + 1] =
-					w * std::fma(scalar, static_cast<real_t>(q_data[i]), offset);
-			out2_data[j] =
-					w * std::fma(scalar, static_cast<real_t>(i2_data[i]), offset);
-			out2_data[j + 1] =
-					w * std::fma(scalar, static_cast<real_t>(q2_data[i]), offset);
-			i += in_stride;
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t j = 0; j < out_row_stride; j += 2) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			const T *pi = i_data;
-			const T *pq = q_data;
-			real_t *po = out_data;
-			for (size_t k = 0; k < navg; ++k) {
-				po[j] = w * std::fma(scalar, static_cast<real_t>(pi[i]), offset);
-				po[j + 1] =
-						w * std::fma(scalar, static_cast<real_t>(pq[i]), offset);
-				pi += in_row_stride;
-				pq += in_row_stride;
-				po += out_row_stride;
-			}
-			i += in_stride;
-			x += 1.0;
-		}
+	for (size_t k = 0; k < navg; ++k) {
+		norm_window_cplx(i_data, q_data, in_stride, win, out_data, nfft,
+				scalar, offset);
+		i_data += in_row_stride;
+		q_data += in_row_stride;
+		out_data += out_row_stride;
 	}
 }
 
 // For Real FFT
-template <typename T>
-void norm_hann(const T *in_data, real_t *out_data, int n, size_t navg,
-		size_t nfft, CodeFormat format, RfftScale scale) {
-	real_t s = hann_kx * ((RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0);
-	const real_t scalar = s * 2.0 / (1 << n);
-	const real_t offset = (CodeFormat::OffsetBinary == format) ? -s : 0.0;
-	const real_t k1 = k_2pi / static_cast<real_t>(nfft);
+template <typename T, typename R>
+void norm_apply_window(const R *win, const T *in_data, R *out_data, int n,
+		size_t navg, size_t nfft, CodeFormat format) {
+	const R scalar = static_cast<R>(2.0 / (1 << n));
+	const R offset = (CodeFormat::OffsetBinary == format) ? -1 : 0;
 	const size_t out_stride = (nfft / 2 + 1) * 2;
-	real_t x = 0.0;
-	if (1 == navg) {
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[i] =
-					w * std::fma(scalar, static_cast<real_t>(in_data[i]), offset);
-			x += 1.0;
-		}
-	} else if (2 == navg) {
-		const T *in2_data = in_data + nfft;
-		real_t *out2_data = out_data + out_stride;
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			out_data[i] =
-					w * std::fma(scalar, static_cast<real_t>(in_data[i]), offset);
-			out2_data[i] =
-					w * std::fma(scalar, static_cast<real_t>(in2_data[i]), offset);
-			x += 1.0;
-		}
-	} else { // 2 < navg
-		for (size_t i = 0; i < nfft; ++i) {
-			const real_t w = hann_k0 + hann_k1 * std::cos(k1 * x);
-			const T *pi = in_data;
-			real_t *po = out_data;
-			for (size_t j = 0; j < navg; ++j) {
-				po[i] = w * std::fma(scalar, static_cast<real_t>(pi[i]), offset);
-				pi += nfft;
-				po += out_stride;
-			}
-			x += 1.0;
-		}
+	for (size_t k = 0; k < navg; ++k) {
+		norm_window(in_data, win, out_data, nfft, scalar, offset);
+		in_data += nfft;
+		out_data += out_stride;
 	}
 }
 
 // For Complex FFT
-template <typename T>
-void norm_no_window(const T *i_data, const T *q_data, real_t *out_data,
+template <typename T, typename R>
+void norm_no_window(const T *i_data, const T *q_data, R *out_data,
 		size_t in_stride, int n, size_t navg, size_t nfft,
 		CodeFormat format) {
-	const real_t scalar = 2.0 / (1 << n);
-	const real_t offset = (CodeFormat::OffsetBinary == format) ? -1.0 : 0.0;
-	const size_t out_size = navg * nfft * 2;
-	size_t i = 0;
-	for (size_t j = 0; j < out_size; j += 2) {
-		out_data[j] = std::fma(scalar, static_cast<real_t>(i_data[i]),
-				offset);
-		out_data[j + 1] = std::fma(
-				scalar, static_cast<real_t>(q_data[i]), offset);
-		i += in_stride;
-	}
+	const R scalar = static_cast<R>(2.0 / (1 << n));
+	const R offset = (CodeFormat::OffsetBinary == format) ? -1 : 0;
+	norm_window_cplx(i_data, q_data, in_stride, static_cast<const R *>(nullptr),
+			out_data, navg * nfft, scalar, offset);
 }
 
 // For Real FFT
-template <typename T>
-void norm_no_window(const T *in_data, real_t *out_data, int n, size_t navg,
+template <typename T, typename R>
+void norm_no_window(const T *in_data, R *out_data, int n, size_t navg,
 		size_t nfft, CodeFormat format, RfftScale scale) {
 	real_t s = (RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0;
-	const real_t scalar = s * 2.0 / (1 << n);
-	const real_t offset = (CodeFormat::OffsetBinary == format) ? -s : 0.0;
+	const R scalar = static_cast<R>(s * 2.0 / (1 << n));
+	const R offset =
+			static_cast<R>((CodeFormat::OffsetBinary == format) ? -s : 0.0);
 	const size_t out_stride = (nfft / 2 + 1) * 2;
 	for (size_t j = 0; j < navg; ++j) {
-		for (size_t i = 0; i < nfft; ++i) {
-			out_data[i] = std::fma(scalar,
-					static_cast<real_t>(in_data[i]),
-					offset);
-		}
+		norm_window(in_data, static_cast<const R *>(nullptr), out_data, nfft,
+				scalar, offset);
 		in_data += nfft;
 		out_data += out_stride;
 	}
@@ -530,13 +315,86 @@ void norm_no_window(const T *in_data, real_t *out_data, int n, size_t navg,
 
 namespace { // FFTW Functions with Plan Caching
 
-// Plan cache key: (nfft, navg, is_real)
+// Precision-specific FFTW entry points.  fftw_api<double> uses libfftw3 and
+// fftw_api<float> uses libfftw3f, which is only available when genalyzer is
+// built with GENALYZER_FFTW_FLOAT.
+template <typename R>
+struct fftw_api;
+
+template <>
+struct fftw_api<double> {
+	using plan_t = fftw_plan;
+	using iodim_t = fftw_iodim64;
+	using complex_t = fftw_complex;
+	static plan_t plan_split_dft(int rank, const iodim_t *dims,
+			int howmany_rank, const iodim_t *howmany_dims, double *ri,
+			double *ii, double *ro, double *io, unsigned flags) {
+		return fftw_plan_guru64_split_dft(rank, dims, howmany_rank,
+				howmany_dims, ri, ii, ro, io, flags);
+	}
+	static plan_t plan_dft_r2c(int rank, const iodim_t *dims,
+			int howmany_rank, const iodim_t *howmany_dims, double *in,
+			complex_t *out, unsigned flags) {
+		return fftw_plan_guru64_dft_r2c(rank, dims, howmany_rank,
+				howmany_dims, in, out, flags);
+	}
+	static void execute_split_dft(plan_t p, double *ri, double *ii,
+			double *ro, double *io) {
+		fftw_execute_split_dft(p, ri, ii, ro, io);
+	}
+	static void execute_dft_r2c(plan_t p, double *in, complex_t *out) {
+		fftw_execute_dft_r2c(p, in, out);
+	}
+	static int alignment_of(double *p) { return fftw_alignment_of(p); }
+	static void *allocate(size_t n) { return fftw_malloc(n); }
+	static void deallocate(void *p) { fftw_free(p); }
+};
+
+#ifdef GENALYZER_FFTW_FLOAT
+template <>
+struct fftw_api<float> {
+	using plan_t = fftwf_plan;
+	using iodim_t = fftwf_iodim64;
+	using complex_t = fftwf_complex;
+	static plan_t plan_split_dft(int rank, const iodim_t *dims,
+			int howmany_rank, const iodim_t *howmany_dims, float *ri,
+			float *ii, float *ro, float *io, unsigned flags) {
+		return fftwf_plan_guru64_split_dft(rank, dims, howmany_rank,
+				howmany_dims, ri, ii, ro, io, flags);
+	}
+	static plan_t plan_dft_r2c(int rank, const iodim_t *dims,
+			int howmany_rank, const iodim_t *howmany_dims, float *in,
+			complex_t *out, unsigned flags) {
+		return fftwf_plan_guru64_dft_r2c(rank, dims, howmany_rank,
+				howmany_dims, in, out, flags);
+	}
+	static void execute_split_dft(plan_t p, float *ri, float *ii,
+			float *ro, float *io) {
+		fftwf_execute_split_dft(p, ri, ii, ro, io);
+	}
+	static void execute_dft_r2c(plan_t p, float *in, complex_t *out) {
+		fftwf_execute_dft_r2c(p, in, out);
+	}
+	static int alignment_of(float *p) { return fftwf_alignment_of(p); }
+	static void *allocate(size_t n) { return fftwf_malloc(n); }
+	static void deallocate(void *p) { fftwf_free(p); }
+};
+#endif
+
+// Plan cache key: (nfft, navg, is_real, planner, align)
+//
+// A plan may only be executed on arrays with the same SIMD alignment as the
+// arrays it was created with.  Records processed by different threads start
+// at different offsets in the work array, so the alignment is part of the key.
 struct PlanKey {
 	size_t nfft;
 	size_t navg;
 	bool is_real;
+	FftPlanner planner;
+	int align;
 	bool operator==(const PlanKey &o) const {
-		return nfft == o.nfft && navg == o.navg && is_real == o.is_real;
+		return nfft == o.nfft && navg == o.navg && is_real == o.is_real &&
+				planner == o.planner && align == o.align;
 	}
 };
 
@@ -545,179 +403,500 @@ struct PlanKeyHash {
 		size_t h = std::hash<size_t>{}(k.nfft);
 		h ^= std::hash<size_t>{}(k.navg) + 0x9e3779b9 + (h << 6) + (h >> 2);
 		h ^= std::hash<bool>{}(k.is_real) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		h ^= std::hash<int>{}(static_cast<int>(k.planner)) + 0x9e3779b9 +
+				(h << 6) + (h >> 2);
+		h ^= std::hash<int>{}(k.align) + 0x9e3779b9 + (h << 6) + (h >> 2);
 		return h;
 	}
 };
 
 // FFTW plan creation is not thread-safe, so we protect the cache with a mutex.
 // Plans themselves can be executed concurrently with fftw_execute_split_dft /
-// fftw_execute_dft_r2c on different data arrays.
+// fftw_execute_dft_r2c on different data arrays.  The mutex also guards the
+// FFTW wisdom functions, which share state with the planner.
 std::mutex &plan_cache_mutex() {
 	static std::mutex mtx;
 	return mtx;
 }
 
-std::unordered_map<PlanKey, fftw_plan, PlanKeyHash> &plan_cache() {
-	static std::unordered_map<PlanKey, fftw_plan, PlanKeyHash> cache;
+#ifdef GENALYZER_FFTW_FLOAT
+// FFTW keeps separate wisdom for each precision, so single-precision wisdom is
+// saved to a second file
+str_t float_wisdom_filename(const str_t &filename) {
+	return filename + ".float";
+}
+#endif
+
+// One cache per precision, all guarded by plan_cache_mutex()
+template <typename R>
+std::unordered_map<PlanKey, typename fftw_api<R>::plan_t, PlanKeyHash> &
+plan_cache() {
+	static std::unordered_map<PlanKey, typename fftw_api<R>::plan_t,
+			PlanKeyHash>
+			cache;
 	return cache;
 }
 
-void exec_fftw(real_t *data, size_t navg, size_t nfft) {
-	diff_t navg_ = static_cast<diff_t>(navg);
-	diff_t nfft_ = static_cast<diff_t>(nfft);
+std::atomic<FftPlanner> &fft_planner_setting() {
+	static std::atomic<FftPlanner> planner{ FftPlanner::Estimate };
+	return planner;
+}
 
-	PlanKey key{ nfft, navg, false };
-	fftw_plan plan = nullptr;
+unsigned planner_flags(FftPlanner planner) {
+	switch (planner) {
+		case FftPlanner::Measure:
+			return FFTW_MEASURE;
+		case FftPlanner::Patient:
+			return FFTW_PATIENT;
+		default:
+			return FFTW_ESTIMATE;
+	}
+}
 
+// Cached plans are never destroyed, so each thread keeps a private front cache
+// of the plans it has used.  Hits are served without locking; only a miss
+// takes the mutex, either to create the plan or to fetch one created by
+// another thread.
+template <typename R, typename MakePlan>
+typename fftw_api<R>::plan_t get_plan(const PlanKey &key, MakePlan make_plan) {
+	using plan_t = typename fftw_api<R>::plan_t;
+	thread_local std::unordered_map<PlanKey, plan_t, PlanKeyHash> front;
+	auto fit = front.find(key);
+	if (fit != front.end()) {
+		return fit->second;
+	}
+	plan_t plan = nullptr;
 	{
 		std::lock_guard<std::mutex> lock(plan_cache_mutex());
-		auto &cache = plan_cache();
+		auto &cache = plan_cache<R>();
 		auto it = cache.find(key);
 		if (it != cache.end()) {
 			plan = it->second;
 		} else {
-			int rank = 1;
-			fftw_iodim64 dims{ nfft_, 2, 2 };
-			int howmany_rank = 1;
-			fftw_iodim64 howmany_dims = { navg_, nfft_ * 2, nfft_ * 2 };
-			plan = fftw_plan_guru64_split_dft(rank, &dims, howmany_rank,
-					&howmany_dims,
-					data, data + 1, data, data + 1,
-					FFTW_ESTIMATE);
+			plan = make_plan();
 			if (nullptr == plan) {
 				throw runtime_error("FFTW Plan is NULL");
 			}
 			cache[key] = plan;
 		}
 	}
-
-	// Execute with new-array interface (safe for cached plans)
-	fftw_execute_split_dft(plan, data, data + 1, data, data + 1);
+	front.emplace(key, plan);
+	return plan;
 }
 
-void exec_rfftw(real_t *data, size_t navg, size_t nfft) {
-	diff_t navg_ = static_cast<diff_t>(navg);
-	diff_t nfft_ = static_cast<diff_t>(nfft);
-	diff_t out_stride = nfft_ / 2 + 1;
-
-	PlanKey key{ nfft, navg, true };
-	fftw_plan plan = nullptr;
-	fftw_complex *out_data = reinterpret_cast<fftw_complex *>(data);
-
-	{
-		std::lock_guard<std::mutex> lock(plan_cache_mutex());
-		auto &cache = plan_cache();
-		auto it = cache.find(key);
-		if (it != cache.end()) {
-			plan = it->second;
-		} else {
-			int rank = 1;
-			fftw_iodim64 dims{ nfft_, 1, 1 };
-			int howmany_rank = 1;
-			fftw_iodim64 howmany_dims{ navg_, out_stride * 2, out_stride };
-			plan = fftw_plan_guru64_dft_r2c(rank, &dims, howmany_rank,
-					&howmany_dims, data, out_data,
-					FFTW_ESTIMATE);
-			if (nullptr == plan) {
-				throw runtime_error("FFTW Plan is NULL");
+// Measuring planners overwrite the arrays, so they plan on a scratch array of
+// n elements with the same alignment as data.  Otherwise, returns data.
+template <typename R>
+class plan_scratch {
+public:
+	plan_scratch(R *data, size_t n, const PlanKey &key) : m_data(data) {
+		if (FftPlanner::Estimate != key.planner) {
+			m_buf = fftw_api<R>::allocate(n * sizeof(R) + key.align);
+			if (nullptr == m_buf) {
+				throw runtime_error("FFTW scratch allocation failed");
 			}
-			cache[key] = plan;
+			m_data = reinterpret_cast<R *>(
+					static_cast<char *>(m_buf) + key.align);
+		}
+	}
+	plan_scratch(const plan_scratch &) = delete;
+	plan_scratch &operator=(const plan_scratch &) = delete;
+	~plan_scratch() {
+		if (nullptr != m_buf) {
+			fftw_api<R>::deallocate(m_buf);
 		}
 	}
+	R *data() const { return m_data; }
+
+private:
+	void *m_buf = nullptr;
+	R *m_data;
+};
+
+template <typename R>
+void exec_fftw(R *data, size_t navg, size_t nfft) {
+	using api = fftw_api<R>;
+	PlanKey key{ nfft, navg, false, fft_planner_setting().load(),
+		api::alignment_of(data) };
+	auto plan = get_plan<R>(key, [&]() {
+		diff_t navg_ = static_cast<diff_t>(navg);
+		diff_t nfft_ = static_cast<diff_t>(nfft);
+		plan_scratch<R> scratch(data, navg * nfft * 2, key);
+		R *plan_data = scratch.data();
+		int rank = 1;
+		typename api::iodim_t dims{ nfft_, 2, 2 };
+		int howmany_rank = 1;
+		typename api::iodim_t howmany_dims{ navg_, nfft_ * 2, nfft_ * 2 };
+		return api::plan_split_dft(rank, &dims, howmany_rank,
+				&howmany_dims, plan_data, plan_data + 1, plan_data,
+				plan_data + 1, planner_flags(key.planner));
+	});
+
+	// Execute with new-array interface (safe for cached plans)
+	api::execute_split_dft(plan, data, data + 1, data, data + 1);
+}
+
+template <typename R>
+void exec_rfftw(R *data, size_t navg, size_t nfft) {
+	using api = fftw_api<R>;
+	PlanKey key{ nfft, navg, true, fft_planner_setting().load(),
+		api::alignment_of(data) };
+	auto plan = get_plan<R>(key, [&]() {
+		diff_t navg_ = static_cast<diff_t>(navg);
+		diff_t nfft_ = static_cast<diff_t>(nfft);
+		diff_t out_stride = nfft_ / 2 + 1;
+		plan_scratch<R> scratch(
+				data, navg * static_cast<size_t>(out_stride) * 2, key);
+		R *plan_data = scratch.data();
+		int rank = 1;
+		typename api::iodim_t dims{ nfft_, 1, 1 };
+		int howmany_rank = 1;
+		typename api::iodim_t howmany_dims{ navg_, out_stride * 2,
+			out_stride };
+		return api::plan_dft_r2c(rank, &dims, howmany_rank, &howmany_dims,
+				plan_data,
+				reinterpret_cast<typename api::complex_t *>(plan_data),
+				planner_flags(key.planner));
+	});
 
-	fftw_execute_dft_r2c(plan, data, out_data);
+	api::execute_dft_r2c(plan, data,
+			reinterpret_cast<typename api::complex_t *>(data));
 }
 
 } // namespace
 
 namespace { // Scaling and Averaging Functions
 
-void reduce_and_scale_fft(real_t *fftw_data, real_t *out_data, size_t navg,
-		size_t nfft) {
-	cplx_t *cfftw_data = reinterpret_cast<cplx_t *>(fftw_data);
-	cplx_t *cout_data = reinterpret_cast<cplx_t *>(out_data);
-	for (size_t i = 0; i < nfft; ++i) {
+// These are templated on the spectrum precision R.
+
+// Reduces bins [first, last) over all records.  Each bin is independent, so
+// disjoint bin ranges can be reduced concurrently with identical results.
+template <typename R>
+void reduce_and_scale_fft(const R *fftw_data, R *out_data, size_t navg,
+		size_t nfft, size_t first, size_t last) {
+	using cplx = std::complex<R>;
+	const cplx *cfftw_data = reinterpret_cast<const cplx *>(fftw_data);
+	cplx *cout_data = reinterpret_cast<cplx *>(out_data);
+	for (size_t i = first; i < last; ++i) {
 		cout_data[i] = { std::norm(cfftw_data[i]),
 			std::arg(cfftw_data[i]) };
 	}
 	for (size_t j = 1; j < navg; ++j) {
 		cfftw_data += nfft;
-		for (size_t i = 0; i < nfft; ++i) {
-			cout_data[i] += cplx_t(std::norm(cfftw_data[i]),
+		for (size_t i = first; i < last; ++i) {
+			cout_data[i] += cplx(std::norm(cfftw_data[i]),
 					std::arg(cfftw_data[i]));
 		}
 	}
-	const real_t avg_scalar = 1.0 / static_cast<real_t>(navg);
-	const real_t fft_scalar = 1.0 / static_cast<real_t>(nfft);
-	for (size_t i = 0; i < nfft; ++i) {
-		cplx_t &x = cout_data[i];
+	const R avg_scalar = static_cast<R>(1.0 / static_cast<real_t>(navg));
+	const R fft_scalar = static_cast<R>(1.0 / static_cast<real_t>(nfft));
+	for (size_t i = first; i < last; ++i) {
+		cplx &x = cout_data[i];
 		x *= avg_scalar;
 		x = std::polar(std::sqrt(x.real()) * fft_scalar, x.imag());
 	}
 }
 
-void reduce_and_scale_rfft(real_t *fftw_data, real_t *out_data, size_t navg,
-		size_t nfft, RfftScale scale) {
-	cplx_t *cfftw_data = reinterpret_cast<cplx_t *>(fftw_data);
-	cplx_t *cout_data = reinterpret_cast<cplx_t *>(out_data);
+// Reduces bins [first, last) over all records; see reduce_and_scale_fft.
+template <typename R>
+void reduce_and_scale_rfft(const R *fftw_data, R *out_data, size_t navg,
+		size_t nfft, RfftScale scale, size_t first, size_t last) {
+	using cplx = std::complex<R>;
+	const cplx *cfftw_data = reinterpret_cast<const cplx *>(fftw_data);
+	cplx *cout_data = reinterpret_cast<cplx *>(out_data);
 	const size_t cout_size = nfft / 2 + 1;
-	for (size_t i = 0; i < cout_size; ++i) {
+	for (size_t i = first; i < last; ++i) {
 		cout_data[i] = { std::norm(cfftw_data[i]),
 			std::arg(cfftw_data[i]) };
 	}
 	for (size_t j = 1; j < navg; ++j) {
 		cfftw_data += cout_size;
-		for (size_t i = 0; i < cout_size; ++i) {
-			cout_data[i] += cplx_t(std::norm(cfftw_data[i]),
+		for (size_t i = first; i < last; ++i) {
+			cout_data[i] += cplx(std::norm(cfftw_data[i]),
 					std::arg(cfftw_data[i]));
 		}
 	}
-	const real_t avg_scalar = 1.0 / static_cast<real_t>(navg);
+	const R avg_scalar = static_cast<R>(1.0 / static_cast<real_t>(navg));
 	real_t s = (RfftScale::Native == scale) ? 1.0 : k_sqrt2;
-	const real_t fft_scalar = s / static_cast<real_t>(nfft);
-	for (size_t i = 0; i < cout_size; ++i) {
-		cplx_t &x = cout_data[i];
+	const R fft_scalar = static_cast<R>(s / static_cast<real_t>(nfft));
+	for (size_t i = first; i < last; ++i) {
+		cplx &x = cout_data[i];
 		x *= avg_scalar;
 		x = std::polar(std::sqrt(x.real()) * fft_scalar, x.imag());
 	}
 	if (RfftScale::Native != scale) {
-		cout_data[0] /= k_sqrt2;
-		if (1 < nfft && is_even(nfft)) {
-			cout_data[cout_size - 1] /= k_sqrt2;
+		const R sqrt2 = static_cast<R>(k_sqrt2);
+		if (0 == first) {
+			cout_data[0] /= sqrt2;
+		}
+		if (1 < nfft && is_even(nfft) && cout_size == last) {
+			cout_data[cout_size - 1] /= sqrt2;
 		}
 	}
 }
 
-void scale_fft(real_t *data, size_t nfft) {
+// Writes the mean-square magnitude of bins [first, last), averaged over all
+// records.  The averaged phase is not needed, so the per-bin arg()/polar()
+// of reduce_and_scale_fft() is skipped.  The result equals the norm() of the
+// reduce_and_scale_fft() output, up to floating-point rounding.
+template <typename R>
+void reduce_msq_fft(const R *fftw_data, R *out_data, size_t navg,
+		size_t nfft, size_t first, size_t last) {
+	const size_t row_stride = nfft * 2;
+	const R *p = fftw_data;
+	for (size_t i = first; i < last; ++i) {
+		out_data[i] = p[2 * i] * p[2 * i] + p[2 * i + 1] * p[2 * i + 1];
+	}
+	for (size_t j = 1; j < navg; ++j) {
+		p += row_stride;
+		for (size_t i = first; i < last; ++i) {
+			out_data[i] += p[2 * i] * p[2 * i] + p[2 * i + 1] * p[2 * i + 1];
+		}
+	}
+	const real_t nfft_r = static_cast<real_t>(nfft);
+	const R scalar = static_cast<R>(
+			1.0 / (static_cast<real_t>(navg) * nfft_r * nfft_r));
+	for (size_t i = first; i < last; ++i) {
+		out_data[i] *= scalar;
+	}
+}
+
+// See reduce_msq_fft
+template <typename R>
+void reduce_msq_rfft(const R *fftw_data, R *out_data, size_t navg,
+		size_t nfft, RfftScale scale, size_t first, size_t last) {
+	const size_t nbins = nfft / 2 + 1;
+	const size_t row_stride = nbins * 2;
+	const R *p = fftw_data;
+	for (size_t i = first; i < last; ++i) {
+		out_data[i] = p[2 * i] * p[2 * i] + p[2 * i + 1] * p[2 * i + 1];
+	}
+	for (size_t j = 1; j < navg; ++j) {
+		p += row_stride;
+		for (size_t i = first; i < last; ++i) {
+			out_data[i] += p[2 * i] * p[2 * i] + p[2 * i + 1] * p[2 * i + 1];
+		}
+	}
+	const real_t nfft_r = static_cast<real_t>(nfft);
+	const real_t s = (RfftScale::Native == scale) ? 1.0 : 2.0;
+	const R scalar = static_cast<R>(
+			s / (static_cast<real_t>(navg) * nfft_r * nfft_r));
+	for (size_t i = first; i < last; ++i) {
+		out_data[i] *= scalar;
+	}
+	if (RfftScale::Native != scale) {
+		if (0 == first) {
+			out_data[0] /= 2;
+		}
+		if (1 < nfft && is_even(nfft) && nbins == last) {
+			out_data[nbins - 1] /= 2;
+		}
+	}
+}
+
+template <typename R>
+void scale_fft(R *data, size_t nfft) {
 	const size_t size = 2 * nfft;
-	const real_t scalar = 1.0 / static_cast<real_t>(nfft);
+	const R scalar = static_cast<R>(1.0 / static_cast<real_t>(nfft));
 	for (size_t i = 0; i < size; ++i) {
 		data[i] *= scalar;
 	}
 }
 
-void scale_rfft(real_t *data, size_t nfft, RfftScale scale) {
+template <typename R>
+void scale_rfft(R *data, size_t nfft, RfftScale scale) {
 	const size_t size = (nfft / 2 + 1) * 2;
 	real_t s = (RfftScale::Native == scale) ? 1.0 : k_sqrt2;
-	const real_t scalar = s / static_cast<real_t>(nfft);
+	const R scalar = static_cast<R>(s / static_cast<real_t>(nfft));
 	for (size_t i = 0; i < size; ++i) {
 		data[i] *= scalar;
 	}
 	if (RfftScale::Native != scale) {
-		data[0] /= k_sqrt2;
-		data[1] /= k_sqrt2;
+		const R sqrt2 = static_cast<R>(k_sqrt2);
+		data[0] /= sqrt2;
+		data[1] /= sqrt2;
 		if (1 < nfft && is_even(nfft)) {
-			data[size - 1] /= k_sqrt2;
-			data[size - 2] /= k_sqrt2;
+			data[size - 1] /= sqrt2;
+			data[size - 2] /= sqrt2;
 		}
 	}
 }
 
 } // namespace
 
-void fft(const real_t *i_data, size_t i_size, const real_t *q_data,
-		size_t q_size, real_t *out_data, size_t out_size, size_t navg,
-		size_t nfft, Window window) {
+namespace { // Record-Parallel Averaging
+
+// Below this many input samples, threading overhead outweighs the gain
+const size_t min_parallel_samples = 1 << 16;
+
+// Approximate number of input samples in one record block
+const size_t block_samples = 1 << 14;
+
+// The block count depends only on nrec and nfft, never on the thread count, so
+// every record is transformed by the same FFTW plan at the same offset however
+// many threads run the blocks.
+size_t record_blocks(size_t nrec, size_t nfft) {
+	if (nrec < 2 || nrec * nfft < min_parallel_samples) {
+		return 1;
+	}
+	const size_t block_records = std::max<size_t>(1, block_samples / nfft);
+	return (nrec + block_records - 1) / block_records;
+}
+
+// Calls f(b) for every block b in [0, nblocks).  On a single thread the blocks
+// run inline, so no std::function is built for parallel_for().
+template <typename F>
+void for_each_block(size_t nblocks, const F &f) {
+	if (nblocks < 2 || get_num_threads() < 2) {
+		for (size_t b = 0; b < nblocks; ++b) {
+			f(b);
+		}
+	} else {
+		parallel_for(nblocks, f);
+	}
+}
+
+// The records of all nch channels are transformed together: record k is
+// record k % navg of channel k / navg, and channel c averages into row c of
+// out_data.  The records are split into contiguous blocks (see
+// record_blocks()) that are windowed and transformed, and then the bins are
+// split into ranges that are reduced; with more than one thread (see
+// set_num_threads()) the blocks and ranges run concurrently.  Every bin is
+// accumulated in record order, so the result is bit-identical for any thread
+// count.
+//
+// prepare(k, n) normalizes and windows records [k, k + n) into fftw_data.  If
+// msq is true, each row of out_data is the mean-square spectrum (nfft or
+// nfft / 2 + 1 elements); otherwise it is the interleaved Re/Im spectrum.
+template <typename R, typename Prepare>
+void averaged_fft(const Prepare &prepare, R *fftw_data, R *out_data,
+		size_t nch, size_t navg, size_t nfft, bool msq) {
+	const size_t nrec = nch * navg;
+	const size_t nblocks = record_blocks(nrec, nfft);
+	const size_t row_stride = nfft * 2;
+	for_each_block(nblocks, [&](size_t b) {
+		auto [first, last] = partition_range(nrec, nblocks, b);
+		prepare(first, last - first);
+		exec_fftw(fftw_data + first * row_stride, last - first, nfft);
+	});
+	if (1 == navg && !msq) {
+		for (size_t c = 0; c < nch; ++c) {
+			scale_fft(out_data + c * row_stride, nfft);
+		}
+		return;
+	}
+	auto reduce = [&](size_t first, size_t last) {
+		for (size_t c = 0; c < nch; ++c) {
+			const R *ch_data = fftw_data + c * navg * row_stride;
+			if (msq) {
+				reduce_msq_fft(ch_data, out_data + c * nfft, navg, nfft,
+						first, last);
+			} else {
+				reduce_and_scale_fft(ch_data, out_data + c * row_stride,
+						navg, nfft, first, last);
+			}
+		}
+	};
+	for_each_block(nblocks, [&](size_t b) {
+		auto [first, last] = partition_range(nfft, nblocks, b);
+		reduce(first, last);
+	});
+}
+
+// See averaged_fft
+template <typename R, typename Prepare>
+void averaged_rfft(const Prepare &prepare, R *fftw_data, R *out_data,
+		size_t nch, size_t navg, size_t nfft, RfftScale scale, bool msq) {
+	const size_t nrec = nch * navg;
+	const size_t nblocks = record_blocks(nrec, nfft);
+	const size_t nbins = nfft / 2 + 1;
+	const size_t row_stride = nbins * 2;
+	for_each_block(nblocks, [&](size_t b) {
+		auto [first, last] = partition_range(nrec, nblocks, b);
+		prepare(first, last - first);
+		exec_rfftw(fftw_data + first * row_stride, last - first, nfft);
+	});
+	if (1 == navg && !msq) {
+		for (size_t c = 0; c < nch; ++c) {
+			scale_rfft(out_data + c * row_stride, nfft, scale);
+		}
+		return;
+	}
+	auto reduce = [&](size_t first, size_t last) {
+		for (size_t c = 0; c < nch; ++c) {
+			const R *ch_data = fftw_data + c * navg * row_stride;
+			if (msq) {
+				reduce_msq_rfft(ch_data, out_data + c * nbins, navg, nfft,
+						scale, first, last);
+			} else {
+				reduce_and_scale_rfft(ch_data, out_data + c * row_stride,
+						navg, nfft, scale, first, last);
+			}
+		}
+	};
+	for_each_block(nblocks, [&](size_t b) {
+		auto [first, last] = partition_range(nbins, nblocks, b);
+		reduce(first, last);
+	});
+}
+
+// Splits records [k, k + n) of a channel-major batch into runs that lie in a
+// single channel, and calls f(c, j, m) for records [j, j + m) of channel c.
+template <typename F>
+void for_each_channel_run(size_t k, size_t n, size_t navg, const F &f) {
+	while (0 < n) {
+		const size_t c = k / navg;
+		const size_t j = k % navg;
+		const size_t m = std::min(n, navg - j);
+		f(c, j, m);
+		k += m;
+		n -= m;
+	}
+}
+
+} // namespace
+
+namespace { // Transform Implementations
+
+// If not averaging (1 == navg) and out_data holds the Re/Im spectrum, the FFT
+// is computed in place in out_data.  Otherwise, the normalized/windowed
+// records and their FFTs need navg * spec_size elements, where spec_size is
+// the Re/Im spectrum size of all channels: the caller's work array if one is
+// given, or else a temporary that is allocated here.
+template <typename R>
+R *select_work(std::vector<R> &tmp, R *work, size_t work_size, R *out_data,
+		size_t spec_size, size_t navg, bool msq) {
+	if (1 == navg && !msq) {
+		return out_data;
+	}
+	const size_t size = navg * spec_size;
+	if (nullptr == work) {
+		tmp.resize(size);
+		return tmp.data();
+	}
+	if (work_size < size) {
+		throw runtime_error("work array size (" + std::to_string(work_size) +
+				") is less than required (" + std::to_string(size) + ")");
+	}
+	return work;
+}
+
+// The quantized-input functions are shared by the double- and
+// single-precision public functions; R is the precision of the work array and
+// of the output spectrum.
+//
+// Each function transforms nch channels whose inputs start ch_stride elements
+// apart; i_size, q_size, and in_size are the sizes of one channel.  out_data
+// holds one output row per channel: the Re/Im spectrum, or if msq is true, the
+// mean-square spectrum (half the size).  If table is not nullptr, it holds the
+// window coefficients and window is ignored (see select_window()).
+
+template <typename T, typename R>
+void fft_quantized(const T *i_data, size_t i_size, const T *q_data,
+		size_t q_size, R *out_data, size_t out_size, int n, size_t navg,
+		size_t nfft, Window window, CodeFormat format, R *work,
+		size_t work_size, bool msq = false, size_t nch = 1,
+		size_t ch_stride = 0, const std::vector<R> *table = nullptr) {
 	size_t in_stride = 1;
 	if (0 == q_size) {
 		// Interleaved I/Q
@@ -732,46 +911,85 @@ void fft(const real_t *i_data, size_t i_size, const real_t *q_data,
 				q_data, q_size);
 	}
 	check_array("", "output array", out_data, out_size);
-	size_t out_size_expected = fft_size(i_size, q_size, navg,
+	const size_t row_stride = fft_size(i_size, q_size, navg,
 			nfft); // may modify navg and nfft
 	assert_eq("", "output array size", out_size, "expected",
-			out_size_expected);
-	// If not averaging (1 == navg), use out_data directly.  Otherwise, allocate
-	// temporary array to store result of normalization/windowing and FFT.  For
-	// example,
+			nch * (msq ? row_stride / 2 : row_stride));
+	check_code_width("", n);
+	// For example,
 	//   navg = 4, nfft = 16
 	//   => i_size = 64
 	//      q_size = 64
 	//      out_size = 16 * 2 = 32
-	//      tmp.size = navg * out_size = 128
-	std::vector<real_t> tmp((1 == navg) ? 0 : 2 * i_size);
-	real_t *fftw_data = (1 == navg) ? out_data : tmp.data();
-	switch (window) {
-		case Window::BlackmanHarris:
-			blackman_harris(i_data, q_data, fftw_data, in_stride, navg,
-					nfft);
-			break;
-		case Window::Hann:
-			hann(i_data, q_data, fftw_data, in_stride, navg, nfft);
-			break;
-		case Window::NoWindow:
-			no_window(i_data, q_data, fftw_data, in_stride, navg, nfft);
-			break;
-		default:
-			throw runtime_error("unsupported window");
-	}
-	exec_fftw(fftw_data, navg, nfft);
-	if (1 == navg) {
-		scale_fft(out_data, nfft);
-	} else {
-		reduce_and_scale_fft(fftw_data, out_data, navg, nfft);
-	}
+	//      work size = navg * out_size = 128 (per channel)
+	std::vector<R> tmp;
+	R *fftw_data = select_work(tmp, work, work_size, out_data,
+			nch * row_stride, navg, msq);
+	window_table<R> cached;
+	const std::vector<R> *win =
+			select_window(table, cached, window, nfft, RfftScale::Native);
+	const size_t in_row_stride = nfft * in_stride;
+	auto prepare = [&](size_t k, size_t nrec) {
+		for_each_channel_run(k, nrec, navg,
+				[&](size_t c, size_t j, size_t m) {
+			const T *pi = i_data + c * ch_stride + j * in_row_stride;
+			const T *pq = q_data + c * ch_stride + j * in_row_stride;
+			R *po = fftw_data + (c * navg + j) * row_stride;
+			if (win) {
+				norm_apply_window(win->data(), pi, pq, po, in_stride, n, m,
+						nfft, format);
+			} else {
+				norm_no_window(pi, pq, po, in_stride, n, m, nfft, format);
+			}
+		});
+	};
+	averaged_fft(prepare, fftw_data, out_data, nch, navg, nfft, msq);
 }
 
-template <typename T>
-void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
-		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
-		Window window, CodeFormat format) {
+template <typename T, typename R>
+void rfft_quantized(const T *in_data, size_t in_size, R *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format, RfftScale scale, R *work, size_t work_size,
+		bool msq = false, size_t nch = 1, size_t ch_stride = 0,
+		const std::vector<R> *table = nullptr) {
+	check_array("", "input array", in_data, in_size);
+	check_array("", "output array", out_data, out_size);
+	const size_t row_stride = rfft_size(in_size, navg, nfft);
+	assert_eq("", "output array size", out_size, "expected",
+			nch * (msq ? row_stride / 2 : row_stride));
+	check_code_width("", n);
+	// For example,
+	//   navg = 4, nfft = 16
+	//   => in_size = 64
+	//      out_size = (16/2 + 1) * 2 = 18
+	//      work size = navg * out_size = 72 (per channel)
+	std::vector<R> tmp;
+	R *fftw_data = select_work(tmp, work, work_size, out_data,
+			nch * row_stride, navg, msq);
+	window_table<R> cached;
+	const std::vector<R> *win =
+			select_window(table, cached, window, nfft, scale);
+	auto prepare = [&](size_t k, size_t nrec) {
+		for_each_channel_run(k, nrec, navg,
+				[&](size_t c, size_t j, size_t m) {
+			const T *pi = in_data + c * ch_stride + j * nfft;
+			R *po = fftw_data + (c * navg + j) * row_stride;
+			if (win) {
+				norm_apply_window(win->data(), pi, po, n, m, nfft, format);
+			} else {
+				norm_no_window(pi, po, n, m, nfft, format, scale);
+			}
+		});
+	};
+	averaged_rfft(prepare, fftw_data, out_data, nch, navg, nfft, scale,
+			msq);
+}
+
+void fft_normalized(const real_t *i_data, size_t i_size,
+		const real_t *q_data, size_t q_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window,
+		real_t *work, size_t work_size, bool msq = false, size_t nch = 1,
+		size_t ch_stride = 0, const std::vector<real_t> *table = nullptr) {
 	size_t in_stride = 1;
 	if (0 == q_size) {
 		// Interleaved I/Q
@@ -786,43 +1004,80 @@ void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
 				q_data, q_size);
 	}
 	check_array("", "output array", out_data, out_size);
-	size_t out_size_expected = fft_size(i_size, q_size, navg,
+	const size_t row_stride = fft_size(i_size, q_size, navg,
 			nfft); // may modify navg and nfft
 	assert_eq("", "output array size", out_size, "expected",
-			out_size_expected);
-	check_code_width("", n);
-	// If not averaging (1 == navg), use out_data directly.  Otherwise, allocate
-	// temporary array to store result of normalization/windowing and FFT.  For
-	// example,
-	//   navg = 4, nfft = 16
-	//   => i_size = 64
-	//      q_size = 64
-	//      out_size = 16 * 2 = 32
-	//      tmp.size = navg * out_size = 128
-	std::vector<real_t> tmp((1 == navg) ? 0 : 2 * i_size);
-	real_t *fftw_data = (1 == navg) ? out_data : tmp.data();
-	switch (window) {
-		case Window::BlackmanHarris:
-			norm_blackman_harris(i_data, q_data, fftw_data, in_stride, n,
-					navg, nfft, format);
-			break;
-		case Window::Hann:
-			norm_hann(i_data, q_data, fftw_data, in_stride, n, navg, nfft,
-					format);
-			break;
-		case Window::NoWindow:
-			norm_no_window(i_data, q_data, fftw_data, in_stride, n, navg,
-					nfft, format);
-			break;
-		default:
-			throw runtime_error("unsupported window");
-	}
-	exec_fftw(fftw_data, navg, nfft);
-	if (1 == navg) {
-		scale_fft(out_data, nfft);
-	} else {
-		reduce_and_scale_fft(fftw_data, out_data, navg, nfft);
-	}
+			nch * (msq ? row_stride / 2 : row_stride));
+	std::vector<real_t> tmp;
+	real_t *fftw_data = select_work(tmp, work, work_size, out_data,
+			nch * row_stride, navg, msq);
+	window_table<real_t> cached;
+	const std::vector<real_t> *win =
+			select_window(table, cached, window, nfft, RfftScale::Native);
+	const size_t in_row_stride = nfft * in_stride;
+	auto prepare = [&](size_t k, size_t nrec) {
+		for_each_channel_run(k, nrec, navg,
+				[&](size_t c, size_t j, size_t m) {
+			const real_t *pi = i_data + c * ch_stride + j * in_row_stride;
+			const real_t *pq = q_data + c * ch_stride + j * in_row_stride;
+			real_t *po = fftw_data + (c * navg + j) * row_stride;
+			if (win) {
+				apply_window(win->data(), pi, pq, po, in_stride, m, nfft);
+			} else {
+				no_window(pi, pq, po, in_stride, m, nfft);
+			}
+		});
+	};
+	averaged_fft(prepare, fftw_data, out_data, nch, navg, nfft, msq);
+}
+
+void rfft_normalized(const real_t *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window,
+		RfftScale scale, real_t *work, size_t work_size, bool msq = false,
+		size_t nch = 1, size_t ch_stride = 0,
+		const std::vector<real_t> *table = nullptr) {
+	check_array("", "input array", in_data, in_size);
+	check_array("", "output array", out_data, out_size);
+	const size_t row_stride = rfft_size(in_size, navg, nfft);
+	assert_eq("", "output array size", out_size, "expected",
+			nch * (msq ? row_stride / 2 : row_stride));
+	std::vector<real_t> tmp;
+	real_t *fftw_data = select_work(tmp, work, work_size, out_data,
+			nch * row_stride, navg, msq);
+	window_table<real_t> cached;
+	const std::vector<real_t> *win =
+			select_window(table, cached, window, nfft, scale);
+	auto prepare = [&](size_t k, size_t nrec) {
+		for_each_channel_run(k, nrec, navg,
+				[&](size_t c, size_t j, size_t m) {
+			const real_t *pi = in_data + c * ch_stride + j * nfft;
+			real_t *po = fftw_data + (c * navg + j) * row_stride;
+			if (win) {
+				apply_window(win->data(), pi, po, m, nfft);
+			} else {
+				no_window(pi, po, m, nfft, scale);
+			}
+		});
+	};
+	averaged_rfft(prepare, fftw_data, out_data, nch, navg, nfft, scale,
+			msq);
+}
+
+} // namespace
+
+void fft(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, Window window) {
+	fft_normalized(i_data, i_size, q_data, q_size, out_data, out_size, navg,
+			nfft, window, nullptr, 0);
+}
+
+template <typename T>
+void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		Window window, CodeFormat format) {
+	fft_quantized(i_data, i_size, q_data, q_size, out_data, out_size, n,
+			navg, nfft, window, format, static_cast<real_t *>(nullptr), 0);
 }
 
 template void fft(const int16_t *, size_t, const int16_t *, size_t, real_t *,
@@ -835,80 +1090,16 @@ template void fft(const int64_t *, size_t, const int64_t *, size_t, real_t *,
 void rfft(const real_t *in_data, size_t in_size, real_t *out_data,
 		size_t out_size, size_t navg, size_t nfft, Window window,
 		RfftScale scale) {
-	check_array("", "input array", in_data, in_size);
-	check_array("", "output array", out_data, out_size);
-	size_t out_size_expected = rfft_size(in_size, navg, nfft);
-	assert_eq("", "output array size", out_size, "expected",
-			out_size_expected);
-	// If not averaging (1 == navg), use out_data directly.  Otherwise, allocate
-	// temporary array to store result of windowing and FFT.  For example,
-	//   navg = 4, nfft = 16
-	//   => in_size = 64
-	//      out_size = (16/2 + 1) * 2 = 18
-	//      tmp.size = navg * out_size = 72
-	std::vector<real_t> tmp((1 == navg) ? 0 : navg * out_size);
-	real_t *fftw_data = (1 == navg) ? out_data : tmp.data();
-	switch (window) {
-		case Window::BlackmanHarris:
-			blackman_harris(in_data, fftw_data, navg, nfft, scale);
-			break;
-		case Window::Hann:
-			hann(in_data, fftw_data, navg, nfft, scale);
-			break;
-		case Window::NoWindow:
-			no_window(in_data, fftw_data, navg, nfft, scale);
-			break;
-		default:
-			throw runtime_error("unsupported window");
-	}
-	exec_rfftw(fftw_data, navg, nfft);
-	if (1 == navg) {
-		scale_rfft(out_data, nfft, scale);
-	} else {
-		reduce_and_scale_rfft(fftw_data, out_data, navg, nfft, scale);
-	}
+	rfft_normalized(in_data, in_size, out_data, out_size, navg, nfft, window,
+			scale, nullptr, 0);
 }
 
 template <typename T>
 void rfft(const T *in_data, size_t in_size, real_t *out_data, size_t out_size,
 		int n, size_t navg, size_t nfft, Window window, CodeFormat format,
 		RfftScale scale) {
-	check_array("", "input array", in_data, in_size);
-	check_array("", "output array", out_data, out_size);
-	size_t out_size_expected = rfft_size(in_size, navg, nfft);
-	assert_eq("", "output array size", out_size, "expected",
-			out_size_expected);
-	check_code_width("", n);
-	// If not averaging (1 == navg), use out_data directly.  Otherwise, allocate
-	// temporary array to store result of normalization/windowing and FFT.  For
-	// example,
-	//   navg = 4, nfft = 16
-	//   => in_size = 64
-	//      out_size = (16/2 + 1) * 2 = 18
-	//      tmp.size = navg * out_size = 72
-	std::vector<real_t> tmp((1 == navg) ? 0 : navg * out_size);
-	real_t *fftw_data = (1 == navg) ? out_data : tmp.data();
-	switch (window) {
-		case Window::BlackmanHarris:
-			norm_blackman_harris(in_data, fftw_data, n, navg, nfft, format,
-					scale);
-			break;
-		case Window::Hann:
-			norm_hann(in_data, fftw_data, n, navg, nfft, format, scale);
-			break;
-		case Window::NoWindow:
-			norm_no_window(in_data, fftw_data, n, navg, nfft, format,
-					scale);
-			break;
-		default:
-			throw runtime_error("unsupported window");
-	}
-	exec_rfftw(fftw_data, navg, nfft);
-	if (1 == navg) {
-		scale_rfft(out_data, nfft, scale);
-	} else {
-		reduce_and_scale_rfft(fftw_data, out_data, navg, nfft, scale);
-	}
+	rfft_quantized(in_data, in_size, out_data, out_size, n, navg, nfft,
+			window, format, scale, static_cast<real_t *>(nullptr), 0);
 }
 
 template void rfft(const int16_t *, size_t, real_t *, size_t, int, size_t,
@@ -918,6 +1109,461 @@ template void rfft(const int32_t *, size_t, real_t *, size_t, int, size_t,
 template void rfft(const int64_t *, size_t, real_t *, size_t, int, size_t,
 		size_t, Window, CodeFormat, RfftScale);
 
+#ifndef GENALYZER_FFTW_FLOAT
+namespace {
+
+[[noreturn]] void throw_no_single_precision() {
+	throw runtime_error("single-precision FFTs are not available: genalyzer "
+						"was built without the FFTW float library");
+}
+
+} // namespace
+#endif
+
+void fft(const int16_t *i_data, size_t i_size, const int16_t *q_data,
+		size_t q_size, float *out_data, size_t out_size, int n, size_t navg,
+		size_t nfft, Window window, CodeFormat format) {
+#ifdef GENALYZER_FFTW_FLOAT
+	fft_quantized(i_data, i_size, q_data, q_size, out_data, out_size, n,
+			navg, nfft, window, format, static_cast<float *>(nullptr), 0);
+#else
+	throw_no_single_precision();
+#endif
+}
+
+void rfft(const int16_t *in_data, size_t in_size, float *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format, RfftScale scale) {
+#ifdef GENALYZER_FFTW_FLOAT
+	rfft_quantized(in_data, in_size, out_data, out_size, n, navg, nfft,
+			window, format, scale, static_cast<float *>(nullptr), 0);
+#else
+	throw_no_single_precision();
+#endif
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Caller-Provided Work Arrays
+
+void fft(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, const window_coefficients &win, real_t *work,
+		size_t work_size) {
+	fft_normalized(i_data, i_size, q_data, q_size, out_data, out_size, navg,
+			nfft, Window::NoWindow, work, work_size, false, 1, 0,
+			win.get());
+}
+
+template <typename T>
+void fft(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		const window_coefficients &win, CodeFormat format, real_t *work,
+		size_t work_size) {
+	fft_quantized(i_data, i_size, q_data, q_size, out_data, out_size, n,
+			navg, nfft, Window::NoWindow, format, work, work_size, false, 1,
+			0, win.get());
+}
+
+template void fft(const int16_t *, size_t, const int16_t *, size_t, real_t *,
+		size_t, int, size_t, size_t, const window_coefficients &, CodeFormat,
+		real_t *, size_t);
+template void fft(const int32_t *, size_t, const int32_t *, size_t, real_t *,
+		size_t, int, size_t, size_t, const window_coefficients &, CodeFormat,
+		real_t *, size_t);
+template void fft(const int64_t *, size_t, const int64_t *, size_t, real_t *,
+		size_t, int, size_t, size_t, const window_coefficients &, CodeFormat,
+		real_t *, size_t);
+
+void rfft(const real_t *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft,
+		const window_coefficients &win, RfftScale scale, real_t *work,
+		size_t work_size) {
+	rfft_normalized(in_data, in_size, out_data, out_size, navg, nfft,
+			Window::NoWindow, scale, work, work_size, false, 1, 0, win.get());
+}
+
+template <typename T>
+void rfft(const T *in_data, size_t in_size, real_t *out_data, size_t out_size,
+		int n, size_t navg, size_t nfft, const window_coefficients &win,
+		CodeFormat format, RfftScale scale, real_t *work, size_t work_size) {
+	rfft_quantized(in_data, in_size, out_data, out_size, n, navg, nfft,
+			Window::NoWindow, format, scale, work, work_size, false, 1, 0,
+			win.get());
+}
+
+template void rfft(const int16_t *, size_t, real_t *, size_t, int, size_t,
+		size_t, const window_coefficients &, CodeFormat, RfftScale, real_t *,
+		size_t);
+template void rfft(const int32_t *, size_t, real_t *, size_t, int, size_t,
+		size_t, const window_coefficients &, CodeFormat, RfftScale, real_t *,
+		size_t);
+template void rfft(const int64_t *, size_t, real_t *, size_t, int, size_t,
+		size_t, const window_coefficients &, CodeFormat, RfftScale, real_t *,
+		size_t);
+
+size_t fft_work_size(size_t navg, size_t nfft) {
+	return (1 < navg) ? navg * nfft * 2 : 0;
+}
+
+size_t rfft_work_size(size_t navg, size_t nfft) {
+	return (1 < navg) ? navg * (nfft / 2 + 1) * 2 : 0;
+}
+
+window_coefficients fft_window_coefficients(Window window, size_t nfft,
+		RfftScale scale) {
+	assert_gt0("", "nfft", nfft);
+	if (Window::NoWindow == window) {
+		return nullptr;
+	}
+	return get_window_table<real_t>(window, nfft, scale);
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Batched Multi-Channel Transforms
+
+namespace {
+
+// Checks an input array that holds nch channels of ch_size elements each, the
+// first element of each channel stride elements after that of the previous
+// one.  Returns the resolved stride (ch_size if stride is 0).
+size_t check_batch(const char *name, size_t size, size_t nch, size_t stride,
+		size_t ch_size) {
+	if (0 == stride) {
+		stride = ch_size;
+	} else if (stride < ch_size) {
+		throw runtime_error("channel stride (" + std::to_string(stride) +
+				") is less than channel size (" + std::to_string(ch_size) +
+				")");
+	}
+	const size_t required = (nch - 1) * stride + ch_size;
+	if (size < required) {
+		throw runtime_error(str_t(name) + " size (" + std::to_string(size) +
+				") is less than required (" + std::to_string(required) + ")");
+	}
+	return stride;
+}
+
+// Resolves the per-channel input size and channel stride of a complex batch.
+// On return, i_size and q_size are the sizes of one channel.
+size_t check_fft_batch(size_t &i_size, size_t &q_size, size_t nch,
+		size_t stride, size_t navg, size_t nfft) {
+	assert_gt0("", "number of channels", nch);
+	assert_gt0("", "navg", navg);
+	assert_gt0("", "nfft", nfft);
+	const size_t ch_size = navg * nfft * (0 == q_size ? 2 : 1);
+	stride = check_batch("I array", i_size, nch, stride, ch_size);
+	if (0 < q_size) {
+		check_batch("Q array", q_size, nch, stride, ch_size);
+		q_size = ch_size;
+	}
+	i_size = ch_size;
+	return stride;
+}
+
+// See check_fft_batch
+size_t check_rfft_batch(size_t &in_size, size_t nch, size_t stride,
+		size_t navg, size_t nfft) {
+	assert_gt0("", "number of channels", nch);
+	assert_gt0("", "navg", navg);
+	assert_gt0("", "nfft", nfft);
+	const size_t ch_size = navg * nfft;
+	stride = check_batch("input array", in_size, nch, stride, ch_size);
+	in_size = ch_size;
+	return stride;
+}
+
+} // namespace
+
+void fft_batch(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, size_t nch, size_t stride, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window) {
+	stride = check_fft_batch(i_size, q_size, nch, stride, navg, nfft);
+	fft_normalized(i_data, i_size, q_data, q_size, out_data, out_size, navg,
+			nfft, window, nullptr, 0, false, nch, stride);
+}
+
+template <typename T>
+void fft_batch(const T *i_data, size_t i_size, const T *q_data,
+		size_t q_size, size_t nch, size_t stride, real_t *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format) {
+	stride = check_fft_batch(i_size, q_size, nch, stride, navg, nfft);
+	fft_quantized(i_data, i_size, q_data, q_size, out_data, out_size, n,
+			navg, nfft, window, format, static_cast<real_t *>(nullptr), 0,
+			false, nch, stride);
+}
+
+template void fft_batch(const int16_t *, size_t, const int16_t *, size_t,
+		size_t, size_t, real_t *, size_t, int, size_t, size_t, Window,
+		CodeFormat);
+template void fft_batch(const int32_t *, size_t, const int32_t *, size_t,
+		size_t, size_t, real_t *, size_t, int, size_t, size_t, Window,
+		CodeFormat);
+template void fft_batch(const int64_t *, size_t, const int64_t *, size_t,
+		size_t, size_t, real_t *, size_t, int, size_t, size_t, Window,
+		CodeFormat);
+
+void rfft_batch(const real_t *in_data, size_t in_size, size_t nch,
+		size_t stride, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, Window window, RfftScale scale) {
+	stride = check_rfft_batch(in_size, nch, stride, navg, nfft);
+	rfft_normalized(in_data, in_size, out_data, out_size, navg, nfft, window,
+			scale, nullptr, 0, false, nch, stride);
+}
+
+template <typename T>
+void rfft_batch(const T *in_data, size_t in_size, size_t nch, size_t stride,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		Window window, CodeFormat format, RfftScale scale) {
+	stride = check_rfft_batch(in_size, nch, stride, navg, nfft);
+	rfft_quantized(in_data, in_size, out_data, out_size, n, navg, nfft,
+			window, format, scale, static_cast<real_t *>(nullptr), 0,
+			false, nch, stride);
+}
+
+template void rfft_batch(const int16_t *, size_t, size_t, size_t, real_t *,
+		size_t, int, size_t, size_t, Window, CodeFormat, RfftScale);
+template void rfft_batch(const int32_t *, size_t, size_t, size_t, real_t *,
+		size_t, int, size_t, size_t, Window, CodeFormat, RfftScale);
+template void rfft_batch(const int64_t *, size_t, size_t, size_t, real_t *,
+		size_t, int, size_t, size_t, Window, CodeFormat, RfftScale);
+
+size_t fft_batch_size(size_t nch, size_t nfft) {
+	return nch * nfft * 2;
+}
+
+size_t rfft_batch_size(size_t nch, size_t nfft) {
+	return nch * (nfft / 2 + 1) * 2;
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Mean-Square Output
+
+void fft_msq(const real_t *i_data, size_t i_size, const real_t *q_data,
+		size_t q_size, real_t *out_data, size_t out_size, size_t navg,
+		size_t nfft, Window window) {
+	fft_normalized(i_data, i_size, q_data, q_size, out_data, out_size, navg,
+			nfft, window, nullptr, 0, true);
+}
+
+template <typename T>
+void fft_msq(const T *i_data, size_t i_size, const T *q_data, size_t q_size,
+		real_t *out_data, size_t out_size, int n, size_t navg, size_t nfft,
+		Window window, CodeFormat format) {
+	fft_quantized(i_data, i_size, q_data, q_size, out_data, out_size, n,
+			navg, nfft, window, format, static_cast<real_t *>(nullptr), 0,
+			true);
+}
+
+template void fft_msq(const int16_t *, size_t, const int16_t *, size_t,
+		real_t *, size_t, int, size_t, size_t, Window, CodeFormat);
+template void fft_msq(const int32_t *, size_t, const int32_t *, size_t,
+		real_t *, size_t, int, size_t, size_t, Window, CodeFormat);
+template void fft_msq(const int64_t *, size_t, const int64_t *, size_t,
+		real_t *, size_t, int, size_t, size_t, Window, CodeFormat);
+
+void rfft_msq(const real_t *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window,
+		RfftScale scale) {
+	rfft_normalized(in_data, in_size, out_data, out_size, navg, nfft, window,
+			scale, nullptr, 0, true);
+}
+
+template <typename T>
+void rfft_msq(const T *in_data, size_t in_size, real_t *out_data,
+		size_t out_size, int n, size_t navg, size_t nfft, Window window,
+		CodeFormat format, RfftScale scale) {
+	rfft_quantized(in_data, in_size, out_data, out_size, n, navg, nfft,
+			window, format, scale, static_cast<real_t *>(nullptr), 0, true);
+}
+
+template void rfft_msq(const int16_t *, size_t, real_t *, size_t, int,
+		size_t, size_t, Window, CodeFormat, RfftScale);
+template void rfft_msq(const int32_t *, size_t, real_t *, size_t, int,
+		size_t, size_t, Window, CodeFormat, RfftScale);
+template void rfft_msq(const int64_t *, size_t, real_t *, size_t, int,
+		size_t, size_t, Window, CodeFormat, RfftScale);
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Selected Mean-Square Bins
+
+namespace {
+
+// Each bin is a DFT sum over blocks of sparse_block samples.  Within a block,
+// the sum is a dot product of the windowed samples with a per-bin table of
+// exp(-j w n), so there is no recursion (as in Goertzel) to limit
+// instruction-level parallelism or to accumulate error.  Each block sum is
+// then rotated to the block offset by a per-bin phasor, which steps by one
+// block at a time and is recomputed exactly every sparse_anchor blocks.
+const size_t sparse_block = 64;
+const size_t sparse_anchor = 64;
+const size_t sparse_lanes = 4;
+
+using cplx_t = std::complex<real_t>;
+
+// exp(-j 2 pi k n / nfft); k * n is reduced modulo nfft exactly (nfft < 2^32)
+cplx_t dft_phasor(size_t k, size_t n, size_t nfft) {
+	const size_t t = ((k % nfft) * (n % nfft)) % nfft;
+	return std::polar(1.0,
+			-k_2pi * static_cast<real_t>(t) / static_cast<real_t>(nfft));
+}
+
+// Sum of a[j] * b[j] over a block, in independent partial sums
+real_t block_dot(const real_t *a, const real_t *b) {
+	real_t acc[sparse_lanes] = {};
+	for (size_t j = 0; j < sparse_block; j += sparse_lanes) {
+		for (size_t l = 0; l < sparse_lanes; ++l) {
+			acc[l] += a[j + l] * b[j + l];
+		}
+	}
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+// DFT sums of one record over blocks [b1, b2), for every bin, plus the sums of
+// y, (-1)^n y, and y^2 of the windowed record y.
+struct sparse_sums {
+	std::vector<cplx_t> bins;
+	real_t sum = 0.0;
+	real_t alt = 0.0;
+	real_t sumsq = 0.0;
+};
+
+void sparse_dft(const real_t *in_data, const real_t *win, real_t scalar,
+		size_t nfft, const size_t *bins, size_t bins_size,
+		const std::vector<real_t> &table, const std::vector<cplx_t> &steps,
+		size_t b1, size_t b2, sparse_sums &sums) {
+	alignas(64) real_t y[sparse_block];
+	alignas(64) real_t alt_sign[sparse_block];
+	alignas(64) real_t ones[sparse_block];
+	for (size_t j = 0; j < sparse_block; ++j) {
+		alt_sign[j] = is_odd(j) ? -1.0 : 1.0; // sparse_block is even
+		ones[j] = 1.0;
+	}
+	std::vector<cplx_t> phasors(bins_size);
+	sums.bins.assign(bins_size, 0.0);
+	sums.sum = 0.0;
+	sums.alt = 0.0;
+	sums.sumsq = 0.0;
+	for (size_t b = b1; b < b2; ++b) {
+		const size_t n0 = b * sparse_block;
+		const size_t m = std::min(sparse_block, nfft - n0);
+		if (win) {
+			for (size_t j = 0; j < m; ++j) {
+				y[j] = win[n0 + j] * in_data[n0 + j];
+			}
+		} else {
+			for (size_t j = 0; j < m; ++j) {
+				y[j] = scalar * in_data[n0 + j];
+			}
+		}
+		std::fill(y + m, y + sparse_block, 0.0);
+		sums.sum += block_dot(y, ones);
+		sums.alt += block_dot(y, alt_sign);
+		sums.sumsq += block_dot(y, y);
+		const bool anchor = 0 == (b - b1) % sparse_anchor;
+		for (size_t i = 0; i < bins_size; ++i) {
+			phasors[i] = anchor ? dft_phasor(bins[i], n0, nfft)
+								: phasors[i] * steps[i];
+			const real_t *ct = table.data() + 2 * i * sparse_block;
+			const real_t *st = ct + sparse_block;
+			sums.bins[i] += phasors[i] *
+					cplx_t(block_dot(y, ct), block_dot(y, st));
+		}
+	}
+}
+
+} // namespace
+
+real_t rfft_msq_bins(const real_t *in_data, size_t in_size,
+		const size_t *bins, size_t bins_size, real_t *out_data,
+		size_t out_size, size_t navg, size_t nfft, Window window,
+		RfftScale scale) {
+	check_array("", "input array", in_data, in_size);
+	check_array("", "bins array", bins, bins_size);
+	check_array("", "output array", out_data, out_size);
+	assert_eq("", "output array size", out_size, "bins array size",
+			bins_size);
+	rfft_size(in_size, navg, nfft); // may modify navg and nfft
+	const size_t nbins = nfft / 2 + 1;
+	for (size_t i = 0; i < bins_size; ++i) {
+		if (nbins <= bins[i]) {
+			throw runtime_error("bin " + std::to_string(bins[i]) +
+					" is out of range [0, " + std::to_string(nbins) + ")");
+		}
+	}
+	window_table<real_t> win;
+	if (Window::NoWindow != window) {
+		win = get_window_table<real_t>(window, nfft, scale);
+	}
+	const real_t scalar = (RfftScale::DbfsSin == scale) ? k_sqrt2 : 1.0;
+	// Per bin: cos, then -sin, of w * j for j in [0, sparse_block); and the
+	// phasor step from one block to the next
+	std::vector<real_t> table(2 * sparse_block * bins_size);
+	std::vector<cplx_t> steps(bins_size);
+	for (size_t i = 0; i < bins_size; ++i) {
+		real_t *ct = table.data() + 2 * i * sparse_block;
+		for (size_t j = 0; j < sparse_block; ++j) {
+			const cplx_t p = dft_phasor(bins[i], j, nfft);
+			ct[j] = p.real();
+			ct[sparse_block + j] = p.imag();
+		}
+		steps[i] = dft_phasor(bins[i], sparse_block, nfft);
+	}
+	const size_t nblocks = (nfft + sparse_block - 1) / sparse_block;
+	const size_t nparts = (nfft < min_parallel_samples)
+			? 1
+			: std::min(get_num_threads(), nblocks);
+	std::vector<sparse_sums> parts(nparts);
+	std::fill(out_data, out_data + out_size, 0.0);
+	real_t total = 0.0;
+	const real_t nfft_r = static_cast<real_t>(nfft);
+	const bool even = is_even(nfft);
+	for (size_t r = 0; r < navg; ++r) {
+		const real_t *rec = in_data + r * nfft;
+		parallel_for(nparts, [&](size_t part) {
+			auto [b1, b2] = partition_range(nblocks, nparts, part);
+			sparse_dft(rec, win ? win->data() : nullptr, scalar, nfft, bins,
+					bins_size, table, steps, b1, b2, parts[part]);
+		});
+		sparse_sums &s = parts[0];
+		for (size_t part = 1; part < nparts; ++part) {
+			for (size_t i = 0; i < bins_size; ++i) {
+				s.bins[i] += parts[part].bins[i];
+			}
+			s.sum += parts[part].sum;
+			s.alt += parts[part].alt;
+			s.sumsq += parts[part].sumsq;
+		}
+		for (size_t i = 0; i < bins_size; ++i) {
+			out_data[i] += std::norm(s.bins[i]);
+		}
+		// Parseval: the two-sided spectrum sums to nfft * sumsq.  Bin 0 and,
+		// if nfft is even, bin nfft/2 are not mirrored in the one-sided
+		// spectrum.
+		const real_t unpaired = s.sum * s.sum + (even ? s.alt * s.alt : 0.0);
+		if (RfftScale::Native == scale) {
+			total += (nfft_r * s.sumsq + unpaired) / 2;
+		} else {
+			total += nfft_r * s.sumsq;
+		}
+	}
+	// Same scaling as reduce_msq_rfft
+	const real_t s = (RfftScale::Native == scale) ? 1.0 : 2.0;
+	const real_t scalar_msq = s / (static_cast<real_t>(navg) * nfft_r * nfft_r);
+	for (size_t i = 0; i < bins_size; ++i) {
+		out_data[i] *= scalar_msq;
+		if (RfftScale::Native != scale &&
+				(0 == bins[i] || (1 < nfft && even && nbins - 1 == bins[i]))) {
+			out_data[i] /= 2;
+		}
+	}
+	return total / (static_cast<real_t>(navg) * nfft_r * nfft_r);
+}
+
 } // namespace genalyzer_impl
 
 namespace genalyzer_impl {
@@ -987,4 +1633,75 @@ size_t rfft_size(size_t in_size, size_t &navg, size_t &nfft) {
 	return size;
 }
 
+FftPlanner get_fft_planner() {
+	return fft_planner_setting().load();
+}
+
+void set_fft_planner(FftPlanner planner) {
+	fft_planner_setting().store(planner);
+}
+
+void fft_wisdom_export(const str_t &filename) {
+	std::lock_guard<std::mutex> lock(plan_cache_mutex());
+	if (0 == fftw_export_wisdom_to_filename(filename.c_str())) {
+		throw runtime_error("failed to export FFTW wisdom to '" + filename +
+				"'");
+	}
+#ifdef GENALYZER_FFTW_FLOAT
+	const str_t float_filename = float_wisdom_filename(filename);
+	if (0 == fftwf_export_wisdom_to_filename(float_filename.c_str())) {
+		throw runtime_error("failed to export FFTW wisdom to '" +
+				float_filename + "'");
+	}
+#endif
+}
+
+void fft_wisdom_import(const str_t &filename) {
+	std::lock_guard<std::mutex> lock(plan_cache_mutex());
+	if (0 == fftw_import_wisdom_from_filename(filename.c_str())) {
+		throw runtime_error("failed to import FFTW wisdom from '" +
+				filename + "'");
+	}
+#ifdef GENALYZER_FFTW_FLOAT
+	// Files exported without single-precision FFTs have no float wisdom
+	const str_t float_filename = float_wisdom_filename(filename);
+	if (std::ifstream(float_filename).good() &&
+			0 == fftwf_import_wisdom_from_filename(float_filename.c_str())) {
+		throw runtime_error("failed to import FFTW wisdom from '" +
+				float_filename + "'");
+	}
+#endif
+}
+
+void fft_wisdom_forget() {
+	std::lock_guard<std::mutex> lock(plan_cache_mutex());
+	fftw_forget_wisdom();
+#ifdef GENALYZER_FFTW_FLOAT
+	fftwf_forget_wisdom();
+#endif
+}
+
+void window_cache_clear() {
+	std::lock_guard<std::mutex> lock(window_cache_mutex());
+	window_cache<double>().clear();
+	window_cache<float>().clear();
+	++window_cache_generation();
+}
+
+size_t window_cache_size() {
+	std::lock_guard<std::mutex> lock(window_cache_mutex());
+	return window_cache<double>().size() + window_cache<float>().size();
+}
+
+void window_cache_warm(Window window, size_t nfft, RfftScale scale) {
+	assert_gt0("", "nfft", nfft);
+	if (Window::NoWindow == window) {
+		return;
+	}
+	get_window_table<real_t>(window, nfft, scale);
+#ifdef GENALYZER_FFTW_FLOAT
+	get_window_table<float>(window, nfft, scale);
+#endif
+}
+
 } // namespace genalyzer_impl
\ No newline at end of file
@@ -28,6 +28,9 @@ std::shared_ptr<fourier_analysis> fourier_analysis::load(const str_t &filename)
 				std::make_shared<fourier_analysis>();
 		j["en_conv_offset"].get_to(p->en_conv_offset);
 		j["en_fund_images"].get_to(p->en_fund_images);
+		if (j.contains("en_imd_tones")) { // not in older files
+			j["en_imd_tones"].get_to(p->en_imd_tones);
+		}
 		j["en_quad_errors"].get_to(p->en_quad_errors);
 		j["clk_as_noise"].get_to(p->clk_as_noise);
 		j["dc_as_dist"].get_to(p->dc_as_dist);
@@ -128,6 +131,7 @@ void fourier_analysis::save_impl(const str_t &filename) const {
 	j["dc_as_dist"] = dc_as_dist;
 	j["en_conv_offset"] = en_conv_offset;
 	j["en_fund_images"] = en_fund_images;
+	j["en_imd_tones"] = en_imd_tones;
 	j["en_quad_errors"] = en_quad_errors;
 	j["fdata"] = m_fdata;
 	j["fsample"] = m_fsample;
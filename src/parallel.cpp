@@ -0,0 +1,137 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "parallel.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace genalyzer_impl {
+
+namespace {
+
+struct task_batch {
+	const std::function<void(size_t)> *f = nullptr;
+	size_t ntasks = 0;
+	std::atomic<size_t> next{ 0 };
+	std::atomic<size_t> done{ 0 };
+	std::mutex mtx;
+	std::condition_variable cv;
+	std::exception_ptr error; // guarded by mtx
+};
+
+// Claims and runs tasks from b until none are left.
+void run_tasks(task_batch &b) {
+	for (;;) {
+		const size_t i = b.next.fetch_add(1);
+		if (b.ntasks <= i) {
+			return;
+		}
+		try {
+			(*b.f)(i);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(b.mtx);
+			if (!b.error) {
+				b.error = std::current_exception();
+			}
+		}
+		if (b.done.fetch_add(1) + 1 == b.ntasks) {
+			std::lock_guard<std::mutex> lock(b.mtx);
+			b.cv.notify_all();
+		}
+	}
+}
+
+class thread_pool {
+public:
+	void ensure_workers(size_t nworkers) {
+		std::lock_guard<std::mutex> lock(m_mtx);
+		while (m_nworkers < nworkers) {
+			std::thread(&thread_pool::worker_loop, this).detach();
+			++m_nworkers;
+		}
+	}
+
+	void submit(const std::shared_ptr<task_batch> &b) {
+		{
+			std::lock_guard<std::mutex> lock(m_mtx);
+			m_queue.push_back(b);
+		}
+		m_cv.notify_all();
+	}
+
+private:
+	void worker_loop() {
+		for (;;) {
+			std::shared_ptr<task_batch> b;
+			{
+				std::unique_lock<std::mutex> lock(m_mtx);
+				m_cv.wait(lock, [this] { return !m_queue.empty(); });
+				b = m_queue.front();
+				if (b->ntasks <= b->next.load()) {
+					m_queue.pop_front();
+					continue;
+				}
+			}
+			run_tasks(*b);
+		}
+	}
+
+	std::mutex m_mtx;
+	std::condition_variable m_cv;
+	std::deque<std::shared_ptr<task_batch>> m_queue;
+	size_t m_nworkers = 0;
+};
+
+// Workers are detached and the pool is intentionally never destroyed, so that
+// process exit (or library unload) never waits on idle worker threads.
+thread_pool &pool() {
+	static thread_pool *p = new thread_pool;
+	return *p;
+}
+
+std::atomic<size_t> &num_threads_setting() {
+	static std::atomic<size_t> n{ 1 };
+	return n;
+}
+
+} // namespace
+
+size_t get_num_threads() {
+	return num_threads_setting().load();
+}
+
+void set_num_threads(size_t num_threads) {
+	if (0 == num_threads) {
+		num_threads = std::thread::hardware_concurrency();
+	}
+	num_threads_setting().store((0 == num_threads) ? 1 : num_threads);
+}
+
+void parallel_for(size_t ntasks, const std::function<void(size_t)> &f) {
+	const size_t nthreads = get_num_threads();
+	if (ntasks < 2 || nthreads < 2) {
+		for (size_t i = 0; i < ntasks; ++i) {
+			f(i);
+		}
+		return;
+	}
+	pool().ensure_workers(nthreads - 1);
+	auto b = std::make_shared<task_batch>();
+	b->f = &f;
+	b->ntasks = ntasks;
+	pool().submit(b);
+	run_tasks(*b);
+	std::unique_lock<std::mutex> lock(b->mtx);
+	b->cv.wait(lock, [&b] { return b->ntasks == b->done.load(); });
+	if (b->error) {
+		std::rethrow_exception(b->error);
+	}
+}
+
+} // namespace genalyzer_impl
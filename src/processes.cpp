@@ -4,6 +4,8 @@
 #include "processes.hpp"
 
 #include "constants.hpp"
+#include "sample_format.hpp"
+#include "simd_kernels.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -199,6 +201,29 @@ template void normalize(const int32_t *, size_t, real_t *, size_t, int,
 template void normalize(const int64_t *, size_t, real_t *, size_t, int,
 		CodeFormat);
 
+void normalize_raw(const uint8_t *buf, size_t buf_size, real_t *out_data,
+		size_t out_size, const sample_format &fmt) {
+	const char *trace = "normalize_raw : ";
+	check_array(trace, "raw buffer", buf, buf_size);
+	check_array(trace, "output array", out_data, out_size);
+	check_sample_format(trace, fmt);
+	if (raw_sample_count(buf_size, fmt) < out_size) {
+		throw runtime_error(str_t(trace) +
+				"output array size exceeds sample count");
+	}
+	const real_t scalar = 2.0 / (1 << fmt.bits);
+	const real_t offset =
+			(CodeFormat::OffsetBinary == fmt.format) ? -1.0 : 0.0;
+	const real_t *no_window = nullptr;
+	int32_t codes[k_raw_block_size];
+	for (size_t first = 0; first < out_size; first += k_raw_block_size) {
+		const size_t count = std::min(k_raw_block_size, out_size - first);
+		unpack_raw(codes, count, buf, buf_size, fmt, first);
+		norm_window(codes, no_window, out_data + first, count, scalar,
+				offset);
+	}
+}
+
 void polyval(const real_t *in_data, size_t in_size, real_t *out_data,
 		size_t out_size, const real_t *c_data, size_t c_size) {
 	check_array_pair("polyval : ", "input array", in_data, in_size,
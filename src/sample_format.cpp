@@ -0,0 +1,237 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "sample_format.hpp"
+
+#include "exceptions.hpp"
+#include "utils.hpp"
+
+namespace genalyzer_impl {
+
+namespace {
+
+using unpack_fn = void (*)(int32_t *out, size_t count, const uint8_t *p,
+		size_t step, int lsh, int rsh);
+
+using packed_fn = void (*)(int32_t *out, size_t count, const uint8_t *buf,
+		size_t buf_size, uint64_t bit, uint64_t step, int cb, int lsh,
+		int rsh);
+
+// Shift the code to the top of a 32-bit word, then back down, which clears
+// the other container bits and extends the sign of two's complement codes
+template <bool TwosComplement>
+int32_t extract_code(uint32_t w, int lsh, int rsh) {
+	const uint32_t v = w << lsh;
+	if constexpr (TwosComplement) {
+		return static_cast<int32_t>(v) >> rsh;
+	} else {
+		return static_cast<int32_t>(v >> rsh);
+	}
+}
+
+template <int Bytes, bool BigEndian>
+uint32_t load_word(const uint8_t *p) {
+	uint32_t w = 0;
+	for (int b = 0; b < Bytes; ++b) {
+		const int shift = 8 * (BigEndian ? Bytes - 1 - b : b);
+		w |= static_cast<uint32_t>(p[b]) << shift;
+	}
+	return w;
+}
+
+// p: first word; step: bytes from one sample to the next
+template <int Bytes, bool BigEndian, bool TwosComplement>
+void unpack_words(int32_t *out, size_t count, const uint8_t *p, size_t step,
+		int lsh, int rsh) {
+	// Separate loop with a constant step, so that it can be vectorized
+	if (Bytes == step) {
+		for (size_t j = 0; j < count; ++j) {
+			out[j] = extract_code<TwosComplement>(
+					load_word<Bytes, BigEndian>(p + j * Bytes), lsh, rsh);
+		}
+	} else {
+		for (size_t j = 0; j < count; ++j) {
+			out[j] = extract_code<TwosComplement>(
+					load_word<Bytes, BigEndian>(p + j * step), lsh, rsh);
+		}
+	}
+}
+
+template <int Bytes>
+unpack_fn words_kernel(bool big_endian, bool tc) {
+	if (big_endian) {
+		return tc ? unpack_words<Bytes, true, true>
+				  : unpack_words<Bytes, true, false>;
+	}
+	return tc ? unpack_words<Bytes, false, true>
+			  : unpack_words<Bytes, false, false>;
+}
+
+// Load the nbytes bytes at p into the low bytes of a word, in stream order
+template <bool BigEndian>
+uint64_t load_bytes(const uint8_t *p, int nbytes) {
+	uint64_t x = 0;
+	for (int b = 0; b < nbytes; ++b) {
+		if (BigEndian) {
+			x = (x << 8) | p[b];
+		} else {
+			x |= static_cast<uint64_t>(p[b]) << (8 * b);
+		}
+	}
+	return x;
+}
+
+// bit: first bit of the first container; step: bits from one sample to the
+// next; cb: container bits.  A container spans at most 5 bytes, which are
+// loaded with a fixed-length loop except near the end of the buffer.
+template <bool BigEndian, bool TwosComplement>
+void unpack_packed(int32_t *out, size_t count, const uint8_t *buf,
+		size_t buf_size, uint64_t bit, uint64_t step, int cb, int lsh,
+		int rsh) {
+	const uint64_t mask = (uint64_t{ 1 } << cb) - 1;
+	for (size_t j = 0; j < count; ++j, bit += step) {
+		const size_t byte = static_cast<size_t>(bit >> 3);
+		const int skip = static_cast<int>(bit & 7);
+		const int nbytes = (buf_size - byte < 5)
+				? static_cast<int>(buf_size - byte)
+				: 5;
+		const uint64_t x = (5 == nbytes)
+				? load_bytes<BigEndian>(buf + byte, 5)
+				: load_bytes<BigEndian>(buf + byte, nbytes);
+		const int shift = BigEndian ? 8 * nbytes - skip - cb : skip;
+		const uint32_t w = static_cast<uint32_t>((x >> shift) & mask);
+		out[j] = extract_code<TwosComplement>(w, lsh, rsh);
+	}
+}
+
+// Contiguous containers of CB bits, from a byte boundary: each group of G
+// containers fills GB bytes, so the position of each container in its group
+// is a constant.  Returns the number of samples decoded, a multiple of G.
+template <int CB, bool BigEndian, bool TwosComplement>
+size_t unpack_packed_groups(int32_t *out, size_t count, const uint8_t *p,
+		int lsh, int rsh) {
+	constexpr int G = (0 == CB % 4) ? 2 : ((0 == CB % 2) ? 4 : 8);
+	constexpr int GB = CB * G / 8;
+	constexpr uint64_t mask = (uint64_t{ 1 } << CB) - 1;
+	const size_t ngroups = count / G;
+	for (size_t g = 0; g < ngroups; ++g) {
+		const uint8_t *q = p + g * GB;
+		for (int k = 0; k < G; ++k) {
+			const int skip = (k * CB) & 7;
+			const int nbytes = (skip + CB + 7) >> 3;
+			const uint64_t x = load_bytes<BigEndian>(q + ((k * CB) >> 3),
+					nbytes);
+			const int shift = BigEndian ? 8 * nbytes - skip - CB : skip;
+			const uint32_t w = static_cast<uint32_t>((x >> shift) & mask);
+			out[g * G + k] = extract_code<TwosComplement>(w, lsh, rsh);
+		}
+	}
+	return ngroups * G;
+}
+
+using groups_fn = size_t (*)(int32_t *out, size_t count, const uint8_t *p,
+		int lsh, int rsh);
+
+template <int CB>
+groups_fn groups_kernel(bool big_endian, bool tc) {
+	if (big_endian) {
+		return tc ? unpack_packed_groups<CB, true, true>
+				  : unpack_packed_groups<CB, true, false>;
+	}
+	return tc ? unpack_packed_groups<CB, false, true>
+			  : unpack_packed_groups<CB, false, false>;
+}
+
+} // namespace
+
+void check_sample_format(const char *trace, const sample_format &fmt) {
+	check_code_width(trace, fmt.bits);
+	if (fmt.container_bits < fmt.bits || 32 < fmt.container_bits) {
+		throw runtime_error(str_t(trace) +
+				"container bits must be in [bits, 32]");
+	}
+	if (0 == fmt.stride) {
+		throw runtime_error(str_t(trace) + "stride must be positive");
+	}
+}
+
+size_t raw_sample_count(size_t buf_size, const sample_format &fmt) {
+	check_sample_format("raw_sample_count : ", fmt);
+	// floor(8 * buf_size / cb), without overflow
+	const size_t cb = static_cast<size_t>(fmt.container_bits);
+	const size_t ncont = buf_size / cb * 8 + buf_size % cb * 8 / cb;
+	if (ncont <= fmt.offset) {
+		return 0;
+	}
+	return (ncont - fmt.offset - 1) / fmt.stride + 1;
+}
+
+void unpack_raw(int32_t *out_data, size_t out_size, const uint8_t *buf,
+		size_t buf_size, const sample_format &fmt, size_t first) {
+	const char *trace = "unpack_raw : ";
+	check_array(trace, "output array", out_data, out_size);
+	check_array(trace, "raw buffer", buf, buf_size);
+	const size_t count = raw_sample_count(buf_size, fmt);
+	if (count < first || count - first < out_size) {
+		throw runtime_error(str_t(trace) + "samples out of range");
+	}
+	const bool tc = CodeFormat::TwosComplement == fmt.format;
+	const int cb = fmt.container_bits;
+	const int lsh = 32 - (fmt.left_justified ? cb : fmt.bits);
+	const int rsh = 32 - fmt.bits;
+	const size_t c0 = fmt.offset + first * fmt.stride;
+	if (0 == cb % 8) {
+		const size_t bytes = static_cast<size_t>(cb / 8);
+		unpack_fn f = nullptr;
+		switch (bytes) {
+			case 1:
+				f = words_kernel<1>(fmt.big_endian, tc);
+				break;
+			case 2:
+				f = words_kernel<2>(fmt.big_endian, tc);
+				break;
+			case 3:
+				f = words_kernel<3>(fmt.big_endian, tc);
+				break;
+			default:
+				f = words_kernel<4>(fmt.big_endian, tc);
+				break;
+		}
+		f(out_data, out_size, buf + c0 * bytes, fmt.stride * bytes, lsh, rsh);
+		return;
+	}
+	uint64_t bit = static_cast<uint64_t>(c0) * cb;
+	const uint64_t step = static_cast<uint64_t>(fmt.stride) * cb;
+	if (1 == fmt.stride && 0 == bit % 8) {
+		// Common packed widths
+		groups_fn g = nullptr;
+		switch (cb) {
+			case 10:
+				g = groups_kernel<10>(fmt.big_endian, tc);
+				break;
+			case 12:
+				g = groups_kernel<12>(fmt.big_endian, tc);
+				break;
+			case 14:
+				g = groups_kernel<14>(fmt.big_endian, tc);
+				break;
+			default:
+				break;
+		}
+		if (g) {
+			const size_t done = g(out_data, out_size, buf + bit / 8, lsh, rsh);
+			out_data += done;
+			out_size -= done;
+			bit += done * step;
+		}
+	}
+	packed_fn f = nullptr;
+	if (fmt.big_endian) {
+		f = tc ? unpack_packed<true, true> : unpack_packed<true, false>;
+	} else {
+		f = tc ? unpack_packed<false, true> : unpack_packed<false, false>;
+	}
+	f(out_data, out_size, buf, buf_size, bit, step, cb, lsh, rsh);
+}
+
+} // namespace genalyzer_impl
@@ -0,0 +1,216 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "simd_kernels.hpp"
+
+#include "exceptions.hpp"
+#include "type_aliases.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <type_traits>
+
+namespace genalyzer_impl {
+
+namespace {
+
+// GENALYZER_SIMD_AVX2, GENALYZER_SIMD_AVX512, and GENALYZER_SIMD_NEON are
+// defined by the build when the corresponding kernel table is compiled in.
+bool simd_level_supported(SimdLevel level) {
+	switch (level) {
+		case SimdLevel::Scalar:
+			return true;
+		case SimdLevel::Avx2:
+#ifdef GENALYZER_SIMD_AVX2
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+			return false;
+#endif
+		case SimdLevel::Avx512:
+#ifdef GENALYZER_SIMD_AVX512
+			return __builtin_cpu_supports("avx512f");
+#else
+			return false;
+#endif
+		case SimdLevel::Neon:
+#ifdef GENALYZER_SIMD_NEON
+			return true;
+#else
+			return false;
+#endif
+	}
+	return false;
+}
+
+// AVX-512 is not the default: these kernels are bound by memory bandwidth, and
+// 512-bit stores measured slower than AVX2 for real input.
+SimdLevel detect_simd_level() {
+	for (SimdLevel level : { SimdLevel::Avx2, SimdLevel::Neon }) {
+		if (simd_level_supported(level)) {
+			return level;
+		}
+	}
+	return SimdLevel::Scalar;
+}
+
+std::atomic<SimdLevel> &simd_level_setting() {
+	static std::atomic<SimdLevel> level{ detect_simd_level() };
+	return level;
+}
+
+const simd_kernel_table *active_table() {
+	switch (simd_level_setting().load(std::memory_order_relaxed)) {
+#ifdef GENALYZER_SIMD_AVX2
+		case SimdLevel::Avx2:
+			return &avx2_kernel_table;
+#endif
+#ifdef GENALYZER_SIMD_AVX512
+		case SimdLevel::Avx512:
+			return &avx512_kernel_table;
+#endif
+#ifdef GENALYZER_SIMD_NEON
+		case SimdLevel::Neon:
+			return &neon_kernel_table;
+#endif
+		default:
+			return nullptr;
+	}
+}
+
+template <typename R>
+const norm_window_kernels<R> *active_kernels() {
+	const simd_kernel_table *table = active_table();
+	if (nullptr == table) {
+		return nullptr;
+	}
+	if constexpr (std::is_same_v<R, double>) {
+		return &table->f64;
+	} else {
+		return &table->f32;
+	}
+}
+
+// Only int16_t and int32_t samples have vector kernels
+template <typename T>
+constexpr bool has_kernels =
+		std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t>;
+
+template <typename T, typename R>
+R norm_sample(T x, R scalar, R offset) {
+	return std::fma(scalar, static_cast<R>(x), offset);
+}
+
+} // namespace
+
+SimdLevel get_simd_level() {
+	return simd_level_setting().load(std::memory_order_relaxed);
+}
+
+void set_simd_level(SimdLevel level) {
+	if (!simd_level_supported(level)) {
+		throw runtime_error(str_t("set_simd_level : ") +
+				simd_level_name(level) + " is not available on this host");
+	}
+	simd_level_setting().store(level, std::memory_order_relaxed);
+}
+
+const char *simd_level_name(SimdLevel level) {
+	switch (level) {
+		case SimdLevel::Scalar:
+			return "Scalar";
+		case SimdLevel::Avx2:
+			return "AVX2";
+		case SimdLevel::Avx512:
+			return "AVX-512";
+		case SimdLevel::Neon:
+			return "NEON";
+	}
+	return "";
+}
+
+template <typename T, typename R>
+void norm_window(const T *in_data, const R *win, R *out_data, size_t size,
+		R scalar, R offset) {
+	size_t i = 0;
+	if constexpr (has_kernels<T>) {
+		if (const norm_window_kernels<R> *k = active_kernels<R>()) {
+			if constexpr (std::is_same_v<T, int16_t>) {
+				i = k->real16(in_data, win, out_data, size, scalar, offset);
+			} else {
+				i = k->real32(in_data, win, out_data, size, scalar, offset);
+			}
+		}
+	}
+	if (win) {
+		for (; i < size; ++i) {
+			out_data[i] = win[i] * norm_sample(in_data[i], scalar, offset);
+		}
+	} else {
+		for (; i < size; ++i) {
+			out_data[i] = norm_sample(in_data[i], scalar, offset);
+		}
+	}
+}
+
+template <typename T, typename R>
+void norm_window_cplx(const T *i_data, const T *q_data, size_t in_stride,
+		const R *win, R *out_data, size_t nfft, R scalar, R offset) {
+	size_t j = 0;
+	if constexpr (has_kernels<T>) {
+		const norm_window_kernels<R> *k = active_kernels<R>();
+		if (k && 1 == in_stride) {
+			if constexpr (std::is_same_v<T, int16_t>) {
+				j = k->split16(i_data, q_data, win, out_data, nfft, scalar,
+						offset);
+			} else {
+				j = k->split32(i_data, q_data, win, out_data, nfft, scalar,
+						offset);
+			}
+		} else if (k && 2 == in_stride && i_data + 1 == q_data) {
+			// Interleaved I/Q
+			if constexpr (std::is_same_v<T, int16_t>) {
+				j = k->inter16(i_data, win, out_data, nfft, scalar, offset);
+			} else {
+				j = k->inter32(i_data, win, out_data, nfft, scalar, offset);
+			}
+		}
+	}
+	for (; j < nfft; ++j) {
+		R x = norm_sample(i_data[j * in_stride], scalar, offset);
+		R y = norm_sample(q_data[j * in_stride], scalar, offset);
+		if (win) {
+			x *= win[j];
+			y *= win[j];
+		}
+		out_data[2 * j] = x;
+		out_data[2 * j + 1] = y;
+	}
+}
+
+template void norm_window(const int16_t *, const double *, double *, size_t,
+		double, double);
+template void norm_window(const int32_t *, const double *, double *, size_t,
+		double, double);
+template void norm_window(const int64_t *, const double *, double *, size_t,
+		double, double);
+template void norm_window(const int16_t *, const float *, float *, size_t,
+		float, float);
+template void norm_window(const int32_t *, const float *, float *, size_t,
+		float, float);
+template void norm_window(const int64_t *, const float *, float *, size_t,
+		float, float);
+
+template void norm_window_cplx(const int16_t *, const int16_t *, size_t,
+		const double *, double *, size_t, double, double);
+template void norm_window_cplx(const int32_t *, const int32_t *, size_t,
+		const double *, double *, size_t, double, double);
+template void norm_window_cplx(const int64_t *, const int64_t *, size_t,
+		const double *, double *, size_t, double, double);
+template void norm_window_cplx(const int16_t *, const int16_t *, size_t,
+		const float *, float *, size_t, float, float);
+template void norm_window_cplx(const int32_t *, const int32_t *, size_t,
+		const float *, float *, size_t, float, float);
+template void norm_window_cplx(const int64_t *, const int64_t *, size_t,
+		const float *, float *, size_t, float, float);
+
+} // namespace genalyzer_impl
@@ -0,0 +1,188 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// AVX2 + FMA normalize-window kernels.  This file is compiled with -mavx2
+// -mfma and is only called after a run-time CPU check; see simd_kernels.hpp.
+#include "simd_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace genalyzer_impl {
+
+namespace {
+
+// A block is 8 samples: two __m256d or one __m256
+constexpr size_t block_size = 8;
+
+struct f64_block {
+	__m256d v[2];
+};
+
+struct f32_block {
+	__m256 v;
+};
+
+__m256d broadcast(double x) {
+	return _mm256_set1_pd(x);
+}
+
+__m256 broadcast(float x) {
+	return _mm256_set1_ps(x);
+}
+
+__m128i load_si128(const void *p) {
+	return _mm_loadu_si128(static_cast<const __m128i *>(p));
+}
+
+f64_block load(const int16_t *p, double) {
+	const __m256i x = _mm256_cvtepi16_epi32(load_si128(p));
+	return { { _mm256_cvtepi32_pd(_mm256_castsi256_si128(x)),
+			_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)) } };
+}
+
+f64_block load(const int32_t *p, double) {
+	return { { _mm256_cvtepi32_pd(load_si128(p)),
+			_mm256_cvtepi32_pd(load_si128(p + 4)) } };
+}
+
+f32_block load(const int16_t *p, float) {
+	return { _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(load_si128(p))) };
+}
+
+f32_block load(const int32_t *p, float) {
+	return { _mm256_cvtepi32_ps(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))) };
+}
+
+f64_block load(const double *p) {
+	return { { _mm256_loadu_pd(p), _mm256_loadu_pd(p + 4) } };
+}
+
+f32_block load(const float *p) {
+	return { _mm256_loadu_ps(p) };
+}
+
+void store(double *p, const f64_block &x) {
+	_mm256_storeu_pd(p, x.v[0]);
+	_mm256_storeu_pd(p + 4, x.v[1]);
+}
+
+void store(float *p, const f32_block &x) {
+	_mm256_storeu_ps(p, x.v);
+}
+
+// fma(scalar, x, offset), as in the scalar kernels
+f64_block norm(const f64_block &x, __m256d scalar, __m256d offset) {
+	return { { _mm256_fmadd_pd(scalar, x.v[0], offset),
+			_mm256_fmadd_pd(scalar, x.v[1], offset) } };
+}
+
+f32_block norm(const f32_block &x, __m256 scalar, __m256 offset) {
+	return { _mm256_fmadd_ps(scalar, x.v, offset) };
+}
+
+f64_block mul(const f64_block &a, const f64_block &b) {
+	return { { _mm256_mul_pd(a.v[0], b.v[0]),
+			_mm256_mul_pd(a.v[1], b.v[1]) } };
+}
+
+f32_block mul(const f32_block &a, const f32_block &b) {
+	return { _mm256_mul_ps(a.v, b.v) };
+}
+
+// lo = a0 b0 a1 b1 a2 b2 a3 b3, hi = a4 b4 a5 b5 a6 b6 a7 b7
+void zip(__m256d a, __m256d b, __m256d &lo, __m256d &hi) {
+	const __m256d l = _mm256_unpacklo_pd(a, b); // a0 b0 a2 b2
+	const __m256d h = _mm256_unpackhi_pd(a, b); // a1 b1 a3 b3
+	lo = _mm256_permute2f128_pd(l, h, 0x20);
+	hi = _mm256_permute2f128_pd(l, h, 0x31);
+}
+
+void zip(const f64_block &a, const f64_block &b, f64_block &lo,
+		f64_block &hi) {
+	zip(a.v[0], b.v[0], lo.v[0], lo.v[1]);
+	zip(a.v[1], b.v[1], hi.v[0], hi.v[1]);
+}
+
+void zip(const f32_block &a, const f32_block &b, f32_block &lo,
+		f32_block &hi) {
+	const __m256 l = _mm256_unpacklo_ps(a.v, b.v); // a0 b0 a1 b1 a4 b4 a5 b5
+	const __m256 h = _mm256_unpackhi_ps(a.v, b.v); // a2 b2 a3 b3 a6 b6 a7 b7
+	lo.v = _mm256_permute2f128_ps(l, h, 0x20);
+	hi.v = _mm256_permute2f128_ps(l, h, 0x31);
+}
+
+template <typename T, typename R>
+size_t real_kernel(const T *in, const R *win, R *out, size_t size,
+		R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = size - size % block_size;
+	for (size_t i = 0; i < n; i += block_size) {
+		auto x = norm(load(in + i, R()), s, o);
+		if (win) {
+			x = mul(load(win + i), x);
+		}
+		store(out + i, x);
+	}
+	return n;
+}
+
+template <typename T, typename R>
+size_t split_kernel(const T *i_data, const T *q_data, const R *win, R *out,
+		size_t nfft, R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = nfft - nfft % block_size;
+	for (size_t j = 0; j < n; j += block_size) {
+		auto x = norm(load(i_data + j, R()), s, o);
+		auto y = norm(load(q_data + j, R()), s, o);
+		if (win) {
+			const auto w = load(win + j);
+			x = mul(w, x);
+			y = mul(w, y);
+		}
+		decltype(x) lo, hi;
+		zip(x, y, lo, hi);
+		store(out + 2 * j, lo);
+		store(out + 2 * j + block_size, hi);
+	}
+	return n;
+}
+
+template <typename T, typename R>
+size_t inter_kernel(const T *iq_data, const R *win, R *out, size_t nfft,
+		R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = nfft - nfft % block_size;
+	for (size_t j = 0; j < n; j += block_size) {
+		auto x = norm(load(iq_data + 2 * j, R()), s, o);
+		auto y = norm(load(iq_data + 2 * j + block_size, R()), s, o);
+		if (win) {
+			const auto w = load(win + j);
+			decltype(x) w_lo, w_hi; // each coefficient twice
+			zip(w, w, w_lo, w_hi);
+			x = mul(w_lo, x);
+			y = mul(w_hi, y);
+		}
+		store(out + 2 * j, x);
+		store(out + 2 * j + block_size, y);
+	}
+	return n;
+}
+
+template <typename R>
+constexpr norm_window_kernels<R> make_kernels() {
+	return { real_kernel<int16_t, R>, real_kernel<int32_t, R>,
+		split_kernel<int16_t, R>, split_kernel<int32_t, R>,
+		inter_kernel<int16_t, R>, inter_kernel<int32_t, R> };
+}
+
+} // namespace
+
+const simd_kernel_table avx2_kernel_table = { make_kernels<double>(),
+	make_kernels<float>() };
+
+} // namespace genalyzer_impl
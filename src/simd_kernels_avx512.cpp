@@ -0,0 +1,190 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// AVX-512 normalize-window kernels.  This file is compiled with -mavx512f and
+// is only called after a run-time CPU check; see simd_kernels.hpp.
+#include "simd_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace genalyzer_impl {
+
+namespace {
+
+// A block is 16 samples: two __m512d or one __m512
+constexpr size_t block_size = 16;
+
+struct f64_block {
+	__m512d v[2];
+};
+
+struct f32_block {
+	__m512 v;
+};
+
+__m512d broadcast(double x) {
+	return _mm512_set1_pd(x);
+}
+
+__m512 broadcast(float x) {
+	return _mm512_set1_ps(x);
+}
+
+__m256i load_si256(const void *p) {
+	return _mm256_loadu_si256(static_cast<const __m256i *>(p));
+}
+
+f64_block load(const int16_t *p, double) {
+	const __m512i x = _mm512_cvtepi16_epi32(load_si256(p));
+	return { { _mm512_cvtepi32_pd(_mm512_castsi512_si256(x)),
+			_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(x, 1)) } };
+}
+
+f64_block load(const int32_t *p, double) {
+	return { { _mm512_cvtepi32_pd(load_si256(p)),
+			_mm512_cvtepi32_pd(load_si256(p + 8)) } };
+}
+
+f32_block load(const int16_t *p, float) {
+	return { _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(load_si256(p))) };
+}
+
+f32_block load(const int32_t *p, float) {
+	return { _mm512_cvtepi32_ps(_mm512_loadu_si512(p)) };
+}
+
+f64_block load(const double *p) {
+	return { { _mm512_loadu_pd(p), _mm512_loadu_pd(p + 8) } };
+}
+
+f32_block load(const float *p) {
+	return { _mm512_loadu_ps(p) };
+}
+
+void store(double *p, const f64_block &x) {
+	_mm512_storeu_pd(p, x.v[0]);
+	_mm512_storeu_pd(p + 8, x.v[1]);
+}
+
+void store(float *p, const f32_block &x) {
+	_mm512_storeu_ps(p, x.v);
+}
+
+// fma(scalar, x, offset), as in the scalar kernels
+f64_block norm(const f64_block &x, __m512d scalar, __m512d offset) {
+	return { { _mm512_fmadd_pd(scalar, x.v[0], offset),
+			_mm512_fmadd_pd(scalar, x.v[1], offset) } };
+}
+
+f32_block norm(const f32_block &x, __m512 scalar, __m512 offset) {
+	return { _mm512_fmadd_ps(scalar, x.v, offset) };
+}
+
+f64_block mul(const f64_block &a, const f64_block &b) {
+	return { { _mm512_mul_pd(a.v[0], b.v[0]),
+			_mm512_mul_pd(a.v[1], b.v[1]) } };
+}
+
+f32_block mul(const f32_block &a, const f32_block &b) {
+	return { _mm512_mul_ps(a.v, b.v) };
+}
+
+// lo = a0 b0 a1 b1 ... a3 b3, hi = a4 b4 ... a7 b7
+void zip(__m512d a, __m512d b, __m512d &lo, __m512d &hi) {
+	const __m512i idx_lo = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+	const __m512i idx_hi = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+	lo = _mm512_permutex2var_pd(a, idx_lo, b);
+	hi = _mm512_permutex2var_pd(a, idx_hi, b);
+}
+
+void zip(const f64_block &a, const f64_block &b, f64_block &lo,
+		f64_block &hi) {
+	zip(a.v[0], b.v[0], lo.v[0], lo.v[1]);
+	zip(a.v[1], b.v[1], hi.v[0], hi.v[1]);
+}
+
+// lo = a0 b0 a1 b1 ... a7 b7, hi = a8 b8 ... a15 b15
+void zip(const f32_block &a, const f32_block &b, f32_block &lo,
+		f32_block &hi) {
+	const __m512i idx_lo = _mm512_set_epi32(23, 7, 22, 6, 21, 5, 20, 4, 19,
+			3, 18, 2, 17, 1, 16, 0);
+	const __m512i idx_hi = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12,
+			27, 11, 26, 10, 25, 9, 24, 8);
+	lo.v = _mm512_permutex2var_ps(a.v, idx_lo, b.v);
+	hi.v = _mm512_permutex2var_ps(a.v, idx_hi, b.v);
+}
+
+template <typename T, typename R>
+size_t real_kernel(const T *in, const R *win, R *out, size_t size,
+		R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = size - size % block_size;
+	for (size_t i = 0; i < n; i += block_size) {
+		auto x = norm(load(in + i, R()), s, o);
+		if (win) {
+			x = mul(load(win + i), x);
+		}
+		store(out + i, x);
+	}
+	return n;
+}
+
+template <typename T, typename R>
+size_t split_kernel(const T *i_data, const T *q_data, const R *win, R *out,
+		size_t nfft, R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = nfft - nfft % block_size;
+	for (size_t j = 0; j < n; j += block_size) {
+		auto x = norm(load(i_data + j, R()), s, o);
+		auto y = norm(load(q_data + j, R()), s, o);
+		if (win) {
+			const auto w = load(win + j);
+			x = mul(w, x);
+			y = mul(w, y);
+		}
+		decltype(x) lo, hi;
+		zip(x, y, lo, hi);
+		store(out + 2 * j, lo);
+		store(out + 2 * j + block_size, hi);
+	}
+	return n;
+}
+
+template <typename T, typename R>
+size_t inter_kernel(const T *iq_data, const R *win, R *out, size_t nfft,
+		R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = nfft - nfft % block_size;
+	for (size_t j = 0; j < n; j += block_size) {
+		auto x = norm(load(iq_data + 2 * j, R()), s, o);
+		auto y = norm(load(iq_data + 2 * j + block_size, R()), s, o);
+		if (win) {
+			const auto w = load(win + j);
+			decltype(x) w_lo, w_hi; // each coefficient twice
+			zip(w, w, w_lo, w_hi);
+			x = mul(w_lo, x);
+			y = mul(w_hi, y);
+		}
+		store(out + 2 * j, x);
+		store(out + 2 * j + block_size, y);
+	}
+	return n;
+}
+
+template <typename R>
+constexpr norm_window_kernels<R> make_kernels() {
+	return { real_kernel<int16_t, R>, real_kernel<int32_t, R>,
+		split_kernel<int16_t, R>, split_kernel<int32_t, R>,
+		inter_kernel<int16_t, R>, inter_kernel<int32_t, R> };
+}
+
+} // namespace
+
+const simd_kernel_table avx512_kernel_table = { make_kernels<double>(),
+	make_kernels<float>() };
+
+} // namespace genalyzer_impl
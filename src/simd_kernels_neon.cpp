@@ -0,0 +1,204 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+//
+// NEON normalize-window kernels.  NEON is part of the AArch64 baseline, so no
+// extra compiler flags or run-time check are needed; see simd_kernels.hpp.
+#include "simd_kernels.hpp"
+
+#include <arm_neon.h>
+
+namespace genalyzer_impl {
+
+namespace {
+
+// A block is 8 samples: four float64x2_t or two float32x4_t
+constexpr size_t block_size = 8;
+
+struct f64_block {
+	float64x2_t v[4];
+};
+
+struct f32_block {
+	float32x4_t v[2];
+};
+
+float64x2_t broadcast(double x) {
+	return vdupq_n_f64(x);
+}
+
+float32x4_t broadcast(float x) {
+	return vdupq_n_f32(x);
+}
+
+float64x2_t cvt_lo(int32x4_t x) {
+	return vcvtq_f64_s64(vmovl_s32(vget_low_s32(x)));
+}
+
+float64x2_t cvt_hi(int32x4_t x) {
+	return vcvtq_f64_s64(vmovl_s32(vget_high_s32(x)));
+}
+
+f64_block load(const int16_t *p, double) {
+	const int16x8_t x = vld1q_s16(p);
+	const int32x4_t lo = vmovl_s16(vget_low_s16(x));
+	const int32x4_t hi = vmovl_s16(vget_high_s16(x));
+	return { { cvt_lo(lo), cvt_hi(lo), cvt_lo(hi), cvt_hi(hi) } };
+}
+
+f64_block load(const int32_t *p, double) {
+	const int32x4_t lo = vld1q_s32(p);
+	const int32x4_t hi = vld1q_s32(p + 4);
+	return { { cvt_lo(lo), cvt_hi(lo), cvt_lo(hi), cvt_hi(hi) } };
+}
+
+f32_block load(const int16_t *p, float) {
+	const int16x8_t x = vld1q_s16(p);
+	return { { vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))),
+			vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))) } };
+}
+
+f32_block load(const int32_t *p, float) {
+	return { { vcvtq_f32_s32(vld1q_s32(p)), vcvtq_f32_s32(vld1q_s32(p + 4)) } };
+}
+
+f64_block load(const double *p) {
+	return { { vld1q_f64(p), vld1q_f64(p + 2), vld1q_f64(p + 4),
+			vld1q_f64(p + 6) } };
+}
+
+f32_block load(const float *p) {
+	return { { vld1q_f32(p), vld1q_f32(p + 4) } };
+}
+
+void store(double *p, const f64_block &x) {
+	for (int k = 0; k < 4; ++k) {
+		vst1q_f64(p + 2 * k, x.v[k]);
+	}
+}
+
+void store(float *p, const f32_block &x) {
+	vst1q_f32(p, x.v[0]);
+	vst1q_f32(p + 4, x.v[1]);
+}
+
+// fma(scalar, x, offset), as in the scalar kernels
+f64_block norm(const f64_block &x, float64x2_t scalar, float64x2_t offset) {
+	f64_block y;
+	for (int k = 0; k < 4; ++k) {
+		y.v[k] = vfmaq_f64(offset, scalar, x.v[k]);
+	}
+	return y;
+}
+
+f32_block norm(const f32_block &x, float32x4_t scalar, float32x4_t offset) {
+	return { { vfmaq_f32(offset, scalar, x.v[0]),
+			vfmaq_f32(offset, scalar, x.v[1]) } };
+}
+
+f64_block mul(const f64_block &a, const f64_block &b) {
+	f64_block y;
+	for (int k = 0; k < 4; ++k) {
+		y.v[k] = vmulq_f64(a.v[k], b.v[k]);
+	}
+	return y;
+}
+
+f32_block mul(const f32_block &a, const f32_block &b) {
+	return { { vmulq_f32(a.v[0], b.v[0]), vmulq_f32(a.v[1], b.v[1]) } };
+}
+
+// lo = a0 b0 a1 b1 a2 b2 a3 b3, hi = a4 b4 a5 b5 a6 b6 a7 b7
+void zip(const f64_block &a, const f64_block &b, f64_block &lo,
+		f64_block &hi) {
+	lo.v[0] = vzip1q_f64(a.v[0], b.v[0]);
+	lo.v[1] = vzip2q_f64(a.v[0], b.v[0]);
+	lo.v[2] = vzip1q_f64(a.v[1], b.v[1]);
+	lo.v[3] = vzip2q_f64(a.v[1], b.v[1]);
+	hi.v[0] = vzip1q_f64(a.v[2], b.v[2]);
+	hi.v[1] = vzip2q_f64(a.v[2], b.v[2]);
+	hi.v[2] = vzip1q_f64(a.v[3], b.v[3]);
+	hi.v[3] = vzip2q_f64(a.v[3], b.v[3]);
+}
+
+void zip(const f32_block &a, const f32_block &b, f32_block &lo,
+		f32_block &hi) {
+	lo.v[0] = vzip1q_f32(a.v[0], b.v[0]);
+	lo.v[1] = vzip2q_f32(a.v[0], b.v[0]);
+	hi.v[0] = vzip1q_f32(a.v[1], b.v[1]);
+	hi.v[1] = vzip2q_f32(a.v[1], b.v[1]);
+}
+
+template <typename T, typename R>
+size_t real_kernel(const T *in, const R *win, R *out, size_t size,
+		R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = size - size % block_size;
+	for (size_t i = 0; i < n; i += block_size) {
+		auto x = norm(load(in + i, R()), s, o);
+		if (win) {
+			x = mul(load(win + i), x);
+		}
+		store(out + i, x);
+	}
+	return n;
+}
+
+template <typename T, typename R>
+size_t split_kernel(const T *i_data, const T *q_data, const R *win, R *out,
+		size_t nfft, R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = nfft - nfft % block_size;
+	for (size_t j = 0; j < n; j += block_size) {
+		auto x = norm(load(i_data + j, R()), s, o);
+		auto y = norm(load(q_data + j, R()), s, o);
+		if (win) {
+			const auto w = load(win + j);
+			x = mul(w, x);
+			y = mul(w, y);
+		}
+		decltype(x) lo, hi;
+		zip(x, y, lo, hi);
+		store(out + 2 * j, lo);
+		store(out + 2 * j + block_size, hi);
+	}
+	return n;
+}
+
+template <typename T, typename R>
+size_t inter_kernel(const T *iq_data, const R *win, R *out, size_t nfft,
+		R scalar, R offset) {
+	const auto s = broadcast(scalar);
+	const auto o = broadcast(offset);
+	const size_t n = nfft - nfft % block_size;
+	for (size_t j = 0; j < n; j += block_size) {
+		auto x = norm(load(iq_data + 2 * j, R()), s, o);
+		auto y = norm(load(iq_data + 2 * j + block_size, R()), s, o);
+		if (win) {
+			const auto w = load(win + j);
+			decltype(x) w_lo, w_hi; // each coefficient twice
+			zip(w, w, w_lo, w_hi);
+			x = mul(w_lo, x);
+			y = mul(w_hi, y);
+		}
+		store(out + 2 * j, x);
+		store(out + 2 * j + block_size, y);
+	}
+	return n;
+}
+
+template <typename R>
+constexpr norm_window_kernels<R> make_kernels() {
+	return { real_kernel<int16_t, R>, real_kernel<int32_t, R>,
+		split_kernel<int16_t, R>, split_kernel<int32_t, R>,
+		inter_kernel<int16_t, R>, inter_kernel<int32_t, R> };
+}
+
+} // namespace
+
+const simd_kernel_table neon_kernel_table = { make_kernels<double>(),
+	make_kernels<float>() };
+
+} // namespace genalyzer_impl
@@ -0,0 +1,362 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "sine_fit.hpp"
+
+#include "constants.hpp"
+#include "utils.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace genalyzer_impl {
+
+namespace {
+
+// The fit kernels work on blocks of block_size samples.  cos(w * n) and
+// sin(w * n) are computed directly for the first sample of each block, then
+// rotated by a table of the phasors of w * k, so errors do not accumulate from
+// block to block, and no two samples of a block depend on each other.  Sums
+// are kept in lanes independent partial sums.  Both make the loops below
+// vectorize, and the whole fit O(N) with one sin/cos pair per block.
+constexpr size_t block_size = 64;
+constexpr size_t lanes = 4;
+constexpr int max_iterations = 50;
+constexpr real_t max_step = 0.5; // bins per four-parameter iteration
+
+using lane_sum = std::array<real_t, lanes>;
+
+real_t total(const lane_sum &acc) {
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+// acc[l] += a[k] * b[k] for every k in the block with k % lanes == l
+void accumulate(lane_sum &acc, const real_t *a, const real_t *b) {
+	for (size_t k = 0; k < block_size; k += lanes) {
+		for (size_t l = 0; l < lanes; ++l) {
+			acc[l] += a[k + l] * b[k + l];
+		}
+	}
+}
+
+// One block of data with the fit columns cos(w * n), sin(w * n), and 1.  Past
+// the end of the data, every column is 0, so padding adds nothing to a sum.
+template <typename T>
+class fit_block {
+public:
+	fit_block(const T *data, size_t size, real_t w) :
+			m_data{ data }, m_size{ size }, m_w{ w } {
+		for (size_t k = 0; k < block_size; ++k) {
+			const real_t theta = w * static_cast<real_t>(k);
+			m_cos_k[k] = std::cos(theta);
+			m_sin_k[k] = std::sin(theta);
+		}
+	}
+
+	size_t count() const {
+		return (m_size + block_size - 1) / block_size;
+	}
+
+	void load(size_t b) {
+		const size_t n0 = b * block_size;
+		const size_t m = std::min(block_size, m_size - n0);
+		const real_t theta = m_w * static_cast<real_t>(n0);
+		const real_t c0 = std::cos(theta);
+		const real_t s0 = std::sin(theta);
+		for (size_t k = 0; k < block_size; ++k) {
+			c[k] = c0 * m_cos_k[k] - s0 * m_sin_k[k];
+			s[k] = s0 * m_cos_k[k] + c0 * m_sin_k[k];
+			n[k] = static_cast<real_t>(n0 + k);
+		}
+		for (size_t k = 0; k < m; ++k) {
+			y[k] = static_cast<real_t>(m_data[n0 + k]);
+			one[k] = 1.0;
+		}
+		for (size_t k = m; k < block_size; ++k) {
+			c[k] = 0.0;
+			s[k] = 0.0;
+			y[k] = 0.0;
+			one[k] = 0.0;
+		}
+	}
+
+	alignas(64) real_t c[block_size];
+	alignas(64) real_t s[block_size];
+	alignas(64) real_t y[block_size];
+	alignas(64) real_t one[block_size];
+	alignas(64) real_t n[block_size];
+
+private:
+	const T *m_data;
+	size_t m_size;
+	real_t m_w;
+	alignas(64) real_t m_cos_k[block_size];
+	alignas(64) real_t m_sin_k[block_size];
+};
+
+using matrix4 = std::array<std::array<real_t, 4>, 4>;
+using vector4 = std::array<real_t, 4>;
+
+// Solves the leading p x p block of the symmetric system m * x = r, and
+// returns x.  The system is scaled to a unit diagonal first, since the
+// frequency column is much larger than the others.  m[2][2] is the number of
+// samples, so a column whose norm is tiny relative to it (e.g., the sine
+// column at fs/2) is treated as singular.
+vector4 solve(matrix4 m, vector4 r, size_t p) {
+	const char *msg = "sine_fit_analysis : fit is singular";
+	const real_t min_diag = 1e-12 * m[2][2];
+	vector4 scale{};
+	for (size_t i = 0; i < p; ++i) {
+		if (!(min_diag < m[i][i])) {
+			throw runtime_error(msg);
+		}
+		scale[i] = 1.0 / std::sqrt(m[i][i]);
+	}
+	for (size_t i = 0; i < p; ++i) {
+		for (size_t j = 0; j < p; ++j) {
+			m[i][j] *= scale[i] * scale[j];
+		}
+		r[i] *= scale[i];
+	}
+	// Gaussian elimination with partial pivoting
+	for (size_t i = 0; i < p; ++i) {
+		size_t pivot = i;
+		for (size_t j = i + 1; j < p; ++j) {
+			if (std::fabs(m[pivot][i]) < std::fabs(m[j][i])) {
+				pivot = j;
+			}
+		}
+		if (!(1e-12 < std::fabs(m[pivot][i]))) {
+			throw runtime_error(msg);
+		}
+		std::swap(m[i], m[pivot]);
+		std::swap(r[i], r[pivot]);
+		for (size_t j = i + 1; j < p; ++j) {
+			const real_t f = m[j][i] / m[i][i];
+			for (size_t k = i; k < p; ++k) {
+				m[j][k] -= f * m[i][k];
+			}
+			r[j] -= f * r[i];
+		}
+	}
+	vector4 x{};
+	for (size_t i = p; 0 < i--;) {
+		real_t v = r[i];
+		for (size_t k = i + 1; k < p; ++k) {
+			v -= m[i][k] * x[k];
+		}
+		x[i] = v / m[i][i];
+	}
+	for (size_t i = 0; i < p; ++i) {
+		x[i] *= scale[i];
+	}
+	return x;
+}
+
+// Sums over the data of the products of the fit columns cos(w * n),
+// sin(w * n), and 1 with each other and with y[n], and, for the
+// four-parameter fit, with n and n^2.  The derivative of the model with
+// respect to w is n * (b * cos(w * n) - a * sin(w * n)), which is linear in
+// the amplitudes a and b, so its sums follow from these for any a and b, and
+// the amplitudes can be re-solved at each frequency without another pass.
+struct fit_sums {
+	real_t n, cc, cs, ss, c1, s1, yc, ys, y1, yy; // three-parameter fit
+	real_t ncc, ncs, nss, nc, ns, nncc, nncs, nnss, ync, yns; // frequency
+};
+
+template <typename T>
+fit_sums sum_fit(const T *data, size_t size, real_t w, bool fit_freq) {
+	fit_block<T> blk(data, size, w);
+	lane_sum cc{}, cs{}, ss{}, c1{}, s1{}, yc{}, ys{}, y1{}, yy{};
+	lane_sum ncc{}, ncs{}, nss{}, nc{}, ns{}, nncc{}, nncs{}, nnss{}, ync{},
+			yns{};
+	alignas(64) real_t nc_k[block_size];
+	alignas(64) real_t ns_k[block_size];
+	for (size_t b = 0; b < blk.count(); ++b) {
+		blk.load(b);
+		accumulate(cc, blk.c, blk.c);
+		accumulate(cs, blk.c, blk.s);
+		accumulate(ss, blk.s, blk.s);
+		accumulate(c1, blk.c, blk.one);
+		accumulate(s1, blk.s, blk.one);
+		accumulate(yc, blk.y, blk.c);
+		accumulate(ys, blk.y, blk.s);
+		accumulate(y1, blk.y, blk.one);
+		accumulate(yy, blk.y, blk.y);
+		if (fit_freq) {
+			for (size_t k = 0; k < block_size; ++k) {
+				nc_k[k] = blk.n[k] * blk.c[k];
+				ns_k[k] = blk.n[k] * blk.s[k];
+			}
+			accumulate(ncc, nc_k, blk.c);
+			accumulate(ncs, nc_k, blk.s);
+			accumulate(nss, ns_k, blk.s);
+			accumulate(nc, nc_k, blk.one);
+			accumulate(ns, ns_k, blk.one);
+			accumulate(nncc, nc_k, nc_k);
+			accumulate(nncs, nc_k, ns_k);
+			accumulate(nnss, ns_k, ns_k);
+			accumulate(ync, blk.y, nc_k);
+			accumulate(yns, blk.y, ns_k);
+		}
+	}
+	return fit_sums{ static_cast<real_t>(size), total(cc), total(cs),
+		total(ss), total(c1), total(s1), total(yc), total(ys), total(y1),
+		total(yy), total(ncc), total(ncs), total(nss), total(nc), total(ns),
+		total(nncc), total(nncs), total(nnss), total(ync), total(yns) };
+}
+
+// Least-squares fit of y[n] = a * cos(w * n) + b * sin(w * n) + offset.
+// Returns (a, b, offset, 0).
+vector4 fit3(const fit_sums &f) {
+	matrix4 m{ { { f.cc, f.cs, f.c1, 0.0 }, { f.cs, f.ss, f.s1, 0.0 },
+			{ f.c1, f.s1, f.n, 0.0 }, { 0.0, 0.0, 0.0, 0.0 } } };
+	vector4 r{ f.yc, f.ys, f.y1, 0.0 };
+	return solve(m, r, 3);
+}
+
+// Returns the residual sum of squares of the three-parameter fit x, from the
+// normal equations.  At high SNR it is lost to rounding, below about 1e-15 of
+// f.yy, so it is only compared with a margin of f.yy.
+real_t residual_ss(const fit_sums &f, const vector4 &x) {
+	return std::max(real_t{ 0.0 },
+			f.yy - (x[0] * f.yc + x[1] * f.ys + x[2] * f.y1));
+}
+
+// Gauss-Newton step of the four-parameter fit, linearized at the amplitudes
+// of the three-parameter fit x0 at the same w, whose residual sum of squares
+// is rss.  Returns (a, b, offset, dw), and sets var_w to the variance of w
+// implied by the residual.
+vector4 fit4(const fit_sums &f, const vector4 &x0, real_t rss,
+		real_t &var_w) {
+	const real_t a0 = x0[0];
+	const real_t b0 = x0[1];
+	const real_t dc = b0 * f.ncc - a0 * f.ncs;
+	const real_t ds = b0 * f.ncs - a0 * f.nss;
+	const real_t d1 = b0 * f.nc - a0 * f.ns;
+	const real_t dd = b0 * b0 * f.nncc - 2.0 * a0 * b0 * f.nncs +
+			a0 * a0 * f.nnss;
+	const real_t yd = b0 * f.ync - a0 * f.yns;
+	matrix4 m{ { { f.cc, f.cs, f.c1, dc }, { f.cs, f.ss, f.s1, ds },
+			{ f.c1, f.s1, f.n, d1 }, { dc, ds, d1, dd } } };
+	vector4 r{ f.yc, f.ys, f.y1, yd };
+	var_w = rss / (f.n - 4.0) * solve(m, vector4{ 0.0, 0.0, 0.0, 1.0 }, 4)[3];
+	return solve(m, r, 4);
+}
+
+// Returns the RMS of y[n] - (a * cos(w * n) + b * sin(w * n) + offset)
+template <typename T>
+real_t residual_rms(const T *data, size_t size, real_t w, real_t a, real_t b,
+		real_t offset) {
+	fit_block<T> blk(data, size, w);
+	lane_sum rr{};
+	alignas(64) real_t r[block_size];
+	for (size_t i = 0; i < blk.count(); ++i) {
+		blk.load(i);
+		for (size_t k = 0; k < block_size; ++k) {
+			r[k] = blk.y[k] -
+					(a * blk.c[k] + b * blk.s[k] + offset * blk.one[k]);
+		}
+		accumulate(rr, r, r);
+	}
+	return std::sqrt(total(rr) / static_cast<real_t>(size));
+}
+
+} // namespace
+
+template <typename T>
+std::map<str_t, real_t> sine_fit_analysis(const T *wf_data, size_t wf_size,
+		real_t fs, real_t freq, bool fit_freq) {
+	const char *trace = "sine_fit_analysis : ";
+	check_array(trace, "waveform array", wf_data, wf_size);
+	if (wf_size < 4) {
+		throw runtime_error(str_t(trace) + "waveform array size < 4");
+	}
+	assert_gt0(trace, "fs", fs);
+	assert_gt0(trace, "freq", freq);
+	real_t w = k_2pi * freq / fs; // radians per sample
+	int iterations = 0;
+	if (fit_freq) {
+		// Each iteration re-solves the amplitudes at the current frequency,
+		// then takes a Gauss-Newton step linearized at them.  Linearizing at
+		// the amplitudes of the previous step instead couples their error into
+		// the frequency step, which converges only linearly at low SNR.
+		// Steps are limited to max_step bins, which keeps a start that is
+		// nearly a bin off from overshooting, and a step that increases the
+		// residual is halved, so that at very low SNR, where the residual has
+		// local minima about a bin apart, the fit settles in one of them.
+		// Stop when the step moves the phase of the last sample by < 1e-9 rad,
+		// or, with noise, when it is < 1% of the standard error of w: further
+		// steps cannot improve the estimate, and with a large residual
+		// Gauss-Newton converges slowly.
+		const real_t dw_max = max_step * k_2pi / static_cast<real_t>(wf_size);
+		const real_t tol = 1e-9 / static_cast<real_t>(wf_size);
+		real_t w_prev = w;
+		real_t step = 0.0;
+		real_t rss_prev = 0.0;
+		while (true) {
+			if (max_iterations == iterations) {
+				throw runtime_error(str_t(trace) +
+						"four-parameter fit did not converge");
+			}
+			const fit_sums f = sum_fit(wf_data, wf_size, w, true);
+			const vector4 x0 = fit3(f);
+			const real_t rss = residual_ss(f, x0);
+			if (0 < iterations++ && rss_prev + 1e-12 * f.yy < rss) {
+				step *= 0.5;
+				w = w_prev + step;
+				if (std::fabs(step) <= tol) {
+					break;
+				}
+				continue;
+			}
+			real_t var_w = 0.0;
+			const real_t dw = fit4(f, x0, rss, var_w)[3];
+			step = std::max(-dw_max, std::min(dw, dw_max));
+			w_prev = w;
+			rss_prev = rss;
+			w += step;
+			if (std::fabs(dw) <= std::max(tol, 1e-2 * std::sqrt(var_w))) {
+				break;
+			}
+		}
+	}
+	// Amplitudes and offset at the final frequency
+	const vector4 x = fit3(sum_fit(wf_data, wf_size, w, false));
+	const real_t ampl = std::hypot(x[0], x[1]);
+	const real_t resid =
+			residual_rms(wf_data, wf_size, w, x[0], x[1], x[2]);
+	const real_t sinad =
+			bounded_db20(ampl * k_inv_sqrt2) - bounded_db20(resid);
+	// IEEE Std 1241: SINAD of an ideal N-bit quantizer is 6.02N + 1.76 dB
+	const real_t enob = (sinad - 10.0 * std::log10(1.5)) /
+			(20.0 * std::log10(2.0));
+	const std::vector<str_t> &keys = sine_fit_analysis_ordered_keys();
+	return std::map<str_t, real_t>{
+		{ keys[0], ampl },
+		{ keys[1], w * fs / k_2pi },
+		{ keys[2], std::atan2(-x[1], x[0]) },
+		{ keys[3], x[2] },
+		{ keys[4], resid },
+		{ keys[5], sinad },
+		{ keys[6], enob },
+		{ keys[7], static_cast<real_t>(iterations) }
+	};
+}
+
+template std::map<str_t, real_t> sine_fit_analysis(const int16_t *, size_t,
+		real_t, real_t, bool);
+template std::map<str_t, real_t> sine_fit_analysis(const int32_t *, size_t,
+		real_t, real_t, bool);
+template std::map<str_t, real_t> sine_fit_analysis(const int64_t *, size_t,
+		real_t, real_t, bool);
+template std::map<str_t, real_t> sine_fit_analysis(const real_t *, size_t,
+		real_t, real_t, bool);
+
+const std::vector<str_t> &sine_fit_analysis_ordered_keys() {
+	static const std::vector<str_t> keys{ "ampl", "freq", "phase", "offset",
+		"resid_rms", "sinad", "enob", "iterations" };
+	return keys;
+}
+
+} // namespace genalyzer_impl
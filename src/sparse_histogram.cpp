@@ -0,0 +1,186 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "sparse_histogram.hpp"
+
+#include "code_density.hpp"
+#include "exceptions.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+
+namespace genalyzer_impl {
+
+std::shared_ptr<sparse_histogram> sparse_histogram::create(int n,
+		CodeFormat format) {
+	std::pair<int64_t, int64_t> mm =
+			resolution_to_minmax<int64_t>(n, format);
+	return create(mm.first, mm.second);
+}
+
+sparse_histogram::sparse_histogram(int64_t min, int64_t max) :
+		m_min{ min },
+		m_max{ max },
+		m_size{ code_densityx_size(min, max) },
+		m_sum{ 0 },
+		m_pages{},
+		m_spill{} {
+	m_pages.resize((m_size - 1) / page_size + 1);
+}
+
+template <typename T>
+void sparse_histogram::add(const T *wf_data, size_t wf_size) {
+	check_array("sparse_histogram::add : ", "waveform array", wf_data,
+			wf_size);
+	// Codes outside [min, max] wrap around to more than span
+	const uint64_t umin = static_cast<uint64_t>(m_min);
+	const uint64_t span = static_cast<uint64_t>(m_size - 1);
+	uint64_t count = 0;
+	for (size_t i = 0; i < wf_size; ++i) {
+		const int64_t x = static_cast<int64_t>(wf_data[i]);
+		const uint64_t k = static_cast<uint64_t>(x) - umin;
+		if (span < k) {
+			continue;
+		}
+		std::vector<uint32_t> &page = m_pages[k >> page_bits];
+		if (page.empty()) {
+			page.assign(page_size, 0);
+		}
+		if (0 == ++page[k & (page_size - 1)]) {
+			++m_spill[k];
+		}
+		++count;
+	}
+	m_sum += count;
+}
+
+template void sparse_histogram::add(const int16_t *, size_t);
+template void sparse_histogram::add(const int32_t *, size_t);
+template void sparse_histogram::add(const int64_t *, size_t);
+
+void sparse_histogram::reset() {
+	for (std::vector<uint32_t> &page : m_pages) {
+		std::vector<uint32_t>().swap(page);
+	}
+	m_spill.clear();
+	m_sum = 0;
+}
+
+uint64_t sparse_histogram::count(size_t index) const {
+	if (m_size <= index) {
+		throw runtime_error("sparse_histogram::count : index out of range");
+	}
+	const std::vector<uint32_t> &page = m_pages[index >> page_bits];
+	if (page.empty()) {
+		return 0;
+	}
+	uint64_t c = page[index & (page_size - 1)];
+	if (!m_spill.empty()) {
+		auto it = m_spill.find(index);
+		if (m_spill.end() != it) {
+			c += it->second << 32;
+		}
+	}
+	return c;
+}
+
+void sparse_histogram::get(uint64_t *hist_data, size_t hist_size,
+		size_t first) const {
+	const char *trace = "sparse_histogram::get : ";
+	check_array(trace, "hist array", hist_data, hist_size);
+	if (m_size < first || m_size - first < hist_size) {
+		throw runtime_error(str_t(trace) + "bins out of range");
+	}
+	const size_t last = first + hist_size;
+	size_t i = first;
+	while (i < last) {
+		const std::vector<uint32_t> &page = m_pages[i >> page_bits];
+		const size_t page_end =
+				std::min(last, ((i >> page_bits) + 1) << page_bits);
+		uint64_t *out = hist_data + (i - first);
+		if (page.empty()) {
+			std::fill(out, out + (page_end - i), 0);
+		} else {
+			std::copy(page.begin() + (i & (page_size - 1)),
+					page.begin() + ((page_end - 1) & (page_size - 1)) + 1,
+					out);
+		}
+		i = page_end;
+	}
+	for (auto it = m_spill.lower_bound(first);
+			m_spill.end() != it && it->first < last; ++it) {
+		hist_data[it->first - first] += it->second << 32;
+	}
+}
+
+size_p sparse_histogram::nz_range() const {
+	// Every allocated page has a non-zero bin, but its counter is zero if the
+	// count is a multiple of 2^32
+	auto nz = [this](const std::vector<uint32_t> &page, size_t index) {
+		return 0 != page[index & (page_size - 1)] ||
+				(!m_spill.empty() && 0 != m_spill.count(index));
+	};
+	size_t p = 0;
+	while (p < m_pages.size() && m_pages[p].empty()) {
+		++p;
+	}
+	if (m_pages.size() == p) {
+		return size_p(m_size, m_size);
+	}
+	size_t first = p << page_bits;
+	while (!nz(m_pages[p], first)) {
+		++first;
+	}
+	p = m_pages.size() - 1;
+	while (m_pages[p].empty()) {
+		--p;
+	}
+	size_t last = std::min(m_size, (p + 1) << page_bits) - 1;
+	while (!nz(m_pages[p], last)) {
+		--last;
+	}
+	return size_p(first, last);
+}
+
+size_t sparse_histogram::memory_size() const {
+	size_t bytes = m_pages.size() * sizeof(std::vector<uint32_t>);
+	for (const std::vector<uint32_t> &page : m_pages) {
+		bytes += page.capacity() * sizeof(uint32_t);
+	}
+	bytes += m_spill.size() * (sizeof(size_t) + sizeof(uint64_t));
+	return bytes;
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Virtual Function Overrides
+
+bool sparse_histogram::equals_impl(const object &that_obj) const {
+	if (ObjectType::SparseHistogram != that_obj.object_type()) {
+		return false;
+	}
+	auto &that = static_cast<const sparse_histogram &>(that_obj);
+	return (this->m_min == that.m_min) && (this->m_max == that.m_max) &&
+			(this->m_sum == that.m_sum) && (this->m_pages == that.m_pages) &&
+			(this->m_spill == that.m_spill);
+}
+
+void sparse_histogram::save_impl(const str_t &) const {
+	throw runtime_error("sparse_histogram::save : not supported");
+}
+
+str_t sparse_histogram::to_string_impl() const {
+	size_t npages = 0;
+	for (const std::vector<uint32_t> &page : m_pages) {
+		npages += page.empty() ? 0 : 1;
+	}
+	str_t s = "SparseHistogram\n";
+	s += "  min   : " + std::to_string(m_min) + "\n";
+	s += "  max   : " + std::to_string(m_max) + "\n";
+	s += "  sum   : " + std::to_string(m_sum) + "\n";
+	s += "  pages : " + std::to_string(npages) + " of " +
+			std::to_string(m_pages.size()) + "\n";
+	return s;
+}
+
+} // namespace genalyzer_impl
@@ -0,0 +1,207 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "spectrum_averager.hpp"
+
+#include "enum_maps.hpp"
+#include "exceptions.hpp"
+#include "fourier_transforms.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace genalyzer_impl {
+
+spectrum_averager::spectrum_averager(bool cplx, size_t nfft, Window window,
+		RfftScale scale) :
+		m_cplx{ cplx },
+		m_nfft{ nfft },
+		m_window{ window },
+		m_scale{ scale },
+		m_count{ 0 },
+		m_work{},
+		m_power{},
+		m_phase{} {
+	assert_gt0("spectrum_averager : ", "nfft", nfft);
+	const size_t nbins = cplx ? nfft : nfft / 2 + 1;
+	m_work.resize(nbins * 2);
+	m_power.resize(nbins);
+	m_phase.resize(nbins);
+}
+
+void spectrum_averager::add(const real_t *i_data, size_t i_size,
+		const real_t *q_data, size_t q_size) {
+	check_type(true);
+	if (0 == q_size) {
+		// Interleaved I/Q: each record is 2 * nfft elements
+		check_array("", "input array", i_data, i_size, true);
+		const size_t nrec = record_count(i_size / 2);
+		const size_t rec_size = m_nfft * 2;
+		for (size_t k = 0; k < nrec; ++k) {
+			fft(i_data + k * rec_size, rec_size, nullptr, 0, m_work.data(),
+					m_work.size(), 1, m_nfft, m_window);
+			accumulate();
+		}
+	} else {
+		check_array_pair("", "I array", i_data, i_size, "Q array", q_data,
+				q_size);
+		const size_t nrec = record_count(i_size);
+		for (size_t k = 0; k < nrec; ++k) {
+			fft(i_data + k * m_nfft, m_nfft, q_data + k * m_nfft, m_nfft,
+					m_work.data(), m_work.size(), 1, m_nfft, m_window);
+			accumulate();
+		}
+	}
+}
+
+template <typename T>
+void spectrum_averager::add(const T *i_data, size_t i_size, const T *q_data,
+		size_t q_size, int n, CodeFormat format) {
+	check_type(true);
+	if (0 == q_size) {
+		// Interleaved I/Q: each record is 2 * nfft elements
+		check_array("", "input array", i_data, i_size, true);
+		const size_t nrec = record_count(i_size / 2);
+		const size_t rec_size = m_nfft * 2;
+		for (size_t k = 0; k < nrec; ++k) {
+			const T *q_null = nullptr;
+			fft(i_data + k * rec_size, rec_size, q_null, 0, m_work.data(),
+					m_work.size(), n, 1, m_nfft, m_window, format);
+			accumulate();
+		}
+	} else {
+		check_array_pair("", "I array", i_data, i_size, "Q array", q_data,
+				q_size);
+		const size_t nrec = record_count(i_size);
+		for (size_t k = 0; k < nrec; ++k) {
+			fft(i_data + k * m_nfft, m_nfft, q_data + k * m_nfft, m_nfft,
+					m_work.data(), m_work.size(), n, 1, m_nfft, m_window,
+					format);
+			accumulate();
+		}
+	}
+}
+
+template void spectrum_averager::add(const int16_t *, size_t, const int16_t *,
+		size_t, int, CodeFormat);
+template void spectrum_averager::add(const int32_t *, size_t, const int32_t *,
+		size_t, int, CodeFormat);
+template void spectrum_averager::add(const int64_t *, size_t, const int64_t *,
+		size_t, int, CodeFormat);
+
+void spectrum_averager::radd(const real_t *in_data, size_t in_size) {
+	check_type(false);
+	check_array("", "input array", in_data, in_size);
+	const size_t nrec = record_count(in_size);
+	for (size_t k = 0; k < nrec; ++k) {
+		rfft(in_data + k * m_nfft, m_nfft, m_work.data(), m_work.size(), 1,
+				m_nfft, m_window, m_scale);
+		accumulate();
+	}
+}
+
+template <typename T>
+void spectrum_averager::radd(const T *in_data, size_t in_size, int n,
+		CodeFormat format) {
+	check_type(false);
+	check_array("", "input array", in_data, in_size);
+	const size_t nrec = record_count(in_size);
+	for (size_t k = 0; k < nrec; ++k) {
+		rfft(in_data + k * m_nfft, m_nfft, m_work.data(), m_work.size(), n,
+				1, m_nfft, m_window, format, m_scale);
+		accumulate();
+	}
+}
+
+template void spectrum_averager::radd(const int16_t *, size_t, int,
+		CodeFormat);
+template void spectrum_averager::radd(const int32_t *, size_t, int,
+		CodeFormat);
+template void spectrum_averager::radd(const int64_t *, size_t, int,
+		CodeFormat);
+
+void spectrum_averager::get(real_t *out_data, size_t out_size) const {
+	check_array("", "output array", out_data, out_size);
+	assert_eq("", "output array size", out_size, "expected", size());
+	if (0 == m_count) {
+		throw runtime_error("spectrum_averager::get : no records added");
+	}
+	// Same reduction as the averaging in fft() / rfft(): RMS magnitude and
+	// mean phase.  The FFT scale factors are already applied to each record.
+	const real_t avg_scalar = 1.0 / static_cast<real_t>(m_count);
+	cplx_t *cout_data = reinterpret_cast<cplx_t *>(out_data);
+	for (size_t i = 0; i < m_power.size(); ++i) {
+		cout_data[i] = std::polar(std::sqrt(m_power[i] * avg_scalar),
+				m_phase[i] * avg_scalar);
+	}
+}
+
+void spectrum_averager::reset() {
+	m_count = 0;
+	std::fill(m_power.begin(), m_power.end(), 0.0);
+	std::fill(m_phase.begin(), m_phase.end(), 0.0);
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Virtual Function Overrides
+
+bool spectrum_averager::equals_impl(const object &that_obj) const {
+	if (ObjectType::SpectrumAverager != that_obj.object_type()) {
+		return false;
+	}
+	auto &that = static_cast<const spectrum_averager &>(that_obj);
+	return (this->m_cplx == that.m_cplx) && (this->m_nfft == that.m_nfft) &&
+			(this->m_window == that.m_window) &&
+			(this->m_scale == that.m_scale) &&
+			(this->m_count == that.m_count) &&
+			(this->m_power == that.m_power) && (this->m_phase == that.m_phase);
+}
+
+void spectrum_averager::save_impl(const str_t &) const {
+	throw runtime_error("spectrum_averager::save : not supported");
+}
+
+str_t spectrum_averager::to_string_impl() const {
+	str_t s = "SpectrumAverager\n";
+	s += "  type   : " + str_t(m_cplx ? "complex" : "real") + "\n";
+	s += "  nfft   : " + std::to_string(m_nfft) + "\n";
+	s += "  window : " + window_map.at(to_int(m_window)) + "\n";
+	if (!m_cplx) {
+		s += "  scale  : " + rfft_scale_map.at(to_int(m_scale)) + "\n";
+	}
+	s += "  count  : " + std::to_string(m_count) + "\n";
+	return s;
+}
+
+} // namespace genalyzer_impl
+
+namespace genalyzer_impl { // Non-Public
+
+void spectrum_averager::check_type(bool cplx) const {
+	if (cplx != m_cplx) {
+		throw runtime_error(str_t("spectrum_averager : object averages ") +
+				(m_cplx ? "complex" : "real") + " FFTs");
+	}
+}
+
+size_t spectrum_averager::record_count(size_t size) const {
+	if (0 != size % m_nfft) {
+		throw runtime_error("spectrum_averager : input size (" +
+				std::to_string(size) + ") is not a multiple of nfft (" +
+				std::to_string(m_nfft) + ")");
+	}
+	return size / m_nfft;
+}
+
+void spectrum_averager::accumulate() {
+	const cplx_t *cwork = reinterpret_cast<const cplx_t *>(m_work.data());
+	for (size_t i = 0; i < m_power.size(); ++i) {
+		m_power[i] += std::norm(cwork[i]);
+		m_phase[i] += std::arg(cwork[i]);
+	}
+	++m_count;
+}
+
+} // namespace genalyzer_impl
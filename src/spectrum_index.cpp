@@ -0,0 +1,171 @@
+// Copyright (C) 2024-2026 Analog Devices, Inc.
+//
+// SPDX short identifier: ADIBSD OR GPL-2.0-or-later
+#include "spectrum_index.hpp"
+
+namespace genalyzer_impl {
+
+namespace {
+
+real_t block_sum(const real_t *data) {
+	// Four independent partial sums, so the loop is not latency bound
+	real_t acc[4] = { 0.0, 0.0, 0.0, 0.0 };
+	for (size_t i = 0; i < spectrum_index::block_size; i += 4) {
+		acc[0] += data[i];
+		acc[1] += data[i + 1];
+		acc[2] += data[i + 2];
+		acc[3] += data[i + 3];
+	}
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+// Updates (best, best_value) with the first maximum of data[i1, i2)
+void scan_max(const real_t *data, size_t i1, size_t i2, diff_t &best,
+		real_t &best_value) {
+	for (size_t i = i1; i < i2; ++i) {
+		if (best_value < data[i]) {
+			best_value = data[i];
+			best = static_cast<diff_t>(i);
+		}
+	}
+}
+
+constexpr size_t no_block = static_cast<size_t>(-1);
+
+// Returns the largest element of one block, or 0 if none is greater than 0
+real_t block_max(const real_t *data) {
+	real_t acc[4] = { 0.0, 0.0, 0.0, 0.0 };
+	for (size_t i = 0; i < spectrum_index::block_size; i += 4) {
+		for (size_t j = 0; j < 4; ++j) {
+			acc[j] = (acc[j] < data[i + j]) ? data[i + j] : acc[j];
+		}
+	}
+	const real_t a = (acc[0] < acc[1]) ? acc[1] : acc[0];
+	const real_t b = (acc[2] < acc[3]) ? acc[3] : acc[2];
+	return (a < b) ? b : a;
+}
+
+} // namespace
+
+void spectrum_index::build(const real_t *data, size_t size, bool max_queries) {
+	m_data = data;
+	m_size = size;
+	const size_t nblocks = size / block_size;
+	m_prefix.resize((nblocks + 1) * 2);
+	max_queries = max_queries && 0 < nblocks;
+	m_block_max.resize(max_queries ? nblocks : 0);
+	real_t *p = m_prefix.data();
+	real_t hi = 0.0;
+	real_t lo = 0.0;
+	p[0] = hi;
+	p[1] = lo;
+	for (size_t b = 0; b < nblocks; ++b) {
+		const real_t *block = data + b * block_size;
+		const real_t x = block_sum(block);
+		// hi + lo += x, with the rounding error of hi + x kept in lo (TwoSum)
+		const real_t s = hi + x;
+		const real_t v = s - hi;
+		lo += (hi - (s - v)) + (x - v);
+		// Renormalize, so that |lo| <= ulp(hi) / 2 (FastTwoSum)
+		hi = s + lo;
+		lo -= hi - s;
+		p += 2;
+		p[0] = hi;
+		p[1] = lo;
+		if (max_queries) {
+			// In the same pass, while the block is still in cache
+			m_block_max[b] = block_max(block);
+		}
+	}
+	if (!max_queries) {
+		m_leaves = 0;
+		m_tree.clear();
+		return;
+	}
+	// Bottom-up segment tree: node k has children 2k and 2k+1, and the leaves
+	// start at m_leaves.  On ties the left (lower) block wins.  The padding
+	// leaves have a maximum of -1, so they never win over a real block.
+	m_leaves = 1;
+	while (m_leaves < nblocks) {
+		m_leaves *= 2;
+	}
+	m_block_max.resize(m_leaves, -1.0);
+	m_tree.resize(m_leaves * 2);
+	for (size_t b = 0; b < m_leaves; ++b) {
+		m_tree[m_leaves + b] = b;
+	}
+	for (size_t k = m_leaves - 1; 0 < k; --k) {
+		const size_t l = m_tree[k * 2];
+		const size_t r = m_tree[k * 2 + 1];
+		m_tree[k] = (m_block_max[l] < m_block_max[r]) ? r : l;
+	}
+}
+
+std::pair<diff_t, real_t> spectrum_index::max_index(size_t i1,
+		size_t i2) const {
+	diff_t best = -1;
+	real_t best_value = 0.0;
+	const size_t b1 = (i1 + block_size - 1) / block_size; // first whole block
+	const size_t b2 = i2 / block_size; // one past the last whole block
+	if (b2 <= b1 || 0 == m_leaves) {
+		scan_max(m_data, i1, i2, best, best_value);
+		return { best, best_value };
+	}
+	scan_max(m_data, i1, b1 * block_size, best, best_value);
+	// Nodes to the left are visited in ascending order and nodes to the right
+	// in descending order, so ties resolve to the lowest block
+	size_t left = no_block;
+	size_t right = no_block;
+	auto better = [this](size_t a, size_t b) { // a precedes b
+		if (no_block == b) {
+			return a;
+		}
+		if (no_block == a) {
+			return b;
+		}
+		return (m_block_max[a] < m_block_max[b]) ? b : a;
+	};
+	for (size_t l = b1 + m_leaves, r = b2 + m_leaves; l < r; l /= 2, r /= 2) {
+		if (l & 1) {
+			left = better(left, m_tree[l++]);
+		}
+		if (r & 1) {
+			right = better(m_tree[--r], right);
+		}
+	}
+	const size_t b = better(left, right);
+	if (no_block != b && best_value < m_block_max[b]) {
+		const size_t n1 = b * block_size;
+		diff_t i = -1;
+		real_t v = 0.0;
+		scan_max(m_data, n1, n1 + block_size, i, v);
+		best = i;
+		best_value = v;
+	}
+	scan_max(m_data, b2 * block_size, i2, best, best_value);
+	return { best, best_value };
+}
+
+real_t spectrum_index::sum(size_t i1, size_t i2) const {
+	const size_t b1 = (i1 + block_size - 1) / block_size; // first whole block
+	const size_t b2 = i2 / block_size; // one past the last whole block
+	real_t mag = 0.0;
+	if (b2 <= b1) {
+		for (size_t i = i1; i < i2; ++i) {
+			mag += m_data[i];
+		}
+		return mag;
+	}
+	for (size_t i = i1; i < b1 * block_size; ++i) {
+		mag += m_data[i];
+	}
+	const real_t *p1 = &m_prefix[b1 * 2];
+	const real_t *p2 = &m_prefix[b2 * 2];
+	mag += (p2[0] - p1[0]) + (p2[1] - p1[1]);
+	for (size_t i = b2 * block_size; i < i2; ++i) {
+		mag += m_data[i];
+	}
+	return mag;
+}
+
+} // namespace genalyzer_impl
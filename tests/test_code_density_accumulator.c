@@ -0,0 +1,249 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NPTS 60000
+#define NWORKERS 3
+#define NCHUNKS 4
+#define XMIN -300
+#define XMAX 900
+#define RES 10
+#define HIST_SIZE (1 << RES)
+
+// Checks that gn_cda_analysis of obj_key equals gn_hist_analysis of hist
+static int check_analysis(const char *obj_key, const uint64_t *hist, size_t hist_size)
+{
+    int err_code;
+    size_t results_size;
+    err_code = gn_analysis_results_size(&results_size, GnAnalysisTypeHistogram);
+    if (err_code != 0)return err_code;
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_analysis_results_key_sizes(key_sizes, results_size, GnAnalysisTypeHistogram);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    char **cda_rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t k = 0; k < results_size; k++) {
+        rkeys[k] = (char*)malloc(key_sizes[k]);
+        cda_rkeys[k] = (char*)malloc(key_sizes[k]);
+    }
+    double *rvalues = (double*)malloc(results_size*sizeof(double));
+    double *cda_rvalues = (double*)malloc(results_size*sizeof(double));
+
+    err_code = gn_hist_analysis(rkeys, results_size, rvalues, results_size, hist, hist_size);
+    if (err_code != 0)return err_code;
+    err_code = gn_cda_analysis(cda_rkeys, results_size, cda_rvalues, results_size, obj_key);
+    if (err_code != 0)return err_code;
+    for (size_t k = 0; k < results_size; k++) {
+        assert(0 == strcmp(rkeys[k], cda_rkeys[k]));
+        assert(rvalues[k] == cda_rvalues[k]);
+    }
+
+    // free memory
+    for (size_t k = 0; k < results_size; k++) {
+        free(rkeys[k]);
+        free(cda_rkeys[k]);
+    }
+    free(rkeys);
+    free(cda_rkeys);
+    free(rvalues);
+    free(cda_rvalues);
+    free(key_sizes);
+    return 0;
+}
+
+// Checks the histogram, counts, code range, and analysis of obj_key against
+// one gn_histx64 of the first in_size samples of in
+static int check_accumulator(const char *obj_key, const int64_t *in, size_t in_size,
+    int64_t min, int64_t max)
+{
+    int err_code;
+    const size_t hist_size = (size_t)(max - min + 1);
+    uint64_t *expected = (uint64_t*)malloc(hist_size*sizeof(uint64_t));
+    uint64_t *actual = (uint64_t*)malloc(hist_size*sizeof(uint64_t));
+    size_t size;
+    err_code = gn_cda_size(&size, obj_key);
+    if (err_code != 0)return err_code;
+    assert(size == hist_size);
+    if (0 < in_size) {
+        err_code = gn_histx64(expected, hist_size, in, in_size, min, max, false);
+        if (err_code != 0)return err_code;
+    } else {
+        memset(expected, 0, hist_size*sizeof(uint64_t));
+    }
+    err_code = gn_cda_snapshot(actual, hist_size, obj_key);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(expected, actual, hist_size*sizeof(uint64_t)));
+
+    uint64_t below = 0, above = 0;
+    int64_t min_code = INT64_MAX, max_code = INT64_MIN;
+    for (size_t k = 0; k < in_size; k++) {
+        below += (in[k] < min) ? 1 : 0;
+        above += (max < in[k]) ? 1 : 0;
+        min_code = (in[k] < min_code) ? in[k] : min_code;
+        max_code = (max_code < in[k]) ? in[k] : max_code;
+    }
+    uint64_t cda_count, cda_below, cda_above;
+    err_code = gn_cda_counts(&cda_count, &cda_below, &cda_above, obj_key);
+    if (err_code != 0)return err_code;
+    assert(cda_count == in_size);
+    assert(cda_below == below);
+    assert(cda_above == above);
+    int64_t cda_min_code, cda_max_code;
+    err_code = gn_cda_code_range(&cda_min_code, &cda_max_code, obj_key);
+    if (err_code != 0)return err_code;
+    if (0 < in_size) {
+        assert(cda_min_code == min_code);
+        assert(cda_max_code == max_code);
+    } else {
+        assert(cda_max_code < cda_min_code);
+    }
+
+    err_code = check_analysis(obj_key, expected, hist_size);
+    if (err_code != 0)return err_code;
+    free(expected);
+    free(actual);
+    return 0;
+}
+
+// Pushes chunk [first, last) of in to obj_key with a sample type that
+// depends on the chunk
+static int push_chunk(const char *obj_key, const int64_t *in, size_t first, size_t last, size_t chunk)
+{
+    int err_code;
+    const size_t size = last - first;
+    if (0 == chunk % 3) {
+        int16_t *x = (int16_t*)malloc((size + 1)*sizeof(int16_t));
+        for (size_t k = 0; k < size; k++)
+            x[k] = (int16_t)in[first + k];
+        err_code = gn_cda_push16(obj_key, x, size);
+        free(x);
+    } else if (1 == chunk % 3) {
+        int32_t *x = (int32_t*)malloc((size + 1)*sizeof(int32_t));
+        for (size_t k = 0; k < size; k++)
+            x[k] = (int32_t)in[first + k];
+        err_code = gn_cda_push32(obj_key, x, size);
+        free(x);
+    } else {
+        err_code = gn_cda_push64(obj_key, in + first, size);
+    }
+    return err_code;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    // codes that fall below, inside, and above [XMIN, XMAX], and outside
+    // the RES-bit range
+    int64_t *in = (int64_t*)malloc(NPTS*sizeof(int64_t));
+    srand(31);
+    for (size_t k = 0; k < NPTS; k++)
+        in[k] = (int64_t)(rand() % 2000) - 800;
+    in[17] = -30000;
+    in[NPTS - 5] = 30000;
+
+    // NWORKERS accumulators each take a contiguous share of the data, in
+    // NCHUNKS pushes of uneven size, and are merged into the first
+    const char *keys[NWORKERS] = {"cda_0", "cda_1", "cda_2"};
+    for (size_t w = 0; w < NWORKERS; w++) {
+        err_code = gn_cda_createx(keys[w], XMIN, XMAX);
+        if (err_code != 0)return err_code;
+    }
+    err_code = check_accumulator(keys[0], in, 0, XMIN, XMAX);
+    if (err_code != 0)return err_code;
+    for (size_t w = 0; w < NWORKERS; w++) {
+        const size_t w_first = w * NPTS / NWORKERS;
+        const size_t w_last = (w + 1) * NPTS / NWORKERS;
+        size_t first = w_first;
+        for (size_t c = 0; c < NCHUNKS; c++) {
+            size_t last = (c + 1 == NCHUNKS) ? w_last : first + (w_last - first) / (c + 2);
+            err_code = push_chunk(keys[w], in, first, last, c + w);
+            if (err_code != 0)return err_code;
+            first = last;
+        }
+        err_code = check_accumulator(keys[w], in + w_first, w_last - w_first, XMIN, XMAX);
+        if (err_code != 0)return err_code;
+    }
+    for (size_t w = 1; w < NWORKERS; w++) {
+        err_code = gn_cda_merge(keys[0], keys[w]);
+        if (err_code != 0)return err_code;
+    }
+    err_code = check_accumulator(keys[0], in, NPTS, XMIN, XMAX);
+    if (err_code != 0)return err_code;
+
+    // merging an empty accumulator changes nothing; reset empties it
+    err_code = gn_cda_reset(keys[1]);
+    if (err_code != 0)return err_code;
+    err_code = check_accumulator(keys[1], in, 0, XMIN, XMAX);
+    if (err_code != 0)return err_code;
+    err_code = gn_cda_merge(keys[0], keys[1]);
+    if (err_code != 0)return err_code;
+    err_code = check_accumulator(keys[0], in, NPTS, XMIN, XMAX);
+    if (err_code != 0)return err_code;
+
+    // accumulators that see disjoint code ranges, merged in both orders, so
+    // that the merged nonzero range comes from both sides
+    int64_t *split = (int64_t*)malloc(NPTS*sizeof(int64_t));
+    size_t nlow = 0;
+    for (size_t k = 0; k < NPTS; k++) {
+        if (in[k] < 200)
+            split[nlow++] = in[k];
+    }
+    size_t nhigh = nlow;
+    for (size_t k = 0; k < NPTS; k++) {
+        if (200 <= in[k])
+            split[nhigh++] = in[k];
+    }
+    for (size_t order = 0; order < 2; order++) {
+        err_code = gn_cda_reset(keys[0]);
+        if (err_code != 0)return err_code;
+        err_code = gn_cda_reset(keys[1]);
+        if (err_code != 0)return err_code;
+        err_code = push_chunk(keys[order], split, 0, nlow, 2);
+        if (err_code != 0)return err_code;
+        err_code = push_chunk(keys[1 - order], split, nlow, NPTS, 2);
+        if (err_code != 0)return err_code;
+        err_code = gn_cda_merge(keys[0], keys[1]);
+        if (err_code != 0)return err_code;
+        err_code = check_accumulator(keys[0], split, NPTS, XMIN, XMAX);
+        if (err_code != 0)return err_code;
+    }
+
+    // resolution and code format: same as gn_hist16 of all the data
+    const char *cda_key = "cda_res";
+    err_code = gn_cda_create(cda_key, RES, GnCodeFormatTwosComplement);
+    if (err_code != 0)return err_code;
+    err_code = push_chunk(cda_key, in, 0, NPTS / 2, 0);
+    if (err_code != 0)return err_code;
+    err_code = push_chunk(cda_key, in, NPTS / 2, NPTS, 1);
+    if (err_code != 0)return err_code;
+    int16_t *in16 = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    for (size_t k = 0; k < NPTS; k++)
+        in16[k] = (int16_t)in[k];
+    uint64_t *hist = (uint64_t*)malloc(HIST_SIZE*sizeof(uint64_t));
+    uint64_t *snapshot = (uint64_t*)malloc(HIST_SIZE*sizeof(uint64_t));
+    err_code = gn_hist16(hist, HIST_SIZE, in16, NPTS, RES, GnCodeFormatTwosComplement, false);
+    if (err_code != 0)return err_code;
+    err_code = gn_cda_snapshot(snapshot, HIST_SIZE, cda_key);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(hist, snapshot, HIST_SIZE*sizeof(uint64_t)));
+    err_code = check_accumulator(cda_key, in, NPTS, -(HIST_SIZE / 2), HIST_SIZE / 2 - 1);
+    if (err_code != 0)return err_code;
+
+    for (size_t w = 0; w < NWORKERS; w++) {
+        err_code = gn_mgr_remove(keys[w]);
+        if (err_code != 0)return err_code;
+    }
+    err_code = gn_mgr_remove(cda_key);
+    if (err_code != 0)return err_code;
+    free(in);
+    free(split);
+    free(in16);
+    free(hist);
+    free(snapshot);
+    return 0;
+}
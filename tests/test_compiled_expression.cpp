@@ -0,0 +1,139 @@
+// Checks that compiled_expression::evaluate gives bit-identical results to
+// expression::evaluate, for each operator, unary minus and plus, nesting, and
+// repeated variables, and that both throw on division by zero.
+#include "exceptions.hpp"
+#include "expression.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+const char *const exprs[] = {
+	"a",
+	"2.5",
+	"a + b",
+	"a - b",
+	"a * b",
+	"a / b",
+	"a % b",
+	"-a % b",
+	"a % -b",
+	"a ^ 2",
+	"a ^ b ^ 0.5",
+	"(a ^ b) ^ 0.5",
+	"-a",
+	"-(-a)",
+	"+a",
+	"-a ^ 2",
+	"(-a) ^ 2",
+	"-(a + b) * c",
+	"a - (-b)",
+	"a * -b",
+	"a ^ -c",
+	"a - (b - c)",
+	"a - b - c",
+	"a / b / c",
+	"a * (b + c * (a - (b / (c + 10))))",
+	"((((a + 1) * 2 - b) / 3 + c) % 7) ^ 1.5",
+	"a * a - 2 * a * b + b * b",
+	"fs / 4 - a % (b + 2)",
+	"-(-(-(a)))",
+};
+
+const gn::str_vector slots = { "a", "b", "c", "fs" };
+
+bool same(gn::real_t x, gn::real_t y) {
+	return 0 == std::memcmp(&x, &y, sizeof(x));
+}
+
+// Evaluates expr both ways at values; returns false if only one of them
+// throws, and true if both throw
+bool check(const gn::expression &e, const gn::compiled_expression &ce,
+		const std::vector<gn::real_t> &values) {
+	gn::expression::var_map vars;
+	for (size_t i = 0; i < slots.size(); ++i) {
+		vars[slots[i]] = values[i];
+	}
+	bool threw = false;
+	bool compiled_threw = false;
+	gn::real_t x = 0.0;
+	gn::real_t y = 0.0;
+	try {
+		x = e.evaluate(vars);
+	} catch (const gn::runtime_error &) {
+		threw = true;
+	}
+	try {
+		y = ce.evaluate(values.data());
+	} catch (const gn::runtime_error &) {
+		compiled_threw = true;
+	}
+	if (threw != compiled_threw) {
+		return false;
+	}
+	return threw || same(x, y);
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 gen(17);
+	std::uniform_real_distribution<gn::real_t> dist(-8.0, 8.0);
+	for (const char *s : exprs) {
+		gn::expression e(s);
+		gn::compiled_expression ce = e.compile(slots);
+		for (int trial = 0; trial < 200; ++trial) {
+			std::vector<gn::real_t> values(slots.size());
+			for (gn::real_t &v : values) {
+				v = dist(gen);
+			}
+			// Small integers and exact zeros hit the divide by 0 and integer
+			// power paths
+			if (0 == trial % 4) {
+				for (gn::real_t &v : values) {
+					v = static_cast<gn::real_t>(static_cast<int>(v) / 2);
+				}
+			}
+			if (!check(e, ce, values)) {
+				std::printf("%s: mismatch at a = %g, b = %g, c = %g\n", s,
+						values[0], values[1], values[2]);
+				return 1;
+			}
+		}
+	}
+
+	// Both throw on division by zero, and agree where the divisor is not 0
+	const std::vector<gn::real_t> zero_b = { 3.0, 0.0, 1.0, 1.0 };
+	for (const char *s : { "a / b", "a % b", "1 / (b * c)", "(a + 1) % (b - b)",
+			     "a / (c - 1)", "a % (a - a + b)" }) {
+		gn::expression e(s);
+		gn::compiled_expression ce = e.compile(slots);
+		bool threw = false;
+		try {
+			ce.evaluate(zero_b.data());
+		} catch (const gn::runtime_error &) {
+			threw = true;
+		}
+		assert(threw);
+		assert(check(e, ce, zero_b));
+	}
+
+	// A variable not in slots is an error when compiling
+	bool threw = false;
+	try {
+		gn::expression("a + x").compile(slots);
+	} catch (const gn::runtime_error &) {
+		threw = true;
+	}
+	assert(threw);
+
+	std::printf("%zu expressions: compiled identical to interpreted\n",
+			sizeof(exprs) / sizeof(exprs[0]));
+	return 0;
+}
@@ -0,0 +1,201 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// fsample = NFFT, so bin k is at k Hz
+#define NFFT 512
+#define MAX_SIGNALS 4
+#define NCONFIGS 200
+
+typedef struct fa_run {
+    size_t size;
+    char **keys;
+    double *values;
+} fa_run;
+
+static int run_analysis(fa_run *run, const char *cfg_key, const double *msq,
+    size_t msq_size, GnFreqAxisType axis_type)
+{
+    int err_code;
+    err_code = gn_fft_analysis_results_size(&run->size, cfg_key, msq_size, NFFT);
+    if (err_code != 0)return err_code;
+    size_t *key_sizes = (size_t*)malloc(run->size*sizeof(size_t));
+    err_code = gn_fft_analysis_results_key_sizes(key_sizes, run->size, cfg_key, msq_size, NFFT);
+    if (err_code != 0)return err_code;
+    run->keys = (char**)malloc(run->size*sizeof(char*));
+    for (size_t k = 0; k < run->size; k++)
+        run->keys[k] = (char*)malloc(key_sizes[k]);
+    run->values = (double*)malloc(run->size*sizeof(double));
+    free(key_sizes);
+    return gn_fft_analysis(run->keys, run->size, run->values, run->size, cfg_key, msq, msq_size, NFFT, axis_type);
+}
+
+static void free_run(fa_run *run)
+{
+    for (size_t k = 0; k < run->size; k++)
+        free(run->keys[k]);
+    free(run->keys);
+    free(run->values);
+}
+
+static const double *find_result(const fa_run *run, const char *key)
+{
+    for (size_t k = 0; k < run->size; k++) {
+        if (0 == strcmp(run->keys[k], key))
+            return &run->values[k];
+    }
+    return NULL;
+}
+
+// The key of the tone with order index i, or NULL if there is none
+static const char *tone_key(const fa_run *run, double i, char *key, size_t key_size)
+{
+    for (size_t k = 0; k < run->size; k++) {
+        const char *sep = strstr(run->keys[k], ":orderindex");
+        if (sep && 0 == strcmp(sep, ":orderindex") && run->values[k] == i) {
+            snprintf(key, key_size, "%.*s", (int)(sep - run->keys[k]), run->keys[k]);
+            return key;
+        }
+    }
+    return NULL;
+}
+
+// Checks that every result without IMD tones has the same value with IMD
+// tones.  Order indexes differ, since IMD tones have keys; the carrier must be
+// the same tone, and MaxSpur the same tone unless it is an IMD tone.
+static void check_same(const fa_run *tones, const fa_run *products)
+{
+    char key[64], tones_key[64];
+    for (size_t k = 0; k < products->size; k++) {
+        const char *rkey = products->keys[k];
+        if (strstr(rkey, ":orderindex") || 0 == strcmp(rkey, "carrierindex") ||
+                0 == strcmp(rkey, "maxspurindex"))
+            continue;
+        const double *v = find_result(tones, rkey);
+        assert(v);
+        assert(0 == memcmp(v, &products->values[k], sizeof(double)));
+    }
+    const double carrier = *find_result(products, "carrierindex");
+    if (carrier < 0) {
+        assert(*find_result(tones, "carrierindex") < 0);
+    } else {
+        assert(0 == strcmp(tone_key(products, carrier, key, sizeof(key)),
+            tone_key(tones, *find_result(tones, "carrierindex"), tones_key, sizeof(tones_key))));
+    }
+    const double maxspur = *find_result(products, "maxspurindex");
+    const double tones_maxspur = *find_result(tones, "maxspurindex");
+    if (maxspur < 0) {
+        if (0 <= tones_maxspur) {
+            tone_key(tones, tones_maxspur, tones_key, sizeof(tones_key));
+            snprintf(key, sizeof(key), "%s:tag", tones_key);
+            assert(GnFACompTagIMD == (int)*find_result(tones, key));
+        }
+    } else {
+        assert(0 == strcmp(tone_key(products, maxspur, key, sizeof(key)),
+            tone_key(tones, tones_maxspur, tones_key, sizeof(tones_key))));
+    }
+}
+
+// A random configuration of Signals, FixedTone or MaxTone, and a spectrum
+// with the Signals, spurs on some of their IMD products, and noise
+static int check_config(int trial)
+{
+    int err_code;
+    const bool cplx = (1 == trial % 2);
+    const GnFreqAxisType axis_type = cplx
+        ? ((trial % 4 == 1) ? GnFreqAxisTypeDcCenter : GnFreqAxisTypeDcLeft)
+        : GnFreqAxisTypeReal;
+    const size_t msq_size = cplx ? NFFT : NFFT / 2 + 1;
+    const int nsig = 2 + rand() % (MAX_SIGNALS - 1);
+    int bins[MAX_SIGNALS];
+    double *msq = (double*)malloc(msq_size*sizeof(double));
+    for (size_t k = 0; k < msq_size; k++)
+        msq[k] = 1e-9 * (1.0 + (double)rand() / RAND_MAX);
+    for (int s = 0; s < nsig; s++) {
+        bins[s] = 3 + rand() % (int)(msq_size - 6);
+        msq[bins[s]] += pow(10.0, -(double)(rand() % 40) / 10.0);
+    }
+    // spurs on IMD products of the first two Signals, and random spurs
+    for (int p = -3; p <= 3; p++) {
+        const int b = ((p * bins[0] + (1 - p) * bins[1]) % NFFT + NFFT) % NFFT;
+        if ((size_t)b < msq_size && 0 != rand() % 3)
+            msq[b] += pow(10.0, -(double)(20 + rand() % 50) / 10.0);
+    }
+    for (int p = 0; p < 8; p++)
+        msq[rand() % msq_size] += pow(10.0, -(double)(20 + rand() % 60) / 10.0);
+
+    int ssbs[MAX_SIGNALS], kinds[MAX_SIGNALS];
+    for (int s = 0; s < nsig; s++) {
+        ssbs[s] = rand() % 4 - 1;
+        kinds[s] = (0 == s) ? 0 : rand() % 3;
+    }
+    const int hd = 1 + rand() % 5;
+    const int imd = 2 + rand() % 4;
+    const int wo = rand() % 4;
+    const int ssb = rand() % 3;
+    const bool quad_errors = cplx && 0 == rand() % 2;
+
+    // the same configuration and spectrum, with and without IMD tones
+    fa_run runs[2];
+    for (int mode = 0; mode < 2; mode++) {
+        const char *cfg_key = "fa_imd";
+        err_code = gn_fa_create(cfg_key);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_fsample(cfg_key, NFFT);
+        if (err_code != 0)return err_code;
+        for (int s = 0; s < nsig; s++) {
+            const char name[2] = {(char)('A' + s), '\0'};
+            if (0 == kinds[s]) {
+                err_code = gn_fa_max_tone(cfg_key, name, GnFACompTagSignal, ssbs[s]);
+            } else if (1 == kinds[s]) {
+                err_code = gn_fa_fixed_tone(cfg_key, name, GnFACompTagSignal, bins[s], ssbs[s]);
+            } else {
+                // a FixedTone that depends on the MaxTone A
+                char expr[32];
+                const int d = bins[s] - bins[0];
+                snprintf(expr, sizeof(expr), (d < 0) ? "A-%d" : "A+%d", abs(d));
+                err_code = gn_fa_fixed_tone_e(cfg_key, name, GnFACompTagSignal, expr, ssbs[s]);
+            }
+            if (err_code != 0)return err_code;
+        }
+        err_code = gn_fa_hd(cfg_key, hd);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_imd(cfg_key, imd);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_wo(cfg_key, wo);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_ssb(cfg_key, GnFASsbDefault, ssb);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_quad_errors(cfg_key, quad_errors);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_imd_tones(cfg_key, 0 == mode);
+        if (err_code != 0)return err_code;
+        err_code = run_analysis(&runs[mode], cfg_key, msq, msq_size, axis_type);
+        if (err_code != 0)return err_code;
+        err_code = gn_mgr_remove(cfg_key);
+        if (err_code != 0)return err_code;
+    }
+    check_same(&runs[0], &runs[1]);
+
+    // free memory
+    free_run(&runs[0]);
+    free_run(&runs[1]);
+    free(msq);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    srand(43);
+    for (int trial = 0; trial < NCONFIGS; trial++) {
+        err_code = check_config(trial);
+        if (err_code != 0)return err_code;
+    }
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Real analysis of a mean-square spectrum; fsample = NFFT, so bin k is at k Hz
+#define NFFT 128
+#define NBINS (NFFT / 2 + 1)
+#define MAX_WO 9
+#define DC_SSB 1
+#define A_BIN 20
+#define A_SSB 2
+
+typedef struct wo_result {
+    double ffinal;
+    double i1;
+    double i2;
+    double mag;
+} wo_result;
+
+// Reference: search the whole WO mask once per WO, taking the lowest index
+// among equal maxima, and remove each zone from the mask before the next
+// search.  The zone is clipped to the free range that holds the maximum.
+// Then order the WOs from max to min magnitude; equal magnitudes go last
+// found first.
+static void reference_wo(const double *msq, int wo, int wo_ssb, wo_result *expected)
+{
+    bool free_bin[NBINS];
+    wo_result found[MAX_WO];
+    for (int k = 0; k < NBINS; k++)
+        free_bin[k] = !(k <= DC_SSB || (A_BIN - A_SSB <= k && k <= A_BIN + A_SSB));
+    for (int w = 0; w < wo; w++) {
+        int m = -1;
+        for (int k = 0; k < NBINS; k++) {
+            if (free_bin[k] && (m < 0 || msq[m] < msq[k]))
+                m = k;
+        }
+        if (m < 0) {
+            found[w].ffinal = 0.0;
+            found[w].i1 = -1.0;
+            found[w].i2 = -1.0;
+            found[w].mag = 0.0;
+            continue;
+        }
+        int i1 = m, i2 = m;
+        while (m - wo_ssb < i1 && 0 < i1 && free_bin[i1 - 1])
+            i1--;
+        while (i2 < m + wo_ssb && i2 < NBINS - 1 && free_bin[i2 + 1])
+            i2++;
+        double sum = 0.0;
+        for (int k = i1; k <= i2; k++) {
+            sum += msq[k];
+            free_bin[k] = false;
+        }
+        found[w].ffinal = m;
+        found[w].i1 = i1;
+        found[w].i2 = i2;
+        found[w].mag = sqrt(sum);
+    }
+    // stable insertion sort of the found order reversed, by descending
+    // magnitude
+    for (int w = 0; w < wo; w++) {
+        wo_result r = found[wo - 1 - w];
+        int j = w;
+        while (0 < j && expected[j - 1].mag < r.mag) {
+            expected[j] = expected[j - 1];
+            j--;
+        }
+        expected[j] = r;
+    }
+}
+
+static double get_result(char **rkeys, const double *rvalues, size_t results_size, const char *key)
+{
+    for (size_t k = 0; k < results_size; k++) {
+        if (0 == strcmp(rkeys[k], key))
+            return rvalues[k];
+    }
+    assert(false);
+    return 0.0;
+}
+
+static bool has_result(char **rkeys, size_t results_size, const char *key)
+{
+    for (size_t k = 0; k < results_size; k++) {
+        if (0 == strcmp(rkeys[k], key))
+            return true;
+    }
+    return false;
+}
+
+// Analyzes msq with wo worst others of wo_ssb single-side bins, and checks
+// each WO against the reference.  wo above MAX_WO is clamped to MAX_WO.
+static int check_wo(const double *msq, int wo, int wo_ssb)
+{
+    int err_code;
+    const char *cfg_key = "fa_wo";
+    err_code = gn_fa_create(cfg_key);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_fsample(cfg_key, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_fixed_tone(cfg_key, "A", GnFACompTagSignal, A_BIN, A_SSB);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_hd(cfg_key, 1);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_imd(cfg_key, 1);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_ssb(cfg_key, GnFASsbDC, DC_SSB);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_ssb(cfg_key, GnFASsbWO, wo_ssb);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_wo(cfg_key, wo);
+    if (err_code != 0)return err_code;
+    const int nwo = (MAX_WO < wo) ? MAX_WO : wo;
+
+    size_t results_size;
+    err_code = gn_fft_analysis_results_size(&results_size, cfg_key, NBINS, NFFT);
+    if (err_code != 0)return err_code;
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_fft_analysis_results_key_sizes(key_sizes, results_size, cfg_key, NBINS, NFFT);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t k = 0; k < results_size; k++)
+        rkeys[k] = (char*)malloc(key_sizes[k]);
+    double *rvalues = (double*)malloc(results_size*sizeof(double));
+    err_code = gn_fft_analysis(rkeys, results_size, rvalues, results_size, cfg_key, msq, NBINS, NFFT, GnFreqAxisTypeReal);
+    if (err_code != 0)return err_code;
+
+    wo_result expected[MAX_WO];
+    reference_wo(msq, nwo, wo_ssb, expected);
+    char key[32];
+    for (int w = 0; w < nwo; w++) {
+        const char *prefix = "wo";
+        char name[8];
+        if (1 == nwo)
+            snprintf(name, sizeof(name), "%s", prefix);
+        else
+            snprintf(name, sizeof(name), "%s%d", prefix, w + 1);
+        snprintf(key, sizeof(key), "%s:ffinal", name);
+        assert(get_result(rkeys, rvalues, results_size, key) == expected[w].ffinal);
+        snprintf(key, sizeof(key), "%s:i1", name);
+        assert(get_result(rkeys, rvalues, results_size, key) == expected[w].i1);
+        snprintf(key, sizeof(key), "%s:i2", name);
+        assert(get_result(rkeys, rvalues, results_size, key) == expected[w].i2);
+        snprintf(key, sizeof(key), "%s:mag", name);
+        assert(get_result(rkeys, rvalues, results_size, key) == expected[w].mag);
+    }
+    snprintf(key, sizeof(key), "wo%d:ffinal", nwo + 1);
+    assert(!has_result(rkeys, results_size, key));
+
+    // free memory
+    for (size_t k = 0; k < results_size; k++)
+        free(rkeys[k]);
+    free(rkeys);
+    free(rvalues);
+    free(key_sizes);
+    return gn_mgr_remove(cfg_key);
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    // Small integer bin values: sums are exact in any order, and there are
+    // many equal maxima and equal WO magnitudes
+    double msq[NBINS];
+    srand(17);
+    const int wos[5] = {1, 2, 5, 9, 12};
+    const int wo_ssbs[4] = {0, 1, 3, 8};
+    for (int trial = 0; trial < 20; trial++) {
+        const int levels = (trial % 2) ? 3 : 64;
+        for (int k = 0; k < NBINS; k++)
+            msq[k] = (double)(1 + rand() % levels);
+        msq[A_BIN] = 1e6;
+        for (int w = 0; w < 5; w++) {
+            for (int s = 0; s < 4; s++) {
+                err_code = check_wo(msq, wos[w], wo_ssbs[s]);
+                if (err_code != 0)return err_code;
+            }
+        }
+    }
+
+    // a flat spectrum: every bin ties
+    for (int k = 0; k < NBINS; k++)
+        msq[k] = 1.0;
+    for (int w = 0; w < 5; w++) {
+        for (int s = 0; s < 4; s++) {
+            err_code = check_wo(msq, wos[w], wo_ssbs[s]);
+            if (err_code != 0)return err_code;
+        }
+    }
+
+    return 0;
+}
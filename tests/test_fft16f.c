@@ -0,0 +1,151 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define MAX_NAVG 4
+#define MAX_NFFT 4096
+
+// Set by the first single-precision call: true if genalyzer was built with
+// the FFTW float library
+static int float_state = -1;
+
+// Checks the result of a single-precision call.  Without the FFTW float
+// library every call fails with the same message; with it every call
+// succeeds.  Returns true if the output should be compared.
+static bool check_float_call(int err_code)
+{
+    if (float_state < 0)
+        float_state = (0 == err_code) ? 1 : 0;
+    if (1 == float_state) {
+        assert(0 == err_code);
+        return true;
+    }
+    char buf[256];
+    assert(0 != err_code);
+    gn_error_string(buf, sizeof(buf));
+    assert(NULL != strstr(buf, "single-precision FFTs are not available"));
+    gn_error_clear();
+    return false;
+}
+
+// Checks that out_f is within single-precision tolerance of out_d: each
+// element within a small multiple of float epsilon of the largest magnitude,
+// which is where the rounding of the single-precision FFT accumulates.  An
+// averaged spectrum holds the mean phase of the records, which jumps when the
+// phase of one record wraps at +/-pi, so only its magnitudes are compared.
+static void check_close(const float *out_f, const double *out_d, size_t size, size_t navg, size_t nfft)
+{
+    double peak = 0.0;
+    for (size_t k = 0; k < size; k++)
+        peak = fmax(peak, fabs(out_d[k]));
+    const double tol = 4.0 * log2((double)nfft) * 1.2e-7 * peak;
+    for (size_t k = 0; k < size; k += 2) {
+        if (1 == navg) {
+            assert(fabs((double)out_f[k] - out_d[k]) <= tol);
+            assert(fabs((double)out_f[k + 1] - out_d[k + 1]) <= tol);
+        } else {
+            assert(fabs(hypot(out_f[k], out_f[k + 1]) - hypot(out_d[k], out_d[k + 1])) <= tol);
+        }
+    }
+}
+
+static int check_fft(const int16_t *i, const int16_t *q, size_t in_size, bool interleaved,
+    int n, size_t navg, size_t nfft, GnWindow window, GnCodeFormat format)
+{
+    int err_code;
+    const size_t q_size = interleaved ? 0 : in_size;
+    const size_t i_size = interleaved ? 2 * in_size : in_size;
+    size_t out_size;
+    err_code = gn_fft_size(&out_size, i_size, q_size, navg, nfft);
+    if (err_code != 0)return err_code;
+    double *out_d = (double*)malloc(out_size*sizeof(double));
+    float *out_f = (float*)malloc(out_size*sizeof(float));
+    err_code = gn_fft16(out_d, out_size, i, i_size, q, q_size, n, navg, nfft, window, format);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft16f(out_f, out_size, i, i_size, q, q_size, n, navg, nfft, window, format);
+    if (check_float_call(err_code))
+        check_close(out_f, out_d, out_size, navg, nfft);
+
+    // free memory
+    free(out_d);
+    free(out_f);
+    return 0;
+}
+
+static int check_rfft(const int16_t *in, size_t in_size, int n, size_t navg, size_t nfft,
+    GnWindow window, GnCodeFormat format, GnRfftScale scale)
+{
+    int err_code;
+    size_t out_size;
+    err_code = gn_rfft_size(&out_size, in_size, navg, nfft);
+    if (err_code != 0)return err_code;
+    double *out_d = (double*)malloc(out_size*sizeof(double));
+    float *out_f = (float*)malloc(out_size*sizeof(float));
+    err_code = gn_rfft16(out_d, out_size, in, in_size, n, navg, nfft, window, format, scale);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft16f(out_f, out_size, in, in_size, n, navg, nfft, window, format, scale);
+    if (check_float_call(err_code))
+        check_close(out_f, out_d, out_size, navg, nfft);
+
+    // free memory
+    free(out_d);
+    free(out_f);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    // a two-tone signal with noise, as codes of each resolution and format;
+    // the interleaved I/Q buffer holds twice as many samples as i and q
+    const size_t max_size = MAX_NAVG * MAX_NFFT;
+    int16_t *i = (int16_t*)malloc(max_size*sizeof(int16_t));
+    int16_t *q = (int16_t*)malloc(max_size*sizeof(int16_t));
+    int16_t *iq = (int16_t*)malloc(2*max_size*sizeof(int16_t));
+    srand(47);
+    const int resolutions[2] = {10, 14};
+    const GnCodeFormat formats[2] = {GnCodeFormatTwosComplement, GnCodeFormatOffsetBinary};
+    const size_t navgs[3] = {1, 2, MAX_NAVG};
+    const size_t nffts[3] = {60, 1024, MAX_NFFT};
+    const GnWindow windows[3] = {GnWindowNoWindow, GnWindowBlackmanHarris, GnWindowHann};
+    const GnRfftScale scales[3] = {GnRfftScaleDbfsDc, GnRfftScaleDbfsSin, GnRfftScaleNative};
+    for (size_t r = 0; r < 2; r++) {
+        const int n = resolutions[r];
+        for (size_t f = 0; f < 2; f++) {
+            const double mid = (GnCodeFormatTwosComplement == formats[f]) ? -0.5 : (1 << n) / 2 - 0.5;
+            const double amp = 0.45 * ((1 << n) - 1);
+            for (size_t k = 0; k < 2 * max_size; k++) {
+                const double u = (double)rand() / RAND_MAX - 0.5;
+                const double x = mid + amp * (sin(0.0913 * k) + 0.01 * cos(0.517 * k)) + u;
+                if (k < max_size) {
+                    i[k] = (int16_t)lround(x);
+                    q[k] = (int16_t)lround(mid + amp * cos(0.0913 * k) + u);
+                }
+                iq[k] = (int16_t)lround(x);
+            }
+            for (size_t a = 0; a < 3; a++) {
+                for (size_t b = 0; b < 3; b++) {
+                    const size_t in_size = navgs[a] * nffts[b];
+                    for (size_t w = 0; w < 3; w++) {
+                        err_code = check_fft(i, q, in_size, false, n, navgs[a], nffts[b], windows[w], formats[f]);
+                        if (err_code != 0)return err_code;
+                        err_code = check_fft(iq, NULL, in_size, true, n, navgs[a], nffts[b], windows[w], formats[f]);
+                        if (err_code != 0)return err_code;
+                        err_code = check_rfft(i, in_size, n, navgs[a], nffts[b], windows[w], formats[f], scales[w]);
+                        if (err_code != 0)return err_code;
+                    }
+                }
+            }
+        }
+    }
+
+    free(i);
+    free(q);
+    free(iq);
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NFFT 4096
+#define FS 1e9
+#define COUNT 7
+
+// Analyzes count spectra of size spectrum_size with gn_fft_analysis_batch and
+// checks that row i equals gn_fft_analysis_plan on spectrum i, byte for byte
+static int check_batch(const char *plan_key, const double *in, size_t spectrum_size, size_t count)
+{
+    int err_code;
+    size_t results_size;
+    err_code = gn_ap_results_size(&results_size, plan_key);
+    if (err_code != 0)return err_code;
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_ap_results_key_sizes(key_sizes, results_size, plan_key);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    char **batch_rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t k = 0; k < results_size; k++) {
+        rkeys[k] = (char*)malloc(key_sizes[k]);
+        batch_rkeys[k] = (char*)malloc(key_sizes[k]);
+    }
+    double *rvalues = (double*)malloc(results_size*sizeof(double));
+    double *batch_rvalues = (double*)malloc(count*results_size*sizeof(double));
+
+    err_code = gn_fft_analysis_batch(batch_rvalues, count*results_size, plan_key, in, count*spectrum_size, count);
+    if (err_code != 0)return err_code;
+    err_code = gn_ap_results_keys(batch_rkeys, results_size, plan_key);
+    if (err_code != 0)return err_code;
+    for (size_t i = 0; i < count; i++) {
+        err_code = gn_fft_analysis_plan(rkeys, results_size, rvalues, results_size, plan_key, in + i * spectrum_size, spectrum_size);
+        if (err_code != 0)return err_code;
+        for (size_t k = 0; k < results_size; k++)
+            assert(0 == strcmp(rkeys[k], batch_rkeys[k]));
+        assert(0 == memcmp(rvalues, batch_rvalues + i * results_size, results_size*sizeof(double)));
+    }
+
+    // free memory
+    for (size_t k = 0; k < results_size; k++) {
+        free(rkeys[k]);
+        free(batch_rkeys[k]);
+    }
+    free(rkeys);
+    free(batch_rkeys);
+    free(rvalues);
+    free(batch_rvalues);
+    free(key_sizes);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    const char *cfg_key = "fa_batch";
+    const char *real_key = "ap_batch_real";
+    const char *cplx_key = "ap_batch_cplx";
+    err_code = gn_fa_create(cfg_key);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_fsample(cfg_key, FS);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_max_tone(cfg_key, "A", GnFACompTagSignal, 3);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_hd(cfg_key, 3);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_wo(cfg_key, 3);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_prepare(real_key, cfg_key, NFFT, GnFreqAxisTypeReal, false);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_prepare(cplx_key, cfg_key, NFFT, GnFreqAxisTypeDcCenter, true);
+    if (err_code != 0)return err_code;
+
+    // COUNT spectra whose tone and spur move from one to the next, so that
+    // each row has different tones and worst others
+    const size_t rfft_size = 2 * (NFFT / 2 + 1);
+    const size_t fft_size = 2 * NFFT;
+    double *i = (double*)malloc(NFFT*sizeof(double));
+    double *q = (double*)malloc(NFFT*sizeof(double));
+    double *rfft_out = (double*)malloc(COUNT*rfft_size*sizeof(double));
+    double *fft_out = (double*)malloc(COUNT*fft_size*sizeof(double));
+    double *msq_out = (double*)malloc(COUNT*(NFFT / 2 + 1)*sizeof(double));
+    srand(19);
+    for (size_t s = 0; s < COUNT; s++) {
+        const double f = 2.0 * M_PI * (0.05 + 0.031 * s);
+        const double fspur = 2.0 * M_PI * (0.37 - 0.017 * s);
+        for (size_t k = 0; k < NFFT; k++) {
+            double noise = (double)rand() / RAND_MAX - 0.5;
+            i[k] = 0.45 * cos(f * k) + 1e-3 * cos(2.0 * f * k) + 3e-4 * cos(fspur * k) + 1e-5 * noise;
+            q[k] = 0.45 * sin(f * k) + 1e-3 * sin(2.0 * f * k) + 3e-4 * sin(fspur * k) - 1e-5 * noise;
+        }
+        err_code = gn_rfft(rfft_out + s * rfft_size, rfft_size, i, NFFT, 1, NFFT, GnWindowBlackmanHarris, GnRfftScaleDbfsSin);
+        if (err_code != 0)return err_code;
+        err_code = gn_rfft_msq(msq_out + s * (NFFT / 2 + 1), NFFT / 2 + 1, i, NFFT, 1, NFFT, GnWindowBlackmanHarris, GnRfftScaleDbfsSin);
+        if (err_code != 0)return err_code;
+        err_code = gn_fft(fft_out + s * fft_size, fft_size, i, NFFT, q, NFFT, 1, NFFT, GnWindowBlackmanHarris);
+        if (err_code != 0)return err_code;
+    }
+
+    // one thread, and more threads than spectra per thread
+    const size_t thread_counts[3] = {1, 3, 16};
+    for (size_t t = 0; t < 3; t++) {
+        err_code = gn_set_num_threads(thread_counts[t]);
+        if (err_code != 0)return err_code;
+        err_code = check_batch(real_key, rfft_out, rfft_size, COUNT);
+        if (err_code != 0)return err_code;
+        err_code = check_batch(real_key, msq_out, NFFT / 2 + 1, COUNT);
+        if (err_code != 0)return err_code;
+        err_code = check_batch(cplx_key, fft_out, fft_size, COUNT);
+        if (err_code != 0)return err_code;
+        err_code = check_batch(cplx_key, fft_out, fft_size, 1);
+        if (err_code != 0)return err_code;
+    }
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+
+    free(i);
+    free(q);
+    free(rfft_out);
+    free(fft_out);
+    free(msq_out);
+    err_code = gn_mgr_remove(real_key);
+    if (err_code != 0)return err_code;
+    err_code = gn_mgr_remove(cplx_key);
+    if (err_code != 0)return err_code;
+    return gn_mgr_remove(cfg_key);
+}
@@ -0,0 +1,178 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NFFT 8192
+#define FS 1e9
+#define NSPECTRA 3
+
+// Runs gn_fft_analysis and gn_fft_analysis_plan on the same spectrum and
+// checks that they give the same keys, in the same order, with identical
+// values
+static int check_plan(const char *cfg_key, const char *plan_key,
+    const double *in, size_t in_size, GnFreqAxisType axis_type)
+{
+    int err_code;
+    size_t results_size, plan_results_size;
+    err_code = gn_fft_analysis_results_size(&results_size, cfg_key, in_size, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_ap_results_size(&plan_results_size, plan_key);
+    if (err_code != 0)return err_code;
+    assert(results_size == plan_results_size);
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    size_t *plan_key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_fft_analysis_results_key_sizes(key_sizes, results_size, cfg_key, in_size, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_ap_results_key_sizes(plan_key_sizes, results_size, plan_key);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    char **plan_rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t k = 0; k < results_size; k++) {
+        assert(key_sizes[k] == plan_key_sizes[k]);
+        rkeys[k] = (char*)malloc(key_sizes[k]);
+        plan_rkeys[k] = (char*)malloc(key_sizes[k]);
+    }
+    double *rvalues = (double*)malloc(results_size*sizeof(double));
+    double *plan_rvalues = (double*)malloc(results_size*sizeof(double));
+
+    err_code = gn_fft_analysis(rkeys, results_size, rvalues, results_size, cfg_key, in, in_size, NFFT, axis_type);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_analysis_plan(plan_rkeys, results_size, plan_rvalues, results_size, plan_key, in, in_size);
+    if (err_code != 0)return err_code;
+    for (size_t k = 0; k < results_size; k++) {
+        assert(0 == strcmp(rkeys[k], plan_rkeys[k]));
+        // identical, including NaN results
+        assert(0 == memcmp(&rvalues[k], &plan_rvalues[k], sizeof(double)));
+    }
+
+    // a few keys on their own
+    const char *select_keys[4] = {"sfdr", "snr", "A:mag_dbfs", "wo1:freq"};
+    double select_values[4];
+    err_code = gn_fft_analysis_select_plan(select_values, 4, plan_key, select_keys, 4, in, in_size);
+    if (err_code != 0)return err_code;
+    for (size_t s = 0; s < 4; s++) {
+        for (size_t k = 0; k < results_size; k++) {
+            if (0 == strcmp(select_keys[s], rkeys[k]))
+                assert(0 == memcmp(&select_values[s], &rvalues[k], sizeof(double)));
+        }
+    }
+
+    // free memory
+    for (size_t k = 0; k < results_size; k++) {
+        free(rkeys[k]);
+        free(plan_rkeys[k]);
+    }
+    free(rkeys);
+    free(plan_rkeys);
+    free(rvalues);
+    free(plan_rvalues);
+    free(key_sizes);
+    free(plan_key_sizes);
+    return 0;
+}
+
+// Two signals with harmonics, IMD, worst others, and a clock spur
+static int configure(const char *cfg_key, bool max_tone)
+{
+    int err_code;
+    err_code = gn_fa_create(cfg_key);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_fsample(cfg_key, FS);
+    if (err_code != 0)return err_code;
+    if (max_tone) {
+        err_code = gn_fa_max_tone(cfg_key, "A", GnFACompTagSignal, 3);
+        if (err_code != 0)return err_code;
+    } else {
+        err_code = gn_fa_fixed_tone(cfg_key, "A", GnFACompTagSignal, 0.0731 * FS, 3);
+        if (err_code != 0)return err_code;
+    }
+    err_code = gn_fa_fixed_tone(cfg_key, "B", GnFACompTagSignal, 0.0913 * FS, 3);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_hd(cfg_key, 4);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_imd(cfg_key, 3);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_wo(cfg_key, 4);
+    if (err_code != 0)return err_code;
+    int clk[1] = {4};
+    err_code = gn_fa_clk(cfg_key, clk, 1, false);
+    if (err_code != 0)return err_code;
+    return gn_fa_ssb(cfg_key, GnFASsbDefault, 3);
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    double *i = (double*)malloc(NFFT*sizeof(double));
+    double *q = (double*)malloc(NFFT*sizeof(double));
+    double *rfft_out = (double*)malloc(2*(NFFT / 2 + 1)*sizeof(double));
+    double *fft_out = (double*)malloc(2*NFFT*sizeof(double));
+    double *msq_out = (double*)malloc((NFFT / 2 + 1)*sizeof(double));
+    srand(13);
+
+    const bool max_tone[2] = {false, true};
+    for (size_t m = 0; m < 2; m++) {
+        const char *cfg_key = "fa_plan";
+        const char *real_key = "ap_plan_real";
+        const char *left_key = "ap_plan_left";
+        const char *center_key = "ap_plan_center";
+        err_code = configure(cfg_key, max_tone[m]);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_prepare(real_key, cfg_key, NFFT, GnFreqAxisTypeReal, false);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_prepare(left_key, cfg_key, NFFT, GnFreqAxisTypeDcLeft, true);
+        if (err_code != 0)return err_code;
+        err_code = gn_fa_prepare(center_key, cfg_key, NFFT, GnFreqAxisTypeDcCenter, true);
+        if (err_code != 0)return err_code;
+
+        // several spectra through the same plans, with spurs that move
+        for (size_t s = 0; s < NSPECTRA; s++) {
+            const double fa = 2.0 * M_PI * 0.0731;
+            const double fb = 2.0 * M_PI * 0.0913;
+            const double fspur = 2.0 * M_PI * (0.21 + 0.05 * s);
+            for (size_t k = 0; k < NFFT; k++) {
+                double noise = (double)rand() / RAND_MAX - 0.5;
+                i[k] = 0.4 * cos(fa * k) + 0.3 * cos(fb * k) + 1e-3 * cos(2.0 * fa * k)
+                    + 2e-4 * cos((fa + fb) * k) + (1e-4 * (s + 1)) * cos(fspur * k) + 1e-5 * noise;
+                q[k] = 0.4 * sin(fa * k) + 0.3 * sin(fb * k) + 1e-3 * sin(2.0 * fa * k)
+                    + 2e-4 * sin((fa + fb) * k) + (1e-4 * (s + 1)) * sin(fspur * k) - 1e-5 * noise;
+            }
+            err_code = gn_rfft(rfft_out, 2*(NFFT / 2 + 1), i, NFFT, 1, NFFT, GnWindowBlackmanHarris, GnRfftScaleDbfsSin);
+            if (err_code != 0)return err_code;
+            err_code = check_plan(cfg_key, real_key, rfft_out, 2*(NFFT / 2 + 1), GnFreqAxisTypeReal);
+            if (err_code != 0)return err_code;
+            // mean-square input
+            err_code = gn_rfft_msq(msq_out, NFFT / 2 + 1, i, NFFT, 1, NFFT, GnWindowBlackmanHarris, GnRfftScaleDbfsSin);
+            if (err_code != 0)return err_code;
+            err_code = check_plan(cfg_key, real_key, msq_out, NFFT / 2 + 1, GnFreqAxisTypeReal);
+            if (err_code != 0)return err_code;
+            err_code = gn_fft(fft_out, 2*NFFT, i, NFFT, q, NFFT, 1, NFFT, GnWindowBlackmanHarris);
+            if (err_code != 0)return err_code;
+            err_code = check_plan(cfg_key, left_key, fft_out, 2*NFFT, GnFreqAxisTypeDcLeft);
+            if (err_code != 0)return err_code;
+            err_code = check_plan(cfg_key, center_key, fft_out, 2*NFFT, GnFreqAxisTypeDcCenter);
+            if (err_code != 0)return err_code;
+        }
+
+        err_code = gn_mgr_remove(real_key);
+        if (err_code != 0)return err_code;
+        err_code = gn_mgr_remove(left_key);
+        if (err_code != 0)return err_code;
+        err_code = gn_mgr_remove(center_key);
+        if (err_code != 0)return err_code;
+        err_code = gn_mgr_remove(cfg_key);
+        if (err_code != 0)return err_code;
+    }
+
+    free(i);
+    free(q);
+    free(rfft_out);
+    free(fft_out);
+    free(msq_out);
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NCH 3
+#define NFFT 256
+#define MAX_NAVG 4
+// Padded channel stride; the channels are contiguous when the stride is 0
+#define PAD 37
+
+// Runs each batch transform on NCH channels and checks that row c of the
+// output matches the single-channel transform of channel c
+static int check_batch(const double *i, const double *q, const int16_t *i16,
+    const int16_t *q16, size_t stride, size_t navg, GnWindow win)
+{
+    int err_code;
+    const size_t npts = navg * NFFT;
+    const size_t ch_stride = (0 == stride) ? npts : stride;
+    const size_t in_size = (NCH - 1) * ch_stride + npts;
+    size_t fft_row, rfft_row, fft_size, rfft_size;
+    err_code = gn_fft_size(&fft_row, npts, npts, navg, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft_size(&rfft_row, npts, navg, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_batch_size(&fft_size, NCH, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft_batch_size(&rfft_size, NCH, NFFT);
+    if (err_code != 0)return err_code;
+    assert(fft_size == NCH * fft_row);
+    assert(rfft_size == NCH * rfft_row);
+    double *batch = (double*)malloc(fft_size*sizeof(double));
+    double *single = (double*)malloc(fft_row*sizeof(double));
+
+    err_code = gn_fft_batch(batch, fft_size, i, in_size, q, in_size, NCH, stride, navg, NFFT, win);
+    if (err_code != 0)return err_code;
+    for (size_t c = 0; c < NCH; c++) {
+        err_code = gn_fft(single, fft_row, i + c * ch_stride, npts, q + c * ch_stride, npts, navg, NFFT, win);
+        if (err_code != 0)return err_code;
+        assert(0 == memcmp(batch + c * fft_row, single, fft_row*sizeof(double)));
+    }
+
+    err_code = gn_fft_batch16(batch, fft_size, i16, in_size, q16, in_size, NCH, stride, 12, navg, NFFT, win, GnCodeFormatTwosComplement);
+    if (err_code != 0)return err_code;
+    for (size_t c = 0; c < NCH; c++) {
+        err_code = gn_fft16(single, fft_row, i16 + c * ch_stride, npts, q16 + c * ch_stride, npts, 12, navg, NFFT, win, GnCodeFormatTwosComplement);
+        if (err_code != 0)return err_code;
+        assert(0 == memcmp(batch + c * fft_row, single, fft_row*sizeof(double)));
+    }
+
+    err_code = gn_rfft_batch(batch, rfft_size, i, in_size, NCH, stride, navg, NFFT, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    for (size_t c = 0; c < NCH; c++) {
+        err_code = gn_rfft(single, rfft_row, i + c * ch_stride, npts, navg, NFFT, win, GnRfftScaleDbfsSin);
+        if (err_code != 0)return err_code;
+        assert(0 == memcmp(batch + c * rfft_row, single, rfft_row*sizeof(double)));
+    }
+
+    err_code = gn_rfft_batch16(batch, rfft_size, i16, in_size, NCH, stride, 12, navg, NFFT, win, GnCodeFormatTwosComplement, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    for (size_t c = 0; c < NCH; c++) {
+        err_code = gn_rfft16(single, rfft_row, i16 + c * ch_stride, npts, 12, navg, NFFT, win, GnCodeFormatTwosComplement, GnRfftScaleDbfsSin);
+        if (err_code != 0)return err_code;
+        assert(0 == memcmp(batch + c * rfft_row, single, rfft_row*sizeof(double)));
+    }
+
+    free(batch);
+    free(single);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    // large enough for every channel layout below
+    const size_t size = NCH * (MAX_NAVG * NFFT + PAD);
+    double *i = (double*)malloc(size*sizeof(double));
+    double *q = (double*)malloc(size*sizeof(double));
+    int16_t *i16 = (int16_t*)malloc(size*sizeof(int16_t));
+    int16_t *q16 = (int16_t*)malloc(size*sizeof(int16_t));
+    srand(11);
+    for (size_t k = 0; k < size; k++) {
+        double noise = (double)rand() / RAND_MAX - 0.5;
+        i[k] = 0.5 * cos(0.213 * k) + 1e-3 * noise;
+        q[k] = 0.5 * sin(0.213 * k) + 1e-3 * noise;
+        i16[k] = (int16_t)lround(2047.0 * i[k]);
+        q16[k] = (int16_t)lround(2047.0 * q[k]);
+    }
+
+    const GnWindow windows[3] = {GnWindowBlackmanHarris, GnWindowHann, GnWindowNoWindow};
+    const size_t navgs[2] = {1, MAX_NAVG};
+    for (size_t w = 0; w < 3; w++) {
+        for (size_t a = 0; a < 2; a++) {
+            // contiguous and padded channels
+            err_code = check_batch(i, q, i16, q16, 0, navgs[a], windows[w]);
+            if (err_code != 0)return err_code;
+            err_code = check_batch(i, q, i16, q16, navgs[a] * NFFT + PAD, navgs[a], windows[w]);
+            if (err_code != 0)return err_code;
+        }
+    }
+
+    free(i);
+    free(q);
+    free(i16);
+    free(q16);
+    return 0;
+}
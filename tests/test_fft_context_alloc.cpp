@@ -0,0 +1,137 @@
+// Checks that fft_context calls perform no heap allocation on a single
+// thread, for complex and real FFTs of normalized and quantized data, with
+// and without averaging, and with enough records to split into blocks.  The
+// global operator new is replaced to count allocations.
+#include "fft_context.hpp"
+#include "parallel.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+std::atomic<size_t> allocations{ 0 };
+
+void *counted_alloc(std::size_t size) {
+	++allocations;
+	void *p = std::malloc(0 == size ? 1 : size);
+	if (nullptr == p) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void *counted_alloc(std::size_t size, std::align_val_t al) {
+	++allocations;
+	const std::size_t a = static_cast<std::size_t>(al);
+	void *p = std::aligned_alloc(a, (size + a - 1) / a * a);
+	if (nullptr == p) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+} // namespace
+
+void *operator new(std::size_t size) {
+	return counted_alloc(size);
+}
+
+void *operator new[](std::size_t size) {
+	return counted_alloc(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t al) {
+	return counted_alloc(size, al);
+}
+
+void *operator new[](std::size_t size, std::align_val_t al) {
+	return counted_alloc(size, al);
+}
+
+void operator delete(void *p) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+	std::free(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void *p, std::align_val_t) noexcept {
+	std::free(p);
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept {
+	std::free(p);
+}
+
+namespace {
+
+// Runs each kind of transform of ctx twice, and checks that neither call
+// allocates
+void check_context(bool cplx, size_t navg, size_t nfft, gn::Window window) {
+	auto ctx = gn::fft_context::create(cplx, navg, nfft, window,
+			gn::RfftScale::DbfsSin);
+	const size_t size = navg * nfft * (cplx ? 2 : 1);
+	std::vector<double> in_data(size);
+	std::vector<int32_t> codes(size);
+	for (size_t k = 0; k < size; ++k) {
+		in_data[k] = static_cast<double>(k % 13) / 13.0 - 0.5;
+		codes[k] = static_cast<int32_t>(k % 4001) - 2000;
+	}
+	std::vector<double> out_data(ctx->size());
+	for (int quantized = 0; quantized < 2; ++quantized) {
+		for (int call = 0; call < 2; ++call) {
+			const size_t before = allocations.load();
+			if (cplx && quantized) {
+				ctx->fft(codes.data(), size, codes.data(), 0,
+						out_data.data(), out_data.size(), 12,
+						gn::CodeFormat::TwosComplement);
+			} else if (cplx) {
+				ctx->fft(in_data.data(), size, nullptr, 0, out_data.data(),
+						out_data.size());
+			} else if (quantized) {
+				ctx->rfft(codes.data(), size, out_data.data(),
+						out_data.size(), 12, gn::CodeFormat::TwosComplement);
+			} else {
+				ctx->rfft(in_data.data(), size, out_data.data(),
+						out_data.size());
+			}
+			assert(before == allocations.load());
+		}
+	}
+}
+
+} // namespace
+
+int main() {
+	gn::set_num_threads(1);
+	for (bool cplx : { true, false }) {
+		// one record; averaged; and more records than one block holds
+		check_context(cplx, 1, 1024, gn::Window::NoWindow);
+		check_context(cplx, 4, 1024, gn::Window::BlackmanHarris);
+		check_context(cplx, 40, 4096, gn::Window::Hann);
+	}
+	return 0;
+}
@@ -0,0 +1,237 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NAVG 3
+#define NFFT 4096
+#define NPTS (NAVG * NFFT)
+
+// a and b are equal up to floating-point rounding, relative to scale
+static bool close_to(double a, double b, double scale)
+{
+    return fabs(a - b) <= 1e-12 * scale;
+}
+
+static double max_value(const double *a, size_t size)
+{
+    double m = 0.0;
+    for (size_t k = 0; k < size; k++)
+        m = (m < a[k]) ? a[k] : m;
+    return m;
+}
+
+// Checks that each mean-square spectrum equals gn_norm of the matching FFT
+static int check_norm(const double *i, const double *q, const int16_t *i16,
+    const int16_t *q16, GnWindow win)
+{
+    int err_code;
+    const size_t fft_size = 2 * NFFT;
+    const size_t rfft_size = 2 * (NFFT / 2 + 1);
+    double *fft_out = (double*)malloc(fft_size*sizeof(double));
+    double *norm_out = (double*)malloc(NFFT*sizeof(double));
+    double *msq_out = (double*)malloc(NFFT*sizeof(double));
+    double peak;
+
+    err_code = gn_fft(fft_out, fft_size, i, NPTS, q, NPTS, NAVG, NFFT, win);
+    if (err_code != 0)return err_code;
+    err_code = gn_norm(norm_out, NFFT, fft_out, fft_size);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_msq(msq_out, NFFT, i, NPTS, q, NPTS, NAVG, NFFT, win);
+    if (err_code != 0)return err_code;
+    peak = max_value(norm_out, NFFT);
+    for (size_t k = 0; k < NFFT; k++)
+        assert(close_to(msq_out[k], norm_out[k], peak));
+
+    err_code = gn_fft16(fft_out, fft_size, i16, NPTS, q16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement);
+    if (err_code != 0)return err_code;
+    err_code = gn_norm(norm_out, NFFT, fft_out, fft_size);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_msq16(msq_out, NFFT, i16, NPTS, q16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement);
+    if (err_code != 0)return err_code;
+    peak = max_value(norm_out, NFFT);
+    for (size_t k = 0; k < NFFT; k++)
+        assert(close_to(msq_out[k], norm_out[k], peak));
+
+    const GnRfftScale scales[3] = {GnRfftScaleDbfsDc, GnRfftScaleDbfsSin, GnRfftScaleNative};
+    for (size_t s = 0; s < 3; s++) {
+        err_code = gn_rfft(fft_out, rfft_size, i, NPTS, NAVG, NFFT, win, scales[s]);
+        if (err_code != 0)return err_code;
+        err_code = gn_norm(norm_out, rfft_size / 2, fft_out, rfft_size);
+        if (err_code != 0)return err_code;
+        err_code = gn_rfft_msq(msq_out, rfft_size / 2, i, NPTS, NAVG, NFFT, win, scales[s]);
+        if (err_code != 0)return err_code;
+        peak = max_value(norm_out, rfft_size / 2);
+        for (size_t k = 0; k < rfft_size / 2; k++)
+            assert(close_to(msq_out[k], norm_out[k], peak));
+
+        err_code = gn_rfft16(fft_out, rfft_size, i16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement, scales[s]);
+        if (err_code != 0)return err_code;
+        err_code = gn_norm(norm_out, rfft_size / 2, fft_out, rfft_size);
+        if (err_code != 0)return err_code;
+        err_code = gn_rfft_msq16(msq_out, rfft_size / 2, i16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement, scales[s]);
+        if (err_code != 0)return err_code;
+        peak = max_value(norm_out, rfft_size / 2);
+        for (size_t k = 0; k < rfft_size / 2; k++)
+            assert(close_to(msq_out[k], norm_out[k], peak));
+    }
+
+    free(fft_out);
+    free(norm_out);
+    free(msq_out);
+    return 0;
+}
+
+// Checks that, without a window, the bins of each mean-square spectrum sum to
+// the mean square of the input (Parseval's theorem)
+static int check_parseval(const double *i, const double *q)
+{
+    int err_code;
+    double *msq_out = (double*)malloc(NFFT*sizeof(double));
+    double ms_real = 0.0, ms_cplx = 0.0, total;
+    for (size_t k = 0; k < NPTS; k++) {
+        ms_real += i[k] * i[k];
+        ms_cplx += i[k] * i[k] + q[k] * q[k];
+    }
+    ms_real /= NPTS;
+    ms_cplx /= NPTS;
+
+    err_code = gn_fft_msq(msq_out, NFFT, i, NPTS, q, NPTS, NAVG, NFFT, GnWindowNoWindow);
+    if (err_code != 0)return err_code;
+    total = 0.0;
+    for (size_t k = 0; k < NFFT; k++)
+        total += msq_out[k];
+    assert(close_to(total, ms_cplx, ms_cplx));
+
+    // DbfsDc: the bins sum to the mean square; DbfsSin: to twice that
+    err_code = gn_rfft_msq(msq_out, NFFT / 2 + 1, i, NPTS, NAVG, NFFT, GnWindowNoWindow, GnRfftScaleDbfsDc);
+    if (err_code != 0)return err_code;
+    total = 0.0;
+    for (size_t k = 0; k < NFFT / 2 + 1; k++)
+        total += msq_out[k];
+    assert(close_to(total, ms_real, ms_real));
+    err_code = gn_rfft_msq(msq_out, NFFT / 2 + 1, i, NPTS, NAVG, NFFT, GnWindowNoWindow, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    total = 0.0;
+    for (size_t k = 0; k < NFFT / 2 + 1; k++)
+        total += msq_out[k];
+    assert(close_to(total, 2.0 * ms_real, ms_real));
+
+    free(msq_out);
+    return 0;
+}
+
+// Checks that gn_fft_analysis_sparse, which computes only the component bins
+// and the total power directly, matches gn_rfft_msq followed by
+// gn_fft_analysis_plan
+static int check_sparse(const double *in, GnWindow win, int ssb)
+{
+    int err_code;
+    const char *cfg_key = "fa_msq";
+    const char *plan_key = "ap_msq";
+    err_code = gn_fa_create(cfg_key);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_fsample(cfg_key, NFFT);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_fixed_tone(cfg_key, "A", GnFACompTagSignal, 1021.0, ssb);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_hd(cfg_key, 3);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_wo(cfg_key, 0);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_ssb(cfg_key, GnFASsbDefault, ssb);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_ssb(cfg_key, GnFASsbDC, ssb);
+    if (err_code != 0)return err_code;
+    err_code = gn_fa_prepare(plan_key, cfg_key, NFFT, GnFreqAxisTypeReal, false);
+    if (err_code != 0)return err_code;
+
+    size_t results_size;
+    err_code = gn_ap_results_size(&results_size, plan_key);
+    if (err_code != 0)return err_code;
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_ap_results_key_sizes(key_sizes, results_size, plan_key);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    char **sparse_rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t k = 0; k < results_size; k++) {
+        rkeys[k] = (char*)malloc(key_sizes[k]);
+        sparse_rkeys[k] = (char*)malloc(key_sizes[k]);
+    }
+    double *rvalues = (double*)malloc(results_size*sizeof(double));
+    double *sparse_rvalues = (double*)malloc(results_size*sizeof(double));
+    double *msq_out = (double*)malloc((NFFT / 2 + 1)*sizeof(double));
+
+    err_code = gn_rfft_msq(msq_out, NFFT / 2 + 1, in, NPTS, NAVG, NFFT, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_analysis_plan(rkeys, results_size, rvalues, results_size, plan_key, msq_out, NFFT / 2 + 1);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_analysis_sparse(sparse_rkeys, results_size, sparse_rvalues, results_size, plan_key, in, NPTS, NAVG, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    for (size_t k = 0; k < results_size; k++) {
+        assert(0 == strcmp(rkeys[k], sparse_rkeys[k]));
+        if (isnan(rvalues[k]) || isinf(rvalues[k])) {
+            assert(isnan(sparse_rvalues[k]) == isnan(rvalues[k]));
+            assert(isinf(sparse_rvalues[k]) == isinf(rvalues[k]));
+            continue;
+        }
+        assert(fabs(sparse_rvalues[k] - rvalues[k]) <= 1e-6 * fmax(1.0, fabs(rvalues[k])));
+    }
+
+    // free memory
+    for (size_t k = 0; k < results_size; k++) {
+        free(rkeys[k]);
+        free(sparse_rkeys[k]);
+    }
+    free(rkeys);
+    free(sparse_rkeys);
+    free(rvalues);
+    free(sparse_rvalues);
+    free(msq_out);
+    free(key_sizes);
+    err_code = gn_mgr_remove(plan_key);
+    if (err_code != 0)return err_code;
+    return gn_mgr_remove(cfg_key);
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    double *i = (double*)malloc(NPTS*sizeof(double));
+    double *q = (double*)malloc(NPTS*sizeof(double));
+    int16_t *i16 = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    int16_t *q16 = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    srand(5);
+    for (size_t k = 0; k < NPTS; k++) {
+        // coherent tone in bin 1021, HD2, HD3, DC, and noise
+        double w = 2.0 * M_PI * 1021.0 * (k % NFFT) / NFFT;
+        double noise = (double)rand() / RAND_MAX - 0.5;
+        i[k] = 0.01 + 0.5 * sin(w + 0.3) + 1e-3 * sin(2.0 * w) + 3e-4 * sin(3.0 * w) + 1e-4 * noise;
+        q[k] = 0.5 * cos(w + 0.3) - 1e-4 * noise;
+        i16[k] = (int16_t)lround(2047.0 * i[k]);
+        q16[k] = (int16_t)lround(2047.0 * q[k]);
+    }
+
+    const GnWindow windows[3] = {GnWindowBlackmanHarris, GnWindowHann, GnWindowNoWindow};
+    for (size_t w = 0; w < 3; w++) {
+        err_code = check_norm(i, q, i16, q16, windows[w]);
+        if (err_code != 0)return err_code;
+    }
+    err_code = check_parseval(i, q);
+    if (err_code != 0)return err_code;
+    // few enough component bins (at most log2(NFFT)) for the sparse path
+    err_code = check_sparse(i, GnWindowNoWindow, 0);
+    if (err_code != 0)return err_code;
+    err_code = check_sparse(i, GnWindowBlackmanHarris, 1);
+    if (err_code != 0)return err_code;
+
+    free(i);
+    free(q);
+    free(i16);
+    free(q16);
+    return 0;
+}
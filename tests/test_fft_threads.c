@@ -0,0 +1,117 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Large enough (navg * nfft >= 65536) for the records to be split across
+// threads
+#define NAVG 16
+#define NFFT 4096
+#define NPTS (NAVG * NFFT)
+
+static const GnWindow windows[3] = {GnWindowBlackmanHarris, GnWindowHann, GnWindowNoWindow};
+
+// Runs each averaged transform with 1 thread and with nthreads threads, and
+// checks that the outputs are identical
+static int check_threads(size_t nthreads, const double *i, const double *q,
+    const int16_t *iq16, const int16_t *qq16, GnWindow win)
+{
+    int err_code;
+    const size_t fft_size = 2 * NFFT;
+    const size_t rfft_size = 2 * (NFFT / 2 + 1);
+    double *out1 = (double*)malloc(fft_size*sizeof(double));
+    double *outn = (double*)malloc(fft_size*sizeof(double));
+
+    // complex, double input
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft(out1, fft_size, i, NPTS, q, NPTS, NAVG, NFFT, win);
+    if (err_code != 0)return err_code;
+    err_code = gn_set_num_threads(nthreads);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft(outn, fft_size, i, NPTS, q, NPTS, NAVG, NFFT, win);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(out1, outn, fft_size*sizeof(double)));
+
+    // complex, 16-bit codes
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft16(out1, fft_size, iq16, NPTS, qq16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement);
+    if (err_code != 0)return err_code;
+    err_code = gn_set_num_threads(nthreads);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft16(outn, fft_size, iq16, NPTS, qq16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(out1, outn, fft_size*sizeof(double)));
+
+    // real, double input
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft(out1, rfft_size, i, NPTS, NAVG, NFFT, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    err_code = gn_set_num_threads(nthreads);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft(outn, rfft_size, i, NPTS, NAVG, NFFT, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(out1, outn, rfft_size*sizeof(double)));
+
+    // real, 16-bit codes
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft16(out1, rfft_size, iq16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    err_code = gn_set_num_threads(nthreads);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft16(outn, rfft_size, iq16, NPTS, 12, NAVG, NFFT, win, GnCodeFormatTwosComplement, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(out1, outn, rfft_size*sizeof(double)));
+
+    // real mean-square spectrum
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft_msq(out1, rfft_size / 2, i, NPTS, NAVG, NFFT, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    err_code = gn_set_num_threads(nthreads);
+    if (err_code != 0)return err_code;
+    err_code = gn_rfft_msq(outn, rfft_size / 2, i, NPTS, NAVG, NFFT, win, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(out1, outn, rfft_size / 2*sizeof(double)));
+
+    free(out1);
+    free(outn);
+    return gn_set_num_threads(1);
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    double *i = (double*)malloc(NPTS*sizeof(double));
+    double *q = (double*)malloc(NPTS*sizeof(double));
+    int16_t *iq16 = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    int16_t *qq16 = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    srand(7);
+    for (size_t k = 0; k < NPTS; k++) {
+        double noise = (double)rand() / RAND_MAX - 0.5;
+        i[k] = 0.5 * cos(0.0731 * k) + 1e-3 * noise;
+        q[k] = 0.5 * sin(0.0731 * k) - 1e-3 * noise;
+        iq16[k] = (int16_t)lround(2047.0 * i[k]);
+        qq16[k] = (int16_t)lround(2047.0 * q[k]);
+    }
+
+    // thread counts that divide the records evenly, unevenly, and that
+    // exceed the core count
+    size_t thread_counts[3] = {2, 3, 8};
+    for (size_t t = 0; t < 3; t++) {
+        for (size_t w = 0; w < 3; w++) {
+            err_code = check_threads(thread_counts[t], i, q, iq16, qq16, windows[w]);
+            if (err_code != 0)return err_code;
+        }
+    }
+
+    free(i);
+    free(q);
+    free(iq16);
+    free(qq16);
+    return 0;
+}
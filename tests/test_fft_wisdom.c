@@ -0,0 +1,193 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NFFT 256
+#define RES 12
+#define FILE_A "test_fft_wisdom_a.txt"
+#define FILE_B "test_fft_wisdom_b.txt"
+#define FILE_C "test_fft_wisdom_c.txt"
+#define FILE_D "test_fft_wisdom_d.txt"
+
+// Reads a whole file into a NUL-terminated buffer; returns NULL if the file
+// cannot be opened
+static char *read_file(const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    if (NULL == fp)
+        return NULL;
+    fseek(fp, 0, SEEK_END);
+    const long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf = (char*)malloc((size_t)size + 1);
+    const size_t nread = fread(buf, 1, (size_t)size, fp);
+    buf[nread] = '\0';
+    fclose(fp);
+    return buf;
+}
+
+static int compare_lines(const void *a, const void *b)
+{
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+// Splits buf into lines in place and sorts them; returns the number of lines
+static size_t sorted_lines(char *buf, char ***lines)
+{
+    size_t count = 0;
+    for (char *p = buf; *p; p++)
+        count += ('\n' == *p);
+    *lines = (char**)malloc((count + 1) * sizeof(char*));
+    size_t n = 0;
+    for (char *line = strtok(buf, "\n"); NULL != line; line = strtok(NULL, "\n"))
+        (*lines)[n++] = line;
+    qsort(*lines, n, sizeof(char*), compare_lines);
+    return n;
+}
+
+// Returns true if both files exist and hold the same wisdom.  FFTW writes
+// wisdom entries in hash table order, which depends on the order they were
+// added, so the entries are compared as sorted lines.
+static bool same_wisdom(const char *filename1, const char *filename2)
+{
+    char *buf1 = read_file(filename1);
+    char *buf2 = read_file(filename2);
+    bool same = (NULL != buf1) && (NULL != buf2);
+    if (same) {
+        char **lines1, **lines2;
+        const size_t n1 = sorted_lines(buf1, &lines1);
+        const size_t n2 = sorted_lines(buf2, &lines2);
+        same = (n1 == n2);
+        for (size_t k = 0; same && k < n1; k++)
+            same = (0 == strcmp(lines1[k], lines2[k]));
+        free(lines1);
+        free(lines2);
+    }
+    free(buf1);
+    free(buf2);
+    return same;
+}
+
+static bool file_exists(const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    if (NULL == fp)
+        return false;
+    fclose(fp);
+    return true;
+}
+
+static void remove_files(const char *filename)
+{
+    char sidecar[64];
+    snprintf(sidecar, sizeof(sidecar), "%s.float", filename);
+    remove(filename);
+    remove(sidecar);
+}
+
+// Computes real and complex FFTs of in, in double and, if available, single
+// precision; returns true if single-precision FFTs are available
+static bool run_ffts(const int16_t *in, double *rout, double *cout, float *fout)
+{
+    int err_code;
+    err_code = gn_rfft16(rout, NFFT + 2, in, NFFT, RES, 1, NFFT, GnWindowBlackmanHarris,
+        GnCodeFormatTwosComplement, GnRfftScaleDbfsSin);
+    assert(0 == err_code);
+    err_code = gn_fft16(cout, 2 * NFFT, in, NFFT, in, NFFT, RES, 1, NFFT, GnWindowBlackmanHarris,
+        GnCodeFormatTwosComplement);
+    assert(0 == err_code);
+    err_code = gn_rfft16f(fout, NFFT + 2, in, NFFT, RES, 1, NFFT, GnWindowBlackmanHarris,
+        GnCodeFormatTwosComplement, GnRfftScaleDbfsSin);
+    if (0 != err_code) {
+        gn_error_clear();
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    int16_t in[NFFT];
+    for (size_t k = 0; k < NFFT; k++)
+        in[k] = (int16_t)lround(1800.0 * sin(0.0913 * k));
+
+    // The getter reports what was set, so the previous setting can be restored
+    GnFftPlanner saved;
+    err_code = gn_fft_get_planner(&saved);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_set_planner(GnFftPlannerPatient);
+    if (err_code != 0)return err_code;
+    GnFftPlanner planner;
+    err_code = gn_fft_get_planner(&planner);
+    if (err_code != 0)return err_code;
+    assert(GnFftPlannerPatient == planner);
+    assert(0 != gn_fft_get_planner(NULL));
+    gn_error_clear();
+
+    // Planning accumulates wisdom, which is exported with a single-precision
+    // sidecar when single-precision FFTs are available
+    double rout1[NFFT + 2], cout1[2 * NFFT];
+    float fout1[NFFT + 2];
+    const bool has_float = run_ffts(in, rout1, cout1, fout1);
+    err_code = gn_fft_wisdom_export(FILE_A);
+    if (err_code != 0)return err_code;
+    assert(has_float == file_exists(FILE_A ".float"));
+
+    // Forgetting discards it, and importing brings it back exactly
+    err_code = gn_fft_wisdom_forget();
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_wisdom_export(FILE_B);
+    if (err_code != 0)return err_code;
+    assert(!same_wisdom(FILE_A, FILE_B));
+    if (has_float)
+        assert(!same_wisdom(FILE_A ".float", FILE_B ".float"));
+    err_code = gn_fft_wisdom_import(FILE_A);
+    assert(0 == err_code);
+    err_code = gn_fft_wisdom_export(FILE_C);
+    if (err_code != 0)return err_code;
+    assert(same_wisdom(FILE_A, FILE_C));
+    if (has_float)
+        assert(same_wisdom(FILE_A ".float", FILE_C ".float"));
+
+    // Plans are cached per planner effort, so measuring plans are made now,
+    // and FFTW satisfies them from the imported patient wisdom: no wisdom is
+    // added, and the FFTs are unchanged after the round trip
+    err_code = gn_fft_set_planner(GnFftPlannerMeasure);
+    if (err_code != 0)return err_code;
+    double rout2[NFFT + 2], cout2[2 * NFFT];
+    float fout2[NFFT + 2];
+    run_ffts(in, rout2, cout2, fout2);
+    err_code = gn_fft_wisdom_export(FILE_D);
+    if (err_code != 0)return err_code;
+    assert(same_wisdom(FILE_A, FILE_D));
+    if (has_float)
+        assert(same_wisdom(FILE_A ".float", FILE_D ".float"));
+    assert(0 == memcmp(rout1, rout2, sizeof(rout1)));
+    assert(0 == memcmp(cout1, cout2, sizeof(cout1)));
+    if (has_float)
+        assert(0 == memcmp(fout1, fout2, sizeof(fout1)));
+
+    // The sidecar is optional on import; the main file is not
+    remove(FILE_A ".float");
+    assert(0 == gn_fft_wisdom_import(FILE_A));
+    remove_files(FILE_A);
+    assert(0 != gn_fft_wisdom_import(FILE_A));
+    gn_error_clear();
+
+    err_code = gn_fft_set_planner(saved);
+    if (err_code != 0)return err_code;
+    err_code = gn_fft_get_planner(&planner);
+    if (err_code != 0)return err_code;
+    assert(saved == planner);
+
+    remove_files(FILE_B);
+    remove_files(FILE_C);
+    remove_files(FILE_D);
+    return 0;
+}
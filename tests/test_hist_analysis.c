@@ -0,0 +1,78 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Runs gn_hist_analysis on hist and checks each result exactly
+static int check_hist_analysis(const uint64_t *hist, size_t hist_size,
+    double sum, double first_nz_index, double last_nz_index, double nz_range)
+{
+    int err_code;
+    size_t results_size;
+    err_code = gn_analysis_results_size(&results_size, GnAnalysisTypeHistogram);
+    if (err_code != 0)return err_code;
+    assert(results_size == 4);
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_analysis_results_key_sizes(key_sizes, results_size, GnAnalysisTypeHistogram);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t i = 0; i < results_size; i++)
+        rkeys[i] = (char*)malloc(key_sizes[i]);
+    double *rvalues = (double*)malloc(results_size*sizeof(double));
+
+    err_code = gn_hist_analysis(rkeys, results_size, rvalues, results_size, hist, hist_size);
+    if (err_code != 0)return err_code;
+    assert(0 == strcmp(rkeys[0], "sum"));
+    assert(0 == strcmp(rkeys[1], "first_nz_index"));
+    assert(0 == strcmp(rkeys[2], "last_nz_index"));
+    assert(0 == strcmp(rkeys[3], "nz_range"));
+    assert(rvalues[0] == sum);
+    assert(rvalues[1] == first_nz_index);
+    assert(rvalues[2] == last_nz_index);
+    assert(rvalues[3] == nz_range);
+
+    // free memory
+    for (size_t i = 0; i < results_size; i++)
+        free(rkeys[i]);
+    free(rkeys);
+    free(rvalues);
+    free(key_sizes);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    // one non-zero bin, inside and at either end of the histogram
+    uint64_t one_bin[8] = {0, 0, 0, 0, 0, 3, 0, 0};
+    err_code = check_hist_analysis(one_bin, 8, 3.0, 5.0, 5.0, 1.0);
+    if (err_code != 0)return err_code;
+    uint64_t first_bin[8] = {7, 0, 0, 0, 0, 0, 0, 0};
+    err_code = check_hist_analysis(first_bin, 8, 7.0, 0.0, 0.0, 1.0);
+    if (err_code != 0)return err_code;
+    uint64_t last_bin[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+    err_code = check_hist_analysis(last_bin, 8, 1.0, 7.0, 7.0, 1.0);
+    if (err_code != 0)return err_code;
+    uint64_t single[1] = {4};
+    err_code = check_hist_analysis(single, 1, 4.0, 0.0, 0.0, 1.0);
+    if (err_code != 0)return err_code;
+
+    // several non-zero bins, with zero bins between them
+    uint64_t several[10] = {0, 0, 2, 5, 0, 0, 1, 9, 0, 0};
+    err_code = check_hist_analysis(several, 10, 17.0, 2.0, 7.0, 6.0);
+    if (err_code != 0)return err_code;
+    uint64_t full[4] = {1, 2, 3, 4};
+    err_code = check_hist_analysis(full, 4, 10.0, 0.0, 3.0, 4.0);
+    if (err_code != 0)return err_code;
+
+    // empty histogram: both indexes are the histogram size
+    uint64_t empty[6] = {0, 0, 0, 0, 0, 0};
+    err_code = check_hist_analysis(empty, 6, 0.0, 6.0, 6.0, 0.0);
+    if (err_code != 0)return err_code;
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Enough samples for several slices of at least 65536 samples each
+#define NPTS (1 << 19)
+#define RES 12
+// Explicit bounds for gn_histx16, not centered on 0
+#define XMIN -700
+#define XMAX 2500
+#define HIST_SIZE (1 << RES)
+#define HISTX_SIZE (XMAX - XMIN + 1)
+#define MAX_SIZE ((HIST_SIZE < HISTX_SIZE) ? HISTX_SIZE : HIST_SIZE)
+
+// Fills both histograms with the same values, so that preserve = true adds
+// to non-zero counts
+static void prefill(uint64_t *a, uint64_t *b, size_t size)
+{
+    for (size_t k = 0; k < size; k++) {
+        a[k] = (uint64_t)(rand() % 1000);
+        b[k] = a[k];
+    }
+}
+
+static int check_parallel(const int16_t *in, size_t in_size, GnCodeFormat format, bool preserve)
+{
+    int err_code;
+    uint64_t *expected = (uint64_t*)malloc(MAX_SIZE*sizeof(uint64_t));
+    uint64_t *actual = (uint64_t*)malloc(MAX_SIZE*sizeof(uint64_t));
+
+    prefill(expected, actual, HIST_SIZE);
+    err_code = gn_hist16(expected, HIST_SIZE, in, in_size, RES, format, preserve);
+    if (err_code != 0)return err_code;
+    err_code = gn_hist16_parallel(actual, HIST_SIZE, in, in_size, RES, format, preserve);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(expected, actual, HIST_SIZE*sizeof(uint64_t)));
+
+    prefill(expected, actual, HISTX_SIZE);
+    err_code = gn_histx16(expected, HISTX_SIZE, in, in_size, XMIN, XMAX, preserve);
+    if (err_code != 0)return err_code;
+    err_code = gn_histx16_parallel(actual, HISTX_SIZE, in, in_size, XMIN, XMAX, preserve);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(expected, actual, HISTX_SIZE*sizeof(uint64_t)));
+
+    free(expected);
+    free(actual);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    // 13-bit codes, so that some are outside the 12-bit range and outside
+    // [XMIN, XMAX], including the extreme int16_t values
+    int16_t *in = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    srand(29);
+    for (size_t k = 0; k < NPTS; k++)
+        in[k] = (int16_t)(rand() % 8192 - 4096);
+    in[0] = INT16_MIN;
+    in[NPTS - 1] = INT16_MAX;
+
+    // 1 thread, an even split, and an uneven split
+    const size_t thread_counts[3] = {1, 4, 7};
+    const GnCodeFormat formats[2] = {GnCodeFormatTwosComplement, GnCodeFormatOffsetBinary};
+    const bool preserve[2] = {false, true};
+    for (size_t t = 0; t < 3; t++) {
+        err_code = gn_set_num_threads(thread_counts[t]);
+        if (err_code != 0)return err_code;
+        for (size_t f = 0; f < 2; f++) {
+            for (size_t p = 0; p < 2; p++) {
+                err_code = check_parallel(in, NPTS, formats[f], preserve[p]);
+                if (err_code != 0)return err_code;
+                // too few samples for more than one slice
+                err_code = check_parallel(in, 1000, formats[f], preserve[p]);
+                if (err_code != 0)return err_code;
+            }
+        }
+    }
+    err_code = gn_set_num_threads(1);
+    if (err_code != 0)return err_code;
+
+    free(in);
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NPTS 20000
+#define MAX_RESULTS 32
+
+typedef struct results {
+    size_t size;
+    char *keys[MAX_RESULTS];
+    double values[MAX_RESULTS];
+} results;
+
+static int alloc_results(results *r, GnAnalysisType type)
+{
+    int err_code;
+    size_t key_sizes[MAX_RESULTS];
+    err_code = gn_analysis_results_size(&r->size, type);
+    if (err_code != 0)return err_code;
+    assert(r->size <= MAX_RESULTS);
+    err_code = gn_analysis_results_key_sizes(key_sizes, r->size, type);
+    if (err_code != 0)return err_code;
+    for (size_t k = 0; k < r->size; k++)
+        r->keys[k] = (char*)malloc(key_sizes[k]);
+    return 0;
+}
+
+static void free_results(results *r)
+{
+    for (size_t k = 0; k < r->size; k++)
+        free(r->keys[k]);
+}
+
+// Checks that the fused results equal the separate results r, in order, with
+// keys that add prefix
+static size_t check_results(const results *fused, size_t first, const char *prefix, const results *r)
+{
+    char key[64];
+    for (size_t k = 0; k < r->size; k++) {
+        snprintf(key, sizeof(key), "%s%s", prefix, r->keys[k]);
+        assert(0 == strcmp(key, fused->keys[first + k]));
+        assert(0 == memcmp(&r->values[k], &fused->values[first + k], sizeof(double)));
+    }
+    return first + r->size;
+}
+
+// Runs gn_hist32, gn_hist_analysis, gn_dnl, gn_dnl_analysis, gn_inl and
+// gn_inl_analysis separately, and checks that gn_linearity_analysis of the
+// histogram and gn_linearity_analysis16/32/64 of the codes give identical
+// histograms, DNL, INL, and results; or that all of them fail
+static int check_linearity(const int32_t *in, size_t in_size, int n, GnCodeFormat format,
+    GnDnlSignal type, GnInlLineFit fit)
+{
+    int err_code;
+    size_t size;
+    err_code = gn_code_density_size(&size, n, format);
+    if (err_code != 0)return err_code;
+    uint64_t *hist = (uint64_t*)malloc(size*sizeof(uint64_t));
+    double *dnl = (double*)malloc(size*sizeof(double));
+    double *inl = (double*)malloc(size*sizeof(double));
+    uint64_t *fused_hist = (uint64_t*)malloc(size*sizeof(uint64_t));
+    double *fused_dnl = (double*)malloc(size*sizeof(double));
+    double *fused_inl = (double*)malloc(size*sizeof(double));
+    int16_t *in16 = (int16_t*)malloc(in_size*sizeof(int16_t));
+    int64_t *in64 = (int64_t*)malloc(in_size*sizeof(int64_t));
+    for (size_t k = 0; k < in_size; k++) {
+        in16[k] = (int16_t)in[k];
+        in64[k] = in[k];
+    }
+    results hist_r, dnl_r, inl_r, fused;
+    err_code = alloc_results(&hist_r, GnAnalysisTypeHistogram);
+    if (err_code != 0)return err_code;
+    err_code = alloc_results(&dnl_r, GnAnalysisTypeDNL);
+    if (err_code != 0)return err_code;
+    err_code = alloc_results(&inl_r, GnAnalysisTypeINL);
+    if (err_code != 0)return err_code;
+    err_code = alloc_results(&fused, GnAnalysisTypeLinearity);
+    if (err_code != 0)return err_code;
+    assert(fused.size == hist_r.size + dnl_r.size + inl_r.size);
+
+    err_code = gn_hist32(hist, size, in, in_size, n, format, false);
+    if (err_code != 0)return err_code;
+    int sep_err = gn_hist_analysis(hist_r.keys, hist_r.size, hist_r.values, hist_r.size, hist, size);
+    if (0 == sep_err)
+        sep_err = gn_dnl(dnl, size, hist, size, type);
+    if (0 == sep_err)
+        sep_err = gn_dnl_analysis(dnl_r.keys, dnl_r.size, dnl_r.values, dnl_r.size, dnl, size);
+    if (0 == sep_err)
+        sep_err = gn_inl(inl, size, dnl, size, fit);
+    if (0 == sep_err)
+        sep_err = gn_inl_analysis(inl_r.keys, inl_r.size, inl_r.values, inl_r.size, inl, size);
+
+    for (int variant = 0; variant < 4; variant++) {
+        memset(fused_hist, 0, size*sizeof(uint64_t));
+        switch (variant) {
+        case 0:
+            memcpy(fused_hist, hist, size*sizeof(uint64_t));
+            err_code = gn_linearity_analysis(fused.keys, fused.size, fused.values, fused.size,
+                fused_dnl, size, fused_inl, size, hist, size, type, fit);
+            break;
+        case 1:
+            err_code = gn_linearity_analysis16(fused.keys, fused.size, fused.values, fused.size,
+                fused_hist, size, fused_dnl, size, fused_inl, size, in16, in_size, n, format, type, fit);
+            break;
+        case 2:
+            err_code = gn_linearity_analysis32(fused.keys, fused.size, fused.values, fused.size,
+                fused_hist, size, fused_dnl, size, fused_inl, size, in, in_size, n, format, type, fit);
+            break;
+        default:
+            err_code = gn_linearity_analysis64(fused.keys, fused.size, fused.values, fused.size,
+                fused_hist, size, fused_dnl, size, fused_inl, size, in64, in_size, n, format, type, fit);
+            break;
+        }
+        assert((0 == sep_err) == (0 == err_code));
+        if (0 != sep_err)
+            continue;
+        assert(0 == memcmp(hist, fused_hist, size*sizeof(uint64_t)));
+        assert(0 == memcmp(dnl, fused_dnl, size*sizeof(double)));
+        assert(0 == memcmp(inl, fused_inl, size*sizeof(double)));
+        size_t first = check_results(&fused, 0, "hist_", &hist_r);
+        first = check_results(&fused, first, "dnl_", &dnl_r);
+        first = check_results(&fused, first, "inl_", &inl_r);
+        assert(first == fused.size);
+    }
+
+    // free memory
+    free_results(&hist_r);
+    free_results(&dnl_r);
+    free_results(&inl_r);
+    free_results(&fused);
+    free(hist);
+    free(dnl);
+    free(inl);
+    free(fused_hist);
+    free(fused_dnl);
+    free(fused_inl);
+    free(in16);
+    free(in64);
+    return 0;
+}
+
+// Waveforms 0 to 3: a noisy ramp, a noisy tone that overdrives the range, a
+// tone with missing codes, and a waveform of two codes.  Waveforms 4 to 6 use
+// only span codes: at the bottom of the range, at the top of the range, and
+// in a ramp from mid-range.
+static void make_wave(int32_t *out, int wave, int span, double min, double max)
+{
+    const double mid = (min + max) / 2;
+    for (size_t k = 0; k < NPTS; k++) {
+        const double u = (double)rand() / RAND_MAX - 0.5;
+        double x;
+        if (0 == wave)
+            x = min + (max - min) * k / (NPTS - 1) + u;
+        else if (1 == wave)
+            x = mid + 0.55 * (max - min) * sin(0.01234 * k + 0.3) + 2.0 * u;
+        else if (2 == wave)
+            x = 2.0 * floor((mid + 0.45 * (max - min) * sin(0.0721 * k)) / 2.0);
+        else if (3 == wave)
+            x = (k % 3) ? mid : min;
+        else if (4 == wave)
+            x = min + rand() % span;
+        else if (5 == wave)
+            x = max - rand() % span;
+        else
+            x = floor(mid) + (double)(k * span / NPTS);
+        out[k] = (int32_t)lround(x);
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    int32_t *in = (int32_t*)malloc(NPTS*sizeof(int32_t));
+    srand(41);
+    const int resolutions[4] = {3, 6, 10, 12};
+    const GnCodeFormat formats[2] = {GnCodeFormatTwosComplement, GnCodeFormatOffsetBinary};
+    const GnDnlSignal types[2] = {GnDnlSignalRamp, GnDnlSignalTone};
+    const GnInlLineFit fits[3] = {GnInlLineFitBestFit, GnInlLineFitEndFit, GnInlLineFitNoFit};
+    for (size_t r = 0; r < 4; r++) {
+        const int n = resolutions[r];
+        for (size_t f = 0; f < 2; f++) {
+            const double min = (GnCodeFormatTwosComplement == formats[f]) ? -(1 << (n - 1)) : 0;
+            const double max = min + (1 << n) - 1;
+            for (int wave = 0; wave < 7; wave++) {
+                for (int span = 1; span <= ((wave < 4) ? 1 : 6); span++) {
+                    make_wave(in, wave, span, min, max);
+                    for (size_t t = 0; t < 2; t++) {
+                        for (size_t l = 0; l < 3; l++) {
+                            err_code = check_linearity(in, NPTS, n, formats[f], types[t], fits[l]);
+                            if (err_code != 0)return err_code;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    free(in);
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// More than two decoding blocks of 1024 samples
+#define MAX_SAMPLES 2500
+#define MAX_STRIDE 3
+
+// Reference packer: writes the cb-bit container value v as container c of
+// buf, one bit at a time.  Little endian fills each byte from its least
+// significant bit, starting with the least significant bit of v; big endian
+// fills each byte from its most significant bit, starting with the most
+// significant bit of v.  For whole-byte containers this gives the usual
+// little- and big-endian words.
+static void put_container(uint8_t *buf, size_t c, int cb, uint32_t v, bool big_endian)
+{
+    for (int i = 0; i < cb; i++) {
+        const uint64_t s = (uint64_t)c * cb + i;
+        const int vbit = big_endian ? cb - 1 - i : i;
+        const int bbit = big_endian ? 7 - (int)(s % 8) : (int)(s % 8);
+        const uint8_t mask = (uint8_t)(1u << bbit);
+        if ((v >> vbit) & 1u)
+            buf[s / 8] |= mask;
+        else
+            buf[s / 8] &= (uint8_t)~mask;
+    }
+}
+
+// Packs random n-bit codes into a buffer of buf_size bytes, with random bits
+// around each code, and checks gn_raw_sample_count, gn_normalize_raw and
+// gn_hist_raw against gn_normalize32 and gn_hist32 of the codes
+static int check_raw(int n, int cb, bool left_justified, bool big_endian,
+    GnCodeFormat format, size_t stride, size_t offset, size_t buf_size)
+{
+    int err_code;
+    uint8_t *buf = (uint8_t*)malloc(buf_size);
+    for (size_t k = 0; k < buf_size; k++)
+        buf[k] = (uint8_t)rand();
+    const size_t ncont = 8 * buf_size / cb;
+    const size_t count = (ncont <= offset) ? 0 : (ncont - offset - 1) / stride + 1;
+    int32_t *codes = (int32_t*)malloc((count + 1)*sizeof(int32_t));
+    const uint32_t code_mask = (1u << n) - 1;
+    for (size_t j = 0; j < count; j++) {
+        uint32_t u = ((uint32_t)rand() << 16 ^ (uint32_t)rand()) & code_mask;
+        // force the extreme codes, so that sign extension is checked
+        if (0 == j % 97)
+            u = code_mask;
+        else if (1 == j % 97)
+            u = 1u << (n - 1);
+        const uint32_t junk = (uint32_t)rand() << 16 ^ (uint32_t)rand();
+        uint32_t v = left_justified ? (u << (cb - n)) | (junk & ((1u << (cb - n)) - 1))
+            : u | (junk << n);
+        if (cb < 32)
+            v &= (1u << cb) - 1;
+        put_container(buf, offset + j * stride, cb, v, big_endian);
+        if (GnCodeFormatTwosComplement == format && (u >> (n - 1)))
+            codes[j] = (int32_t)u - (int32_t)(1u << n);
+        else
+            codes[j] = (int32_t)u;
+    }
+
+    size_t raw_count;
+    err_code = gn_raw_sample_count(&raw_count, buf_size, n, cb, left_justified, big_endian, format, stride, offset);
+    if (err_code != 0)return err_code;
+    assert(raw_count == count);
+    if (0 < count) {
+        double *expected = (double*)malloc(count*sizeof(double));
+        double *actual = (double*)malloc(count*sizeof(double));
+        err_code = gn_normalize32(expected, count, codes, count, n, format);
+        if (err_code != 0)return err_code;
+        err_code = gn_normalize_raw(actual, count, buf, buf_size, n, cb, left_justified, big_endian, format, stride, offset);
+        if (err_code != 0)return err_code;
+        assert(0 == memcmp(expected, actual, count*sizeof(double)));
+        free(expected);
+        free(actual);
+    }
+    if (n <= 16) {
+        const size_t hist_size = (size_t)1 << n;
+        uint64_t *expected = (uint64_t*)malloc(hist_size*sizeof(uint64_t));
+        uint64_t *actual = (uint64_t*)malloc(hist_size*sizeof(uint64_t));
+        memset(expected, 0, hist_size*sizeof(uint64_t));
+        if (0 < count) {
+            err_code = gn_hist32(expected, hist_size, codes, count, n, format, false);
+            if (err_code != 0)return err_code;
+        }
+        err_code = gn_hist_raw(actual, hist_size, buf, buf_size, n, cb, left_justified, big_endian, format, stride, offset, count, false);
+        if (err_code != 0)return err_code;
+        assert(0 == memcmp(expected, actual, hist_size*sizeof(uint64_t)));
+        free(expected);
+        free(actual);
+    }
+
+    // free memory
+    free(buf);
+    free(codes);
+    return 0;
+}
+
+// Packs nsamples cb-bit codes, cb < 8, into as few bytes as hold them, and
+// sets the pad bits after them to ones.  The pad bits count as one more
+// sample if they fill a whole container; passing the true count decodes
+// only the packed samples.
+static int check_padding(int cb, size_t nsamples, size_t expected_raw_count)
+{
+    int err_code;
+    uint8_t buf[8];
+    const size_t buf_size = (nsamples * cb + 7) / 8;
+    memset(buf, 0xff, sizeof(buf));
+    int32_t codes[16];
+    for (size_t j = 0; j < nsamples; j++) {
+        codes[j] = (int32_t)(j % 3);
+        put_container(buf, j, cb, (uint32_t)codes[j], false);
+    }
+    const GnCodeFormat format = GnCodeFormatOffsetBinary;
+    size_t raw_count;
+    err_code = gn_raw_sample_count(&raw_count, buf_size, cb, cb, false, false, format, 1, 0);
+    if (err_code != 0)return err_code;
+    assert(expected_raw_count == raw_count);
+
+    double expected[16], actual[16];
+    err_code = gn_normalize32(expected, nsamples, codes, nsamples, cb, format);
+    if (err_code != 0)return err_code;
+    err_code = gn_normalize_raw(actual, nsamples, buf, buf_size, cb, cb, false, false, format, 1, 0);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(expected, actual, nsamples*sizeof(double)));
+    assert(0 != gn_normalize_raw(actual, raw_count + 1, buf, buf_size, cb, cb, false, false, format, 1, 0));
+    gn_error_clear();
+
+    uint64_t hist_expected[128], hist_actual[128];
+    const size_t hist_size = (size_t)1 << cb;
+    err_code = gn_hist32(hist_expected, hist_size, codes, nsamples, cb, format, false);
+    if (err_code != 0)return err_code;
+    err_code = gn_hist_raw(hist_actual, hist_size, buf, buf_size, cb, cb, false, false, format, 1, 0, nsamples, false);
+    if (err_code != 0)return err_code;
+    assert(0 == memcmp(hist_expected, hist_actual, hist_size*sizeof(uint64_t)));
+    // With the inferred count, a whole container of pad bits is a sample of
+    // the largest code
+    err_code = gn_hist_raw(hist_actual, hist_size, buf, buf_size, cb, cb, false, false, format, 1, 0, raw_count, false);
+    if (err_code != 0)return err_code;
+    assert(raw_count - nsamples == hist_actual[hist_size - 1]);
+    assert(0 != gn_hist_raw(hist_actual, hist_size, buf, buf_size, cb, cb, false, false, format, 1, 0, raw_count + 1, false));
+    gn_error_clear();
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    srand(37);
+
+    // the grouped packed widths, other packed widths, and words
+    const int container_bits[10] = {10, 12, 14, 7, 11, 13, 8, 16, 24, 32};
+    const GnCodeFormat formats[2] = {GnCodeFormatTwosComplement, GnCodeFormatOffsetBinary};
+    // whole groups, a tail of one to seven samples, and more than one block
+    const size_t sample_counts[5] = {1, 7, 64, 1029, MAX_SAMPLES};
+    for (size_t c = 0; c < 10; c++) {
+        const int cb = container_bits[c];
+        // a code that fills the container, and one narrower than it
+        const int widths[2] = {cb < 30 ? cb : 30, cb - 3};
+        for (size_t w = 0; w < 2; w++) {
+            for (int lj = 0; lj < 2; lj++) {
+                for (int be = 0; be < 2; be++) {
+                    for (size_t f = 0; f < 2; f++) {
+                        for (size_t stride = 1; stride <= MAX_STRIDE; stride++) {
+                            for (size_t s = 0; s < 5; s++) {
+                                // every offset below the stride, and
+                                // sometimes an extra byte, which holds part
+                                // or all of one more container
+                                const size_t ns = sample_counts[s];
+                                const size_t nbits = (ns * stride) * cb;
+                                for (size_t offset = 0; offset < stride; offset++) {
+                                    const size_t extra = (size_t)(rand() % 2);
+                                    err_code = check_raw(widths[w], cb, lj, be, formats[f], stride, offset, (nbits + 7) / 8 + extra);
+                                    if (err_code != 0)return err_code;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // a buffer too small for the first sample
+    err_code = check_raw(12, 12, false, false, GnCodeFormatTwosComplement, 2, 1, 2);
+    if (err_code != 0)return err_code;
+
+    // pad bits that fill a whole container, and pad bits that do not
+    err_code = check_padding(4, 3, 4);
+    if (err_code != 0)return err_code;
+    err_code = check_padding(2, 3, 4);
+    if (err_code != 0)return err_code;
+    err_code = check_padding(2, 9, 12);
+    if (err_code != 0)return err_code;
+    err_code = check_padding(3, 5, 5);
+    if (err_code != 0)return err_code;
+    err_code = check_padding(7, 8, 8);
+    if (err_code != 0)return err_code;
+
+    return 0;
+}
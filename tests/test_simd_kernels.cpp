@@ -0,0 +1,118 @@
+// Checks that every normalize-window kernel available on this host gives
+// bit-identical results to the scalar kernels, for each sample type, output
+// precision, and input layout, and for sizes with and without a tail.
+#include "exceptions.hpp"
+#include "simd_kernels.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+const size_t sizes[] = { 0, 1, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65,
+	1000, 1031 };
+
+template <typename T>
+std::vector<T> random_codes(size_t size, std::mt19937 &gen) {
+	std::uniform_int_distribution<int> dist(-2048, 2047);
+	std::vector<T> codes(size);
+	for (T &x : codes) {
+		x = static_cast<T>(dist(gen));
+	}
+	return codes;
+}
+
+template <typename R>
+std::vector<R> random_window(size_t size, std::mt19937 &gen) {
+	std::uniform_real_distribution<R> dist(0.0, 1.0);
+	std::vector<R> win(size);
+	for (R &x : win) {
+		x = dist(gen);
+	}
+	return win;
+}
+
+template <typename R>
+bool same(const std::vector<R> &a, const std::vector<R> &b) {
+	return a.size() == b.size() &&
+			0 == std::memcmp(a.data(), b.data(), a.size() * sizeof(R));
+}
+
+// Runs every kernel of one sample type and precision at the current level
+template <typename T, typename R>
+std::vector<std::vector<R>> run_kernels(const std::vector<T> &codes,
+		const std::vector<R> &win, size_t size) {
+	// Not powers of 2, so that the products round and an unfused multiply-add
+	// would differ from the scalar fma
+	const R scalar = static_cast<R>(2.0 / 4095.0);
+	const R offset = static_cast<R>(1.0 / 3.0);
+	std::vector<std::vector<R>> out;
+	for (const R *w : { static_cast<const R *>(nullptr), win.data() }) {
+		// real
+		out.emplace_back(size);
+		gn::norm_window(codes.data(), w, out.back().data(), size, scalar,
+				offset);
+		// split I/Q
+		out.emplace_back(2 * size);
+		gn::norm_window_cplx(codes.data(), codes.data() + size, 1, w,
+				out.back().data(), size, scalar, offset);
+		// interleaved I/Q
+		out.emplace_back(2 * size);
+		gn::norm_window_cplx(codes.data(), codes.data() + 1, 2, w,
+				out.back().data(), size, scalar, offset);
+		// strided I/Q (no vector kernel)
+		out.emplace_back(2 * size);
+		gn::norm_window_cplx(codes.data(), codes.data() + 1, 3, w,
+				out.back().data(), size, scalar, offset);
+	}
+	return out;
+}
+
+template <typename T, typename R>
+void check_level(gn::SimdLevel level, std::mt19937 &gen) {
+	for (size_t size : sizes) {
+		const std::vector<T> codes = random_codes<T>(3 * size + 1, gen);
+		const std::vector<R> win = random_window<R>(size, gen);
+		gn::set_simd_level(gn::SimdLevel::Scalar);
+		const std::vector<std::vector<R>> expected =
+				run_kernels<T, R>(codes, win, size);
+		gn::set_simd_level(level);
+		const std::vector<std::vector<R>> actual =
+				run_kernels<T, R>(codes, win, size);
+		assert(expected.size() == actual.size());
+		for (size_t i = 0; i < expected.size(); ++i) {
+			assert(same(expected[i], actual[i]));
+		}
+	}
+}
+
+} // namespace
+
+int main() {
+	const gn::SimdLevel default_level = gn::get_simd_level();
+	std::mt19937 gen(3);
+	for (gn::SimdLevel level : { gn::SimdLevel::Avx2, gn::SimdLevel::Avx512,
+				gn::SimdLevel::Neon }) {
+		try {
+			gn::set_simd_level(level);
+		} catch (const gn::runtime_error &) {
+			std::printf("%s: not available, skipped\n",
+					gn::simd_level_name(level));
+			continue;
+		}
+		check_level<int16_t, double>(level, gen);
+		check_level<int32_t, double>(level, gen);
+		check_level<int64_t, double>(level, gen);
+		check_level<int16_t, float>(level, gen);
+		check_level<int32_t, float>(level, gen);
+		check_level<int64_t, float>(level, gen);
+		std::printf("%s: identical to Scalar\n", gn::simd_level_name(level));
+	}
+	gn::set_simd_level(default_level);
+	return 0;
+}
@@ -0,0 +1,159 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NPTS 4000
+#define FS 1e6
+
+// Result order of gn_sine_fit_analysis
+enum {AMPL, FREQ, PHASE, OFFSET, RESID_RMS, SINAD, ENOB, ITERATIONS, NRESULTS};
+
+static const char *result_keys[NRESULTS] = {"ampl", "freq", "phase", "offset",
+    "resid_rms", "sinad", "enob", "iterations"};
+
+// Fits in (normalized, or 16-bit codes if in16 is not NULL) and writes the
+// results in result order
+static int fit(double *values, const double *in, const int16_t *in16,
+    double freq, bool fit_freq)
+{
+    int err_code;
+    size_t results_size;
+    err_code = gn_analysis_results_size(&results_size, GnAnalysisTypeSineFit);
+    if (err_code != 0)return err_code;
+    assert(results_size == NRESULTS);
+    size_t *key_sizes = (size_t*)malloc(results_size*sizeof(size_t));
+    err_code = gn_analysis_results_key_sizes(key_sizes, results_size, GnAnalysisTypeSineFit);
+    if (err_code != 0)return err_code;
+    char **rkeys = (char**)malloc(results_size*sizeof(char*));
+    for (size_t k = 0; k < results_size; k++)
+        rkeys[k] = (char*)malloc(key_sizes[k]);
+
+    if (in16)
+        err_code = gn_sine_fit_analysis16(rkeys, results_size, values, results_size, in16, NPTS, FS, freq, fit_freq);
+    else
+        err_code = gn_sine_fit_analysis(rkeys, results_size, values, results_size, in, NPTS, FS, freq, fit_freq);
+    if (err_code == 0) {
+        for (size_t k = 0; k < results_size; k++)
+            assert(0 == strcmp(rkeys[k], result_keys[k]));
+    }
+
+    // free memory
+    for (size_t k = 0; k < results_size; k++)
+        free(rkeys[k]);
+    free(rkeys);
+    free(key_sizes);
+    return err_code;
+}
+
+// ampl * cos(2 * pi * freq * n / FS + phase) + offset, plus uniform noise of
+// the given peak
+static void make_tone(double *out, double ampl, double freq, double phase,
+    double offset, double noise)
+{
+    for (size_t n = 0; n < NPTS; n++) {
+        double u = (double)rand() / RAND_MAX - 0.5;
+        out[n] = ampl * cos(2.0 * M_PI * freq * n / FS + phase) + offset + 2.0 * noise * u;
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    double *in = (double*)malloc(NPTS*sizeof(double));
+    int16_t *in16 = (int16_t*)malloc(NPTS*sizeof(int16_t));
+    double values[NRESULTS];
+    const double bin = FS / NPTS;
+    // not coherent: 37.3 cycles in the capture
+    const double freq = 37.3 * bin;
+    const double ampl = 0.7, phase = 0.9, offset = -0.05;
+    srand(23);
+
+    // three-parameter fit of an exact tone
+    make_tone(in, ampl, freq, phase, offset, 0.0);
+    err_code = fit(values, in, NULL, freq, false);
+    if (err_code != 0)return err_code;
+    assert(fabs(values[AMPL] - ampl) < 1e-12);
+    assert(values[FREQ] == freq);
+    assert(fabs(values[PHASE] - phase) < 1e-12);
+    assert(fabs(values[OFFSET] - offset) < 1e-12);
+    assert(values[RESID_RMS] < 1e-12);
+    assert(values[ITERATIONS] == 0.0);
+
+    // four-parameter fit from estimates a third of a bin off on either side
+    const double starts[2] = {freq - 0.33 * bin, freq + 0.33 * bin};
+    for (size_t s = 0; s < 2; s++) {
+        err_code = fit(values, in, NULL, starts[s], true);
+        if (err_code != 0)return err_code;
+        assert(fabs(values[AMPL] - ampl) < 1e-9);
+        assert(fabs(values[FREQ] - freq) < 1e-9 * bin);
+        assert(fabs(values[PHASE] - phase) < 1e-9);
+        assert(fabs(values[OFFSET] - offset) < 1e-9);
+        assert(values[RESID_RMS] < 1e-9);
+        assert(0.0 < values[ITERATIONS]);
+    }
+
+    // noise: the residual is the noise, and SINAD and ENOB follow from it
+    const double noise = 1e-3;
+    make_tone(in, ampl, freq, phase, offset, noise);
+    err_code = fit(values, in, NULL, starts[0], true);
+    if (err_code != 0)return err_code;
+    const double noise_rms = noise / sqrt(3.0);
+    assert(fabs(values[AMPL] - ampl) < 1e-4);
+    assert(fabs(values[FREQ] - freq) < 1e-3 * bin);
+    assert(fabs(values[PHASE] - phase) < 1e-3);
+    assert(fabs(values[OFFSET] - offset) < 1e-4);
+    assert(fabs(values[RESID_RMS] - noise_rms) < 0.05 * noise_rms);
+    assert(fabs(values[SINAD] - 20.0 * log10(values[AMPL] / sqrt(2.0) / values[RESID_RMS])) < 1e-9);
+    assert(fabs(values[ENOB] - (values[SINAD] - 1.76) / 6.02) < 1e-2);
+
+    // low SNR, about -25 dB: the fit converges from either start, to a
+    // minimum of the residual, i.e. one that three-parameter fits a small
+    // fraction of the standard error of the frequency away do not improve on
+    for (int trial = 0; trial < 10; trial++) {
+        make_tone(in, ampl, freq, phase, offset, 15.0);
+        for (size_t s = 0; s < 2; s++) {
+            err_code = fit(values, in, NULL, starts[s], true);
+            if (err_code != 0)return err_code;
+            assert(values[ITERATIONS] < 20.0);
+            assert(fabs(values[FREQ] - freq) < 2.0 * bin);
+            const double fit_freq = values[FREQ];
+            const double resid = values[RESID_RMS];
+            for (int side = -1; side <= 1; side += 2) {
+                err_code = fit(values, in, NULL, fit_freq + side * 0.01 * bin, false);
+                if (err_code != 0)return err_code;
+                assert(resid <= values[RESID_RMS] * (1.0 + 1e-9));
+            }
+        }
+    }
+
+    // 16-bit codes: same tone in codes, within quantization error
+    make_tone(in, 20000.0, freq, phase, 100.0, 0.0);
+    for (size_t n = 0; n < NPTS; n++)
+        in16[n] = (int16_t)lround(in[n]);
+    err_code = fit(values, NULL, in16, freq, false);
+    if (err_code != 0)return err_code;
+    assert(fabs(values[AMPL] - 20000.0) < 0.05);
+    assert(fabs(values[PHASE] - phase) < 1e-5);
+    assert(fabs(values[OFFSET] - 100.0) < 0.05);
+    assert(fabs(values[RESID_RMS] - 1.0 / sqrt(12.0)) < 0.02);
+    err_code = fit(values, NULL, in16, starts[1], true);
+    if (err_code != 0)return err_code;
+    assert(fabs(values[AMPL] - 20000.0) < 0.05);
+    assert(fabs(values[FREQ] - freq) < 1e-5 * bin);
+
+    // singular: at fs/2 the sine column is 0, so both fits must fail
+    make_tone(in, ampl, FS / 2, 0.0, offset, 0.0);
+    err_code = fit(values, in, NULL, FS / 2, false);
+    assert(err_code != 0);
+    err_code = fit(values, in, NULL, FS / 2, true);
+    assert(err_code != 0);
+
+    free(in);
+    free(in16);
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NFFT 512
+#define NAVG 5
+#define RES 12
+#define NPTS (NFFT * NAVG)
+
+// The averager scales each record before it is accumulated, and gn_fft /
+// gn_rfft scale the averaged sums, so the results agree to rounding, relative
+// to the largest output
+static void check_close(const double *actual, const double *expected, size_t size)
+{
+    double peak = 0.0;
+    for (size_t k = 0; k < size; k++)
+        peak = fmax(peak, fabs(expected[k]));
+    for (size_t k = 0; k < size; k++)
+        assert(fabs(actual[k] - expected[k]) <= 1e-12 * peak);
+}
+
+// Adds the records of one sample type to a real averager one record at a
+// time, or all at once, and checks gn_sa_get against gn_rfft of all records
+static int check_real(const char *obj_key, const void *in, int type, bool one_call,
+    GnWindow window, GnCodeFormat format, GnRfftScale scale)
+{
+    int err_code;
+    size_t out_size;
+    err_code = gn_rfft_size(&out_size, NPTS, NAVG, NFFT);
+    if (err_code != 0)return err_code;
+    double *expected = (double*)malloc(out_size*sizeof(double));
+    double *actual = (double*)malloc(out_size*sizeof(double));
+    err_code = gn_sa_reset(obj_key);
+    if (err_code != 0)return err_code;
+    const size_t nadds = one_call ? 1 : NAVG;
+    const size_t size = NPTS / nadds;
+    for (size_t r = 0; r < nadds; r++) {
+        const size_t first = r * size;
+        if (0 == type)
+            err_code = gn_sa_radd(obj_key, (const double*)in + first, size);
+        else if (1 == type)
+            err_code = gn_sa_radd16(obj_key, (const int16_t*)in + first, size, RES, format);
+        else if (2 == type)
+            err_code = gn_sa_radd32(obj_key, (const int32_t*)in + first, size, RES, format);
+        else
+            err_code = gn_sa_radd64(obj_key, (const int64_t*)in + first, size, RES, format);
+        if (err_code != 0)return err_code;
+    }
+    size_t count;
+    err_code = gn_sa_count(&count, obj_key);
+    if (err_code != 0)return err_code;
+    assert(NAVG == count);
+    if (0 == type)
+        err_code = gn_rfft(expected, out_size, (const double*)in, NPTS, NAVG, NFFT, window, scale);
+    else if (1 == type)
+        err_code = gn_rfft16(expected, out_size, (const int16_t*)in, NPTS, RES, NAVG, NFFT, window, format, scale);
+    else if (2 == type)
+        err_code = gn_rfft32(expected, out_size, (const int32_t*)in, NPTS, RES, NAVG, NFFT, window, format, scale);
+    else
+        err_code = gn_rfft64(expected, out_size, (const int64_t*)in, NPTS, RES, NAVG, NFFT, window, format, scale);
+    if (err_code != 0)return err_code;
+    err_code = gn_sa_get(actual, out_size, obj_key);
+    if (err_code != 0)return err_code;
+    check_close(actual, expected, out_size);
+
+    // free memory
+    free(expected);
+    free(actual);
+    return 0;
+}
+
+// As check_real, for a complex averager and split I/Q data, or interleaved
+// I/Q data if q is NULL
+static int check_complex(const char *obj_key, const void *i, const void *q, int type,
+    GnWindow window, GnCodeFormat format)
+{
+    int err_code;
+    const size_t q_size = (NULL == q) ? 0 : NFFT;
+    const size_t i_size = (NULL == q) ? 2 * NFFT : NFFT;
+    size_t out_size;
+    err_code = gn_fft_size(&out_size, NAVG * i_size, NAVG * q_size, NAVG, NFFT);
+    if (err_code != 0)return err_code;
+    double *expected = (double*)malloc(out_size*sizeof(double));
+    double *actual = (double*)malloc(out_size*sizeof(double));
+    err_code = gn_sa_reset(obj_key);
+    if (err_code != 0)return err_code;
+    for (size_t r = 0; r < NAVG; r++) {
+        const size_t fi = r * i_size;
+        const size_t fq = r * q_size;
+        if (0 == type) {
+            err_code = gn_sa_add(obj_key, (const double*)i + fi, i_size,
+                q ? (const double*)q + fq : NULL, q_size);
+        } else if (1 == type) {
+            err_code = gn_sa_add16(obj_key, (const int16_t*)i + fi, i_size,
+                q ? (const int16_t*)q + fq : NULL, q_size, RES, format);
+        } else if (2 == type) {
+            err_code = gn_sa_add32(obj_key, (const int32_t*)i + fi, i_size,
+                q ? (const int32_t*)q + fq : NULL, q_size, RES, format);
+        } else {
+            err_code = gn_sa_add64(obj_key, (const int64_t*)i + fi, i_size,
+                q ? (const int64_t*)q + fq : NULL, q_size, RES, format);
+        }
+        if (err_code != 0)return err_code;
+    }
+    const size_t ni = NAVG * i_size;
+    const size_t nq = NAVG * q_size;
+    if (0 == type)
+        err_code = gn_fft(expected, out_size, (const double*)i, ni, (const double*)q, nq, NAVG, NFFT, window);
+    else if (1 == type)
+        err_code = gn_fft16(expected, out_size, (const int16_t*)i, ni, (const int16_t*)q, nq, RES, NAVG, NFFT, window, format);
+    else if (2 == type)
+        err_code = gn_fft32(expected, out_size, (const int32_t*)i, ni, (const int32_t*)q, nq, RES, NAVG, NFFT, window, format);
+    else
+        err_code = gn_fft64(expected, out_size, (const int64_t*)i, ni, (const int64_t*)q, nq, RES, NAVG, NFFT, window, format);
+    if (err_code != 0)return err_code;
+    err_code = gn_sa_get(actual, out_size, obj_key);
+    if (err_code != 0)return err_code;
+    check_close(actual, expected, out_size);
+
+    // free memory
+    free(expected);
+    free(actual);
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    // a noisy tone, as normalized samples and as codes of each sample type;
+    // 2 * NPTS samples, for interleaved I/Q
+    double *x = (double*)malloc(2*NPTS*sizeof(double));
+    int16_t *x16 = (int16_t*)malloc(2*NPTS*sizeof(int16_t));
+    int32_t *x32 = (int32_t*)malloc(2*NPTS*sizeof(int32_t));
+    int64_t *x64 = (int64_t*)malloc(2*NPTS*sizeof(int64_t));
+    srand(53);
+    for (size_t k = 0; k < 2 * NPTS; k++) {
+        const double u = (double)rand() / RAND_MAX - 0.5;
+        const double code = 1800.0 * sin(0.0913 * k) + u;
+        x[k] = code / 2048.0;
+        x16[k] = (int16_t)lround(code);
+        x32[k] = (int32_t)lround(code);
+        x64[k] = (int64_t)lround(code);
+    }
+    const void *data[4] = {x, x16, x32, x64};
+    const void *q_data[4] = {x + NPTS, x16 + NPTS, x32 + NPTS, x64 + NPTS};
+
+    const GnWindow windows[3] = {GnWindowNoWindow, GnWindowBlackmanHarris, GnWindowHann};
+    const GnRfftScale scales[3] = {GnRfftScaleDbfsDc, GnRfftScaleDbfsSin, GnRfftScaleNative};
+    for (size_t w = 0; w < 3; w++) {
+        const char *sa_key = "sa";
+        err_code = gn_sa_rcreate(sa_key, NFFT, windows[w], scales[w]);
+        if (err_code != 0)return err_code;
+        for (int type = 0; type < 4; type++) {
+            for (int one_call = 0; one_call < 2; one_call++) {
+                err_code = check_real(sa_key, data[type], type, one_call, windows[w],
+                    GnCodeFormatTwosComplement, scales[w]);
+                if (err_code != 0)return err_code;
+            }
+        }
+        err_code = gn_mgr_remove(sa_key);
+        if (err_code != 0)return err_code;
+
+        err_code = gn_sa_create(sa_key, NFFT, windows[w]);
+        if (err_code != 0)return err_code;
+        for (int type = 0; type < 4; type++) {
+            err_code = check_complex(sa_key, data[type], q_data[type], type, windows[w],
+                GnCodeFormatTwosComplement);
+            if (err_code != 0)return err_code;
+            err_code = check_complex(sa_key, data[type], NULL, type, windows[w],
+                GnCodeFormatTwosComplement);
+            if (err_code != 0)return err_code;
+        }
+        err_code = gn_mgr_remove(sa_key);
+        if (err_code != 0)return err_code;
+    }
+
+    free(x);
+    free(x16);
+    free(x32);
+    free(x64);
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Checks spectrum_index::sum and spectrum_index::max_index against a linear
+// scan, for ranges shorter than a block, ranges that straddle block edges, and
+// ranges of whole blocks, on data with many ties and on all-zero data.
+#include "spectrum_index.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace gn = genalyzer_impl;
+
+namespace {
+
+const size_t bs = gn::spectrum_index::block_size;
+
+const size_t sizes[] = { 0, 1, 5, bs - 1, bs, bs + 1, 2 * bs, 3 * bs + 7,
+	7 * bs, 9 * bs + 31, 64 * bs + 3, 1000 };
+
+gn::real_t scan_sum(const std::vector<gn::real_t> &data, size_t i1,
+		size_t i2) {
+	gn::real_t sum = 0.0;
+	for (size_t i = i1; i < i2; ++i) {
+		sum += data[i];
+	}
+	return sum;
+}
+
+// The first maximum, as fourier_analysis_comp_mask::find_max_index finds it
+std::pair<gn::diff_t, gn::real_t> scan_max(
+		const std::vector<gn::real_t> &data, size_t i1, size_t i2) {
+	gn::diff_t best = -1;
+	gn::real_t best_value = 0.0;
+	for (size_t i = i1; i < i2; ++i) {
+		if (best_value < data[i]) {
+			best_value = data[i];
+			best = static_cast<gn::diff_t>(i);
+		}
+	}
+	return { best, best_value };
+}
+
+// With integer data every sum is exact, so the index must match the scan
+// exactly; otherwise it must match to the rounding of the scan
+void check_range(const gn::spectrum_index &index,
+		const std::vector<gn::real_t> &data, size_t i1, size_t i2,
+		bool exact) {
+	const gn::real_t expected = scan_sum(data, i1, i2);
+	const gn::real_t actual = index.sum(i1, i2);
+	if (exact) {
+		assert(expected == actual);
+	} else {
+		const gn::real_t tol = 1e-15 * static_cast<gn::real_t>(i2 - i1) *
+				scan_sum(data, 0, data.size());
+		assert(std::fabs(expected - actual) <= tol);
+	}
+	assert(scan_max(data, i1, i2) == index.max_index(i1, i2));
+}
+
+void check(const std::vector<gn::real_t> &data, bool exact,
+		std::mt19937 &gen) {
+	const size_t size = data.size();
+	for (bool max_queries : { false, true }) {
+		gn::spectrum_index index(data.data(), size, max_queries);
+		assert(size == index.size());
+		assert((max_queries && bs <= size) == index.has_max_queries());
+		if (size <= 4 * bs + 1) {
+			// Every range
+			for (size_t i1 = 0; i1 <= size; ++i1) {
+				for (size_t i2 = i1; i2 <= size; ++i2) {
+					check_range(index, data, i1, i2, exact);
+				}
+			}
+			continue;
+		}
+		// Ranges that start and end on, next to, and between block edges
+		std::vector<size_t> edges;
+		for (size_t b = 0; b * bs <= size; ++b) {
+			for (size_t i : { b * bs - 1, b * bs, b * bs + 1, b * bs + bs / 2 }) {
+				if (i <= size) {
+					edges.push_back(i);
+				}
+			}
+		}
+		edges.push_back(size);
+		for (size_t i1 : edges) {
+			for (size_t i2 : edges) {
+				if (i1 <= i2) {
+					check_range(index, data, i1, i2, exact);
+				}
+			}
+		}
+		std::uniform_int_distribution<size_t> dist(0, size);
+		for (int k = 0; k < 2000; ++k) {
+			size_t i1 = dist(gen);
+			size_t i2 = dist(gen);
+			if (i2 < i1) {
+				std::swap(i1, i2);
+			}
+			check_range(index, data, i1, i2, exact);
+		}
+	}
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 gen(29);
+	for (size_t size : sizes) {
+		std::vector<gn::real_t> data(size);
+
+		// Small integers: many ties, within and across blocks
+		std::uniform_int_distribution<int> small(0, 3);
+		for (gn::real_t &x : data) {
+			x = small(gen);
+		}
+		check(data, true, gen);
+
+		// All zero: no maximum anywhere
+		std::fill(data.begin(), data.end(), 0.0);
+		check(data, true, gen);
+
+		// Zero except for equal peaks in two blocks, so the tree must choose
+		// the lower block
+		if (3 * bs <= size) {
+			data[bs + 3] = 1.0;
+			data[2 * bs + 3] = 1.0;
+			check(data, true, gen);
+		}
+
+		// A spectrum-like range of magnitudes
+		std::uniform_real_distribution<gn::real_t> unit(0.0, 1.0);
+		for (gn::real_t &x : data) {
+			x = std::pow(10.0, -12.0 * unit(gen));
+		}
+		check(data, false, gen);
+	}
+
+	// Rebuilding with a smaller size reuses the storage and forgets the rest
+	std::vector<gn::real_t> data(9 * bs);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<gn::real_t>(i % 13);
+	}
+	gn::spectrum_index index(data.data(), data.size(), true);
+	std::vector<gn::real_t> small(data.begin(), data.begin() + 2 * bs + 5);
+	index.build(small.data(), small.size(), true);
+	for (size_t i1 = 0; i1 <= small.size(); ++i1) {
+		for (size_t i2 = i1; i2 <= small.size(); ++i2) {
+			check_range(index, small, i1, i2, true);
+		}
+	}
+
+	std::printf("spectrum_index matches a linear scan\n");
+	return 0;
+}
@@ -0,0 +1,115 @@
+#include "cgenalyzer.h"
+#include "test_genalyzer.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define NFFT 1024
+#define RES 12
+
+static size_t cache_size(void)
+{
+    size_t size = 0;
+    int err_code = gn_fft_window_cache_size(&size);
+    assert(0 == err_code);
+    return size;
+}
+
+// Computes windowed FFTs of in, and checks that they change the number of
+// cached tables by the given number: 0 if they hit the cache
+static void check_rfft(const int16_t *in, GnWindow window, GnRfftScale scale, size_t added)
+{
+    const size_t before = cache_size();
+    double out[NFFT + 2];
+    int err_code = gn_rfft16(out, NFFT + 2, in, NFFT, RES, 1, NFFT, window, GnCodeFormatTwosComplement, scale);
+    assert(0 == err_code);
+    assert(before + added == cache_size());
+}
+
+static void check_fft(const int16_t *in, GnWindow window, size_t added)
+{
+    const size_t before = cache_size();
+    double out[2 * NFFT];
+    int err_code = gn_fft16(out, 2 * NFFT, in, NFFT, in, NFFT, RES, 1, NFFT, window, GnCodeFormatTwosComplement);
+    assert(0 == err_code);
+    assert(before + added == cache_size());
+}
+
+// As check_rfft, in single precision; returns false if genalyzer was built
+// without the FFTW float library
+static bool check_rfft_float(const int16_t *in, GnWindow window, GnRfftScale scale, size_t added)
+{
+    const size_t before = cache_size();
+    float out[NFFT + 2];
+    int err_code = gn_rfft16f(out, NFFT + 2, in, NFFT, RES, 1, NFFT, window, GnCodeFormatTwosComplement, scale);
+    if (0 != err_code) {
+        gn_error_clear();
+        return false;
+    }
+    assert(before + added == cache_size());
+    return true;
+}
+
+int main(int argc, const char* argv[])
+{
+    int err_code;
+    err_code = gn_set_string_termination(true);
+    if (err_code != 0)return err_code;
+
+    int16_t in[NFFT];
+    for (size_t k = 0; k < NFFT; k++)
+        in[k] = (int16_t)lround(1800.0 * sin(0.0913 * k));
+
+    // Find out whether tables are warmed in both precisions: a single-
+    // precision FFT after a clear builds one table if it can run at all
+    gn_fft_window_cache_clear();
+    assert(0 == cache_size());
+    const bool has_float = check_rfft_float(in, GnWindowHann, GnRfftScaleDbfsSin, 1);
+    const size_t per_warm = has_float ? 2 : 1;
+
+    // Warming builds the table of each precision once; FFTs then hit it
+    gn_fft_window_cache_clear();
+    assert(0 == cache_size());
+    err_code = gn_fft_window_cache_warm(GnWindowBlackmanHarris, NFFT, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    assert(per_warm == cache_size());
+    err_code = gn_fft_window_cache_warm(GnWindowBlackmanHarris, NFFT, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    assert(per_warm == cache_size());
+    check_rfft(in, GnWindowBlackmanHarris, GnRfftScaleDbfsSin, 0);
+    if (has_float)
+        check_rfft_float(in, GnWindowBlackmanHarris, GnRfftScaleDbfsSin, 0);
+
+    // DbfsDc and Native share a table, which complex FFTs use too
+    err_code = gn_fft_window_cache_warm(GnWindowBlackmanHarris, NFFT, GnRfftScaleNative);
+    if (err_code != 0)return err_code;
+    assert(2 * per_warm == cache_size());
+    err_code = gn_fft_window_cache_warm(GnWindowBlackmanHarris, NFFT, GnRfftScaleDbfsDc);
+    if (err_code != 0)return err_code;
+    assert(2 * per_warm == cache_size());
+    check_rfft(in, GnWindowBlackmanHarris, GnRfftScaleDbfsDc, 0);
+    check_fft(in, GnWindowBlackmanHarris, 0);
+    if (has_float)
+        check_rfft_float(in, GnWindowBlackmanHarris, GnRfftScaleNative, 0);
+
+    // No window needs no table; a table that is not warmed is built on use
+    err_code = gn_fft_window_cache_warm(GnWindowNoWindow, NFFT, GnRfftScaleDbfsSin);
+    if (err_code != 0)return err_code;
+    assert(2 * per_warm == cache_size());
+    check_rfft(in, GnWindowNoWindow, GnRfftScaleDbfsSin, 0);
+    check_rfft(in, GnWindowHann, GnRfftScaleDbfsSin, 1);
+    check_rfft(in, GnWindowHann, GnRfftScaleDbfsSin, 0);
+    assert(0 != gn_fft_window_cache_warm(GnWindowHann, 0, GnRfftScaleDbfsSin));
+    gn_error_clear();
+
+    // Clearing empties the cache, including the tables each thread holds, so
+    // the next FFT builds its table again
+    gn_fft_window_cache_clear();
+    assert(0 == cache_size());
+    check_rfft(in, GnWindowBlackmanHarris, GnRfftScaleDbfsSin, 1);
+    check_fft(in, GnWindowBlackmanHarris, 1);
+    gn_fft_window_cache_clear();
+    assert(0 == cache_size());
+
+    return 0;
+}